@@ -0,0 +1,276 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+// Encoding-space coverage and callback benchmark.
+//
+// Usage: tricore-coverage-bench [samples32] [architecture]
+//
+// Runs all 65536 16-bit encodings and a deterministic sample of 32-bit
+// encodings (default 1M) through the registered architecture's
+// GetInstructionInfo, GetInstructionText and GetInstructionLowLevelIL, the
+// same callbacks Binary Ninja uses. Reports ns/instruction per callback and
+// per instruction format, how many encodings lift to LLIL_UNIMPL, and the
+// LLIL instructions and basic blocks each encoding lifts to.
+//
+// Each encoding is placed at its own address. The callbacks are timed once
+// with the decode and text caches bypassed, which is the baseline to compare
+// releases by, and again with the caches on after a warm-up pass, as when
+// Binary Ninja revisits the same instructions.
+//
+// The plugin is linked in and registered directly; core plugins are not
+// loaded, so the architecture looked up is always this plugin's.
+
+#include <binaryninjaapi.h>
+#include <lowlevelilinstruction.h>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <iterator>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "decode_cache.h"
+#include "decoder.h"
+#include "text_cache.h"
+
+using namespace BinaryNinja;
+using namespace Tricore;
+
+extern "C" bool CorePluginInit();
+
+static constexpr uint64_t kBase = 0x80000000;
+// Lifted instructions per LowLevelILFunction before starting a new one
+static constexpr size_t kLiftBatch = 4096;
+
+static const char* FormatName(Format format) {
+  static const char* const kNames[] = {
+      "invalid", "SB",   "SBC",  "SBR",  "SBRN", "SC",   "SLR",  "SLRO",
+      "SR",      "SRC",  "SRO",  "SRR",  "SRRS", "SSR",  "SSRO", "ABS",
+      "ABSB",    "B",    "BIT",  "BO",   "BOL",  "BRC",  "BRN",  "BRR",
+      "RC",      "RCPW", "RCR",  "RCRR", "RCRW", "RLC",  "RR",   "RR1",
+      "RR2",     "RRPW", "RRR",  "RRR1", "RRR2", "RRRR", "RRRW", "SYS",
+  };
+  static_assert(std::size(kNames) == static_cast<size_t>(Format::SYS) + 1);
+  return kNames[static_cast<size_t>(format)];
+}
+
+// Decoder of the architecture registered as name, to bucket the encodings
+// the architecture itself accepts
+using DecodeFunction = bool (*)(const uint8_t*, uint64_t, size_t,
+                                DecodedInstruction&);
+
+static DecodeFunction DecoderOf(const std::string& name) {
+  if (name == "tricore") return Decode<IsaVersion::TC16>;
+  if (name == "tricore-tc1.3") return Decode<IsaVersion::TC13>;
+  if (name == "tricore-tc1.6.2") return Decode<IsaVersion::TC162>;
+  if (name == "tricore-tc1.8") return Decode<IsaVersion::TC18>;
+  return nullptr;
+}
+
+struct CallbackTimes {
+  double info = 0, text = 0, lift = 0;  // seconds over all words
+};
+
+struct FormatStats {
+  std::vector<uint32_t> words;  // encodings the decoder accepts
+  uint64_t unimplemented = 0;
+  uint64_t ilInstructions = 0, blocks = 0;  // summed over all words
+  CallbackTimes uncached, cached;
+};
+
+// Address of the i-th word of a format, so the per-address caches see every
+// word as a different instruction
+static uint64_t AddressOf(size_t i) { return kBase + 4 * i; }
+
+template <typename Callback>
+static double Time(const std::vector<uint32_t>& words, Callback&& callback) {
+  const auto start = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < words.size(); i++)
+    callback(reinterpret_cast<const uint8_t*>(&words[i]), AddressOf(i));
+  const std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+  return elapsed.count();
+}
+
+// Times the three callbacks over words, in the order Binary Ninja calls them
+static CallbackTimes TimeCallbacks(Architecture* arch,
+                                   const std::vector<uint32_t>& words) {
+  CallbackTimes times;
+  times.info = Time(words, [&](const uint8_t* data, uint64_t addr) {
+    InstructionInfo result;
+    arch->GetInstructionInfo(data, addr, 4, result);
+  });
+
+  std::vector<InstructionTextToken> tokens;
+  times.text = Time(words, [&](const uint8_t* data, uint64_t addr) {
+    size_t len = 4;
+    tokens.clear();
+    arch->GetInstructionText(data, addr, len, tokens);
+  });
+
+  Ref<LowLevelILFunction> il;
+  size_t lifted = kLiftBatch;
+  times.lift = Time(words, [&](const uint8_t* data, uint64_t addr) {
+    if (lifted++ == kLiftBatch) {
+      il = new LowLevelILFunction(arch);
+      lifted = 1;
+    }
+    size_t len = 4;
+    arch->GetInstructionLowLevelIL(data, addr, len, *il);
+  });
+  return times;
+}
+
+static void SetCachesBypassed(bool bypass) {
+  DecodeCache::SetBypassed(bypass);
+  TextCache::SetBypassed(bypass);
+}
+
+struct LiftShape {
+  bool unimplemented = false;
+  size_t instructions = 0;
+  size_t blocks = 0;
+};
+
+// Lifts one encoding into its own function and counts its IL instructions
+// and basic blocks. A block starts at the first instruction, at every label
+// an If or Goto jumps to and after every If or Goto.
+static LiftShape Shape(Architecture* arch, const uint8_t* data) {
+  LiftShape shape;
+  Ref<LowLevelILFunction> il = new LowLevelILFunction(arch);
+  size_t len = 4;
+  if (!arch->GetInstructionLowLevelIL(data, kBase, len, *il)) return shape;
+  shape.instructions = il->GetInstructionCount();
+  std::set<size_t> leaders = {0};
+  for (size_t i = 0; i < shape.instructions; i++) {
+    const LowLevelILInstruction insn = il->GetInstruction(i);
+    switch (insn.operation) {
+      case LLIL_UNIMPL:
+        shape.unimplemented = true;
+        break;
+      case LLIL_IF:
+        leaders.insert(insn.GetTrueTarget<LLIL_IF>());
+        leaders.insert(insn.GetFalseTarget<LLIL_IF>());
+        leaders.insert(i + 1);
+        break;
+      case LLIL_GOTO:
+        leaders.insert(insn.GetTarget<LLIL_GOTO>());
+        leaders.insert(i + 1);
+        break;
+      default:
+        break;
+    }
+  }
+  // Jumps out of the function (branch targets) do not start a block here
+  for (size_t leader : leaders)
+    if (leader < shape.instructions) shape.blocks++;
+  return shape;
+}
+
+int main(int argc, char** argv) {
+  const size_t samples32 = argc > 1 ? std::strtoull(argv[1], nullptr, 0)
+                                    : size_t{1} << 20;
+  const std::string name = argc > 2 ? argv[2] : "tricore";
+
+  const DecodeFunction decode = DecoderOf(name);
+  if (!decode) {
+    std::fprintf(stderr, "unknown architecture %s\n", name.c_str());
+    return 1;
+  }
+
+  CorePluginInit();
+  Ref<Architecture> arch = Architecture::GetByName(name);
+  if (!arch) {
+    std::fprintf(stderr, "architecture %s is not registered\n", name.c_str());
+    return 1;
+  }
+
+  // Bucket the encoding space by format
+  std::vector<FormatStats> formats(static_cast<size_t>(Format::SYS) + 1);
+  uint64_t invalid = 0;
+  DecodedInstruction insn;
+  auto classify = [&](uint32_t word) {
+    if (decode(reinterpret_cast<const uint8_t*>(&word), kBase, 4, insn))
+      formats[static_cast<size_t>(insn.format)].words.push_back(word);
+    else
+      invalid++;
+  };
+  for (uint32_t word = 0; word < 0x10000; word++)
+    if (!(word & 0x01u)) classify(word);
+  uint64_t state = 0x9E3779B97F4A7C15ull;
+  for (size_t i = 0; i < samples32; i++) {
+    // xorshift64
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    classify(static_cast<uint32_t>(state) | 0x01u);
+  }
+
+  for (FormatStats& stats : formats) {
+    if (stats.words.empty()) continue;
+
+    SetCachesBypassed(true);
+    stats.uncached = TimeCallbacks(arch, stats.words);
+    SetCachesBypassed(false);
+    TimeCallbacks(arch, stats.words);  // warm-up
+    stats.cached = TimeCallbacks(arch, stats.words);
+
+    // Untimed coverage pass
+    for (const uint32_t& word : stats.words) {
+      const LiftShape shape =
+          Shape(arch, reinterpret_cast<const uint8_t*>(&word));
+      stats.unimplemented += shape.unimplemented;
+      stats.ilInstructions += shape.instructions;
+      stats.blocks += shape.blocks;
+    }
+  }
+
+  std::printf("architecture: %s\n", name.c_str());
+  std::printf("encodings:    65536 16-bit (32768 even), %zu 32-bit sampled\n",
+              samples32);
+  std::printf("invalid:      %llu\n\n",
+              static_cast<unsigned long long>(invalid));
+  std::printf("%-8s %8s  %-26s  %-26s\n", "", "", "uncached ns/insn",
+              "cached ns/insn");
+  std::printf("%-8s %8s  %8s %8s %8s  %8s %8s %8s %8s %8s %8s\n", "format",
+              "valid", "info", "text", "lift", "info", "text", "lift",
+              "unimpl", "IL/insn", "bb/insn");
+
+  FormatStats total;
+  size_t totalWords = 0;
+  auto print = [](const char* format, size_t count, const FormatStats& stats) {
+    const auto ns = [&](double seconds) { return seconds * 1e9 / count; };
+    std::printf(
+        "%-8s %8zu  %8.1f %8.1f %8.1f  %8.1f %8.1f %8.1f %8llu %8.2f %8.2f\n",
+        format, count, ns(stats.uncached.info), ns(stats.uncached.text),
+        ns(stats.uncached.lift), ns(stats.cached.info), ns(stats.cached.text),
+        ns(stats.cached.lift),
+        static_cast<unsigned long long>(stats.unimplemented),
+        static_cast<double>(stats.ilInstructions) / count,
+        static_cast<double>(stats.blocks) / count);
+  };
+  auto add = [](CallbackTimes& sum, const CallbackTimes& times) {
+    sum.info += times.info;
+    sum.text += times.text;
+    sum.lift += times.lift;
+  };
+  for (size_t i = 0; i < formats.size(); i++) {
+    const FormatStats& stats = formats[i];
+    const size_t count = stats.words.size();
+    if (count == 0) continue;
+    print(FormatName(static_cast<Format>(i)), count, stats);
+    totalWords += count;
+    add(total.uncached, stats.uncached);
+    add(total.cached, stats.cached);
+    total.unimplemented += stats.unimplemented;
+    total.ilInstructions += stats.ilInstructions;
+    total.blocks += stats.blocks;
+  }
+  print("all", totalWords, total);
+
+  Shutdown();
+  return 0;
+}
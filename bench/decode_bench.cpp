@@ -0,0 +1,208 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+// Linear-sweep decode throughput benchmark.
+//
+// Usage: tricore-decode-bench [image.bin] [iterations]
+//
+// Without an image, a deterministic 16 MiB pseudo-random buffer is used.
+
+#include <bit>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+#include "boundary.h"
+#include "decode_cache.h"
+#include "decoder.h"
+
+using namespace Tricore;
+
+static std::vector<uint8_t> RandomImage(size_t size) {
+  std::vector<uint8_t> image(size);
+  uint64_t state = 0x9E3779B97F4A7C15ull;
+  for (uint8_t& byte : image) {
+    // xorshift64
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    byte = static_cast<uint8_t>(state);
+  }
+  return image;
+}
+
+static bool ReadImage(const char* path, std::vector<uint8_t>& image) {
+  std::ifstream file(path, std::ios::binary);
+  if (!file) return false;
+  image.assign(std::istreambuf_iterator<char>(file),
+               std::istreambuf_iterator<char>());
+  return true;
+}
+
+int main(int argc, char** argv) {
+  std::vector<uint8_t> image;
+  if (argc > 1) {
+    if (!ReadImage(argv[1], image)) {
+      std::fprintf(stderr, "could not read %s\n", argv[1]);
+      return 1;
+    }
+  } else {
+    image = RandomImage(16 << 20);
+  }
+  const int iterations = argc > 2 ? std::atoi(argv[2]) : 10;
+
+  const uint64_t base = 0x80000000;
+  uint64_t decoded = 0, valid = 0;
+  uint32_t checksum = 0;
+  DecodedInstruction insn;
+
+  const auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < iterations; i++) {
+    for (size_t offset = 0; offset + 2 <= image.size();) {
+      const bool ok = Decode(&image[offset], base + offset,
+                             image.size() - offset, insn);
+      decoded++;
+      if (ok) {
+        valid++;
+        checksum += static_cast<uint32_t>(insn.id) + insn.target;
+        offset += insn.length;
+      } else {
+        offset += 2;
+      }
+    }
+  }
+  const std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+
+  std::printf("image:      %zu bytes x %d iterations\n", image.size(),
+              iterations);
+  std::printf("decoded:    %llu (%llu valid)\n",
+              static_cast<unsigned long long>(decoded),
+              static_cast<unsigned long long>(valid));
+  std::printf("elapsed:    %.3f s\n", elapsed.count());
+  std::printf("throughput: %.1f M insn/s\n",
+              decoded / elapsed.count() / 1e6);
+  std::printf("checksum:   %08x\n", checksum);
+
+  // Same sweep through the bulk struct-of-arrays API
+  DecodedRange range;
+  uint64_t rangeDecoded = 0, rangeValid = 0;
+  uint32_t rangeChecksum = 0;
+
+  const auto rangeStart = std::chrono::steady_clock::now();
+  for (int i = 0; i < iterations; i++) {
+    range.clear();
+    rangeValid += DecodeRange(image.data(), image.size(), base, range);
+    rangeDecoded += range.size();
+    for (size_t j = 0; j < range.size(); j++)
+      if (range.id[j] != InstructionId::Invalid)
+        rangeChecksum += static_cast<uint32_t>(range.id[j]) + range.target[j];
+  }
+  const std::chrono::duration<double> rangeElapsed =
+      std::chrono::steady_clock::now() - rangeStart;
+
+  std::printf("\nDecodeRange\n");
+  std::printf("decoded:    %llu (%llu valid)\n",
+              static_cast<unsigned long long>(rangeDecoded),
+              static_cast<unsigned long long>(rangeValid));
+  std::printf("elapsed:    %.3f s\n", rangeElapsed.count());
+  std::printf("throughput: %.1f M insn/s\n",
+              rangeDecoded / rangeElapsed.count() / 1e6);
+  std::printf("checksum:   %08x\n", rangeChecksum);
+
+  // GetInstructionInfo path: length only, full decode for control flow
+  uint64_t infoDecoded = 0, infoBranches = 0;
+
+  const auto infoStart = std::chrono::steady_clock::now();
+  for (int i = 0; i < iterations; i++) {
+    for (size_t offset = 0; offset + 2 <= image.size();) {
+      uint8_t length;
+      bool controlFlow;
+      infoDecoded++;
+      if (!DecodeLength(&image[offset], image.size() - offset, length,
+                        controlFlow)) {
+        offset += 2;
+        continue;
+      }
+      if (controlFlow &&
+          Decode(&image[offset], base + offset, image.size() - offset, insn))
+        infoBranches++;
+      offset += length;
+    }
+  }
+  const std::chrono::duration<double> infoElapsed =
+      std::chrono::steady_clock::now() - infoStart;
+
+  std::printf("\nDecodeLength\n");
+  std::printf("decoded:    %llu (%llu control flow)\n",
+              static_cast<unsigned long long>(infoDecoded),
+              static_cast<unsigned long long>(infoBranches));
+  std::printf("elapsed:    %.3f s\n", infoElapsed.count());
+  std::printf("throughput: %.1f M insn/s\n",
+              infoDecoded / infoElapsed.count() / 1e6);
+
+  // Info, Text and LLIL callbacks for each instruction, through a decode
+  // cache of the plugin's default size
+  DecodeCache cache(16384);
+  uint64_t cachedLookups = 0;
+  uint32_t cachedChecksum = 0;
+
+  const auto cacheStart = std::chrono::steady_clock::now();
+  for (int i = 0; i < iterations; i++) {
+    for (size_t offset = 0; offset + 2 <= image.size();) {
+      const uint8_t* data = &image[offset];
+      const uint64_t addr = base + offset;
+      const size_t maxLen = image.size() - offset;
+      bool ok = false;
+      for (int callback = 0; callback < 3; callback++) {
+        cachedLookups++;
+        ok = cache.Lookup(data, addr, maxLen, insn);
+        if (!ok && (ok = Decode(data, addr, maxLen, insn)))
+          cache.Insert(addr, insn);
+      }
+      if (ok) {
+        cachedChecksum += static_cast<uint32_t>(insn.id) + insn.target;
+        offset += insn.length;
+      } else {
+        offset += 2;
+      }
+    }
+  }
+  const std::chrono::duration<double> cacheElapsed =
+      std::chrono::steady_clock::now() - cacheStart;
+  const DecodeCacheStats cacheStats = cache.Stats();
+
+  std::printf("\nDecodeCache (%zu entries, 3 lookups per instruction)\n",
+              cacheStats.entries);
+  std::printf("lookups:    %llu (%.1f%% hits)\n",
+              static_cast<unsigned long long>(cachedLookups),
+              100.0 * cacheStats.hits / (cacheStats.hits + cacheStats.misses));
+  std::printf("elapsed:    %.3f s\n", cacheElapsed.count());
+  std::printf("throughput: %.1f M lookups/s\n",
+              cachedLookups / cacheElapsed.count() / 1e6);
+  std::printf("checksum:   %08x\n", cachedChecksum);
+
+  // Instruction-boundary pre-scan alone
+  InstructionBoundaries boundaries;
+  uint64_t starts = 0;
+
+  const auto scanStart = std::chrono::steady_clock::now();
+  for (int i = 0; i < iterations; i++) {
+    ScanBoundaries(image.data(), image.size(), boundaries);
+    for (uint64_t word : boundaries.starts) starts += std::popcount(word);
+  }
+  const std::chrono::duration<double> scanElapsed =
+      std::chrono::steady_clock::now() - scanStart;
+
+  std::printf("\nScanBoundaries\n");
+  std::printf("starts:     %llu\n", static_cast<unsigned long long>(starts));
+  std::printf("elapsed:    %.3f s\n", scanElapsed.count());
+  std::printf("throughput: %.1f GB/s\n",
+              image.size() * static_cast<double>(iterations) /
+                  scanElapsed.count() / 1e9);
+  return 0;
+}
@@ -0,0 +1,100 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+// Operand field extraction benchmark, one row per instruction format.
+//
+// Usage: tricore-fields-bench [iterations]
+//
+// Each format's InstructionFields::ExtractOpfields* function is run over the
+// same 1M pseudo-random instruction words and all of its fields are summed.
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <tuple>
+#include <vector>
+
+#include "fields.h"
+
+using namespace Tricore;
+
+static std::vector<uint32_t> RandomWords(size_t count) {
+  std::vector<uint32_t> words(count);
+  uint64_t state = 0x9E3779B97F4A7C15ull;
+  for (uint32_t& word : words) {
+    // xorshift64
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    word = static_cast<uint32_t>(state);
+  }
+  return words;
+}
+
+// Calls Extract on every word with one local per out-parameter, the way the
+// Text and Lift handlers do. Extract is a template argument so it can inline.
+template <auto Extract>
+struct FieldsBench;
+
+template <typename... Fields, void (*Extract)(const uint8_t*, Fields&...)>
+struct FieldsBench<Extract> {
+  static uint32_t Run(const std::vector<uint32_t>& words) {
+    uint32_t sum = 0;
+    for (const uint32_t& raw : words) {
+      std::tuple<Fields...> fields;
+      std::apply(
+          [&](Fields&... field) {
+            Extract(reinterpret_cast<const uint8_t*>(&raw), field...);
+            sum += (0u + ... + static_cast<uint32_t>(field));
+          },
+          fields);
+    }
+    return sum;
+  }
+};
+
+struct FormatBench {
+  const char* name;
+  uint32_t (*run)(const std::vector<uint32_t>& words);
+};
+
+#define FORMAT(name) \
+  {#name, FieldsBench<&InstructionFields::ExtractOpfields##name>::Run}
+
+static const FormatBench kFormats[] = {
+    FORMAT(SB),   FORMAT(SBC),  FORMAT(SBR),  FORMAT(SBRN), FORMAT(SC),
+    FORMAT(SLR),  FORMAT(SLRO), FORMAT(SR),   FORMAT(SRC),  FORMAT(SRO),
+    FORMAT(SRR),  FORMAT(SRRS), FORMAT(SSR),  FORMAT(SSRO), FORMAT(ABS),
+    FORMAT(ABSB), FORMAT(B),    FORMAT(BIT),  FORMAT(BO),   FORMAT(BOL),
+    FORMAT(BRC),  FORMAT(BRN),  FORMAT(BRR),  FORMAT(RC),   FORMAT(RCPW),
+    FORMAT(RCR),  FORMAT(RCRR), FORMAT(RCRW), FORMAT(RLC),  FORMAT(RR),
+    FORMAT(RR1),  FORMAT(RR2),  FORMAT(RRPW), FORMAT(RRR),  FORMAT(RRR1),
+    FORMAT(RRR2), FORMAT(RRRR), FORMAT(RRRW), FORMAT(SYS),
+};
+
+#undef FORMAT
+
+int main(int argc, char** argv) {
+  const int iterations = argc > 1 ? std::atoi(argv[1]) : 20;
+  const std::vector<uint32_t> words = RandomWords(1 << 20);
+
+  uint32_t checksum = 0;
+  double total = 0;
+
+  std::printf("format   ns/insn\n");
+  for (const FormatBench& format : kFormats) {
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++) checksum += format.run(words);
+    const std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start;
+
+    const double ns = elapsed.count() * 1e9 / iterations / words.size();
+    total += ns;
+    std::printf("%-8s %7.3f\n", format.name, ns);
+  }
+
+  std::printf("mean     %7.3f\n", total / std::size(kFormats));
+  std::printf("checksum %08x\n", checksum);
+  return 0;
+}
@@ -0,0 +1,139 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+// Disassembly text rendering benchmark.
+//
+// Usage: tricore-text-bench [image.bin] [iterations]
+//
+// Renders every instruction of a linear sweep with the plugin's Text
+// handlers, as GetInstructionText does, and reports time, heap allocations
+// and tokens per line. The sweep is then repeated through a TextCache, the
+// way GetInstructionText serves repeated requests. Without an image, a
+// deterministic 16 MiB pseudo-random buffer is used.
+
+#include <binaryninjaapi.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <new>
+#include <vector>
+
+#include "decoder.h"
+#include "instructions.h"
+#include "text_cache.h"
+
+using namespace BinaryNinja;
+using namespace Tricore;
+
+// Every operator new in the process, counted by the replacements below
+static std::atomic<uint64_t> allocations{0};
+
+void* operator new(size_t size) {
+  allocations.fetch_add(1, std::memory_order_relaxed);
+  if (void* ptr = std::malloc(size ? size : 1)) return ptr;
+  throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+
+void operator delete(void* ptr, size_t) noexcept { std::free(ptr); }
+
+static std::vector<uint8_t> RandomImage(size_t size) {
+  std::vector<uint8_t> image(size);
+  uint64_t state = 0x9E3779B97F4A7C15ull;
+  for (uint8_t& byte : image) {
+    // xorshift64
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    byte = static_cast<uint8_t>(state);
+  }
+  return image;
+}
+
+static bool ReadImage(const char* path, std::vector<uint8_t>& image) {
+  std::ifstream file(path, std::ios::binary);
+  if (!file) return false;
+  image.assign(std::istreambuf_iterator<char>(file),
+               std::istreambuf_iterator<char>());
+  return true;
+}
+
+int main(int argc, char** argv) {
+  std::vector<uint8_t> image;
+  if (argc > 1) {
+    if (!ReadImage(argv[1], image)) {
+      std::fprintf(stderr, "could not read %s\n", argv[1]);
+      return 1;
+    }
+  } else {
+    image = RandomImage(16 << 20);
+  }
+  const int iterations = argc > 2 ? std::atoi(argv[2]) : 3;
+
+  const uint64_t base = 0x80000000;
+  TextCache cache(4096);
+
+  // Renders every line of the image iterations times, through the cache
+  // when one is given
+  auto sweep = [&](const char* name, TextCache* textCache) {
+    uint64_t lines = 0, tokens = 0;
+    DecodedInstruction insn;
+    std::vector<InstructionTextToken> result;
+    result.reserve(32);
+
+    const uint64_t allocationsBefore = allocations.load();
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++) {
+      for (size_t offset = 0; offset + 2 <= image.size();) {
+        const uint8_t* data = &image[offset];
+        const uint64_t addr = base + offset;
+        size_t len = image.size() - offset;
+        result.clear();
+        if (textCache && textCache->Lookup(data, addr, len, result)) {
+          lines++;
+          tokens += result.size();
+          offset += len;
+          continue;
+        }
+        if (!Decode(data, addr, len, insn)) {
+          offset += 2;
+          continue;
+        }
+        if (Tricore::Text(insn, data, addr, len, result)) {
+          if (textCache) textCache->Insert(insn, addr, result);
+          lines++;
+          tokens += result.size();
+        }
+        offset += insn.length;
+      }
+    }
+    const std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start;
+    const uint64_t lineAllocations = allocations.load() - allocationsBefore;
+
+    std::printf("%s\n", name);
+    std::printf("  image:       %zu bytes x %d iterations\n", image.size(),
+                iterations);
+    std::printf("  lines:       %llu (%.2f tokens/line)\n",
+                static_cast<unsigned long long>(lines),
+                static_cast<double>(tokens) / lines);
+    std::printf("  elapsed:     %.3f s\n", elapsed.count());
+    std::printf("  time:        %.1f ns/line\n", elapsed.count() * 1e9 / lines);
+    std::printf("  allocations: %.2f /line\n",
+                static_cast<double>(lineAllocations) / lines);
+  };
+
+  sweep("Text", nullptr);
+  sweep("TextCache (4096 entries)", &cache);
+  const TextCacheStats stats = cache.Stats();
+  const uint64_t lookups = stats.hits + stats.misses;
+  std::printf("  hit rate:    %.1f%%\n",
+              lookups ? 100.0 * stats.hits / lookups : 0.0);
+  return 0;
+}
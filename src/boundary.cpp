@@ -0,0 +1,125 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#include "boundary.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define TRICORE_BOUNDARY_AVX2
+#elif defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define TRICORE_BOUNDARY_SSE2
+#endif
+
+namespace Tricore {
+// Halfwords at even positions within a 64-halfword block
+static constexpr uint64_t kEvenHalfwords = 0x5555555555555555ull;
+
+// Gathers bit 0 of count halfwords (at most 64) into a mask: bit i is set when
+// halfword i would start a 32-bit instruction
+static uint64_t LongMaskScalar(const uint8_t* data, size_t count) {
+  uint64_t mask = 0;
+  for (size_t i = 0; i < count; i++)
+    mask |= static_cast<uint64_t>(data[2 * i] & 0x01u) << i;
+  return mask;
+}
+
+#if defined(TRICORE_BOUNDARY_AVX2)
+// Same as LongMaskScalar for a full block of 64 halfwords (128 bytes)
+static uint64_t LongMask(const uint8_t* data) {
+  uint64_t mask = 0;
+  for (int i = 0; i < 2; i++) {
+    // Move bit 0 of each halfword into its sign bit, then narrow to bytes
+    // with signed saturation so the sign survives
+    __m256i a = _mm256_loadu_si256(
+        reinterpret_cast<const __m256i*>(data + 64 * i));
+    __m256i b = _mm256_loadu_si256(
+        reinterpret_cast<const __m256i*>(data + 64 * i + 32));
+    a = _mm256_slli_epi16(a, 15);
+    b = _mm256_slli_epi16(b, 15);
+    // packs works per 128-bit lane; restore halfword order across lanes
+    const __m256i packed =
+        _mm256_permute4x64_epi64(_mm256_packs_epi16(a, b), 0xD8);
+    mask |= static_cast<uint64_t>(
+                static_cast<uint32_t>(_mm256_movemask_epi8(packed)))
+            << (32 * i);
+  }
+  return mask;
+}
+#elif defined(TRICORE_BOUNDARY_SSE2)
+// Same as LongMaskScalar for a full block of 64 halfwords (128 bytes)
+static uint64_t LongMask(const uint8_t* data) {
+  uint64_t mask = 0;
+  for (int i = 0; i < 4; i++) {
+    // Move bit 0 of each halfword into its sign bit, then narrow to bytes
+    // with signed saturation so the sign survives
+    __m128i a =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 32 * i));
+    __m128i b =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 32 * i + 16));
+    a = _mm_slli_epi16(a, 15);
+    b = _mm_slli_epi16(b, 15);
+    mask |= static_cast<uint64_t>(
+                static_cast<uint32_t>(_mm_movemask_epi8(_mm_packs_epi16(a, b))))
+            << (16 * i);
+  }
+  return mask;
+}
+#else
+static uint64_t LongMask(const uint8_t* data) {
+  return LongMaskScalar(data, 64);
+}
+#endif
+
+// Resolves the instruction starts of one block from its long-instruction mask.
+// carry is set when the first halfword of the block is the second half of a
+// 32-bit instruction, and is updated for the next block.
+//
+// Within a run of consecutive long halfwords, only every other halfword
+// (counting from the start of the run) actually starts a 32-bit instruction;
+// the one after it is its upper half. Adding the run-start bit to the mask
+// clears exactly the runs that begin at that position, which separates runs
+// starting at even and odd positions without a per-halfword loop.
+static uint64_t ResolveStarts(uint64_t longMask, uint64_t& carry) {
+  longMask &= ~carry;
+
+  const uint64_t runStarts = longMask & ~(longMask << 1);
+  const uint64_t evenRuns = longMask & ~(longMask + (runStarts & kEvenHalfwords));
+  const uint64_t oddRuns = longMask & ~evenRuns;
+  // Halfwords that start a 32-bit instruction
+  const uint64_t wide =
+      (evenRuns & kEvenHalfwords) | (oddRuns & ~kEvenHalfwords);
+
+  const uint64_t upperHalves = (wide << 1) | carry;
+  carry = wide >> 63;
+  return ~upperHalves;
+}
+
+void ScanBoundaries(const uint8_t* buf, size_t len,
+                    InstructionBoundaries& out) {
+  const size_t halfwords = len / 2;
+  const size_t blocks = halfwords / 64;
+  const size_t tail = halfwords % 64;
+  out.starts.resize(blocks + (tail ? 1 : 0));
+  out.halfwords = halfwords;
+  out.truncated = InstructionBoundaries::kNone;
+  if (halfwords == 0) return;
+
+  uint64_t carry = 0;
+  for (size_t block = 0; block < blocks; block++)
+    out.starts[block] = ResolveStarts(LongMask(buf + 128 * block), carry);
+  if (tail) {
+    const uint64_t longMask = LongMaskScalar(buf + 128 * blocks, tail);
+    out.starts[blocks] =
+        ResolveStarts(longMask, carry) & ((uint64_t{1} << tail) - 1);
+  }
+
+  // A 32-bit instruction starting on the last halfword runs past the end
+  const size_t last = halfwords - 1;
+  if (out.IsStart(last) && (buf[2 * last] & 0x01u)) {
+    out.truncated = last;
+    out.starts[last / 64] &= ~(uint64_t{1} << (last % 64));
+  }
+}
+}  // namespace Tricore
@@ -0,0 +1,36 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#ifndef BINARYNINJA_API_TRICORE_BOUNDARY_H
+#define BINARYNINJA_API_TRICORE_BOUNDARY_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Tricore {
+// Instruction-start bitmap for a linear sweep of a buffer. Instruction length
+// depends only on bit 0 of the first halfword, so the boundaries can be found
+// without decoding.
+struct InstructionBoundaries {
+  static constexpr size_t kNone = ~size_t{0};
+
+  // Bit (i % 64) of starts[i / 64] is set when halfword i starts an
+  // instruction
+  std::vector<uint64_t> starts;
+  size_t halfwords = 0;
+  // Halfword whose 32-bit instruction would straddle the end of the buffer,
+  // or kNone. It is not marked in starts.
+  size_t truncated = kNone;
+
+  bool IsStart(size_t halfword) const {
+    return (starts[halfword / 64] >> (halfword % 64)) & 1;
+  }
+};
+
+// Computes the instruction-start bitmap for len bytes of buf, sweeping from
+// the first halfword. A trailing odd byte is ignored.
+void ScanBoundaries(const uint8_t* buf, size_t len, InstructionBoundaries& out);
+}  // namespace Tricore
+
+#endif  // BINARYNINJA_API_TRICORE_BOUNDARY_H
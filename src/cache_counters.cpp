@@ -0,0 +1,102 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#include "cache_counters.h"
+
+#include <atomic>
+#include <bitset>
+#include <mutex>
+#include <vector>
+
+namespace Tricore {
+namespace {
+// One thread's hit and miss counts for every cache. Only the owning thread
+// writes them, so a relaxed load and store is enough to increment and the
+// totals may be read at any time.
+struct ThreadCounts {
+  ThreadCounts();
+  ~ThreadCounts();
+
+  std::atomic<uint64_t> counts[CacheCounters::kMaxCaches][2] = {};
+};
+
+// The live threads' tables, the totals of the threads that have exited and
+// the rows in use
+struct Registry {
+  std::mutex lock;
+  std::vector<ThreadCounts*> threads;
+  uint64_t retired[CacheCounters::kMaxCaches][2] = {};
+  std::bitset<CacheCounters::kMaxCaches> used;
+};
+}  // namespace
+
+static Registry& GetRegistry() {
+  // Never destroyed, so threads exiting after static destruction has begun
+  // can still retire their counts
+  static Registry* registry = new Registry;
+  return *registry;
+}
+
+ThreadCounts::ThreadCounts() {
+  Registry& registry = GetRegistry();
+  std::lock_guard<std::mutex> guard(registry.lock);
+  registry.threads.push_back(this);
+}
+
+ThreadCounts::~ThreadCounts() {
+  Registry& registry = GetRegistry();
+  std::lock_guard<std::mutex> guard(registry.lock);
+  for (size_t i = 0; i < CacheCounters::kMaxCaches; i++)
+    for (size_t event = 0; event < 2; event++)
+      registry.retired[i][event] +=
+          counts[i][event].load(std::memory_order_relaxed);
+  std::erase(registry.threads, this);
+}
+
+static ThreadCounts& LocalCounts() {
+  thread_local ThreadCounts counts;
+  return counts;
+}
+
+CacheCounters::CacheCounters() : index(kNone) {
+  Registry& registry = GetRegistry();
+  std::lock_guard<std::mutex> guard(registry.lock);
+  for (size_t i = 0; i < kMaxCaches; i++) {
+    if (registry.used[i]) continue;
+    registry.used[i] = true;
+    index = i;
+    break;
+  }
+}
+
+CacheCounters::~CacheCounters() {
+  if (index == kNone) return;
+  // Clear the row for the next cache to use it; the cache being destroyed
+  // no longer counts into it
+  Registry& registry = GetRegistry();
+  std::lock_guard<std::mutex> guard(registry.lock);
+  for (size_t event = 0; event < 2; event++) {
+    registry.retired[index][event] = 0;
+    for (ThreadCounts* thread : registry.threads)
+      thread->counts[index][event].store(0, std::memory_order_relaxed);
+  }
+  registry.used[index] = false;
+}
+
+void CacheCounters::Count(size_t event) {
+  if (index == kNone) return;
+  std::atomic<uint64_t>& count = LocalCounts().counts[index][event];
+  count.store(count.load(std::memory_order_relaxed) + 1,
+              std::memory_order_relaxed);
+}
+
+uint64_t CacheCounters::Total(size_t event) const {
+  if (index == kNone) return 0;
+  Registry& registry = GetRegistry();
+  std::lock_guard<std::mutex> guard(registry.lock);
+  uint64_t sum = registry.retired[index][event];
+  for (const ThreadCounts* thread : registry.threads)
+    sum += thread->counts[index][event].load(std::memory_order_relaxed);
+  return sum;
+}
+}  // namespace Tricore
@@ -0,0 +1,42 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#ifndef BINARYNINJA_API_TRICORE_CACHE_COUNTERS_H
+#define BINARYNINJA_API_TRICORE_CACHE_COUNTERS_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Tricore {
+// Hit and miss counters of one cache. Each thread counts into its own table,
+// so counting is a thread-local increment with no shared cache lines;
+// Hits() and Misses() sum the tables of the live threads and of those that
+// have exited. At most kMaxCaches counters exist at a time; further ones do
+// not count.
+class CacheCounters {
+ public:
+  static constexpr size_t kMaxCaches = 64;
+
+  CacheCounters();
+  ~CacheCounters();
+
+  CacheCounters(const CacheCounters&) = delete;
+  CacheCounters& operator=(const CacheCounters&) = delete;
+
+  void Hit() { Count(0); }
+  void Miss() { Count(1); }
+
+  uint64_t Hits() const { return Total(0); }
+  uint64_t Misses() const { return Total(1); }
+
+ private:
+  static constexpr size_t kNone = kMaxCaches;
+
+  void Count(size_t event);
+  uint64_t Total(size_t event) const;
+
+  size_t index;  // row of the thread tables, or kNone
+};
+}  // namespace Tricore
+
+#endif  // BINARYNINJA_API_TRICORE_CACHE_COUNTERS_H
@@ -0,0 +1,206 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#include "callback_profile.h"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <vector>
+
+namespace Tricore {
+static constexpr unsigned kSubBucketBits = 4;
+static constexpr size_t kSubBuckets = size_t{1} << kSubBucketBits;
+// Up to 2^40 ns; longer calls go to the last bucket
+static constexpr unsigned kMaxShift = 40 - kSubBucketBits - 1;
+static constexpr size_t kBuckets = (kMaxShift + 2) * kSubBuckets;
+
+static const char* const kCallbackNames[] = {
+    "GetInstructionInfo",
+    "GetInstructionText",
+    "GetInstructionLowLevelIL",
+};
+static_assert(std::size(kCallbackNames) == kCallbacks);
+
+// Values below kSubBuckets have a bucket each. Above that, each power of two
+// is split into kSubBuckets buckets by the bits following the leading one.
+static size_t BucketIndex(uint64_t ns) {
+  if (ns < kSubBuckets) return static_cast<size_t>(ns);
+  const unsigned shift = std::bit_width(ns) - kSubBucketBits - 1;
+  if (shift > kMaxShift) return kBuckets - 1;
+  return (shift + 1) * kSubBuckets + static_cast<size_t>(ns >> shift) -
+         kSubBuckets;
+}
+
+static uint64_t BucketLow(size_t index) {
+  if (index < kSubBuckets) return index;
+  const unsigned shift = static_cast<unsigned>(index / kSubBuckets) - 1;
+  return static_cast<uint64_t>(kSubBuckets + index % kSubBuckets) << shift;
+}
+
+static uint64_t BucketHigh(size_t index) {
+  if (index < kSubBuckets) return index;
+  const unsigned shift = static_cast<unsigned>(index / kSubBuckets) - 1;
+  return BucketLow(index) + (uint64_t{1} << shift) - 1;
+}
+
+namespace {
+struct Histogram {
+  uint64_t total = 0;
+  uint64_t max = 0;
+  uint64_t buckets[kBuckets] = {};
+};
+
+// One thread's histograms. Only the owning thread writes them, so a relaxed
+// load and store is enough to update and Json() may read them at any time.
+struct ThreadHistograms {
+  ThreadHistograms();
+  ~ThreadHistograms();
+
+  struct {
+    std::atomic<uint64_t> total{0};
+    std::atomic<uint64_t> max{0};
+    std::atomic<uint64_t> buckets[kBuckets] = {};
+  } callbacks[kCallbacks];
+
+  void AddTo(Histogram* sums) const;
+};
+
+// The live threads' histograms and the sums of the threads that have exited
+struct Registry {
+  std::mutex lock;
+  std::vector<const ThreadHistograms*> threads;
+  Histogram retired[kCallbacks];
+};
+}  // namespace
+
+static Registry& GetRegistry() {
+  // Never destroyed, so threads exiting after static destruction has begun
+  // can still retire their histograms
+  static Registry* registry = new Registry;
+  return *registry;
+}
+
+ThreadHistograms::ThreadHistograms() {
+  Registry& registry = GetRegistry();
+  std::lock_guard<std::mutex> guard(registry.lock);
+  registry.threads.push_back(this);
+}
+
+ThreadHistograms::~ThreadHistograms() {
+  Registry& registry = GetRegistry();
+  std::lock_guard<std::mutex> guard(registry.lock);
+  AddTo(registry.retired);
+  std::erase(registry.threads, this);
+}
+
+void ThreadHistograms::AddTo(Histogram* sums) const {
+  for (size_t c = 0; c < kCallbacks; c++) {
+    sums[c].total += callbacks[c].total.load(std::memory_order_relaxed);
+    sums[c].max = std::max(sums[c].max,
+                           callbacks[c].max.load(std::memory_order_relaxed));
+    for (size_t i = 0; i < kBuckets; i++)
+      sums[c].buckets[i] +=
+          callbacks[c].buckets[i].load(std::memory_order_relaxed);
+  }
+}
+
+static void Add(std::atomic<uint64_t>& counter, uint64_t value) {
+  counter.store(counter.load(std::memory_order_relaxed) + value,
+                std::memory_order_relaxed);
+}
+
+void CallbackProfile::Record(Callback callback, uint64_t nanoseconds) {
+  thread_local ThreadHistograms histograms;
+  auto& histogram = histograms.callbacks[static_cast<size_t>(callback)];
+  Add(histogram.buckets[BucketIndex(nanoseconds)], 1);
+  Add(histogram.total, nanoseconds);
+  if (nanoseconds > histogram.max.load(std::memory_order_relaxed))
+    histogram.max.store(nanoseconds, std::memory_order_relaxed);
+}
+
+// Upper bound of the bucket holding the given fraction of the calls, as
+// HdrHistogram reports percentiles
+static uint64_t Percentile(const Histogram& histogram, uint64_t calls,
+                           double fraction) {
+  const uint64_t rank = std::max<uint64_t>(1, fraction * calls + 0.5);
+  uint64_t seen = 0;
+  for (size_t i = 0; i < kBuckets; i++) {
+    seen += histogram.buckets[i];
+    if (seen >= rank) return std::min(BucketHigh(i), histogram.max);
+  }
+  return histogram.max;
+}
+
+std::string CallbackProfile::Json() {
+  Histogram sums[kCallbacks];
+  {
+    Registry& registry = GetRegistry();
+    std::lock_guard<std::mutex> guard(registry.lock);
+    for (size_t c = 0; c < kCallbacks; c++) sums[c] = registry.retired[c];
+    for (const ThreadHistograms* thread : registry.threads)
+      thread->AddTo(sums);
+  }
+
+  std::string json = "{\n  \"unit\": \"ns\",\n  \"callbacks\": {";
+  char buf[256];
+  for (size_t c = 0; c < kCallbacks; c++) {
+    const Histogram& histogram = sums[c];
+    uint64_t calls = 0;
+    for (uint64_t count : histogram.buckets) calls += count;
+
+    std::snprintf(
+        buf, sizeof(buf),
+        "%s\n    \"%s\": {\n      \"calls\": %llu, \"total\": %llu, "
+        "\"max\": %llu,\n      \"p50\": %llu, \"p90\": %llu, \"p99\": %llu, "
+        "\"p999\": %llu,\n      \"buckets\": [",
+        c ? "," : "", kCallbackNames[c],
+        static_cast<unsigned long long>(calls),
+        static_cast<unsigned long long>(histogram.total),
+        static_cast<unsigned long long>(histogram.max),
+        static_cast<unsigned long long>(Percentile(histogram, calls, 0.5)),
+        static_cast<unsigned long long>(Percentile(histogram, calls, 0.9)),
+        static_cast<unsigned long long>(Percentile(histogram, calls, 0.99)),
+        static_cast<unsigned long long>(Percentile(histogram, calls, 0.999)));
+    json += buf;
+
+    // [lowest, highest, calls] of every nonempty bucket
+    bool first = true;
+    for (size_t i = 0; i < kBuckets; i++) {
+      if (!histogram.buckets[i]) continue;
+      std::snprintf(buf, sizeof(buf), "%s\n        [%llu, %llu, %llu]",
+                    first ? "" : ",",
+                    static_cast<unsigned long long>(BucketLow(i)),
+                    static_cast<unsigned long long>(BucketHigh(i)),
+                    static_cast<unsigned long long>(histogram.buckets[i]));
+      json += buf;
+      first = false;
+    }
+    json += first ? "]\n    }" : "\n      ]\n    }";
+  }
+  json += "\n  }\n}\n";
+  return json;
+}
+
+bool CallbackProfile::Save(const std::string& path) {
+  FILE* file = std::fopen(path.c_str(), "w");
+  if (!file) return false;
+  const std::string json = Json();
+  const bool written = std::fwrite(json.data(), 1, json.size(), file) ==
+                       json.size();
+  return std::fclose(file) == 0 && written;
+}
+
+#if TRICORE_PROFILE_CALLBACKS
+// Saves the profile to $TRICORE_PROFILE_JSON when the plugin is unloaded
+static struct SaveAtUnload {
+  ~SaveAtUnload() {
+    if (const char* path = std::getenv("TRICORE_PROFILE_JSON"))
+      CallbackProfile::Save(path);
+  }
+} saveAtUnload;
+#endif
+}  // namespace Tricore
@@ -0,0 +1,73 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#ifndef BINARYNINJA_API_TRICORE_CALLBACK_PROFILE_H
+#define BINARYNINJA_API_TRICORE_CALLBACK_PROFILE_H
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// Latency histograms of the architecture callbacks, compiled in with
+// -DTRICORE_PROFILE_CALLBACKS=ON. Otherwise TRICORE_PROFILE_CALLBACK expands
+// to nothing and the callbacks are not timed at all.
+#ifndef TRICORE_PROFILE_CALLBACKS
+#define TRICORE_PROFILE_CALLBACKS 0
+#endif
+
+#if TRICORE_PROFILE_CALLBACKS
+#define TRICORE_PROFILE_CALLBACK(callback) \
+  ::Tricore::CallbackTimer callbackTimer(::Tricore::Callback::callback)
+#else
+#define TRICORE_PROFILE_CALLBACK(callback) \
+  do {                                     \
+  } while (0)
+#endif
+
+namespace Tricore {
+enum class Callback : uint8_t {
+  Info,  // GetInstructionInfo
+  Text,  // GetInstructionText
+  Lift,  // GetInstructionLowLevelIL
+};
+inline constexpr size_t kCallbacks = 3;
+
+// Per-thread histograms of callback latencies. Buckets are log-linear as in
+// HdrHistogram: 16 per power of two, so a latency is recorded to within
+// 1/16 of its value, from 1 ns up to about 18 minutes. Recording touches
+// only the calling thread's histogram; Json() sums the histograms of the
+// live threads and of those that have exited.
+class CallbackProfile {
+ public:
+  static void Record(Callback callback, uint64_t nanoseconds);
+
+  // Call counts, total and maximum times, percentiles and the nonzero
+  // buckets of each callback
+  static std::string Json();
+  // Writes Json() to path; returns false if the file cannot be written
+  static bool Save(const std::string& path);
+};
+
+// Records the time from construction to destruction as one call of callback
+class CallbackTimer {
+ public:
+  explicit CallbackTimer(Callback callback)
+      : callback(callback), start(std::chrono::steady_clock::now()) {}
+  ~CallbackTimer() {
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    CallbackProfile::Record(
+        callback,
+        std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+  }
+
+  CallbackTimer(const CallbackTimer&) = delete;
+  CallbackTimer& operator=(const CallbackTimer&) = delete;
+
+ private:
+  Callback callback;
+  std::chrono::steady_clock::time_point start;
+};
+}  // namespace Tricore
+
+#endif  // BINARYNINJA_API_TRICORE_CALLBACK_PROFILE_H
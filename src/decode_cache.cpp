@@ -0,0 +1,104 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#include "decode_cache.h"
+
+#include <bit>
+#include <cstring>
+#include <type_traits>
+
+namespace Tricore {
+static constexpr size_t kRecordWords = 4;
+static_assert(std::is_trivially_copyable_v<DecodedInstruction>);
+static_assert(sizeof(DecodedInstruction) <= kRecordWords * sizeof(uint64_t));
+
+// Each slot is guarded by a sequence lock: sequence is odd while a writer
+// owns the slot and 0 until the slot is first written. The record is stored
+// as relaxed atomic words so a torn read is detected, not undefined.
+struct alignas(64) DecodeCache::Slot {
+  std::atomic<uint64_t> sequence{0};
+  std::atomic<uint64_t> address{0};
+  std::atomic<uint64_t> record[kRecordWords] = {};
+};
+
+std::atomic<bool> DecodeCache::bypassed{false};
+
+DecodeCache::DecodeCache(size_t entries) {
+  if (entries == 0) return;
+  entries = std::bit_floor(entries);
+  slots = std::make_unique<Slot[]>(entries);
+  mask = entries - 1;
+}
+
+DecodeCache::~DecodeCache() = default;
+
+// Halfwords are 2-byte aligned, so the low address bit carries no information
+static size_t SlotIndex(uint64_t addr, size_t mask) {
+  return static_cast<size_t>(addr >> 1) & mask;
+}
+
+bool DecodeCache::Lookup(const uint8_t* data, uint64_t addr, size_t maxLen,
+                         DecodedInstruction& insn) {
+  if (!slots || maxLen < 2 || bypassed.load(std::memory_order_relaxed))
+    return false;
+
+  // The key's instruction word, in the same form as DecodedInstruction::raw
+  uint32_t raw;
+  if (data[0] & 0x01u) {
+    if (maxLen < 4) return false;
+    std::memcpy(&raw, data, sizeof(raw));
+  } else {
+    uint16_t raw16;
+    std::memcpy(&raw16, data, sizeof(raw16));
+    raw = raw16;
+  }
+
+  const Slot& slot = slots[SlotIndex(addr, mask)];
+  const uint64_t before = slot.sequence.load(std::memory_order_acquire);
+  uint64_t record[kRecordWords];
+  const uint64_t address = slot.address.load(std::memory_order_relaxed);
+  for (size_t i = 0; i < kRecordWords; i++)
+    record[i] = slot.record[i].load(std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_acquire);
+  const uint64_t after = slot.sequence.load(std::memory_order_relaxed);
+
+  if (before == 0 || (before & 1) || before != after || address != addr) {
+    counters.Miss();
+    return false;
+  }
+  std::memcpy(&insn, record, sizeof(insn));
+  if (insn.raw != raw) {
+    counters.Miss();
+    return false;
+  }
+  counters.Hit();
+  return true;
+}
+
+void DecodeCache::Insert(uint64_t addr, const DecodedInstruction& insn) {
+  if (!slots || bypassed.load(std::memory_order_relaxed)) return;
+
+  Slot& slot = slots[SlotIndex(addr, mask)];
+  uint64_t sequence = slot.sequence.load(std::memory_order_relaxed);
+  if ((sequence & 1) ||
+      !slot.sequence.compare_exchange_strong(sequence, sequence + 1,
+                                             std::memory_order_relaxed))
+    return;
+  std::atomic_thread_fence(std::memory_order_release);
+
+  uint64_t record[kRecordWords] = {};
+  std::memcpy(record, &insn, sizeof(insn));
+  slot.address.store(addr, std::memory_order_relaxed);
+  for (size_t i = 0; i < kRecordWords; i++)
+    slot.record[i].store(record[i], std::memory_order_relaxed);
+  slot.sequence.store(sequence + 2, std::memory_order_release);
+}
+
+DecodeCacheStats DecodeCache::Stats() const {
+  DecodeCacheStats stats;
+  stats.hits = counters.Hits();
+  stats.misses = counters.Misses();
+  stats.entries = slots ? mask + 1 : 0;
+  return stats;
+}
+}  // namespace Tricore
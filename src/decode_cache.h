@@ -0,0 +1,62 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#ifndef BINARYNINJA_API_TRICORE_DECODE_CACHE_H
+#define BINARYNINJA_API_TRICORE_DECODE_CACHE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "cache_counters.h"
+#include "decoder.h"
+
+namespace Tricore {
+struct DecodeCacheStats {
+  uint64_t hits = 0;
+  uint64_t misses = 0;
+  size_t entries = 0;
+};
+
+// Direct-mapped cache of decoded instructions keyed by (address, instruction
+// word), so the Info, Text and LLIL callbacks for one address decode once.
+// Lookups and inserts are lock-free and safe to call from any number of
+// analysis threads. An insert that races another write to the same slot is
+// dropped, and a lookup that races a write misses.
+class DecodeCache {
+ public:
+  // entries is rounded down to a power of two; 0 disables the cache
+  explicit DecodeCache(size_t entries);
+  ~DecodeCache();
+
+  DecodeCache(const DecodeCache&) = delete;
+  DecodeCache& operator=(const DecodeCache&) = delete;
+
+  // Looks up the instruction at data (located at addr). Returns false on a
+  // miss or when fewer than the instruction's length bytes are available.
+  bool Lookup(const uint8_t* data, uint64_t addr, size_t maxLen,
+              DecodedInstruction& insn);
+  // Stores a successfully decoded instruction located at addr
+  void Insert(uint64_t addr, const DecodedInstruction& insn);
+
+  DecodeCacheStats Stats() const;
+
+  // Makes every DecodeCache miss and drop inserts, or work again, so benchmarks
+  // can time the callbacks without the cache
+  static void SetBypassed(bool bypass) {
+    bypassed.store(bypass, std::memory_order_relaxed);
+  }
+
+ private:
+  struct Slot;
+
+  std::unique_ptr<Slot[]> slots;
+  size_t mask = 0;
+  CacheCounters counters;
+
+  static std::atomic<bool> bypassed;
+};
+}  // namespace Tricore
+
+#endif  // BINARYNINJA_API_TRICORE_DECODE_CACHE_H
@@ -0,0 +1,1636 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#include "decoder.h"
+
+#include <cstring>
+#include <utility>
+
+#include "opcodes.h"
+#include "registers.h"
+
+namespace Tricore {
+// Handler descriptor for one valid encoding
+struct Encoding {
+  uint8_t op1;
+  uint8_t op2;  // NO_OP2 for single-opcode encodings
+  InstructionId id;
+  Format format;
+  IsaVersion since;  // first ISA version with this encoding
+};
+
+#define NO_OP2 0xFF
+#define OP1(op1, id, fmt) \
+  {op1, NO_OP2, InstructionId::id, Format::fmt, IsaVersion::TC13}
+#define OP2(op1, op2, id, fmt) \
+  {op1, op2, InstructionId::id, Format::fmt, IsaVersion::TC13}
+#define OP1_SINCE(op1, id, fmt, version) \
+  {op1, NO_OP2, InstructionId::id, Format::fmt, IsaVersion::version}
+#define OP2_SINCE(op1, op2, id, fmt, version) \
+  {op1, op2, InstructionId::id, Format::fmt, IsaVersion::version}
+
+// All encodings handled by the plugin, built from the opcodes in opcodes.h
+static constexpr Encoding kEncodings[] = {
+    // 32-bit, primary opcode only
+    OP1(ADDI_DC_DA_CONST16, Addi, RLC),
+    OP1(ADDIH_DC_DA_CONST16, Addih, RLC),
+    OP1(ADDIHA_AC_AA_CONST16, Addiha, RLC),
+    OP1(LDA_AA_AB_OFF16, Lda, BOL),
+    OP1_SINCE(LDB_DA_AB_OFF16, Ldb, BOL, TC16),
+    OP1_SINCE(LDBU_DA_AB_OFF16, Ldb, BOL, TC16),
+    OP1_SINCE(LDH_DA_AB_OFF16, Ldh, BOL, TC16),
+    OP1_SINCE(LDHU_DA_AB_OFF16, Ldhu, BOL, TC16),
+    OP1(LDW_DA_AB_OFF16, Ldw, BOL),
+    OP1(LEA_AA_AB_OFF16, Lea, BOL),
+    OP1(MFCR_DC_CONST16, Mfcr, RLC),
+    OP1(MOV_DC_CONST16, Mov, RLC),
+    OP1_SINCE(MOV_EC_CONST16, Mov, RLC, TC16),
+    OP1(MOVU_DC_CONST16, Movu, RLC),
+    OP1(MOVH_DC_CONST16, Movh, RLC),
+    OP1(MOVHA_AC_CONST16, Movha, RLC),
+    OP1(MTCR_CONST16_DA, Mtcr, RLC),
+    OP1_SINCE(STB_AB_OFF16_DA, Stb, BOL, TC16),
+    OP1_SINCE(STH_AB_OFF16_DA, Sth, BOL, TC16),
+    OP1_SINCE(STA_AB_OFF16_AA, Sta, BOL, TC16),
+    OP1(STW_AB_OFF16_DA, Stw, BOL),
+    OP1(CALL_DISP24, Call, B),
+    OP1(CALLA_DISP24, Calla, B),
+    OP1_SINCE(FCALL_DISP24, Fcall, B, TC16),
+    OP1_SINCE(FCALLA_DISP24, Fcalla, B, TC16),
+    OP1(J_DISP24, J, B),
+    OP1(JA_DISP24, Ja, B),
+    OP1(JL_DISP24, Jl, B),
+    OP1(JLA_DISP24, Jla, B),
+
+    // 32-bit, primary + secondary opcode
+    OP2(OP1_x6F_BRN, JZT_DA_N_DISP15, Jzt, BRN),
+    OP2(OP1_x6F_BRN, JNZT_DA_N_DISP15, Jnzt, BRN),
+    OP2(OP1_x01_RR, ADDA_AC_AA_AB, Adda, RR),
+    OP2(OP1_x01_RR, ADDSCA_AC_AB_DA_N, Addscaat, RR),
+    OP2(OP1_x01_RR, ADDSCAT_AC_AB_DA, Addscaat, RR),
+    OP2(OP1_x01_RR, EQA_DC_AA_AB, Eqa, RR),
+    OP2(OP1_x01_RR, EQZA_DC_AA, Eqza, RR),
+    OP2(OP1_x01_RR, GEA_DC_AA_AB, Gea, RR),
+    OP2(OP1_x01_RR, LTA_DC_AA_AB, Lta, RR),
+    OP2(OP1_x01_RR, MOVA_AC_DB, Mova, RR),
+    OP2(OP1_x01_RR, MOVAA_AC_AB, Movaa, RR),
+    OP2(OP1_x01_RR, MOVD_DC_AB, Movd, RR),
+    OP2(OP1_x01_RR, NEA_DC_AA_AB, Nea, RR),
+    OP2(OP1_x01_RR, NEZA_DC_AA, Neza, RR),
+    OP2(OP1_x01_RR, SUBA_AC_AA_AB, Suba, RR),
+    OP2(OP1_x03_RRR2, MADD_DC_DD_DA_DB, Madd, RRR2),
+    OP2(OP1_x03_RRR2, MADD_EC_ED_DA_DB, Madd, RRR2),
+    OP2(OP1_x03_RRR2, MADDS_DC_DD_DA_DB, Madd, RRR2),
+    OP2(OP1_x03_RRR2, MADDS_EC_ED_DA_DB, Madd, RRR2),
+    OP2(OP1_x03_RRR2, MADDU_EC_ED_DA_DB, Maddu, RRR2),
+    OP2(OP1_x03_RRR2, MADDSU_DC_DD_DA_DB, Maddu, RRR2),
+    OP2(OP1_x03_RRR2, MADDSU_EC_ED_DA_DB, Maddu, RRR2),
+    OP2(OP1_x05_ABS, LDB_DA_OFF18, Ldb, ABS),
+    OP2(OP1_x05_ABS, LDBU_DA_OFF18, Ldb, ABS),
+    OP2(OP1_x05_ABS, LDH_DA_OFF18, Ldh, ABS),
+    OP2(OP1_x05_ABS, LDHU_DA_OFF18, Ldhu, ABS),
+    OP2(OP1_x07_BIT, NANDT_DC_DA_POS1_DB_POS2, Nandt, BIT),
+    OP2(OP1_x07_BIT, ORNT_DC_DA_POS1_DB_POS2, Ornt, BIT),
+    OP2(OP1_x07_BIT, XNORT_DC_DA_POS1_DB_POS2, Xnort, BIT),
+    OP2(OP1_x07_BIT, XORT_DC_DA_POS1_DB_POS2, Xort, BIT),
+    OP2(OP1_x09_BO, LDA_AA_AB_OFF10, Lda, BO),
+    OP2(OP1_x09_BO, LDA_AA_AB_OFF10_POSTINC, Lda, BO),
+    OP2(OP1_x09_BO, LDA_AA_AB_OFF10_PREINC, Lda, BO),
+    OP2(OP1_x09_BO, LDB_DA_AB_OFF10, Ldb, BO),
+    OP2(OP1_x09_BO, LDB_DA_AB_OFF10_POSTINC, Ldb, BO),
+    OP2(OP1_x09_BO, LDB_DA_AB_OFF10_PREINC, Ldb, BO),
+    OP2(OP1_x09_BO, LDBU_DA_AB_OFF10, Ldb, BO),
+    OP2(OP1_x09_BO, LDBU_DA_AB_OFF10_POSTINC, Ldb, BO),
+    OP2(OP1_x09_BO, LDBU_DA_AB_OFF10_PREINC, Ldb, BO),
+    OP2(OP1_x09_BO, LDD_EA_AB_OFF10, Ldd, BO),
+    OP2(OP1_x09_BO, LDD_EA_AB_OFF10_POSTINC, Ldd, BO),
+    OP2(OP1_x09_BO, LDD_EA_AB_OFF10_PREINC, Ldd, BO),
+    OP2(OP1_x09_BO, LDDA_PA_AB_OFF10, Ldda, BO),
+    OP2(OP1_x09_BO, LDDA_PA_AB_OFF10_POSTINC, Ldda, BO),
+    OP2(OP1_x09_BO, LDDA_PA_AB_OFF10_PREINC, Ldda, BO),
+    OP2(OP1_x09_BO, LDH_DA_AB_OFF10, Ldh, BO),
+    OP2(OP1_x09_BO, LDH_DA_AB_OFF10_POSTINC, Ldh, BO),
+    OP2(OP1_x09_BO, LDH_DA_AB_OFF10_PREINC, Ldh, BO),
+    OP2(OP1_x09_BO, LDHU_DA_AB_OFF10, Ldhu, BO),
+    OP2(OP1_x09_BO, LDHU_DA_AB_OFF10_POSTINC, Ldhu, BO),
+    OP2(OP1_x09_BO, LDHU_DA_AB_OFF10_PREINC, Ldhu, BO),
+    OP2(OP1_x09_BO, LDQ_DA_AB_OFF10, Ldq, BO),
+    OP2(OP1_x09_BO, LDQ_DA_AB_OFF10_POSTINC, Ldq, BO),
+    OP2(OP1_x09_BO, LDQ_DA_AB_OFF10_PREINC, Ldq, BO),
+    OP2(OP1_x09_BO, LDW_DA_AB_OFF10, Ldw, BO),
+    OP2(OP1_x09_BO, LDW_DA_AB_OFF10_POSTINC, Ldw, BO),
+    OP2(OP1_x09_BO, LDW_DA_AB_OFF10_PREINC, Ldw, BO),
+    OP2(OP1_x0B_RR, ABS_DC_DB, Abs, RR),
+    OP2(OP1_x0B_RR, ABSB_DC_DB, Absbh, RR),
+    OP2(OP1_x0B_RR, ABSH_DC_DB, Absbh, RR),
+    OP2(OP1_x0B_RR, ABSDIF_DC_DA_DB, Absdif, RR),
+    OP2(OP1_x0B_RR, ABSDIFB_DC_DA_DB, Absdifbh, RR),
+    OP2(OP1_x0B_RR, ABSDIFH_DC_DA_DB, Absdifbh, RR),
+    OP2(OP1_x0B_RR, ABSDIFS_DC_DA_DB, Absdifs, RR),
+    OP2(OP1_x0B_RR, ABSDIFSH_DC_DA_DB, Absdifsh, RR),
+    OP2(OP1_x0B_RR, ABSS_DC_DB, Abss, RR),
+    OP2(OP1_x0B_RR, ABSSH_DC_DB, Abssh, RR),
+    OP2(OP1_x0B_RR, ADD_DC_DA_DB, Add, RR),
+    OP2(OP1_x0B_RR, ADDB_DC_DA_DB, Addbh, RR),
+    OP2(OP1_x0B_RR, ADDH_DC_DA_DB, Addbh, RR),
+    OP2(OP1_x0B_RR, ADDC_DC_DA_DB, Addc, RR),
+    OP2(OP1_x0B_RR, ADDS_DC_DA_DB, Adds, RR),
+    OP2(OP1_x0B_RR, ADDSH_DC_DA_DB, Addshhu, RR),
+    OP2(OP1_x0B_RR, ADDSHU_DC_DA_DB, Addshhu, RR),
+    OP2(OP1_x0B_RR, ADDSU_DC_DA_DB, Addsu, RR),
+    OP2(OP1_x0B_RR, ADDX_DC_DA_DB, Addx, RR),
+    OP2(OP1_x0B_RR, ANDEQ_DC_DA_DB, Andeq, RR),
+    OP2(OP1_x0B_RR, ANDGE_DC_DA_DB, AndgeGeU, RR),
+    OP2(OP1_x0B_RR, ANDGEU_DC_DA_DB, AndgeGeU, RR),
+    OP2(OP1_x0B_RR, ANDLT_DC_DA_DB, AndltLtU, RR),
+    OP2(OP1_x0B_RR, ANDLTU_DC_DA_DB, AndltLtU, RR),
+    OP2(OP1_x0B_RR, ANDNE_DC_DA_DB, Andne, RR),
+    OP2(OP1_x0B_RR, EQ_DC_DA_DB, Eq, RR),
+    OP2(OP1_x0B_RR, EQB_DC_DA_DB, Eqbhw, RR),
+    OP2(OP1_x0B_RR, EQH_DC_DA_DB, Eqbhw, RR),
+    OP2(OP1_x0B_RR, EQW_DC_DA_DB, Eqbhw, RR),
+    OP2(OP1_x0B_RR, EQANYB_DC_DA_DB, Eqanybh, RR),
+    OP2(OP1_x0B_RR, EQANYH_DC_DA_DB, Eqanybh, RR),
+    OP2(OP1_x0B_RR, GE_DC_DA_DB, Ge, RR),
+    OP2(OP1_x0B_RR, GEU_DC_DA_DB, Ge, RR),
+    OP2(OP1_x0B_RR, LT_DC_DA_DB, Lt, RR),
+    OP2(OP1_x0B_RR, LTU_DC_DA_DB, Lt, RR),
+    OP2(OP1_x0B_RR, LTB_DC_DA_DB, Ltb, RR),
+    OP2(OP1_x0B_RR, LTBU_DC_DA_DB, Ltb, RR),
+    OP2(OP1_x0B_RR, LTH_DC_DA_DB, Lth, RR),
+    OP2(OP1_x0B_RR, LTHU_DC_DA_DB, Lth, RR),
+    OP2(OP1_x0B_RR, LTW_DC_DA_DB, Ltw, RR),
+    OP2(OP1_x0B_RR, LTWU_DC_DA_DB, Ltw, RR),
+    OP2(OP1_x0B_RR, MAX_DC_DA_DB, Max, RR),
+    OP2(OP1_x0B_RR, MAXU_DC_DA_DB, Max, RR),
+    OP2(OP1_x0B_RR, MAXB_DC_DA_DB, Maxb, RR),
+    OP2(OP1_x0B_RR, MAXBU_DC_DA_DB, Maxb, RR),
+    OP2(OP1_x0B_RR, MAXH_DC_DA_DB, Maxh, RR),
+    OP2(OP1_x0B_RR, MAXHU_DC_DA_DB, Maxh, RR),
+    OP2(OP1_x0B_RR, MIN_DC_DA_DB, Min, RR),
+    OP2(OP1_x0B_RR, MINU_DC_DA_DB, Min, RR),
+    OP2(OP1_x0B_RR, MINB_DC_DA_DB, Minb, RR),
+    OP2(OP1_x0B_RR, MINBU_DC_DA_DB, Minb, RR),
+    OP2(OP1_x0B_RR, MINH_DC_DA_DB, Minh, RR),
+    OP2(OP1_x0B_RR, MINHU_DC_DA_DB, Minh, RR),
+    OP2(OP1_x0B_RR, MOV_DC_DB, Mov, RR),
+    OP2_SINCE(OP1_x0B_RR, MOV_EC_DB, Mov, RR, TC16),
+    OP2_SINCE(OP1_x0B_RR, MOV_EC_DA_DB, Mov, RR, TC16),
+    OP2(OP1_x0B_RR, NE_DC_DA_DB, Ne, RR),
+    OP2(OP1_x0B_RR, OREQ_DC_DA_DB, Oreq, RR),
+    OP2(OP1_x0B_RR, ORGE_DC_DA_DB, OrgeGeu, RR),
+    OP2(OP1_x0B_RR, ORGEU_DC_DA_DB, OrgeGeu, RR),
+    OP2(OP1_x0B_RR, ORLT_DC_DA_DB, OrltLtu, RR),
+    OP2(OP1_x0B_RR, ORLTU_DC_DA_DB, OrltLtu, RR),
+    OP2(OP1_x0B_RR, ORNE_DC_DA_DB, Orne, RR),
+    OP2(OP1_x0B_RR, SATB_DC_DA, Satb, RR),
+    OP2(OP1_x0B_RR, SATBU_DC_DA, Satbu, RR),
+    OP2(OP1_x0B_RR, SATH_DC_DA, Sath, RR),
+    OP2(OP1_x0B_RR, SATHU_DC_DA, Sathu, RR),
+    OP2(OP1_x0B_RR, SHEQ_DC_DA_DB, Sheq, RR),
+    OP2(OP1_x0B_RR, SHGE_DC_DA_DB, ShgeGeu, RR),
+    OP2(OP1_x0B_RR, SHGEU_DC_DA_DB, ShgeGeu, RR),
+    OP2(OP1_x0B_RR, SHLT_DC_DA_DB, ShltLtu, RR),
+    OP2(OP1_x0B_RR, SHLTU_DC_DA_DB, ShltLtu, RR),
+    OP2(OP1_x0B_RR, SHNE_DC_DA_DB, Shne, RR),
+    OP2(OP1_x0B_RR, SUB_DC_DA_DB, Sub, RR),
+    OP2(OP1_x0B_RR, SUBB_DC_DA_DB, Subbh, RR),
+    OP2(OP1_x0B_RR, SUBH_DC_DA_DB, Subbh, RR),
+    OP2(OP1_x0B_RR, SUBC_DC_DA_DB, Subc, RR),
+    OP2(OP1_x0B_RR, SUBS_DC_DA_DB, Subsu, RR),
+    OP2(OP1_x0B_RR, SUBSU_DC_DA_DB, Subsu, RR),
+    OP2(OP1_x0B_RR, SUBSH_DC_DA_DB, SubshHu, RR),
+    OP2(OP1_x0B_RR, SUBSHU_DC_DA_DB, SubshHu, RR),
+    OP2(OP1_x0B_RR, SUBX_DC_DA_DB, Subx, RR),
+    OP2(OP1_x0B_RR, XOREQ_DC_DA_DB, Xoreq, RR),
+    OP2(OP1_x0B_RR, XORGE_DC_DA_DB, Xorge, RR),
+    OP2(OP1_x0B_RR, XORGEU_DC_DA_DB, Xorge, RR),
+    OP2(OP1_x0B_RR, XORLT_DC_DA_DB, Xorlt, RR),
+    OP2(OP1_x0B_RR, XORLTU_DC_DA_DB, Xorlt, RR),
+    OP2(OP1_x0B_RR, XORNE_DC_DA_DB, Xorne, RR),
+    OP2(OP1_x0D_SYS, DEBUG32, Debug, SYS),
+    OP2(OP1_x0D_SYS, DISABLE, Disable, SYS),
+    OP2_SINCE(OP1_x0D_SYS, DISABLE_DA, DisableDa, SYS, TC16),
+    OP2(OP1_x0D_SYS, DSYNC, Dsync, SYS),
+    OP2(OP1_x0D_SYS, ENABLE, Enable, SYS),
+    OP2(OP1_x0D_SYS, ISYNC, Isync, SYS),
+    OP2(OP1_x0D_SYS, NOP32, Nop, SYS),
+    OP2_SINCE(OP1_x0D_SYS, RESTORE_DA, RestoreDa, SYS, TC16),
+    OP2(OP1_x0D_SYS, RET32, Ret, SYS),
+    OP2_SINCE(OP1_x0D_SYS, FRET32, Fret, SYS, TC16),
+    OP2(OP1_x0D_SYS, RFE32, Rfe, SYS),
+    OP2(OP1_x0D_SYS, RFM, Rfm, SYS),
+    OP2(OP1_x0D_SYS, RSLCX, Rslcx, SYS),
+    OP2(OP1_x0D_SYS, SVLCX, Svlcx, SYS),
+    OP2(OP1_x0D_SYS, TRAPSV, Trapsv, SYS),
+    OP2(OP1_x0D_SYS, TRAPV, Trapv, SYS),
+    OP2_SINCE(OP1_x0D_SYS, WAIT, Wait, SYS, TC16),
+    OP2(OP1_x0F_RR, AND_DC_DA_DB, And, RR),
+    OP2(OP1_x0F_RR, ANDN_DC_DA_DB, Andn, RR),
+    OP2(OP1_x0F_RR, CLO_DC_DA, Clo, RR),
+    OP2(OP1_x0F_RR, CLOH_DC_DA, Cloh, RR),
+    OP2(OP1_x0F_RR, CLS_DC_DA, Cls, RR),
+    OP2(OP1_x0F_RR, CLSH_DC_DA, Clsh, RR),
+    OP2(OP1_x0F_RR, CLZ_DC_DA, Clz, RR),
+    OP2(OP1_x0F_RR, CLZH_DC_DA, Clzh, RR),
+    OP2(OP1_x0F_RR, NAND_DC_DA_DB, Nand, RR),
+    OP2(OP1_x0F_RR, NOR_DC_DA_DB, Nor, RR),
+    OP2(OP1_x0F_RR, OR_DC_DA_DB, Or, RR),
+    OP2(OP1_x0F_RR, ORN_DC_DA_DB, Orn, RR),
+    OP2(OP1_x0F_RR, SH_DC_DA_DB, Sh, RR),
+    OP2(OP1_x0F_RR, SHH_DC_DA_DB, Shh, RR),
+    OP2(OP1_x0F_RR, SHA_DC_DA_DB, Sha, RR),
+    OP2(OP1_x0F_RR, SHAH_DC_DA_DB, Shah, RR),
+    OP2(OP1_x0F_RR, SHAS_DC_DA_DB, Shas, RR),
+    OP2(OP1_x0F_RR, XNOR_DC_DA_DB, Xnor, RR),
+    OP2(OP1_x0F_RR, XOR_DC_DA_DB, Xor, RR),
+    OP2(OP1_x13_RCR, MADD_DC_DD_DA_CONST9, Madd, RCR),
+    OP2(OP1_x13_RCR, MADD_EC_ED_DA_CONST9, Madd, RCR),
+    OP2(OP1_x13_RCR, MADDS_DC_DD_DA_CONST9, Madd, RCR),
+    OP2(OP1_x13_RCR, MADDS_EC_ED_DA_CONST9, Madd, RCR),
+    OP2(OP1_x13_RCR, MADDU_EC_ED_DA_CONST9, Maddu, RCR),
+    OP2(OP1_x13_RCR, MADDSU_DC_DD_DA_CONST9, Maddu, RCR),
+    OP2(OP1_x13_RCR, MADDSU_EC_ED_DA_CONST9, Maddu, RCR),
+    OP2(OP1_x15_ABS, LDLCX_OFF18, Ldlcx, ABS),
+    OP2(OP1_x15_ABS, LDUCX_OFF18, Lducx, ABS),
+    OP2(OP1_x15_ABS, STLCX_OFF18, Stlcx, ABS),
+    OP2(OP1_x15_ABS, STUCX_OFF18, Stucx, ABS),
+    OP2(OP1_x17_RRRR, DEXTR_DC_DA_DB_DD, Dextr, RRRR),
+    OP2(OP1_x17_RRRR, EXTR_DC_DA_ED, Extr, RRRR),
+    OP2(OP1_x17_RRRR, EXTRU_DC_DA_ED, Extr, RRRR),
+    OP2(OP1_x17_RRRR, INSERT_DC_DA_DB_ED, Insert, RRRR),
+    OP2(OP1_x1F_BRR, JNED_DA_DB_DISP15, Jned, BRR),
+    OP2(OP1_x1F_BRR, JNEI_DA_DB_DISP15, Jnei, BRR),
+    OP2(OP1_x23_RRR2, MSUB_DC_DD_DA_DB, Msub, RRR2),
+    OP2(OP1_x23_RRR2, MSUB_EC_ED_DA_DB, Msub, RRR2),
+    OP2(OP1_x23_RRR2, MSUBS_DC_DD_DA_DB, Msub, RRR2),
+    OP2(OP1_x23_RRR2, MSUBS_EC_ED_DA_DB, Msub, RRR2),
+    OP2(OP1_x23_RRR2, MSUBU_EC_ED_DA_DB, Msubu, RRR2),
+    OP2(OP1_x23_RRR2, MSUBSU_DC_DD_DA_DB, Msubu, RRR2),
+    OP2(OP1_x23_RRR2, MSUBSU_EC_ED_DA_DB, Msubu, RRR2),
+    OP2(OP1_x25_ABS, STB_OFF18_DA, Stb, ABS),
+    OP2(OP1_x25_ABS, STH_OFF18_DA, Sth, ABS),
+    OP2(OP1_x27_BIT, SHANDT_DC_DA_POS1_DB_POS2, ShAndOrNorXorT, BIT),
+    OP2(OP1_x27_BIT, SHANDNT_DC_DA_POS1_DB_POS2, ShAndOrNorXorT, BIT),
+    OP2(OP1_x27_BIT, SHNORT_DC_DA_POS1_DB_POS2, ShAndOrNorXorT, BIT),
+    OP2(OP1_x27_BIT, SHORT_DC_DA_POS1_DB_POS2, ShAndOrNorXorT, BIT),
+    OP2(OP1_x29_BO, LDA_AA_PB, Lda, BO),
+    OP2(OP1_x29_BO, LDA_AA_PB_OFF10, Lda, BO),
+    OP2(OP1_x29_BO, LDB_DA_PB, Ldb, BO),
+    OP2(OP1_x29_BO, LDB_DA_PB_OFF10, Ldb, BO),
+    OP2(OP1_x29_BO, LDBU_DA_PB, Ldb, BO),
+    OP2(OP1_x29_BO, LDBU_DA_PB_OFF10, Ldb, BO),
+    OP2(OP1_x29_BO, LDD_EA_PB, Ldd, BO),
+    OP2(OP1_x29_BO, LDD_EA_PB_OFF10, Ldd, BO),
+    OP2(OP1_x29_BO, LDDA_PA_PB, Ldda, BO),
+    OP2(OP1_x29_BO, LDDA_PA_PB_OFF10, Ldda, BO),
+    OP2(OP1_x29_BO, LDH_DA_PB, Ldh, BO),
+    OP2(OP1_x29_BO, LDH_DA_PB_OFF10, Ldh, BO),
+    OP2(OP1_x29_BO, LDHU_DA_PB, Ldhu, BO),
+    OP2(OP1_x29_BO, LDHU_DA_PB_OFF10, Ldhu, BO),
+    OP2(OP1_x29_BO, LDQ_DA_PB, Ldq, BO),
+    OP2(OP1_x29_BO, LDQ_DA_PB_OFF10, Ldq, BO),
+    OP2(OP1_x29_BO, LDW_DA_PB, Ldw, BO),
+    OP2(OP1_x29_BO, LDW_DA_PB_OFF10, Ldw, BO),
+    OP2(OP1_x2B_RRR, CADD_DC_DD_DA_DB, Cadd, RRR),
+    OP2(OP1_x2B_RRR, CADDN_DC_DD_DA_DB, Caddn, RRR),
+    OP2(OP1_x2B_RRR, CSUB_DC_DD_DA_DB, Csub, RRR),
+    OP2(OP1_x2B_RRR, CSUBN_DC_DD_DA_DB, Csubn, RRR),
+    OP2(OP1_x2B_RRR, SEL_DC_DD_DA_DB, Sel, RRR),
+    OP2(OP1_x2B_RRR, SELN_DC_DD_DA_DB, Seln, RRR),
+    OP2(OP1_x2D_RR, CALLI_AA, Calli, RR),
+    OP2_SINCE(OP1_x2D_RR, FCALLI_AA, Fcalli, RR, TC16),
+    OP2(OP1_x2D_RR, JI_AA_32, Ji, RR),
+    OP2(OP1_x2D_RR, JLI_AA, Jli, RR),
+    OP2(OP1_x2F_SYS, RSTV, Rstv, SYS),
+    OP2(OP1_x33_RCR, MSUB_DC_DD_DA_CONST9, Msub, RCR),
+    OP2(OP1_x33_RCR, MSUB_EC_ED_DA_CONST9, Msub, RCR),
+    OP2(OP1_x33_RCR, MSUBS_DC_DD_DA_CONST9, Msub, RCR),
+    OP2(OP1_x33_RCR, MSUBS_EC_ED_DA_CONST9, Msub, RCR),
+    OP2(OP1_x33_RCR, MSUBU_EC_ED_DA_CONST9, Msubu, RCR),
+    OP2(OP1_x33_RCR, MSUBSU_DC_DD_DA_CONST9, Msubu, RCR),
+    OP2(OP1_x33_RCR, MSUBSU_EC_ED_DA_CONST9, Msubu, RCR),
+    OP2(OP1_x37_RRPW, EXTR_DC_DA_POS_WIDTH, Extr, RRPW),
+    OP2(OP1_x37_RRPW, EXTRU_DC_DA_POS_WIDTH, Extr, RRPW),
+    OP2(OP1_x37_RRPW, IMASK_EC_DB_POS_WIDTH, Imask, RRPW),
+    OP2(OP1_x37_RRPW, INSERT_DC_DA_DB_POS_WIDTH, Insert, RRPW),
+    OP2(OP1_x3F_BRR, JLT_DA_DB_DISP15, Jlt, BRR),
+    OP2(OP1_x3F_BRR, JLTU_DA_DB_DISP15, Jlt, BRR),
+    OP2(OP1_x43_RRR1, MADDQ_DC_DD_DA_DB_N, Maddq, RRR1),
+    OP2(OP1_x43_RRR1, MADDQ_EC_ED_DA_DB_N, Maddq, RRR1),
+    OP2(OP1_x43_RRR1, MADDQ_DC_DD_DA_DBL_N, Maddq, RRR1),
+    OP2(OP1_x43_RRR1, MADDQ_EC_ED_DA_DBL_N, Maddq, RRR1),
+    OP2(OP1_x43_RRR1, MADDQ_DC_DD_DA_DBU_N, Maddq, RRR1),
+    OP2(OP1_x43_RRR1, MADDQ_EC_ED_DA_DBU_N, Maddq, RRR1),
+    OP2(OP1_x43_RRR1, MADDQ_DC_DD_DAL_DBL_N, Maddq, RRR1),
+    OP2(OP1_x43_RRR1, MADDQ_EC_ED_DAL_DBL_N, Maddq, RRR1),
+    OP2(OP1_x43_RRR1, MADDQ_DC_DD_DAU_DBU_N, Maddq, RRR1),
+    OP2(OP1_x43_RRR1, MADDQ_EC_ED_DAU_DBU_N, Maddq, RRR1),
+    OP2(OP1_x43_RRR1, MADDSQ_DC_DD_DA_DB_N, Maddq, RRR1),
+    OP2(OP1_x43_RRR1, MADDSQ_EC_ED_DA_DB_N, Maddq, RRR1),
+    OP2(OP1_x43_RRR1, MADDSQ_DC_DD_DA_DBL_N, Maddq, RRR1),
+    OP2(OP1_x43_RRR1, MADDSQ_EC_ED_DA_DBL_N, Maddq, RRR1),
+    OP2(OP1_x43_RRR1, MADDSQ_DC_DD_DA_DBU_N, Maddq, RRR1),
+    OP2(OP1_x43_RRR1, MADDSQ_EC_ED_DA_DBU_N, Maddq, RRR1),
+    OP2(OP1_x43_RRR1, MADDSQ_DC_DD_DAL_DBL_N, Maddq, RRR1),
+    OP2(OP1_x43_RRR1, MADDSQ_EC_ED_DAL_DBL_N, Maddq, RRR1),
+    OP2(OP1_x43_RRR1, MADDSQ_DC_DD_DAU_DBU_N, Maddq, RRR1),
+    OP2(OP1_x43_RRR1, MADDSQ_EC_ED_DAU_DBU_N, Maddq, RRR1),
+    OP2(OP1_x43_RRR1, MADDRQ_DC_DD_DAL_DBL_N, Maddrq, RRR1),
+    OP2(OP1_x43_RRR1, MADDRQ_DC_DD_DAU_DBU_N, Maddrq, RRR1),
+    OP2(OP1_x43_RRR1, MADDRSQ_DC_DD_DAL_DBL_N, Maddrq, RRR1),
+    OP2(OP1_x43_RRR1, MADDRSQ_DC_DD_DAU_DBU_N, Maddrq, RRR1),
+    OP2(OP1_x43_RRR1, MADDRH_DC_ED_DA_DBUL_N, MaddrhSh, RRR1),
+    OP2(OP1_x43_RRR1, MADDRSH_DC_ED_DA_DBUL_N, MaddrhSh, RRR1),
+    OP2(OP1_x45_ABS, LDQ_DA_OFF18, Ldq, ABS),
+    OP2(OP1_x47_BIT, ANDANDT_DC_DA_POS1_DB_POS2, AndAndnNorOrT, BIT),
+    OP2(OP1_x47_BIT, ANDANDNT_DC_DA_POS1_DB_POS2, AndAndnNorOrT, BIT),
+    OP2(OP1_x47_BIT, ANDNORT_DC_DA_POS1_DB_POS2, AndAndnNorOrT, BIT),
+    OP2(OP1_x47_BIT, ANDORT_DC_DA_POS1_DB_POS2, AndAndnNorOrT, BIT),
+    OP2_SINCE(OP1_x49_BO, CMPSWAPW_AB_OFF10_EA, Cmpswap, BO, TC16),
+    OP2_SINCE(OP1_x49_BO, CMPSWAPW_AB_OFF10_EA_PREINC, Cmpswap, BO, TC16),
+    OP2_SINCE(OP1_x49_BO, CMPSWAPW_AB_OFF10_EA_POSTINC, Cmpswap, BO, TC16),
+    OP2(OP1_x49_BO, LDLCX_AB_OFF10, Ldlcx, BO),
+    OP2(OP1_x49_BO, LDMST_AB_OFF10_EA, Ldmst, BO),
+    OP2(OP1_x49_BO, LDMST_AB_OFF10_EA_POSTINC, Ldmst, BO),
+    OP2(OP1_x49_BO, LDMST_AB_OFF10_EA_PREINC, Ldmst, BO),
+    OP2(OP1_x49_BO, LDUCX_AB_OFF10, Lducx, BO),
+    OP2(OP1_x49_BO, LEA_AA_AB_OFF10, Lea, BO),
+    OP2(OP1_x49_BO, STLCX_AB_OFF10, Stlcx, BO),
+    OP2(OP1_x49_BO, STUCX_AB_OFF10, Stucx, BO),
+    OP2(OP1_x49_BO, SWAPW_AB_OFF10_DA, Swapw, BO),
+    OP2(OP1_x49_BO, SWAPW_AB_OFF10_DA_POSTINC, Swapw, BO),
+    OP2(OP1_x49_BO, SWAPW_AB_OFF10_DA_PREINC, Swapw, BO),
+    OP2(OP1_x4B_RR, BMERGE_DC_DA_DB, Bmerge, RR),
+    OP2(OP1_x4B_RR, BSPLIT_EC_DA, Bsplit, RR),
+    OP2_SINCE(OP1_x4B_RR, CRC32_DC_DB_DA, Crc32, RR, TC16),
+    OP2(OP1_x4B_RR, DVINITB_EC_DA_DB, Dvinit, RR),
+    OP2(OP1_x4B_RR, DVINITBU_EC_DA_DB, Dvinit, RR),
+    OP2(OP1_x4B_RR, DVINITH_EC_DA_DB, Dvinit, RR),
+    OP2(OP1_x4B_RR, DVINITHU_EC_DA_DB, Dvinit, RR),
+    OP2(OP1_x4B_RR, DVINIT_EC_DA_DB, Dvinit, RR),
+    OP2(OP1_x4B_RR, DVINITU_EC_DA_DB, Dvinit, RR),
+    OP2_SINCE(OP1_x4B_RR, DIV_EC_DA_DB, Div, RR, TC16),
+    OP2_SINCE(OP1_x4B_RR, DIVU_EC_DA_DB, Div, RR, TC16),
+    OP2(OP1_x4B_RR, PARITY_DC_DA, Parity, RR),
+    OP2(OP1_x4B_RR, UNPACK_EC_DA, Unpack, RR),
+    OP2(OP1_x4B_RR, CMPF_DC_DA_DB, Cmpf, RR),
+    OP2(OP1_x4B_RR, DIVF_DC_DA_DB, Divf, RR),
+    OP2(OP1_x4B_RR, FTOI_DC_DA, Ftoi, RR),
+    OP2(OP1_x4B_RR, FTOIZ_DC_DA, Ftoiz, RR),
+    OP2(OP1_x4B_RR, FTOQ31_DC_DA_DB, Ftoq31, RR),
+    OP2(OP1_x4B_RR, FTOQ31Z_DC_DA_DB, Ftoq31z, RR),
+    OP2(OP1_x4B_RR, FTOU_DC_DA, Ftou, RR),
+    OP2(OP1_x4B_RR, FTOUZ_DC_DA, Ftouz, RR),
+    OP2(OP1_x4B_RR, ITOF_DC_DA, Itof, RR),
+    OP2(OP1_x4B_RR, MULF_DC_DA_DB, Mulf, RR),
+    OP2(OP1_x4B_RR, Q31TOF_DC_DA_DB, Q31tof, RR),
+    OP2(OP1_x4B_RR, QSEEDF_DC_DA, Qseedf, RR),
+    OP2(OP1_x4B_RR, UPDFL_DA, Updfl, RR),
+    OP2(OP1_x4B_RR, UTOF_DC_DA, Utof, RR),
+    OP2(OP1_x53_RC, MUL_DC_DA_CONST9, Mul, RC),
+    OP2(OP1_x53_RC, MUL_EC_DA_CONST9, Mul, RC),
+    OP2(OP1_x53_RC, MULS_DC_DA_CONST9, Mul, RC),
+    OP2(OP1_x53_RC, MULU_EC_DA_CONST9, Mulu, RC),
+    OP2(OP1_x53_RC, MULSU_DC_DA_CONST9, Mulu, RC),
+    OP2(OP1_x57_RRRW, EXTR_DC_DA_DD_WIDTH, Extr, RRRW),
+    OP2(OP1_x57_RRRW, EXTRU_DC_DA_DD_WIDTH, Extr, RRRW),
+    OP2(OP1_x57_RRRW, IMASK_EC_DB_DD_WIDTH, Imask, RRRW),
+    OP2(OP1_x57_RRRW, INSERT_DC_DA_DB_DD_WIDTH, Insert, RRRW),
+    OP2(OP1_x5F_BRR, JEQ_DA_DB_DISP15, Jeq, BRR),
+    OP2(OP1_x5F_BRR, JNE_DA_DB_DISP15, Jne, BRR),
+    OP2(OP1_x63_RRR1, MSUBQ_DC_DD_DA_DB_N, Msubq, RRR1),
+    OP2(OP1_x63_RRR1, MSUBQ_EC_ED_DA_DB_N, Msubq, RRR1),
+    OP2(OP1_x63_RRR1, MSUBQ_DC_DD_DA_DBL_N, Msubq, RRR1),
+    OP2(OP1_x63_RRR1, MSUBQ_EC_ED_DA_DBL_N, Msubq, RRR1),
+    OP2(OP1_x63_RRR1, MSUBQ_DC_DD_DA_DBU_N, Msubq, RRR1),
+    OP2(OP1_x63_RRR1, MSUBQ_EC_ED_DA_DBU_N, Msubq, RRR1),
+    OP2(OP1_x63_RRR1, MSUBQ_DC_DD_DAL_DBL_N, Msubq, RRR1),
+    OP2(OP1_x63_RRR1, MSUBQ_EC_ED_DAL_DBL_N, Msubq, RRR1),
+    OP2(OP1_x63_RRR1, MSUBQ_DC_DD_DAU_DBU_N, Msubq, RRR1),
+    OP2(OP1_x63_RRR1, MSUBQ_EC_ED_DAU_DBU_N, Msubq, RRR1),
+    OP2(OP1_x63_RRR1, MSUBSQ_DC_DD_DA_DB_N, Msubq, RRR1),
+    OP2(OP1_x63_RRR1, MSUBSQ_EC_ED_DA_DB_N, Msubq, RRR1),
+    OP2(OP1_x63_RRR1, MSUBSQ_DC_DD_DA_DBL_N, Msubq, RRR1),
+    OP2(OP1_x63_RRR1, MSUBSQ_EC_ED_DA_DBL_N, Msubq, RRR1),
+    OP2(OP1_x63_RRR1, MSUBSQ_DC_DD_DA_DBU_N, Msubq, RRR1),
+    OP2(OP1_x63_RRR1, MSUBSQ_EC_ED_DA_DBU_N, Msubq, RRR1),
+    OP2(OP1_x63_RRR1, MSUBSQ_DC_DD_DAL_DBL_N, Msubq, RRR1),
+    OP2(OP1_x63_RRR1, MSUBSQ_EC_ED_DAL_DBL_N, Msubq, RRR1),
+    OP2(OP1_x63_RRR1, MSUBSQ_DC_DD_DAU_DBU_N, Msubq, RRR1),
+    OP2(OP1_x63_RRR1, MSUBSQ_EC_ED_DAU_DBU_N, Msubq, RRR1),
+    OP2(OP1_x63_RRR1, MSUBRH_DC_ED_DA_DBUL_N, MsubrhSh, RRR1),
+    OP2(OP1_x63_RRR1, MSUBRSH_DC_ED_DA_DBUL_N, MsubrhSh, RRR1),
+    OP2(OP1_x63_RRR1, MSUBRQ_DC_DD_DAL_DBL_N, Msubrq, RRR1),
+    OP2(OP1_x63_RRR1, MSUBRQ_DC_DD_DAU_DBU_N, Msubrq, RRR1),
+    OP2(OP1_x63_RRR1, MSUBRSQ_DC_DD_DAL_DBL_N, Msubrq, RRR1),
+    OP2(OP1_x63_RRR1, MSUBRSQ_DC_DD_DAU_DBU_N, Msubrq, RRR1),
+    OP2(OP1_x65_ABS, STQ_OFF18_DA, Stq, ABS),
+    OP2(OP1_x67_BIT, INST_DC_DA_POS1_DB_POS2, InstNt, BIT),
+    OP2(OP1_x67_BIT, INSNT_DC_DA_POS1_DB_POS2, InstNt, BIT),
+    OP2_SINCE(OP1_x69_BO, CMPSWAPW_PB_EA, Cmpswap, BO, TC16),
+    OP2_SINCE(OP1_x69_BO, CMPSWAPW_PB_OFF10_EA, Cmpswap, BO, TC16),
+    OP2(OP1_x69_BO, LDMST_PB_EA, Ldmst, BO),
+    OP2(OP1_x69_BO, LDMST_PB_OFF10_EA, Ldmst, BO),
+    OP2(OP1_x69_BO, SWAPW_PB_DA, Swapw, BO),
+    OP2(OP1_x69_BO, SWAPW_PB_OFF10_DA, Swapw, BO),
+    OP2(OP1_x6B_RRR, DVADJ_EC_ED_DB, Dvadj, RRR),
+    OP2(OP1_x6B_RRR, DVSTEP_EC_ED_DB, Dvstep, RRR),
+    OP2(OP1_x6B_RRR, DVSTEPU_EC_ED_DB, Dvstep, RRR),
+    OP2(OP1_x6B_RRR, IXMAX_EC_ED_DB, Ixmax, RRR),
+    OP2(OP1_x6B_RRR, IXMAXU_EC_ED_DB, Ixmax, RRR),
+    OP2(OP1_x6B_RRR, IXMIN_EC_ED_DB, Ixmin, RRR),
+    OP2(OP1_x6B_RRR, IXMINU_EC_ED_DB, Ixmin, RRR),
+    OP2(OP1_x6B_RRR, PACK_DC_ED_DA, Pack, RRR),
+    OP2(OP1_x6B_RRR, ADDF_DC_DD_DA, Addf, RRR),
+    OP2(OP1_x6B_RRR, MADDF_DC_DD_DA_DB, Maddf, RRR),
+    OP2(OP1_x6B_RRR, MSUBF_DC_DD_DA_DB, Msubf, RRR),
+    OP2(OP1_x6B_RRR, SUBF_DC_DD_DA, Subf, RRR),
+    OP2(OP1_x73_RR2, MUL_DC_DA_DB, Mul, RR2),
+    OP2(OP1_x73_RR2, MUL_EC_DA_DB, Mul, RR2),
+    OP2(OP1_x73_RR2, MULS_DC_DA_DB, Mul, RR2),
+    OP2(OP1_x73_RR2, MULU_EC_DA_DB, Mulu, RR2),
+    OP2(OP1_x73_RR2, MULSU_DC_DA_DB, Mulu, RR2),
+    OP2(OP1_x75_RR, TLBDEMAP_DA, Tlbdemap, RR),
+    OP2(OP1_x75_RR, TLBFLUSHA, Tlbflush, RR),
+    OP2(OP1_x75_RR, TLBFLUSHB, Tlbflush, RR),
+    OP2(OP1_x75_RR, TLBMAP_EA, Tlbmap, RR),
+    OP2(OP1_x75_RR, TLBPROBEA_DA, Tlbprobea, RR),
+    OP2(OP1_x75_RR, TLBPROBEI_DA, Tlbprobei, RR),
+    OP2(OP1_x77_RRPW, DEXTR_DC_DA_DB_POS, Dextr, RRPW),
+    OP2(OP1_x7D_BRR, JEQA_AA_AB_DISP15, Jeqa, BRR),
+    OP2(OP1_x7D_BRR, JNEA_AA_AB_DISP15, Jnea, BRR),
+    OP2(OP1_x7F_BRR, JGE_DA_DB_DISP15, Jge, BRR),
+    OP2(OP1_x7F_BRR, JGEU_DA_DB_DISP15, Jge, BRR),
+    OP2(OP1_x83_RRR1, MADDH_EC_ED_DA_DBLL_N, Maddh, RRR1),
+    OP2(OP1_x83_RRR1, MADDH_EC_ED_DA_DBLU_N, Maddh, RRR1),
+    OP2(OP1_x83_RRR1, MADDH_EC_ED_DA_DBUL_N, Maddh, RRR1),
+    OP2(OP1_x83_RRR1, MADDH_EC_ED_DA_DBUU_N, Maddh, RRR1),
+    OP2(OP1_x83_RRR1, MADDSH_EC_ED_DA_DBLL_N, Maddh, RRR1),
+    OP2(OP1_x83_RRR1, MADDSH_EC_ED_DA_DBLU_N, Maddh, RRR1),
+    OP2(OP1_x83_RRR1, MADDSH_EC_ED_DA_DBUL_N, Maddh, RRR1),
+    OP2(OP1_x83_RRR1, MADDSH_EC_ED_DA_DBUU_N, Maddh, RRR1),
+    OP2(OP1_x83_RRR1, MADDMH_EC_ED_DA_DBLL_N, MaddmhSh, RRR1),
+    OP2(OP1_x83_RRR1, MADDMH_EC_ED_DA_DBLU_N, MaddmhSh, RRR1),
+    OP2(OP1_x83_RRR1, MADDMH_EC_ED_DA_DBUL_N, MaddmhSh, RRR1),
+    OP2(OP1_x83_RRR1, MADDMH_EC_ED_DA_DBUU_N, MaddmhSh, RRR1),
+    OP2(OP1_x83_RRR1, MADDMSH_EC_ED_DA_DBLL_N, MaddmhSh, RRR1),
+    OP2(OP1_x83_RRR1, MADDMSH_EC_ED_DA_DBLU_N, MaddmhSh, RRR1),
+    OP2(OP1_x83_RRR1, MADDMSH_EC_ED_DA_DBUL_N, MaddmhSh, RRR1),
+    OP2(OP1_x83_RRR1, MADDMSH_EC_ED_DA_DBUU_N, MaddmhSh, RRR1),
+    OP2(OP1_x83_RRR1, MADDRH_DC_DD_DA_DBLL_N, MaddrhSh, RRR1),
+    OP2(OP1_x83_RRR1, MADDRH_DC_DD_DA_DBLU_N, MaddrhSh, RRR1),
+    OP2(OP1_x83_RRR1, MADDRH_DC_DD_DA_DBUL_N, MaddrhSh, RRR1),
+    OP2(OP1_x83_RRR1, MADDRSH_DC_DD_DA_DBUU_N, MaddrhSh, RRR1),
+    OP2(OP1_x83_RRR1, MADDRH_DC_DD_DA_DBUU_N, MaddrhSh, RRR1),
+    OP2(OP1_x83_RRR1, MADDRSH_DC_DD_DA_DBLL_N, MaddrhSh, RRR1),
+    OP2(OP1_x83_RRR1, MADDRSH_DC_DD_DA_DBLU_N, MaddrhSh, RRR1),
+    OP2(OP1_x83_RRR1, MADDRSH_DC_DD_DA_DBUL_N, MaddrhSh, RRR1),
+    OP2(OP1_x85_ABS, LDA_AA_OFF18, Lda, ABS),
+    OP2(OP1_x85_ABS, LDD_EA_OFF18, Ldd, ABS),
+    OP2(OP1_x85_ABS, LDDA_PA_OFF18, Ldda, ABS),
+    OP2(OP1_x85_ABS, LDW_DA_OFF18, Ldw, ABS),
+    OP2(OP1_x87_BIT, ANDT_DC_DA_POS1_DB_POS2, Andt, BIT),
+    OP2(OP1_x87_BIT, ANDNT_DC_DA_POS1_DB_POS2, Andnt, BIT),
+    OP2(OP1_x87_BIT, NORT_DC_DA_POS1_DB_POS2, Nort, BIT),
+    OP2(OP1_x87_BIT, ORT_DC_DA_POS1_DB_POS2, Ort, BIT),
+    OP2(OP1_x89_BO, CACHEAI_AB_OFF10, Cacheai, BO),
+    OP2(OP1_x89_BO, CACHEAI_AB_OFF10_POSTINC, Cacheai, BO),
+    OP2(OP1_x89_BO, CACHEAI_AB_OFF10_PREINC, Cacheai, BO),
+    OP2(OP1_x89_BO, CACHEAW_AB_OFF10, Cacheaw, BO),
+    OP2(OP1_x89_BO, CACHEAW_AB_OFF10_POSTINC, Cacheaw, BO),
+    OP2(OP1_x89_BO, CACHEAW_AB_OFF10_PREINC, Cacheaw, BO),
+    OP2(OP1_x89_BO, CACHEAWI_AB_OFF10, Cacheawi, BO),
+    OP2(OP1_x89_BO, CACHEAWI_AB_OFF10_POSTINC, Cacheawi, BO),
+    OP2(OP1_x89_BO, CACHEAWI_AB_OFF10_PREINC, Cacheawi, BO),
+    OP2_SINCE(OP1_x89_BO, CACHEII_AB_OFF10, Cacheii, BO, TC16),
+    OP2_SINCE(OP1_x89_BO, CACHEII_AB_OFF10_POSTINC, Cacheii, BO, TC16),
+    OP2_SINCE(OP1_x89_BO, CACHEII_AB_OFF10_PREINC, Cacheii, BO, TC16),
+    OP2(OP1_x89_BO, CACHEIW_AB_OFF10, Cacheiw, BO),
+    OP2(OP1_x89_BO, CACHEIW_AB_OFF10_POSTINC, Cacheiw, BO),
+    OP2(OP1_x89_BO, CACHEIW_AB_OFF10_PREINC, Cacheiw, BO),
+    OP2(OP1_x89_BO, CACHEIWI_AB_OFF10, Cacheiwi, BO),
+    OP2(OP1_x89_BO, CACHEIWI_AB_OFF10_POSTINC, Cacheiwi, BO),
+    OP2(OP1_x89_BO, CACHEIWI_AB_OFF10_PREINC, Cacheiwi, BO),
+    OP2(OP1_x89_BO, STA_AB_OFF10_AA, Sta, BO),
+    OP2(OP1_x89_BO, STA_AB_OFF10_AA_POSTINC, Sta, BO),
+    OP2(OP1_x89_BO, STA_AB_OFF10_AA_PREINC, Sta, BO),
+    OP2(OP1_x89_BO, STB_AB_OFF10_DA, Stb, BO),
+    OP2(OP1_x89_BO, STB_AB_OFF10_DA_POSTINC, Stb, BO),
+    OP2(OP1_x89_BO, STB_AB_OFF10_DA_PREINC, Stb, BO),
+    OP2(OP1_x89_BO, STD_AB_OFF10_EA, Std, BO),
+    OP2(OP1_x89_BO, STD_AB_OFF10_EA_POSTINC, Std, BO),
+    OP2(OP1_x89_BO, STD_AB_OFF10_EA_PREINC, Std, BO),
+    OP2(OP1_x89_BO, STDA_AB_OFF10_PA, Stda, BO),
+    OP2(OP1_x89_BO, STDA_AB_OFF10_PA_POSTINC, Stda, BO),
+    OP2(OP1_x89_BO, STDA_AB_OFF10_PA_PREINC, Stda, BO),
+    OP2(OP1_x89_BO, STH_AB_OFF10_DA, Sth, BO),
+    OP2(OP1_x89_BO, STH_AB_OFF10_DA_POSTINC, Sth, BO),
+    OP2(OP1_x89_BO, STH_AB_OFF10_DA_PREINC, Sth, BO),
+    OP2(OP1_x89_BO, STQ_AB_OFF10_DA, Stq, BO),
+    OP2(OP1_x89_BO, STQ_AB_OFF10_DA_POSTINC, Stq, BO),
+    OP2(OP1_x89_BO, STQ_AB_OFF10_DA_PREINC, Stq, BO),
+    OP2(OP1_x89_BO, STW_AB_OFF10_DA, Stw, BO),
+    OP2(OP1_x89_BO, STW_AB_OFF10_DA_POSTINC, Stw, BO),
+    OP2(OP1_x89_BO, STW_AB_OFF10_DA_PREINC, Stw, BO),
+    OP2(OP1_x8B_RC, ABSDIF_DC_DA_CONST9, Absdifsh, RC),
+    OP2(OP1_x8B_RC, ABSDIFS_DC_DA_CONST9, Absdifs, RC),
+    OP2(OP1_x8B_RC, ADD_DC_DA_CONST9, Add, RC),
+    OP2(OP1_x8B_RC, ADDC_DC_DA_CONST9, Addc, RC),
+    OP2(OP1_x8B_RC, ADDS_DC_DA_CONST9, Adds, RC),
+    OP2(OP1_x8B_RC, ADDSU_DC_DA_CONST9, Addsu, RC),
+    OP2(OP1_x8B_RC, ADDX_DC_DA_CONST9, Addx, RC),
+    OP2(OP1_x8B_RC, ANDEQ_DC_DA_CONST9, Andeq, RC),
+    OP2(OP1_x8B_RC, ANDGE_DC_DA_CONST9, AndgeGeU, RC),
+    OP2(OP1_x8B_RC, ANDGEU_DC_DA_CONST9, AndgeGeU, RC),
+    OP2(OP1_x8B_RC, ANDLT_DC_DA_CONST9, AndltLtU, RC),
+    OP2(OP1_x8B_RC, ANDLTU_DC_DA_CONST9, AndltLtU, RC),
+    OP2(OP1_x8B_RC, ANDNE_DC_DA_CONST9, Andne, RC),
+    OP2(OP1_x8B_RC, EQ_DC_DA_CONST9, Eq, RC),
+    OP2(OP1_x8B_RC, EQANYB_DC_DA_CONST9, Eqanybh, RC),
+    OP2(OP1_x8B_RC, EQANYH_DC_DA_CONST9, Eqanybh, RC),
+    OP2(OP1_x8B_RC, GE_DC_DA_CONST9, Ge, RC),
+    OP2(OP1_x8B_RC, GEU_DC_DA_CONST9, Ge, RC),
+    OP2(OP1_x8B_RC, LT_DC_DA_CONST9, Lt, RC),
+    OP2(OP1_x8B_RC, LTU_DC_DA_CONST9, Lt, RC),
+    OP2(OP1_x8B_RC, MAX_DC_DA_CONST9, Max, RC),
+    OP2(OP1_x8B_RC, MAXU_DC_DA_CONST9, Max, RC),
+    OP2(OP1_x8B_RC, MIN_DC_DA_CONST9, Min, RC),
+    OP2(OP1_x8B_RC, MINU_DC_DA_CONST9, Min, RC),
+    OP2(OP1_x8B_RC, NE_DC_DA_CONST9, Ne, RC),
+    OP2(OP1_x8B_RC, OREQ_DC_DA_CONST9, Oreq, RC),
+    OP2(OP1_x8B_RC, ORGE_DC_DA_CONST9, OrgeGeu, RC),
+    OP2(OP1_x8B_RC, ORGEU_DC_DA_CONST9, OrgeGeu, RC),
+    OP2(OP1_x8B_RC, ORLT_DC_DA_CONST9, OrltLtu, RC),
+    OP2(OP1_x8B_RC, ORLTU_DC_DA_CONST9, OrltLtu, RC),
+    OP2(OP1_x8B_RC, ORNE_DC_DA_CONST9, Orne, RC),
+    OP2(OP1_x8B_RC, RSUB_DC_DA_CONST9, Rsub, RC),
+    OP2(OP1_x8B_RC, RSUBS_DC_DA_CONST9, Rsubs, RC),
+    OP2(OP1_x8B_RC, RSUBSU_DC_DA_CONST9, Rsubs, RC),
+    OP2(OP1_x8B_RC, SHEQ_DC_DA_CONST9, Sheq, RC),
+    OP2(OP1_x8B_RC, SHGE_DC_DA_CONST9, ShgeGeu, RC),
+    OP2(OP1_x8B_RC, SHGEU_DC_DA_CONST9, ShgeGeu, RC),
+    OP2(OP1_x8B_RC, SHLT_DC_DA_CONST9, ShltLtu, RC),
+    OP2(OP1_x8B_RC, SHLTU_DC_DA_CONST9, ShltLtu, RC),
+    OP2(OP1_x8B_RC, SHNE_DC_DA_CONST9, Shne, RC),
+    OP2(OP1_x8B_RC, XOREQ_DC_DA_CONST9, Xoreq, RC),
+    OP2(OP1_x8B_RC, XORGE_DC_DA_CONST9, Xorge, RC),
+    OP2(OP1_x8B_RC, XORGEU_DC_DA_CONST9, Xorge, RC),
+    OP2(OP1_x8B_RC, XORLT_DC_DA_CONST9, Xorlt, RC),
+    OP2(OP1_x8B_RC, XORLTU_DC_DA_CONST9, Xorlt, RC),
+    OP2(OP1_x8B_RC, XORNE_DC_DA_CONST9, Xorne, RC),
+    OP2(OP1_x8F_RC, AND_DC_DA_CONST9, And, RC),
+    OP2(OP1_x8F_RC, ANDN_DC_DA_CONST9, Andn, RC),
+    OP2(OP1_x8F_RC, NAND_DC_DA_CONST9, Nand, RC),
+    OP2(OP1_x8F_RC, NOR_DC_DA_CONST9, Nor, RC),
+    OP2(OP1_x8F_RC, OR_DC_DA_CONST9, Or, RC),
+    OP2(OP1_x8F_RC, ORN_DC_DA_CONST9, Orn, RC),
+    OP2(OP1_x8F_RC, SH_DC_DA_CONST9, Sh, RC),
+    OP2(OP1_x8F_RC, SHH_DC_DA_CONST9, Shh, RC),
+    OP2(OP1_x8F_RC, SHA_DC_DA_CONST9, Sha, RC),
+    OP2(OP1_x8F_RC, SHAH_DC_DA_CONST9, Shah, RC),
+    OP2(OP1_x8F_RC, SHAS_DC_DA_CONST9, Shas, RC),
+    OP2(OP1_x8F_RC, XNOR_DC_DA_CONST9, Xnor, RC),
+    OP2(OP1_x8F_RC, XOR_DC_DA_CONST9, Xor, RC),
+    OP2(OP1_x93_RR1, MULQ_DC_DA_DB_N, Mulq, RR1),
+    OP2(OP1_x93_RR1, MULQ_EC_DA_DB_N, Mulq, RR1),
+    OP2(OP1_x93_RR1, MULQ_DC_DA_DBL_N, Mulq, RR1),
+    OP2(OP1_x93_RR1, MULQ_EC_DA_DBL_N, Mulq, RR1),
+    OP2(OP1_x93_RR1, MULQ_DC_DA_DBU_N, Mulq, RR1),
+    OP2(OP1_x93_RR1, MULQ_EC_DA_DBU_N, Mulq, RR1),
+    OP2(OP1_x93_RR1, MULQ_DC_DAL_DBL_N, Mulq, RR1),
+    OP2(OP1_x93_RR1, MULQ_DC_DAU_DBU_N, Mulq, RR1),
+    OP2(OP1_x93_RR1, MULRQ_DC_DAL_DBL_N, Mulrq, RR1),
+    OP2(OP1_x93_RR1, MULRQ_DC_DAU_DBU_N, Mulrq, RR1),
+    OP2(OP1_x97_RCRR, INSERT_DC_DA_CONST4_ED, Insert, RCRR),
+    OP2(OP1_x9F_BRC, JNED_DA_CONST4_DISP15, Jned, BRC),
+    OP2(OP1_x9F_BRC, JNEI_DA_CONST4_DISP15, Jnei, BRC),
+    OP2(OP1_xA3_RRR1, MSUBH_EC_ED_DA_DBLL_N, Msubh, RRR1),
+    OP2(OP1_xA3_RRR1, MSUBH_EC_ED_DA_DBLU_N, Msubh, RRR1),
+    OP2(OP1_xA3_RRR1, MSUBH_EC_ED_DA_DBUL_N, Msubh, RRR1),
+    OP2(OP1_xA3_RRR1, MSUBH_EC_ED_DA_DBUU_N, Msubh, RRR1),
+    OP2(OP1_xA3_RRR1, MSUBSH_EC_ED_DA_DBLL_N, Msubh, RRR1),
+    OP2(OP1_xA3_RRR1, MSUBSH_EC_ED_DA_DBLU_N, Msubh, RRR1),
+    OP2(OP1_xA3_RRR1, MSUBSH_EC_ED_DA_DBUL_N, Msubh, RRR1),
+    OP2(OP1_xA3_RRR1, MSUBSH_EC_ED_DA_DBUU_N, Msubh, RRR1),
+    OP2(OP1_xA3_RRR1, MSUBMH_EC_ED_DA_DBLL_N, MsubmhSh, RRR1),
+    OP2(OP1_xA3_RRR1, MSUBMH_EC_ED_DA_DBLU_N, MsubmhSh, RRR1),
+    OP2(OP1_xA3_RRR1, MSUBMH_EC_ED_DA_DBUL_N, MsubmhSh, RRR1),
+    OP2(OP1_xA3_RRR1, MSUBMH_EC_ED_DA_DBUU_N, MsubmhSh, RRR1),
+    OP2(OP1_xA3_RRR1, MSUBMSH_EC_ED_DA_DBLL_N, MsubmhSh, RRR1),
+    OP2(OP1_xA3_RRR1, MSUBMSH_EC_ED_DA_DBLU_N, MsubmhSh, RRR1),
+    OP2(OP1_xA3_RRR1, MSUBMSH_EC_ED_DA_DBUL_N, MsubmhSh, RRR1),
+    OP2(OP1_xA3_RRR1, MSUBMSH_EC_ED_DA_DBUU_N, MsubmhSh, RRR1),
+    OP2(OP1_xA3_RRR1, MSUBRH_DC_DD_DA_DBLL_N, MsubrhSh, RRR1),
+    OP2(OP1_xA3_RRR1, MSUBRH_DC_DD_DA_DBLU_N, MsubrhSh, RRR1),
+    OP2(OP1_xA3_RRR1, MSUBRH_DC_DD_DA_DBUL_N, MsubrhSh, RRR1),
+    OP2(OP1_xA3_RRR1, MSUBRH_DC_DD_DA_DBUU_N, MsubrhSh, RRR1),
+    OP2(OP1_xA3_RRR1, MSUBRSH_DC_DD_DA_DBLL_N, MsubrhSh, RRR1),
+    OP2(OP1_xA3_RRR1, MSUBRSH_DC_DD_DA_DBLU_N, MsubrhSh, RRR1),
+    OP2(OP1_xA3_RRR1, MSUBRSH_DC_DD_DA_DBUL_N, MsubrhSh, RRR1),
+    OP2(OP1_xA3_RRR1, MSUBRSH_DC_DD_DA_DBUU_N, MsubrhSh, RRR1),
+    OP2(OP1_xA5_ABS, STA_OFF18_AA, Sta, ABS),
+    OP2(OP1_xA5_ABS, STD_OFF18_EA, Std, ABS),
+    OP2(OP1_xA5_ABS, STDA_OFF18_PA, Stda, ABS),
+    OP2(OP1_xA5_ABS, STW_OFF18_DA, Stw, ABS),
+    OP2(OP1_xA7_BIT, SHNANDT_DC_DA_POS1_DB_POS2, ShAndOrNorXorT, BIT),
+    OP2(OP1_xA7_BIT, SHORNT_DC_DA_POS1_DB_POS2, ShAndOrNorXorT, BIT),
+    OP2(OP1_xA7_BIT, SHXNORT_DC_DA_POS1_DB_POS2, ShAndOrNorXorT, BIT),
+    OP2(OP1_xA7_BIT, SHXORT_DC_DA_POS1_DB_POS2, ShAndOrNorXorT, BIT),
+    OP2(OP1_xA9_BO, CACHEAI_PB, Cacheawi, BO),
+    OP2(OP1_xA9_BO, CACHEAI_PB_OFF10, Cacheawi, BO),
+    OP2(OP1_xA9_BO, CACHEAW_PB, Cacheawi, BO),
+    OP2(OP1_xA9_BO, CACHEAW_PB_OFF10, Cacheawi, BO),
+    OP2(OP1_xA9_BO, CACHEAWI_PB, Cacheawi, BO),
+    OP2(OP1_xA9_BO, CACHEAWI_PB_OFF10, Cacheawi, BO),
+    OP2(OP1_xA9_BO, STA_PB_AA, Sta, BO),
+    OP2(OP1_xA9_BO, STA_PB_OFF10_AA, Sta, BO),
+    OP2(OP1_xA9_BO, STB_PB_DA, Stb, BO),
+    OP2(OP1_xA9_BO, STB_PB_OFF10_DA, Stb, BO),
+    OP2(OP1_xA9_BO, STD_PB_EA, Std, BO),
+    OP2(OP1_xA9_BO, STD_PB_OFF10_EA, Std, BO),
+    OP2(OP1_xA9_BO, STDA_PB_PA, Stda, BO),
+    OP2(OP1_xA9_BO, STDA_PB_OFF10_PA, Stda, BO),
+    OP2(OP1_xA9_BO, STH_PB_DA, Sth, BO),
+    OP2(OP1_xA9_BO, STH_PB_OFF10_DA, Sth, BO),
+    OP2(OP1_xA9_BO, STQ_PB_DA, Stq, BO),
+    OP2(OP1_xA9_BO, STQ_PB_OFF10_DA, Stq, BO),
+    OP2(OP1_xA9_BO, STW_PB_DA, Stw, BO),
+    OP2(OP1_xA9_BO, STW_PB_OFF10_DA, Stw, BO),
+    OP2(OP1_xAB_RCR, CADD_DC_DD_DA_CONST9, Cadd, RCR),
+    OP2(OP1_xAB_RCR, CADDN_DC_DD_DA_CONST9, Caddn, RCR),
+    OP2(OP1_xAB_RCR, SEL_DC_DD_DA_CONST9, Sel, RCR),
+    OP2(OP1_xAB_RCR, SELN_DC_DD_DA_CONST9, Seln, RCR),
+    OP2(OP1_xAD_RC, BISR_CONST9, Bisr, RC),
+    OP2(OP1_xAD_RC, SYSCALL_CONST9, Syscall, RC),
+    OP2(OP1_xB3_RR1, MULH_EC_DA_DBLL_N, Mulh, RR1),
+    OP2(OP1_xB3_RR1, MULH_EC_DA_DBLU_N, Mulh, RR1),
+    OP2(OP1_xB3_RR1, MULH_EC_DA_DBUL_N, Mulh, RR1),
+    OP2(OP1_xB3_RR1, MULH_EC_DA_DBUU_N, Mulh, RR1),
+    OP2(OP1_xB3_RR1, MULMH_EC_DA_DBLL_N, Mulmh, RR1),
+    OP2(OP1_xB3_RR1, MULMH_EC_DA_DBLU_N, Mulmh, RR1),
+    OP2(OP1_xB3_RR1, MULMH_EC_DA_DBUL_N, Mulmh, RR1),
+    OP2(OP1_xB3_RR1, MULMH_EC_DA_DBUU_N, Mulmh, RR1),
+    OP2(OP1_xB3_RR1, MULRH_DC_DA_DBLL_N, Mulrh, RR1),
+    OP2(OP1_xB3_RR1, MULRH_DC_DA_DBLU_N, Mulrh, RR1),
+    OP2(OP1_xB3_RR1, MULRH_DC_DA_DBUL_N, Mulrh, RR1),
+    OP2(OP1_xB3_RR1, MULRH_DC_DA_DBUU_N, Mulrh, RR1),
+    OP2(OP1_xB7_RCPW, IMASK_EC_CONST4_POS_WIDTH, Imask, RCPW),
+    OP2(OP1_xB7_RCPW, INSERT_DC_DA_CONST4_POS_WIDTH, Insert, RCPW),
+    OP2(OP1_xBD_BRR, JNZA_AA_DISP15, Jnza, BRR),
+    OP2(OP1_xBD_BRR, JZA_AA_DISP15, Jza, BRR),
+    OP2(OP1_xBF_BRC, JLT_DA_CONST4_DISP15, Jlt, BRC),
+    OP2(OP1_xBF_BRC, JLTU_DA_CONST4_DISP15, Jlt, BRC),
+    OP2(OP1_xC3_RRR1, MADDSUH_EC_ED_DA_DBLL_N, MaddsuhSh, RRR1),
+    OP2(OP1_xC3_RRR1, MADDSUH_EC_ED_DA_DBLU_N, MaddsuhSh, RRR1),
+    OP2(OP1_xC3_RRR1, MADDSUH_EC_ED_DA_DBUL_N, MaddsuhSh, RRR1),
+    OP2(OP1_xC3_RRR1, MADDSUH_EC_ED_DA_DBUU_N, MaddsuhSh, RRR1),
+    OP2(OP1_xC3_RRR1, MADDSUSH_EC_ED_DA_DBLL_N, MaddsuhSh, RRR1),
+    OP2(OP1_xC3_RRR1, MADDSUSH_EC_ED_DA_DBLU_N, MaddsuhSh, RRR1),
+    OP2(OP1_xC3_RRR1, MADDSUSH_EC_ED_DA_DBUL_N, MaddsuhSh, RRR1),
+    OP2(OP1_xC3_RRR1, MADDSUSH_EC_ED_DA_DBUU_N, MaddsuhSh, RRR1),
+    OP2(OP1_xC3_RRR1, MADDSUMH_EC_ED_DA_DBLL_N, MaddsumhSh, RRR1),
+    OP2(OP1_xC3_RRR1, MADDSUMH_EC_ED_DA_DBLU_N, MaddsumhSh, RRR1),
+    OP2(OP1_xC3_RRR1, MADDSUMH_EC_ED_DA_DBUL_N, MaddsumhSh, RRR1),
+    OP2(OP1_xC3_RRR1, MADDSUMH_EC_ED_DA_DBUU_N, MaddsumhSh, RRR1),
+    OP2(OP1_xC3_RRR1, MADDSUMSH_EC_ED_DA_DBLL_N, MaddsumhSh, RRR1),
+    OP2(OP1_xC3_RRR1, MADDSUMSH_EC_ED_DA_DBLU_N, MaddsumhSh, RRR1),
+    OP2(OP1_xC3_RRR1, MADDSUMSH_EC_ED_DA_DBUL_N, MaddsumhSh, RRR1),
+    OP2(OP1_xC3_RRR1, MADDSUMSH_EC_ED_DA_DBUU_N, MaddsumhSh, RRR1),
+    OP2(OP1_xC3_RRR1, MADDSURH_DC_DD_DA_DBLL_N, MaddsurhSh, RRR1),
+    OP2(OP1_xC3_RRR1, MADDSURH_DC_DD_DA_DBLU_N, MaddsurhSh, RRR1),
+    OP2(OP1_xC3_RRR1, MADDSURH_DC_DD_DA_DBUL_N, MaddsurhSh, RRR1),
+    OP2(OP1_xC3_RRR1, MADDSURH_DC_DD_DA_DBUU_N, MaddsurhSh, RRR1),
+    OP2(OP1_xC3_RRR1, MADDSURSH_DC_DD_DA_DBLL_N, MaddsurhSh, RRR1),
+    OP2(OP1_xC3_RRR1, MADDSURSH_DC_DD_DA_DBLU_N, MaddsurhSh, RRR1),
+    OP2(OP1_xC3_RRR1, MADDSURSH_DC_DD_DA_DBUL_N, MaddsurhSh, RRR1),
+    OP2(OP1_xC3_RRR1, MADDSURSH_DC_DD_DA_DBUU_N, MaddsurhSh, RRR1),
+    OP2(OP1_xC5_ABS, LEA_AA_OFF18, Lea, ABS),
+    OP2(OP1_xC7_BIT, ORANDT_DC_DA_POS1_DB_POS2, OrAndtAndntNortOrt, BIT),
+    OP2(OP1_xC7_BIT, ORANDNT_DC_DA_POS1_DB_POS2, OrAndtAndntNortOrt, BIT),
+    OP2(OP1_xC7_BIT, ORNORT_DC_DA_POS1_DB_POS2, OrAndtAndntNortOrt, BIT),
+    OP2(OP1_xC7_BIT, ORORT_DC_DA_POS1_DB_POS2, OrAndtAndntNortOrt, BIT),
+    OP2(OP1_xD5_ABSB, STT_OFF18_BPOS3_B, Stt, ABSB),
+    OP2(OP1_xD7_RCRW, IMASK_EC_CONST4_POS_WIDTH, Imask, RCRW),
+    OP2(OP1_xD7_RCRW, INSERT_DC_DA_CONST4_DD_WIDTH, Insert, RCRW),
+    OP2(OP1_xDF_BRC, JEQ_DA_CONST4_DISP15, Jeq, BRC),
+    OP2(OP1_xDF_BRC, JNE_DA_CONST4_DISP15, Jne, BRC),
+    OP2(OP1_xE3_RRR1, MSUBADH_EC_ED_DA_DBLL_N, MsubadhSh, RRR1),
+    OP2(OP1_xE3_RRR1, MSUBADH_EC_ED_DA_DBLU_N, MsubadhSh, RRR1),
+    OP2(OP1_xE3_RRR1, MSUBADH_EC_ED_DA_DBUL_N, MsubadhSh, RRR1),
+    OP2(OP1_xE3_RRR1, MSUBADH_EC_ED_DA_DBUU_N, MsubadhSh, RRR1),
+    OP2(OP1_xE3_RRR1, MSUBADSH_EC_ED_DA_DBLL_N, MsubadhSh, RRR1),
+    OP2(OP1_xE3_RRR1, MSUBADSH_EC_ED_DA_DBLU_N, MsubadhSh, RRR1),
+    OP2(OP1_xE3_RRR1, MSUBADSH_EC_ED_DA_DBUL_N, MsubadhSh, RRR1),
+    OP2(OP1_xE3_RRR1, MSUBADSH_EC_ED_DA_DBUU_N, MsubadhSh, RRR1),
+    OP2(OP1_xE3_RRR1, MSUBADMH_EC_ED_DA_DBLL_N, MsubadmhSh, RRR1),
+    OP2(OP1_xE3_RRR1, MSUBADMH_EC_ED_DA_DBLU_N, MsubadmhSh, RRR1),
+    OP2(OP1_xE3_RRR1, MSUBADMH_EC_ED_DA_DBUL_N, MsubadmhSh, RRR1),
+    OP2(OP1_xE3_RRR1, MSUBADMH_EC_ED_DA_DBUU_N, MsubadmhSh, RRR1),
+    OP2(OP1_xE3_RRR1, MSUBADMSH_EC_ED_DA_DBLL_N, MsubadmhSh, RRR1),
+    OP2(OP1_xE3_RRR1, MSUBADMSH_EC_ED_DA_DBLU_N, MsubadmhSh, RRR1),
+    OP2(OP1_xE3_RRR1, MSUBADMSH_EC_ED_DA_DBUL_N, MsubadmhSh, RRR1),
+    OP2(OP1_xE3_RRR1, MSUBADMSH_EC_ED_DA_DBUU_N, MsubadmhSh, RRR1),
+    OP2(OP1_xE3_RRR1, MSUBADRH_DC_DD_DA_DBLL_N, MsubadrhSh, RRR1),
+    OP2(OP1_xE3_RRR1, MSUBADRH_DC_DD_DA_DBLU_N, MsubadrhSh, RRR1),
+    OP2(OP1_xE3_RRR1, MSUBADRH_DC_DD_DA_DBUL_N, MsubadrhSh, RRR1),
+    OP2(OP1_xE3_RRR1, MSUBADRH_DC_DD_DA_DBUU_N, MsubadrhSh, RRR1),
+    OP2(OP1_xE3_RRR1, MSUBADRSH_DC_DD_DA_DBLL_N, MsubadrhSh, RRR1),
+    OP2(OP1_xE3_RRR1, MSUBADRSH_DC_DD_DA_DBLU_N, MsubadrhSh, RRR1),
+    OP2(OP1_xE3_RRR1, MSUBADRSH_DC_DD_DA_DBUL_N, MsubadrhSh, RRR1),
+    OP2(OP1_xE3_RRR1, MSUBADRSH_DC_DD_DA_DBUU_N, MsubadrhSh, RRR1),
+    OP2(OP1_xE5_ABS, LDMST_OFF18_EA, Ldmst, ABS),
+    OP2(OP1_xE5_ABS, SWAPW_OFF18_DA, Swapw, ABS),
+    OP2(OP1_xFD_BRR, LOOP_AB_DISP15, Loop, BRR),
+    OP2(OP1_xFD_BRR, LOOPU_DISP15, Loopu, BRR),
+    OP2(OP1_xFF_BRC, JGE_DA_CONST4_DISP15, Jge, BRC),
+    OP2(OP1_xFF_BRC, JGEU_DA_CONST4_DISP15, Jge, BRC),
+
+    // 16-bit, primary opcode only
+    OP1(ADDSCA_AA_AB_D15_N, Addscaat, SRRS),
+    OP1(ADD_DA_CONST4, Add, SRC),
+    OP1(ADD_DA_D15_CONST4, Add, SRC),
+    OP1(ADD_D15_DA_CONST4, Add, SRC),
+    OP1(ADD_DA_DB, Add, SRR),
+    OP1(ADD_DA_D15_DB, Add, SRR),
+    OP1(ADD_D15_DA_DB, Add, SRR),
+    OP1(ADDA_AA_CONST4, Adda, SRC),
+    OP1(ADDA_AA_AB, Adda, SRR),
+    OP1(ADDS_DA_DB, Adds, SRR),
+    OP1(AND_D15_CONST8, And, SC),
+    OP1(AND_DA_DB, And, SRR),
+    OP1(BISR_CONST8, Bisr, SC),
+    OP1(CADD_DA_D15_CONST4, Cadd, SRC),
+    OP1(CADDN_DA_D15_CONST4, Caddn, SRC),
+    OP1(CMOV_DA_D15_CONST4, Cmov, SRC),
+    OP1(CMOV_DA_D15_DB, Cmov, SRR),
+    OP1(CMOVN_DA_D15_CONST4, Cmovn, SRC),
+    OP1(CMOVN_DA_D15_DB, Cmovn, SRR),
+    OP1(EQ_D15_DA_CONST4, Eq, SRC),
+    OP1(EQ_D15_DA_DB, Eq, SRR),
+    OP1(LDA_A15_A10_CONST8, Lda, SC),
+    OP1(LDA_AC_AB, Lda, SLR),
+    OP1(LDA_AC_AB_POSTINC, Lda, SLR),
+    OP1(LDA_AC_A15_OFF4, Lda, SLRO),
+    OP1(LDA_A15_AB_OFF4, Lda, SRO),
+    OP1(LDBU_DC_AB, Ldb, SLR),
+    OP1(LDBU_DC_AB_POSTINC, Ldb, SLR),
+    OP1(LDBU_DC_A15_OFF4, Ldb, SLRO),
+    OP1(LDBU_D15_AB_OFF4, Ldb, SRO),
+    OP1(LDH_DC_AB, Ldh, SLR),
+    OP1(LDH_DC_AB_POSTINC, Ldh, SLR),
+    OP1(LDH_DC_A15_OFF4, Ldh, SLRO),
+    OP1(LDH_D15_AB_OFF4, Ldh, SRO),
+    OP1(LDW_D15_A10_CONST8, Ldw, SC),
+    OP1(LDW_DC_AB, Ldw, SLR),
+    OP1(LDW_DC_AB_POSTINC, Ldw, SLR),
+    OP1(LDW_DC_A15_OFF4, Ldw, SLRO),
+    OP1(LDW_D15_AB_OFF4, Ldw, SRO),
+    OP1(LT_D15_DA_CONST4, Lt, SRC),
+    OP1(LT_D15_DA_DB, Lt, SRR),
+    OP1(MOV_D15_CONST8, Mov, SC),
+    OP1(MOV_DA_CONST4, Mov, SRC),
+    OP1_SINCE(MOV_EA_CONST4, Mov, SRC, TC16),
+    OP1(MOV_DA_DB, Mov, SRR),
+    OP1(MOVA_AA_CONST4, Mova, SRC),
+    OP1(MOVA_AA_DB, Mova, SRR),
+    OP1(MOVAA_AA_AB, Movaa, SRR),
+    OP1(MOVD_DA_AB, Movd, SRR),
+    OP1(MUL_DA_DB, Mul, SRR),
+    OP1(OR_D15_CONST8, Or, SC),
+    OP1(OR_DA_DB, Or, SRR),
+    OP1(SH_DA_CONST4, Sh, SRC),
+    OP1(SHA_DA_CONST4, Sha, SRC),
+    OP1(STA_A10_CONST8_A15, Sta, SC),
+    OP1(STA_AB_OFF4_A15, Sta, SRO),
+    OP1(STA_AB_AA, Sta, SSR),
+    OP1(STA_AB_AA_POSTINC, Sta, SSR),
+    OP1(STA_A15_OFF4_AA, Sta, SSRO),
+    OP1(STB_AB_OFF4_D15, Stb, SRO),
+    OP1(STB_AB_DA, Stb, SSR),
+    OP1(STB_AB_DA_POSTINC, Stb, SSR),
+    OP1(STB_A15_OFF4_DA, Stb, SSRO),
+    OP1(STH_AB_OFF4_D15, Sth, SRO),
+    OP1(STH_AB_DA, Sth, SSR),
+    OP1(STH_AB_DA_POSTINC, Sth, SSR),
+    OP1(STH_A15_OFF4_DA, Sth, SSRO),
+    OP1(STW_A10_CONST8_D15, Stw, SC),
+    OP1(STW_AB_OFF4_D15, Stw, SRO),
+    OP1(STW_AB_DA, Stw, SSR),
+    OP1(STW_AB_DA_POSTINC, Stw, SSR),
+    OP1(STW_A15_OFF4_DA, Stw, SSRO),
+    OP1(SUB_DA_DB, Sub, SRR),
+    OP1(SUB_DA_D15_DB, Sub, SRR),
+    OP1(SUB_D15_DA_DB, Sub, SRR),
+    OP1(SUBA_A10_CONST8, Suba, SC),
+    OP1(SUBS_DA_DB, Subsu, SRR),
+    OP1(XOR_DA_DB, Xor, SRR),
+    OP1(CALL_DISP8, Call, SB),
+    OP1(J_DISP8, J, SB),
+    OP1(JEQ_D15_CONST4_DISP4, Jeq, SBC),
+    OP1(JEQ_D15_DB_DISP4, Jeq, SBR),
+    OP1_SINCE(JEQ_D15_CONST4_DISP4_EX, Jeq, SBC, TC16),
+    OP1_SINCE(JEQ_D15_DB_DISP4_EX, Jeq, SBR, TC16),
+    OP1(JGEZ_DB_DISP4, Jgez, SBR),
+    OP1(JGTZ_DB_DISP4, Jgtz, SBR),
+    OP1(JLEZ_DB_DISP4, Jlez, SBR),
+    OP1(JLTZ_DB_DISP4, Jltz, SBR),
+    OP1(JNE_D15_CONST4_DISP4, Jne, SBC),
+    OP1(JNE_D15_DB_DISP4, Jne, SBR),
+    OP1_SINCE(JNE_D15_CONST4_DISP4_EX, Jne, SBC, TC16),
+    OP1_SINCE(JNE_D15_DB_DISP4_EX, Jne, SBR, TC16),
+    OP1(JNZ_D15_DISP8, Jnz, SB),
+    OP1(JNZ_DB_DISP4, Jnz, SBR),
+    OP1(JNZA_AB_DISP4, Jnza, SBR),
+    OP1(JNZT_D15_N_DISP4, Jnzt, SBRN),
+    OP1(JZ_D15_DISP8, Jz, SB),
+    OP1(JZ_DB_DISP4, Jz, SBR),
+    OP1(JZA_AB_DISP4, Jza, SBR),
+    OP1(JZT_D15_N_DISP4, Jzt, SBRN),
+    OP1(LOOP_AB_DISP4, Loop, SBR),
+
+    // 16-bit, primary + secondary opcode
+    OP2(OP1_x00_SR, DEBUG16, Debug, SR),
+    OP2(OP1_x00_SR, NOP16, Nop, SR),
+    OP2(OP1_x00_SR, RET16, Ret, SR),
+    OP2_SINCE(OP1_x00_SR, FRET16, Fret, SR, TC16),
+    OP2(OP1_x00_SR, RFE16, Rfe, SR),
+    OP2(OP1_x46_SR, NOT_DA, Not, SR),
+    OP2(OP1_x32_SR, RSUB_DA, Rsub, SR),
+    OP2(OP1_x32_SR, SATB_DA, Satb, SR),
+    OP2(OP1_x32_SR, SATBU_DA, Satbu, SR),
+    OP2(OP1_x32_SR, SATH_DA, Sath, SR),
+    OP2(OP1_x32_SR, SATHU_DA, Sathu, SR),
+    OP2(OP1_xDC_SR, JI_AA_16, Ji, SR),
+};
+
+#undef OP1
+#undef OP2
+#undef OP1_SINCE
+#undef OP2_SINCE
+
+// Primary opcode table entry. Single-opcode encodings resolve here; dual
+// opcode encodings index kDispatch.secondary with the secondary opcode field.
+struct PrimaryEntry {
+  InstructionId id;
+  Format format;
+  uint8_t op1;    // primary opcode as passed to the handlers
+  uint8_t shift;  // secondary opcode field: (raw >> shift) & mask
+  uint8_t mask;
+  uint8_t count;  // number of secondary entries, 0 for single-opcode
+  uint16_t base;  // first secondary entry
+};
+
+// Location of the secondary opcode field for each format (see
+// Instruction::ExtractSecondaryOpcode). Secondary opcodes are not > 0xFF,
+// even though some formats have up to 12 bits.
+static constexpr void SecondaryField(Format format, uint8_t& shift,
+                                     uint8_t& mask) {
+  switch (format) {
+    case Format::SR:
+      shift = 12;
+      mask = 0xF;
+      break;
+    case Format::RR:
+      shift = 20;
+      mask = 0xFF;
+      break;
+    case Format::RR1:
+      shift = 18;
+      mask = 0xFF;
+      break;
+    case Format::RR2:
+    case Format::RRR2:
+      shift = 16;
+      mask = 0xFF;
+      break;
+    case Format::RRR:
+      shift = 20;
+      mask = 0xF;
+      break;
+    case Format::RRR1:
+      shift = 18;
+      mask = 0x3F;
+      break;
+    case Format::ABS:
+    case Format::ABSB:
+      shift = 26;
+      mask = 0x3;
+      break;
+    case Format::BIT:
+    case Format::RCPW:
+    case Format::RRPW:
+      shift = 21;
+      mask = 0x3;
+      break;
+    case Format::BO:
+    case Format::SYS:
+      shift = 22;
+      mask = 0x3F;
+      break;
+    case Format::RC:
+      shift = 21;
+      mask = 0x7F;
+      break;
+    case Format::RCR:
+    case Format::RCRR:
+    case Format::RCRW:
+    case Format::RRRR:
+    case Format::RRRW:
+      shift = 21;
+      mask = 0x7;
+      break;
+    case Format::BRC:
+    case Format::BRN:
+    case Format::BRR:
+      shift = 31;
+      mask = 0x1;
+      break;
+    default:
+      shift = 0;
+      mask = 0;
+      break;
+  }
+}
+
+// Secondary table space is sized by the largest secondary opcode in use for
+// each primary opcode rather than by the width of the field.
+static constexpr size_t SecondaryTableSize() {
+  size_t size = 0;
+  for (size_t op1 = 0; op1 < 256; op1++) {
+    size_t count = 0;
+    for (const Encoding& e : kEncodings)
+      if (e.op1 == op1 && e.op2 != NO_OP2 && e.op2 + 1u > count)
+        count = e.op2 + 1u;
+    size += count;
+  }
+  return size;
+}
+
+struct DispatchTables {
+  PrimaryEntry primary[256];
+  InstructionId secondary[SecondaryTableSize()];
+  bool valid;  // false if two encodings claim the same opcode
+};
+
+// Tables for the encodings available in the given ISA version
+static constexpr DispatchTables BuildDispatchTables(IsaVersion version) {
+  DispatchTables tables{};
+  tables.valid = true;
+  uint16_t base = 0;
+
+  for (size_t op1 = 0; op1 < 256; op1++) {
+    PrimaryEntry& entry = tables.primary[op1];
+    entry.op1 = op1;
+    entry.base = base;
+    for (const Encoding& e : kEncodings) {
+      if (e.op1 != op1 || e.since > version) continue;
+      if (e.op2 == NO_OP2) {
+        if (entry.id != InstructionId::Invalid || entry.count != 0)
+          tables.valid = false;
+        entry.id = e.id;
+        entry.format = e.format;
+      } else {
+        if (entry.id != InstructionId::Invalid) tables.valid = false;
+        entry.format = e.format;
+        if (e.op2 + 1u > entry.count) entry.count = e.op2 + 1u;
+      }
+    }
+    if (entry.count != 0) {
+      SecondaryField(entry.format, entry.shift, entry.mask);
+      for (const Encoding& e : kEncodings) {
+        if (e.op1 != op1 || e.op2 == NO_OP2 || e.since > version) continue;
+        if (tables.secondary[base + e.op2] != InstructionId::Invalid)
+          tables.valid = false;
+        tables.secondary[base + e.op2] = e.id;
+      }
+      base += entry.count;
+    }
+  }
+
+  // There are two instructions of the BRN format, which has a 7-bit primary
+  // opcode (instead of 8-bit)
+  if (tables.primary[OP1_x6F_BRN | 0x80].format != Format::Invalid)
+    tables.valid = false;
+  tables.primary[OP1_x6F_BRN | 0x80] = tables.primary[OP1_x6F_BRN];
+
+  // The ADDSCA 16-bit instruction is weird and has a smaller primary opcode
+  // (SRRS format)
+  for (size_t op1 = ADDSCA_AA_AB_D15_N + 0x40; op1 < 256; op1 += 0x40) {
+    if (tables.primary[op1].format != Format::Invalid) tables.valid = false;
+    tables.primary[op1] = tables.primary[ADDSCA_AA_AB_D15_N];
+  }
+
+  return tables;
+}
+
+#undef NO_OP2
+
+template <IsaVersion Version>
+static constexpr DispatchTables kDispatch = BuildDispatchTables(Version);
+static_assert(kDispatch<IsaVersion::TC13>.valid &&
+                  kDispatch<IsaVersion::TC16>.valid &&
+                  kDispatch<IsaVersion::TC162>.valid &&
+                  kDispatch<IsaVersion::TC18>.valid,
+              "overlapping encodings in kEncodings");
+
+static void ExtractOperands(DecodedInstruction& insn) {
+  const uint32_t raw = insn.raw;
+
+  switch (insn.format) {
+    case Format::SB:
+      insn.disp = Opfields<Format::SB>::Decode(raw).disp8;
+      break;
+    case Format::SBC: {
+      const auto f = Opfields<Format::SBC>::Decode(raw);
+      insn.disp = f.disp4;
+      insn.imm = f.const4;
+      break;
+    }
+    case Format::SBR: {
+      const auto f = Opfields<Format::SBR>::Decode(raw);
+      insn.disp = f.disp4;
+      insn.s2 = f.s2;
+      break;
+    }
+    case Format::SBRN: {
+      const auto f = Opfields<Format::SBRN>::Decode(raw);
+      insn.disp = f.disp4;
+      insn.n = f.n;
+      break;
+    }
+    case Format::SC:
+      insn.imm = Opfields<Format::SC>::Decode(raw).const8;
+      break;
+    case Format::SLR: {
+      const auto f = Opfields<Format::SLR>::Decode(raw);
+      insn.d = f.d;
+      insn.s2 = f.s2;
+      break;
+    }
+    case Format::SLRO: {
+      const auto f = Opfields<Format::SLRO>::Decode(raw);
+      insn.d = f.d;
+      insn.disp = f.off4;
+      break;
+    }
+    case Format::SR:
+      insn.s1 = insn.d = Opfields<Format::SR>::Decode(raw).s1d;
+      break;
+    case Format::SRC: {
+      const auto f = Opfields<Format::SRC>::Decode(raw);
+      insn.s1 = insn.d = f.s1d;
+      insn.imm = f.const4;
+      break;
+    }
+    case Format::SRO: {
+      const auto f = Opfields<Format::SRO>::Decode(raw);
+      insn.disp = f.off4;
+      insn.s2 = f.s2;
+      break;
+    }
+    case Format::SRR: {
+      const auto f = Opfields<Format::SRR>::Decode(raw);
+      insn.s1 = insn.d = f.s1d;
+      insn.s2 = f.s2;
+      break;
+    }
+    case Format::SRRS: {
+      const auto f = Opfields<Format::SRRS>::Decode(raw);
+      insn.n = f.n;
+      insn.s1 = insn.d = f.s1d;
+      insn.s2 = f.s2;
+      break;
+    }
+    case Format::SSR: {
+      const auto f = Opfields<Format::SSR>::Decode(raw);
+      insn.s1 = f.s1;
+      insn.s2 = f.s2;
+      break;
+    }
+    case Format::SSRO: {
+      const auto f = Opfields<Format::SSRO>::Decode(raw);
+      insn.s1 = f.s1;
+      insn.disp = f.off4;
+      break;
+    }
+    case Format::ABS: {
+      const auto f = Opfields<Format::ABS>::Decode(raw);
+      insn.s1 = insn.d = f.s1d;
+      insn.disp = static_cast<int32_t>(f.ea);
+      break;
+    }
+    case Format::ABSB: {
+      const auto f = Opfields<Format::ABSB>::Decode(raw);
+      insn.imm = f.b;
+      insn.pos1 = f.bpos3;
+      insn.disp = static_cast<int32_t>(f.ea);
+      break;
+    }
+    case Format::B:
+      insn.disp = Opfields<Format::B>::Decode(raw).disp24;
+      break;
+    case Format::BIT: {
+      const auto f = Opfields<Format::BIT>::Decode(raw);
+      insn.s1 = f.s1;
+      insn.s2 = f.s2;
+      insn.pos1 = f.pos1;
+      insn.pos2 = f.pos2;
+      insn.d = f.d;
+      break;
+    }
+    case Format::BO: {
+      const auto f = Opfields<Format::BO>::Decode(raw);
+      insn.s1 = insn.d = f.s1d;
+      insn.s2 = f.s2;
+      insn.disp = f.off10;
+      break;
+    }
+    case Format::BOL: {
+      const auto f = Opfields<Format::BOL>::Decode(raw);
+      insn.s1 = insn.d = f.s1d;
+      insn.s2 = f.s2;
+      insn.disp = f.off16;
+      break;
+    }
+    case Format::BRC: {
+      const auto f = Opfields<Format::BRC>::Decode(raw);
+      insn.s1 = f.s1;
+      insn.imm = f.const4;
+      insn.disp = f.disp15;
+      break;
+    }
+    case Format::BRN: {
+      const auto f = Opfields<Format::BRN>::Decode(raw);
+      insn.n = f.n;
+      insn.s1 = f.s1;
+      insn.disp = f.disp15;
+      break;
+    }
+    case Format::BRR: {
+      const auto f = Opfields<Format::BRR>::Decode(raw);
+      insn.s1 = f.s1;
+      insn.s2 = f.s2;
+      insn.disp = f.disp15;
+      break;
+    }
+    case Format::RC: {
+      const auto f = Opfields<Format::RC>::Decode(raw);
+      insn.s1 = f.s1;
+      insn.d = f.d;
+      insn.imm = f.const9;
+      break;
+    }
+    case Format::RCPW: {
+      const auto f = Opfields<Format::RCPW>::Decode(raw);
+      insn.s1 = f.s1;
+      insn.imm = f.const4;
+      insn.width = f.width;
+      insn.pos1 = f.pos;
+      insn.d = f.d;
+      break;
+    }
+    case Format::RCR: {
+      const auto f = Opfields<Format::RCR>::Decode(raw);
+      insn.s1 = f.s1;
+      insn.imm = f.const9;
+      insn.s3 = f.s3;
+      insn.d = f.d;
+      break;
+    }
+    case Format::RCRR: {
+      const auto f = Opfields<Format::RCRR>::Decode(raw);
+      insn.s1 = f.s1;
+      insn.imm = f.const4;
+      insn.s3 = f.s3;
+      insn.d = f.d;
+      break;
+    }
+    case Format::RCRW: {
+      const auto f = Opfields<Format::RCRW>::Decode(raw);
+      insn.s1 = f.s1;
+      insn.imm = f.const4;
+      insn.width = f.width;
+      insn.s3 = f.s3;
+      insn.d = f.d;
+      break;
+    }
+    case Format::RLC: {
+      const auto f = Opfields<Format::RLC>::Decode(raw);
+      insn.s1 = f.s1;
+      insn.imm = f.const16;
+      insn.d = f.d;
+      break;
+    }
+    case Format::RR: {
+      const auto f = Opfields<Format::RR>::Decode(raw);
+      insn.s1 = f.s1;
+      insn.s2 = f.s2;
+      insn.n = f.n;
+      insn.d = f.d;
+      break;
+    }
+    case Format::RR1: {
+      const auto f = Opfields<Format::RR1>::Decode(raw);
+      insn.s1 = f.s1;
+      insn.s2 = f.s2;
+      insn.n = f.n;
+      insn.d = f.d;
+      break;
+    }
+    case Format::RR2: {
+      const auto f = Opfields<Format::RR2>::Decode(raw);
+      insn.s1 = f.s1;
+      insn.s2 = f.s2;
+      insn.d = f.d;
+      break;
+    }
+    case Format::RRPW: {
+      const auto f = Opfields<Format::RRPW>::Decode(raw);
+      insn.s1 = f.s1;
+      insn.s2 = f.s2;
+      insn.width = f.width;
+      insn.pos1 = f.pos;
+      insn.d = f.d;
+      break;
+    }
+    case Format::RRR: {
+      const auto f = Opfields<Format::RRR>::Decode(raw);
+      insn.s1 = f.s1;
+      insn.s2 = f.s2;
+      insn.n = f.n;
+      insn.s3 = f.s3;
+      insn.d = f.d;
+      break;
+    }
+    case Format::RRR1: {
+      const auto f = Opfields<Format::RRR1>::Decode(raw);
+      insn.s1 = f.s1;
+      insn.s2 = f.s2;
+      insn.n = f.n;
+      insn.s3 = f.s3;
+      insn.d = f.d;
+      break;
+    }
+    case Format::RRR2: {
+      const auto f = Opfields<Format::RRR2>::Decode(raw);
+      insn.s1 = f.s1;
+      insn.s2 = f.s2;
+      insn.s3 = f.s3;
+      insn.d = f.d;
+      break;
+    }
+    case Format::RRRR: {
+      const auto f = Opfields<Format::RRRR>::Decode(raw);
+      insn.s1 = f.s1;
+      insn.s2 = f.s2;
+      insn.s3 = f.s3;
+      insn.d = f.d;
+      break;
+    }
+    case Format::RRRW: {
+      const auto f = Opfields<Format::RRRW>::Decode(raw);
+      insn.s1 = f.s1;
+      insn.s2 = f.s2;
+      insn.width = f.width;
+      insn.s3 = f.s3;
+      insn.d = f.d;
+      break;
+    }
+    case Format::SYS:
+      insn.s1 = insn.d = Opfields<Format::SYS>::Decode(raw).s1d;
+      break;
+    default:
+      break;
+  }
+}
+
+// PC-relative branch target from the decoded displacement
+static uint32_t RelativeTarget(const DecodedInstruction& insn, uint64_t addr) {
+  int64_t offset;
+
+  switch (insn.format) {
+    case Format::SBC:
+    case Format::SBR:
+    case Format::SBRN:
+      if (insn.id == InstructionId::Loop) {
+        // PC = PC + {27'b111111111111111111111111111, disp4, 0};
+        offset = ((insn.disp & 0x0F) << 1) - 32;
+      } else if (insn.op1 == JEQ_D15_CONST4_DISP4_EX ||
+                 insn.op1 == JEQ_D15_DB_DISP4_EX ||
+                 insn.op1 == JNE_D15_CONST4_DISP4_EX ||
+                 insn.op1 == JNE_D15_DB_DISP4_EX) {
+        // TCv1.6 ISA only
+        // PC = PC + zero_ext(disp + 16) * 2;
+        offset = ((insn.disp & 0x0F) + 16) * 2;
+      } else {
+        // PC = PC + zero_ext(disp) * 2;
+        offset = (insn.disp & 0x0F) * 2;
+      }
+      break;
+    default:
+      // PC = PC + sign_ext(disp) * 2;
+      offset = ((int64_t)insn.disp) * 2;
+      break;
+  }
+
+  return (uint32_t)(addr + offset);
+}
+
+// Absolute branch target (CALLA, FCALLA, JA, JLA)
+static uint32_t AbsoluteTarget(const DecodedInstruction& insn) {
+  uint32_t target = 0;
+
+  // PC = {disp24[23:20], 7'b0, disp24[19:0], 1'b0};
+  target |= ((insn.disp & 0xF00000u) << 8);
+  target |= ((insn.disp & 0xFFFFFu) << 1);
+
+  return target;
+}
+
+// Control-flow class of each handler, independent of operands
+static constexpr BranchKind BranchKindOf(InstructionId id) {
+  switch (id) {
+    case InstructionId::Call:
+    case InstructionId::Calla:
+    case InstructionId::Fcall:
+    case InstructionId::Fcalla:
+    case InstructionId::Jl:
+    case InstructionId::Jla:
+      return BranchKind::Call;
+    case InstructionId::Calli:
+    case InstructionId::Fcalli:
+      return BranchKind::Indirect;
+    case InstructionId::J:
+    case InstructionId::Ja:
+    case InstructionId::Loopu:
+      return BranchKind::Unconditional;
+    case InstructionId::Ji:
+    case InstructionId::Jli:
+    case InstructionId::Trapsv:
+    case InstructionId::Trapv:
+      return BranchKind::Unresolved;
+    case InstructionId::Ret:
+    case InstructionId::Rfe:
+    case InstructionId::Rfm:
+    case InstructionId::Fret:
+      return BranchKind::Return;
+    case InstructionId::Jeq:
+    case InstructionId::Jeqa:
+    case InstructionId::Jge:
+    case InstructionId::Jgez:
+    case InstructionId::Jgtz:
+    case InstructionId::Jlez:
+    case InstructionId::Jlt:
+    case InstructionId::Jltz:
+    case InstructionId::Jne:
+    case InstructionId::Jnea:
+    case InstructionId::Jned:
+    case InstructionId::Jnei:
+    case InstructionId::Jnz:
+    case InstructionId::Jnza:
+    case InstructionId::Jnzt:
+    case InstructionId::Jz:
+    case InstructionId::Jza:
+    case InstructionId::Jzt:
+    case InstructionId::Loop:
+      return BranchKind::Conditional;
+    default:
+      return BranchKind::None;
+  }
+}
+
+static void ResolveBranch(uint64_t addr, DecodedInstruction& insn) {
+  insn.branch = BranchKindOf(insn.id);
+
+  switch (insn.branch) {
+    case BranchKind::Call:
+    case BranchKind::Unconditional:
+    case BranchKind::Conditional:
+      if (insn.id == InstructionId::Calla || insn.id == InstructionId::Fcalla ||
+          insn.id == InstructionId::Jla || insn.id == InstructionId::Ja)
+        insn.target = AbsoluteTarget(insn);
+      else
+        insn.target = RelativeTarget(insn, addr);
+      break;
+    case BranchKind::Indirect:
+      insn.target = TRICORE_REG_A0 + insn.s1;
+      break;
+    default:
+      break;
+  }
+}
+
+// Reads the instruction word and looks up its handler and format, without
+// extracting operands
+template <IsaVersion Version>
+static bool Classify(const uint8_t* data, size_t maxLen,
+                     DecodedInstruction& insn) {
+  if (maxLen < 2) return false;
+
+  uint16_t raw16;
+  std::memcpy(&raw16, data, sizeof(raw16));
+  // 32-bit instruction
+  if (raw16 & 0x01u) {
+    if (maxLen < 4) return false;
+    std::memcpy(&insn.raw, data, sizeof(insn.raw));
+    insn.length = 4;
+  }
+  // 16-bit instruction
+  else {
+    insn.raw = raw16;
+    insn.length = 2;
+  }
+
+  const PrimaryEntry& primary = kDispatch<Version>.primary[insn.raw & 0xFFu];
+  insn.op1 = primary.op1;
+  if (primary.count == 0) {
+    insn.op2 = 0xFF;
+    insn.id = primary.id;
+  } else {
+    insn.op2 = (insn.raw >> primary.shift) & primary.mask;
+    if (insn.op2 >= primary.count) return false;
+    insn.id = kDispatch<Version>.secondary[primary.base + insn.op2];
+  }
+  if (insn.id == InstructionId::Invalid) return false;
+  insn.format = primary.format;
+
+  return true;
+}
+
+// Bitmaps for DecodeLength(). A 16-bit encoding is identified by its primary
+// opcode (bits 0-7) and, for the SR format, its secondary opcode (bits 12-15),
+// so 4096 entries cover all 65536 encodings. 32-bit encodings go through the
+// dispatch tables and are then checked against a bitmap of control-flow ids.
+struct ControlFlowTables {
+  uint64_t valid16[4096 / 64];
+  uint64_t flow16[4096 / 64];
+  uint64_t flowIds[(kInstructionIds + 63) / 64];
+};
+
+static constexpr size_t ShortIndex(uint16_t raw16) {
+  return (raw16 & 0xFFu) | ((raw16 >> 12) << 8);
+}
+
+static constexpr ControlFlowTables BuildControlFlowTables(
+    const DispatchTables& dispatch) {
+  ControlFlowTables tables{};
+
+  for (size_t id = 0; id < kInstructionIds; id++)
+    if (BranchKindOf(static_cast<InstructionId>(id)) != BranchKind::None)
+      tables.flowIds[id / 64] |= uint64_t{1} << (id % 64);
+
+  for (uint32_t index = 0; index < 4096; index++) {
+    const uint16_t raw16 = (index & 0xFFu) | ((index >> 8) << 12);
+    // 32-bit instructions have bit 0 set
+    if (raw16 & 0x01u) continue;
+
+    const PrimaryEntry& primary = dispatch.primary[raw16 & 0xFFu];
+    InstructionId id = primary.id;
+    if (primary.count != 0) {
+      const uint8_t op2 = (raw16 >> primary.shift) & primary.mask;
+      id = op2 < primary.count ? dispatch.secondary[primary.base + op2]
+                               : InstructionId::Invalid;
+    }
+    if (id == InstructionId::Invalid) continue;
+
+    tables.valid16[index / 64] |= uint64_t{1} << (index % 64);
+    if (BranchKindOf(id) != BranchKind::None)
+      tables.flow16[index / 64] |= uint64_t{1} << (index % 64);
+  }
+
+  return tables;
+}
+
+template <IsaVersion Version>
+static constexpr ControlFlowTables kControlFlow =
+    BuildControlFlowTables(kDispatch<Version>);
+
+// Every 16-bit encoding must index the bitmaps through the SR secondary field.
+// Later versions only add encodings, so checking the newest covers them all.
+static_assert([] {
+  for (size_t op1 = 0; op1 < 256; op1 += 2) {
+    const PrimaryEntry& primary = kDispatch<IsaVersion::TC18>.primary[op1];
+    if (primary.count != 0 && (primary.format != Format::SR ||
+                               primary.shift != 12 || primary.mask != 0xF))
+      return false;
+  }
+  return true;
+}());
+
+template <IsaVersion Version>
+bool DecodeLength(const uint8_t* data, size_t maxLen, uint8_t& length,
+                  bool& controlFlow) {
+  if (maxLen < 2) return false;
+
+  uint16_t raw16;
+  std::memcpy(&raw16, data, sizeof(raw16));
+  // 16-bit instruction
+  if (!(raw16 & 0x01u)) {
+    const size_t index = ShortIndex(raw16);
+    const uint64_t bit = uint64_t{1} << (index % 64);
+    if (!(kControlFlow<Version>.valid16[index / 64] & bit)) return false;
+    length = 2;
+    controlFlow = kControlFlow<Version>.flow16[index / 64] & bit;
+    return true;
+  }
+
+  // 32-bit instruction
+  DecodedInstruction insn;
+  if (!Classify<Version>(data, maxLen, insn)) return false;
+  const size_t id = static_cast<size_t>(insn.id);
+  length = 4;
+  controlFlow = (kControlFlow<Version>.flowIds[id / 64] >> (id % 64)) & 1;
+  return true;
+}
+
+template <IsaVersion Version>
+bool Decode(const uint8_t* data, uint64_t addr, size_t maxLen,
+            DecodedInstruction& insn) {
+  insn = DecodedInstruction{};
+  if (!Classify<Version>(data, maxLen, insn)) return false;
+
+  ExtractOperands(insn);
+  ResolveBranch(addr, insn);
+
+  return true;
+}
+
+// Grows each array to hold capacity elements, preserving the first size()
+template <typename T>
+static void Grow(std::unique_ptr<T[]>& array, size_t count, size_t capacity) {
+  std::unique_ptr<T[]> grown(new T[capacity]);
+  if (count) std::memcpy(grown.get(), array.get(), count * sizeof(T));
+  array = std::move(grown);
+}
+
+void DecodedRange::reserve(size_t elements) {
+  if (elements <= allocated) return;
+  Grow(address, count, elements);
+  Grow(length, count, elements);
+  Grow(id, count, elements);
+  Grow(branch, count, elements);
+  Grow(target, count, elements);
+  allocated = elements;
+}
+
+template <IsaVersion Version>
+size_t DecodeRange(const uint8_t* buf, size_t len, uint64_t base,
+                   DecodedRange& out) {
+  // Upper bound: every slot is a 16-bit instruction
+  out.reserve(out.count + len / 2);
+  uint64_t* address = out.address.get() + out.count;
+  uint8_t* length = out.length.get() + out.count;
+  InstructionId* id = out.id.get() + out.count;
+  BranchKind* branch = out.branch.get() + out.count;
+  uint32_t* target = out.target.get() + out.count;
+
+  size_t count = 0, valid = 0;
+  DecodedInstruction insn;
+  for (size_t offset = 0; offset + 2 <= len; count++) {
+    // Truncated 32-bit instruction at the end of the buffer
+    if ((buf[offset] & 0x01u) && len - offset < 4) break;
+
+    const uint64_t addr = base + offset;
+    address[count] = addr;
+    insn = DecodedInstruction{};
+    if (Classify<Version>(buf + offset, len - offset, insn)) {
+      // Only control-flow instructions need their operands for the target
+      if (BranchKindOf(insn.id) != BranchKind::None) {
+        ExtractOperands(insn);
+        ResolveBranch(addr, insn);
+      }
+      length[count] = insn.length;
+      id[count] = insn.id;
+      branch[count] = insn.branch;
+      target[count] = insn.target;
+      offset += insn.length;
+      valid++;
+    } else {
+      length[count] = 2;
+      id[count] = InstructionId::Invalid;
+      branch[count] = BranchKind::None;
+      target[count] = 0;
+      offset += 2;
+    }
+  }
+
+  out.count += count;
+  return valid;
+}
+
+#define INSTANTIATE_DECODER(version)                                        \
+  template bool DecodeLength<IsaVersion::version>(const uint8_t*, size_t,   \
+                                                  uint8_t&, bool&);         \
+  template bool Decode<IsaVersion::version>(const uint8_t*, uint64_t,       \
+                                            size_t, DecodedInstruction&);   \
+  template size_t DecodeRange<IsaVersion::version>(const uint8_t*, size_t,  \
+                                                   uint64_t, DecodedRange&);
+
+INSTANTIATE_DECODER(TC13)
+INSTANTIATE_DECODER(TC16)
+INSTANTIATE_DECODER(TC162)
+INSTANTIATE_DECODER(TC18)
+
+#undef INSTANTIATE_DECODER
+}  // namespace Tricore
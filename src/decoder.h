@@ -0,0 +1,122 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#ifndef BINARYNINJA_API_TRICORE_DECODER_H
+#define BINARYNINJA_API_TRICORE_DECODER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "formats.h"
+
+namespace Tricore {
+// TriCore ISA versions. Each version accepts the encodings of the versions
+// before it; the decoder is instantiated once per version so encodings a
+// version lacks are rejected by its dispatch tables. No encoding is marked
+// as added in TC162 or TC18 yet, so those two decode the TC16 set.
+enum class IsaVersion : uint8_t {
+  TC13,   // TC1.3 / TC1.3.1 (AUDO)
+  TC16,   // TC1.6 / TC1.6P / TC1.6E (AURIX TC2xx)
+  TC162,  // TC1.6.2 (AURIX TC3xx)
+  TC18,   // TC1.8 (AURIX TC4xx)
+};
+
+enum class BranchKind : uint8_t {
+  None,
+  Call,           // direct call, target is the callee
+  Unconditional,  // direct jump
+  Conditional,    // taken target, fall-through is addr + length
+  Indirect,       // target holds the register id of the destination
+  Return,
+  Unresolved,  // indirect jump or trap, target unknown
+};
+
+// One entry per handler class, from instruction_table.def
+enum class InstructionId : uint16_t {
+  Invalid,
+#define TRICORE_INSTRUCTION(name, written_flags, signature) name,
+#include "instruction_table.def"
+};
+
+// Number of InstructionId values; Wait is the last handler id
+inline constexpr size_t kInstructionIds =
+    static_cast<size_t>(InstructionId::Wait) + 1;
+
+// Everything the Info, Text and Lift callbacks need to know about a single
+// instruction, filled in by one pass of Decode().
+struct DecodedInstruction {
+  uint32_t raw;  // instruction word, upper half zero for 16-bit
+  InstructionId id;
+  Format format;
+  uint8_t op1;
+  uint8_t op2;  // 0xFF for single-opcode encodings
+  uint8_t length;
+  BranchKind branch;
+  uint32_t target;
+
+  // Operand fields. For formats with a combined source/destination field
+  // (s1/d) both s1 and d are set.
+  uint8_t s1;
+  uint8_t s2;
+  uint8_t s3;
+  uint8_t d;
+  uint8_t n;
+  uint8_t pos1;  // pos, pos1 or bpos3
+  uint8_t pos2;
+  uint8_t width;
+  int32_t imm;   // const4/8/9/16 or the bit value b of ABSB
+  int32_t disp;  // disp4/8/15/24, off4/10/16 or the ABS/ABSB address
+};
+
+// Decodes the instruction at data (located at addr) into insn. Returns false
+// for invalid encodings or when fewer than the instruction's length bytes are
+// available.
+template <IsaVersion Version = IsaVersion::TC16>
+bool Decode(const uint8_t* data, uint64_t addr, size_t maxLen,
+            DecodedInstruction& insn);
+
+// Length and control-flow check for GetInstructionInfo, without extracting
+// operands. Returns false where Decode() would. controlFlow is set for
+// branches, calls, returns and traps; Decode() then gives the branch kind and
+// target.
+template <IsaVersion Version = IsaVersion::TC16>
+bool DecodeLength(const uint8_t* data, size_t maxLen, uint8_t& length,
+                  bool& controlFlow);
+
+struct DecodedRange;
+
+// Linear-sweep decodes len bytes of buf (located at base), appending to out.
+// A trailing odd byte or truncated 32-bit instruction is not recorded.
+// Returns the number of valid instructions decoded.
+template <IsaVersion Version = IsaVersion::TC16>
+size_t DecodeRange(const uint8_t* buf, size_t len, uint64_t base,
+                   DecodedRange& out);
+
+// Struct-of-arrays output of DecodeRange(), one element per decoded slot.
+// Invalid encodings are recorded with InstructionId::Invalid and length 2 so
+// that the sweep stays aligned to halfword boundaries. The arrays are left
+// uninitialized past size() and keep their capacity across clear(), so one
+// DecodedRange can be reused for many regions without reallocating.
+struct DecodedRange {
+  std::unique_ptr<uint64_t[]> address;
+  std::unique_ptr<uint8_t[]> length;
+  std::unique_ptr<InstructionId[]> id;
+  std::unique_ptr<BranchKind[]> branch;
+  std::unique_ptr<uint32_t[]> target;
+
+  size_t size() const { return count; }
+  size_t capacity() const { return allocated; }
+  void clear() { count = 0; }
+  void reserve(size_t elements);
+
+ private:
+  template <IsaVersion Version>
+  friend size_t DecodeRange(const uint8_t*, size_t, uint64_t, DecodedRange&);
+
+  size_t count = 0;
+  size_t allocated = 0;
+};
+}  // namespace Tricore
+
+#endif  // BINARYNINJA_API_TRICORE_DECODER_H
@@ -0,0 +1,345 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#include "fields.h"
+
+#include <cstddef>
+#include <cstdint>
+
+#include "opcodes.h"
+#include "registers.h"
+
+namespace Tricore {
+const char* InstructionFields::RegToStr(const uint32_t rid) {
+  switch (rid) {
+    /* Full-Width General Purpose Data Registers */
+    case TRICORE_REG_D0:
+      return "d0";
+    case TRICORE_REG_D1:
+      return "d1";
+    case TRICORE_REG_D2:
+      return "d2";
+    case TRICORE_REG_D3:
+      return "d3";
+    case TRICORE_REG_D4:
+      return "d4";
+    case TRICORE_REG_D5:
+      return "d5";
+    case TRICORE_REG_D6:
+      return "d6";
+    case TRICORE_REG_D7:
+      return "d7";
+    case TRICORE_REG_D8:
+      return "d8";
+    case TRICORE_REG_D9:
+      return "d9";
+    case TRICORE_REG_D10:
+      return "d10";
+    case TRICORE_REG_D11:
+      return "d11";
+    case TRICORE_REG_D12:
+      return "d12";
+    case TRICORE_REG_D13:
+      return "d13";
+    case TRICORE_REG_D14:
+      return "d14";
+    case TRICORE_REG_D15:
+      return "d15";
+
+    /* Full-Width General Purpose Address Registers */
+    case TRICORE_REG_A0:
+      return "a0";
+    case TRICORE_REG_A1:
+      return "a1";
+    case TRICORE_REG_A2:
+      return "a2";
+    case TRICORE_REG_A3:
+      return "a3";
+    case TRICORE_REG_A4:
+      return "a4";
+    case TRICORE_REG_A5:
+      return "a5";
+    case TRICORE_REG_A6:
+      return "a6";
+    case TRICORE_REG_A7:
+      return "a7";
+    case TRICORE_REG_A8:
+      return "a8";
+    case TRICORE_REG_A9:
+      return "a9";
+    case TRICORE_REG_A10:
+      return "a10";
+    case TRICORE_REG_A11:
+      return "a11";
+    case TRICORE_REG_A12:
+      return "a12";
+    case TRICORE_REG_A13:
+      return "a13";
+    case TRICORE_REG_A14:
+      return "a14";
+    case TRICORE_REG_A15:
+      return "a15";
+
+    /* 64-bit Data Registers */
+    case TRICORE_REG_E0:
+      return "d0/d1";
+    case TRICORE_REG_E2:
+      return "d2/d3";
+    case TRICORE_REG_E4:
+      return "d4/d5";
+    case TRICORE_REG_E6:
+      return "d6/d7";
+    case TRICORE_REG_E8:
+      return "d8/d9";
+    case TRICORE_REG_E10:
+      return "d10/d11";
+    case TRICORE_REG_E12:
+      return "d12/d13";
+    case TRICORE_REG_E14:
+      return "d14/d15";
+
+    /* 64-bit Address Registers */
+    case TRICORE_REG_P0:
+      return "a0/a1";
+    case TRICORE_REG_P2:
+      return "a2/a3";
+    case TRICORE_REG_P4:
+      return "a4/a5";
+    case TRICORE_REG_P6:
+      return "a6/a7";
+    case TRICORE_REG_P8:
+      return "a8/a9";
+    case TRICORE_REG_P10:
+      return "a10/a11";
+    case TRICORE_REG_P12:
+      return "a12/a13";
+    case TRICORE_REG_P14:
+      return "a14/a15";
+
+    /* Core Special Function Registers */
+    case TRICORE_REG_PCXI:
+      return "pcxi";
+    case TRICORE_REG_PSW:
+      return "psw";
+    case TRICORE_REG_PC:
+      return "pc";
+    case TRICORE_REG_SYSCON:
+      return "syscon";
+
+    case TRICORE_REG_CPUID:
+      return "cpuid";
+    case TRICORE_REG_BIV:
+      return "biv";
+    case TRICORE_REG_BTV:
+      return "btv";
+    case TRICORE_REG_ISP:
+      return "isp";
+    case TRICORE_REG_ICR:
+      return "icr";
+    case TRICORE_REG_FCX:
+      return "fcx";
+    case TRICORE_REG_LCX:
+      return "lcx";
+    case TRICORE_REG_DIEAR:
+      return "diear";
+    case TRICORE_REG_DIETR:
+      return "dietr";
+    case TRICORE_REG_CCDIER:
+      return "ccdier";
+    case TRICORE_REG_MIECON:
+      return "miecon";
+    case TRICORE_REG_PIEAR:
+      return "piear";
+    case TRICORE_REG_PIETR:
+      return "pietr";
+    case TIRCORE_REG_CCPIER:
+      return "ccpier";
+    case TRICORE_REG_DBGSR:
+      return "dbgsr";
+    case TRICORE_REG_EXEVT:
+      return "exevt";
+    case TRICORE_REG_CREVT:
+      return "crevt";
+    case TRICORE_REG_SWEVT:
+      return "swevt";
+    case TRICORE_REG_TR0EVT:
+      return "tr0evt";
+    case TRICORE_REG_TR1EVT:
+      return "tr1evt";
+    case TRICORE_REG_DMS:
+      return "dms";
+    case TRICORE_REG_DCX:
+      return "dcx";
+    case TRICORE_REG_DBGTCR:
+      return "dbgtcr";
+    case TRICORE_REG_CCTRL:
+      return "cctrl";
+    case TRICORE_REG_CCNT:
+      return "ccnt";
+    case TRICORE_REG_ICNT:
+      return "icnt";
+    case TRICORE_REG_M1CNT:
+      return "m1cnt";
+    case TRICORE_REG_M2CNT:
+      return "m2cnt";
+    case TRICORE_REG_M3CNT:
+      return "m3cnt";
+    case TRICIRE_REG_COMPAT:
+      return "compat";
+    case TRICORE_REG_BMACON:
+      return "bmacon";
+    case TRICORE_REG_SMACON:
+      return "smacon";
+    case TRICORE_REG_FPUTC:
+      return "fputc";
+    case TRICORE_REG_FPUTPC:
+      return "fputpc";
+    case TRICORE_REG_FPUTOPC:
+      return "fputopc";
+    case TRICORE_REG_FPUTSRC1:
+      return "fputsrc1";
+    case TRICORE_REG_FPUTSRC2:
+      return "fputsrc2";
+    case TRICORE_REG_FPUTSRC3:
+      return "fputsrc3";
+    case TRICORE_REG_FPUIDR:
+      return "fpuidr";
+
+    default:
+      return nullptr;
+  }
+}
+
+uint32_t InstructionFields::ExtractSecondaryOpcode(uint8_t primaryOp,
+                                                   const uint8_t* data) {
+  auto data16 = (const uint16_t*)data;
+  auto data32 = (const uint32_t*)data;
+  /* See TriCore Architecture Volume 2: Instruction Set, V1.3 & V1.3.1;
+   * secion 2.2 - Opcode Formats */
+  switch (primaryOp) {
+    case OP1_x00_SR:
+    case OP1_x46_SR:
+    case OP1_x32_SR:
+    case OP1_xDC_SR:
+      return ((*data16) >> 12) & 0x0Fu;
+
+    case OP1_x01_RR:
+    case OP1_x0B_RR:
+    case OP1_x0F_RR:
+    case OP1_x2D_RR:
+    case OP1_x4B_RR:
+    case OP1_x75_RR:
+      return ((*data32) >> 20) & 0xFFu;
+
+    case OP1_x03_RRR2:
+    case OP1_x23_RRR2:
+      return ((*data32) >> 16) & 0xFFu;
+
+    case OP1_x05_ABS:
+    case OP1_x15_ABS:
+    case OP1_x25_ABS:
+    case OP1_x45_ABS:
+    case OP1_x65_ABS:
+    case OP1_x85_ABS:
+    case OP1_xA5_ABS:
+    case OP1_xC5_ABS:
+    case OP1_xE5_ABS:
+      return ((*data32) >> 26) & 0x03u;
+
+    case OP1_x07_BIT:
+    case OP1_x27_BIT:
+    case OP1_x47_BIT:
+    case OP1_x67_BIT:
+    case OP1_x87_BIT:
+    case OP1_xA7_BIT:
+    case OP1_xC7_BIT:
+      return ((*data32) >> 21) & 0x03u;
+
+    case OP1_x09_BO:
+    case OP1_x29_BO:
+    case OP1_x49_BO:
+    case OP1_x69_BO:
+    case OP1_x89_BO:
+    case OP1_xA9_BO:
+      return ((*data32) >> 22) & 0x3Fu;
+
+    case OP1_x0D_SYS:
+    case OP1_x2F_SYS:
+      return ((*data32) >> 22) & 0x3Fu;
+
+    case OP1_x13_RCR:
+    case OP1_x33_RCR:
+    case OP1_xAB_RCR:
+      return ((*data32) >> 21) & 0x07u;
+
+    case OP1_x17_RRRR:
+      return ((*data32) >> 21) & 0x07u;
+
+    case OP1_x1F_BRR:
+    case OP1_x3F_BRR:
+    case OP1_x5F_BRR:
+    case OP1_x7D_BRR:
+    case OP1_x7F_BRR:
+    case OP1_xBD_BRR:
+    case OP1_xFD_BRR:
+      return ((*data32) >> 31) & 0x01u;
+
+    case OP1_x2B_RRR:
+    case OP1_x6B_RRR:
+      return ((*data32) >> 20) & 0x0Fu;
+
+    case OP1_x37_RRPW:
+    case OP1_x77_RRPW:
+      return ((*data32) >> 21) & 0x03u;
+
+    case OP1_x43_RRR1:
+    case OP1_x63_RRR1:
+    case OP1_x83_RRR1:
+    case OP1_xA3_RRR1:
+    case OP1_xC3_RRR1:
+    case OP1_xE3_RRR1:
+      return ((*data32) >> 18) & 0x3Fu;
+
+    case OP1_x53_RC:
+    case OP1_x8B_RC:
+    case OP1_x8F_RC:
+    case OP1_xAD_RC:
+      return ((*data32) >> 21) & 0x7Fu;
+
+    case OP1_x57_RRRW:
+      return ((*data32) >> 21) & 0x07u;
+
+    // smaller primary opcode (should have been handled in caller)
+    case OP1_x6F_BRN:
+      return ((*data32) >> 31) & 0x01u;
+
+    case OP1_x73_RR2:
+      return ((*data32) >> 16) & 0xFFFu;
+
+    case OP1_x93_RR1:
+    case OP1_xB3_RR1:
+      return ((*data32) >> 18) & 0x3FFu;
+
+    case OP1_x97_RCRR:
+      return ((*data32) >> 21) & 0x07u;
+
+    case OP1_x9F_BRC:
+    case OP1_xBF_BRC:
+    case OP1_xDF_BRC:
+    case OP1_xFF_BRC:
+      return ((*data32) >> 31) & 0x01u;
+
+    case OP1_xB7_RCPW:
+      return ((*data32) >> 21) & 0x03u;
+
+    case OP1_xD5_ABSB:
+      return ((*data32) >> 26) & 0x03u;
+
+    case OP1_xD7_RCRW:
+      return ((*data32) >> 21) & 0x07u;
+
+    default:
+      return 0xFFFF;  // This is not a valid secondary opcode
+  }
+}
+}  // namespace Tricore
@@ -0,0 +1,395 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#ifndef BINARYNINJA_API_TRICORE_FIELDS_H
+#define BINARYNINJA_API_TRICORE_FIELDS_H
+
+#include <cstdint>
+#include <cstring>
+
+#include "formats.h"
+
+namespace Tricore {
+// Opcode field extraction. Does not depend on the Binary Ninja API so it can
+// be built into the standalone tricore-decode library.
+class InstructionFields {
+ public:
+  static uint16_t Load16(const uint8_t* data) {
+    uint16_t raw;
+    std::memcpy(&raw, data, sizeof(raw));
+    return raw;
+  }
+  static uint32_t Load32(const uint8_t* data) {
+    uint32_t raw;
+    std::memcpy(&raw, data, sizeof(raw));
+    return raw;
+  }
+
+  // The ExtractOpfields* functions below are out-parameter wrappers around
+  // Opfields<F>::Decode (see formats.h), kept for the handlers in text.cpp
+  // and lift.cpp.
+
+  // 16-bit instruction opcode field extractions (TriCore Arch, Vol. 2,
+  // Section 2.2.1)
+  static void ExtractOpfieldsSB(const uint8_t* data, uint8_t& op1,
+                                int8_t& disp8) {
+    const auto fields = Opfields<Format::SB>::Decode(Load16(data));
+    op1 = fields.op1;
+    disp8 = fields.disp8;
+  }
+  static void ExtractOpfieldsSBC(const uint8_t* data, uint8_t& op1,
+                                 int8_t& disp4, int8_t& const4) {
+    const auto fields = Opfields<Format::SBC>::Decode(Load16(data));
+    op1 = fields.op1;
+    disp4 = fields.disp4;
+    const4 = fields.const4;
+  }
+  static void ExtractOpfieldsSBR(const uint8_t* data, uint8_t& op1,
+                                 int8_t& disp4, uint8_t& s2) {
+    const auto fields = Opfields<Format::SBR>::Decode(Load16(data));
+    op1 = fields.op1;
+    disp4 = fields.disp4;
+    s2 = fields.s2;
+  }
+  static void ExtractOpfieldsSBRN(const uint8_t* data, uint8_t& op1,
+                                  int8_t& disp4, uint8_t& n) {
+    const auto fields = Opfields<Format::SBRN>::Decode(Load16(data));
+    op1 = fields.op1;
+    disp4 = fields.disp4;
+    n = fields.n;
+  }
+  static void ExtractOpfieldsSC(const uint8_t* data, uint8_t& op1,
+                                int8_t& const8) {
+    const auto fields = Opfields<Format::SC>::Decode(Load16(data));
+    op1 = fields.op1;
+    const8 = fields.const8;
+  }
+  static void ExtractOpfieldsSLR(const uint8_t* data, uint8_t& op1, uint8_t& d,
+                                 uint8_t& s2) {
+    const auto fields = Opfields<Format::SLR>::Decode(Load16(data));
+    op1 = fields.op1;
+    d = fields.d;
+    s2 = fields.s2;
+  }
+  static void ExtractOpfieldsSLRO(const uint8_t* data, uint8_t& op1, uint8_t& d,
+                                  int8_t& off4) {
+    const auto fields = Opfields<Format::SLRO>::Decode(Load16(data));
+    op1 = fields.op1;
+    d = fields.d;
+    off4 = fields.off4;
+  }
+  static void ExtractOpfieldsSR(const uint8_t* data, uint8_t& op1, uint8_t& s1d,
+                                uint8_t& op2) {
+    const auto fields = Opfields<Format::SR>::Decode(Load16(data));
+    op1 = fields.op1;
+    s1d = fields.s1d;
+    op2 = fields.op2;
+  }
+  static void ExtractOpfieldsSRC(const uint8_t* data, uint8_t& op1,
+                                 uint8_t& s1d, int8_t& const4) {
+    const auto fields = Opfields<Format::SRC>::Decode(Load16(data));
+    op1 = fields.op1;
+    s1d = fields.s1d;
+    const4 = fields.const4;
+  }
+  static void ExtractOpfieldsSRO(const uint8_t* data, uint8_t& op1,
+                                 int8_t& off4, uint8_t& s2) {
+    const auto fields = Opfields<Format::SRO>::Decode(Load16(data));
+    op1 = fields.op1;
+    off4 = fields.off4;
+    s2 = fields.s2;
+  }
+  static void ExtractOpfieldsSRR(const uint8_t* data, uint8_t& op1,
+                                 uint8_t& s1d, uint8_t& s2) {
+    const auto fields = Opfields<Format::SRR>::Decode(Load16(data));
+    op1 = fields.op1;
+    s1d = fields.s1d;
+    s2 = fields.s2;
+  }
+  static void ExtractOpfieldsSRRS(const uint8_t* data, uint8_t& op1, uint8_t& n,
+                                  uint8_t& s1d, uint8_t& s2) {
+    const auto fields = Opfields<Format::SRRS>::Decode(Load16(data));
+    op1 = fields.op1;
+    n = fields.n;
+    s1d = fields.s1d;
+    s2 = fields.s2;
+  }
+  static void ExtractOpfieldsSSR(const uint8_t* data, uint8_t& op1, uint8_t& s1,
+                                 uint8_t& s2) {
+    const auto fields = Opfields<Format::SSR>::Decode(Load16(data));
+    op1 = fields.op1;
+    s1 = fields.s1;
+    s2 = fields.s2;
+  }
+  static void ExtractOpfieldsSSRO(const uint8_t* data, uint8_t& op1,
+                                  uint8_t& s1, int8_t& off4) {
+    const auto fields = Opfields<Format::SSRO>::Decode(Load16(data));
+    op1 = fields.op1;
+    s1 = fields.s1;
+    off4 = fields.off4;
+  }
+  // 32-bit instruction opcode field extractions (TriCore Arch, Vol. 2,
+  // Section 2.2.2)
+  static void ExtractOpfieldsABS(const uint8_t* data, uint8_t& op1,
+                                 uint8_t& op2, uint8_t& s1d, uint32_t& ea) {
+    const auto fields = Opfields<Format::ABS>::Decode(Load32(data));
+    op1 = fields.op1;
+    op2 = fields.op2;
+    s1d = fields.s1d;
+    ea = fields.ea;
+  }
+  static void ExtractOpfieldsABSB(const uint8_t* data, uint8_t& op1,
+                                  uint8_t& op2, uint8_t& b, uint8_t& bpos3,
+                                  uint32_t& ea) {
+    const auto fields = Opfields<Format::ABSB>::Decode(Load32(data));
+    op1 = fields.op1;
+    op2 = fields.op2;
+    b = fields.b;
+    bpos3 = fields.bpos3;
+    ea = fields.ea;
+  }
+  static void ExtractOpfieldsB(const uint8_t* data, uint8_t& op1,
+                               int32_t& disp24) {
+    const auto fields = Opfields<Format::B>::Decode(Load32(data));
+    op1 = fields.op1;
+    disp24 = fields.disp24;
+  }
+  static void ExtractOpfieldsBIT(const uint8_t* data, uint8_t& op1,
+                                 uint8_t& op2, uint8_t& s1, uint8_t& s2,
+                                 uint8_t& pos1, uint8_t& pos2, uint8_t& d) {
+    const auto fields = Opfields<Format::BIT>::Decode(Load32(data));
+    op1 = fields.op1;
+    op2 = fields.op2;
+    s1 = fields.s1;
+    s2 = fields.s2;
+    pos1 = fields.pos1;
+    pos2 = fields.pos2;
+    d = fields.d;
+  }
+  static void ExtractOpfieldsBO(const uint8_t* data, uint8_t& op1, uint8_t& op2,
+                                uint8_t& s1d, uint8_t& s2, int16_t& off10) {
+    const auto fields = Opfields<Format::BO>::Decode(Load32(data));
+    op1 = fields.op1;
+    op2 = fields.op2;
+    s1d = fields.s1d;
+    s2 = fields.s2;
+    off10 = fields.off10;
+  }
+  static void ExtractOpfieldsBOL(const uint8_t* data, uint8_t& op1,
+                                 uint8_t& s1d, uint8_t& s2, int16_t& off16) {
+    const auto fields = Opfields<Format::BOL>::Decode(Load32(data));
+    op1 = fields.op1;
+    s1d = fields.s1d;
+    s2 = fields.s2;
+    off16 = fields.off16;
+  }
+  static void ExtractOpfieldsBRC(const uint8_t* data, uint8_t& op1,
+                                 uint8_t& op2, uint8_t& s1, int8_t& const4,
+                                 int16_t& disp15) {
+    const auto fields = Opfields<Format::BRC>::Decode(Load32(data));
+    op1 = fields.op1;
+    op2 = fields.op2;
+    s1 = fields.s1;
+    const4 = fields.const4;
+    disp15 = fields.disp15;
+  }
+  static void ExtractOpfieldsBRN(const uint8_t* data, uint8_t& op1,
+                                 uint8_t& op2, uint8_t& n, uint8_t& s1,
+                                 int16_t& disp15) {
+    const auto fields = Opfields<Format::BRN>::Decode(Load32(data));
+    op1 = fields.op1;
+    op2 = fields.op2;
+    n = fields.n;
+    s1 = fields.s1;
+    disp15 = fields.disp15;
+  }
+  static void ExtractOpfieldsBRR(const uint8_t* data, uint8_t& op1,
+                                 uint8_t& op2, uint8_t& s1, uint8_t& s2,
+                                 int16_t& disp15) {
+    const auto fields = Opfields<Format::BRR>::Decode(Load32(data));
+    op1 = fields.op1;
+    op2 = fields.op2;
+    s1 = fields.s1;
+    s2 = fields.s2;
+    disp15 = fields.disp15;
+  }
+  static void ExtractOpfieldsRC(const uint8_t* data, uint8_t& op1, uint8_t& op2,
+                                uint8_t& s1, uint8_t& d, int16_t& const9) {
+    const auto fields = Opfields<Format::RC>::Decode(Load32(data));
+    op1 = fields.op1;
+    op2 = fields.op2;
+    s1 = fields.s1;
+    d = fields.d;
+    const9 = fields.const9;
+  }
+  static void ExtractOpfieldsRCPW(const uint8_t* data, uint8_t& op1,
+                                  uint8_t& op2, uint8_t& s1, int8_t& const4,
+                                  uint8_t& width, uint8_t& pos, uint8_t& d) {
+    const auto fields = Opfields<Format::RCPW>::Decode(Load32(data));
+    op1 = fields.op1;
+    op2 = fields.op2;
+    s1 = fields.s1;
+    const4 = fields.const4;
+    width = fields.width;
+    pos = fields.pos;
+    d = fields.d;
+  }
+  static void ExtractOpfieldsRCR(const uint8_t* data, uint8_t& op1,
+                                 uint8_t& op2, uint8_t& s1, int16_t& const9,
+                                 uint8_t& s3, uint8_t& d) {
+    const auto fields = Opfields<Format::RCR>::Decode(Load32(data));
+    op1 = fields.op1;
+    op2 = fields.op2;
+    s1 = fields.s1;
+    const9 = fields.const9;
+    s3 = fields.s3;
+    d = fields.d;
+  }
+  static void ExtractOpfieldsRCRR(const uint8_t* data, uint8_t& op1,
+                                  uint8_t& op2, uint8_t& s1, int8_t& const4,
+                                  uint8_t& s3, uint8_t& d) {
+    const auto fields = Opfields<Format::RCRR>::Decode(Load32(data));
+    op1 = fields.op1;
+    op2 = fields.op2;
+    s1 = fields.s1;
+    const4 = fields.const4;
+    s3 = fields.s3;
+    d = fields.d;
+  }
+  static void ExtractOpfieldsRCRW(const uint8_t* data, uint8_t& op1,
+                                  uint8_t& op2, uint8_t& s1, int8_t& const4,
+                                  uint8_t& width, uint8_t& s3, uint8_t& d) {
+    const auto fields = Opfields<Format::RCRW>::Decode(Load32(data));
+    op1 = fields.op1;
+    op2 = fields.op2;
+    s1 = fields.s1;
+    const4 = fields.const4;
+    width = fields.width;
+    s3 = fields.s3;
+    d = fields.d;
+  }
+  static void ExtractOpfieldsRLC(const uint8_t* data, uint8_t& op1, uint8_t& s1,
+                                 int16_t& const16, uint8_t& d) {
+    const auto fields = Opfields<Format::RLC>::Decode(Load32(data));
+    op1 = fields.op1;
+    s1 = fields.s1;
+    const16 = fields.const16;
+    d = fields.d;
+  }
+  static void ExtractOpfieldsRR(const uint8_t* data, uint8_t& op1, uint8_t& op2,
+                                uint8_t& s1, uint8_t& s2, uint8_t& n,
+                                uint8_t& d) {
+    const auto fields = Opfields<Format::RR>::Decode(Load32(data));
+    op1 = fields.op1;
+    op2 = fields.op2;
+    s1 = fields.s1;
+    s2 = fields.s2;
+    n = fields.n;
+    d = fields.d;
+  }
+  static void ExtractOpfieldsRR1(const uint8_t* data, uint8_t& op1,
+                                 uint8_t& op2, uint8_t& s1, uint8_t& s2,
+                                 uint8_t& n, uint8_t& d) {
+    const auto fields = Opfields<Format::RR1>::Decode(Load32(data));
+    op1 = fields.op1;
+    op2 = fields.op2;
+    s1 = fields.s1;
+    s2 = fields.s2;
+    n = fields.n;
+    d = fields.d;
+  }
+  static void ExtractOpfieldsRR2(const uint8_t* data, uint8_t& op1,
+                                 uint8_t& op2, uint8_t& s1, uint8_t& s2,
+                                 uint8_t& d) {
+    const auto fields = Opfields<Format::RR2>::Decode(Load32(data));
+    op1 = fields.op1;
+    op2 = fields.op2;
+    s1 = fields.s1;
+    s2 = fields.s2;
+    d = fields.d;
+  }
+  static void ExtractOpfieldsRRPW(const uint8_t* data, uint8_t& op1,
+                                  uint8_t& op2, uint8_t& s1, uint8_t& s2,
+                                  uint8_t& width, uint8_t& pos, uint8_t& d) {
+    const auto fields = Opfields<Format::RRPW>::Decode(Load32(data));
+    op1 = fields.op1;
+    op2 = fields.op2;
+    s1 = fields.s1;
+    s2 = fields.s2;
+    width = fields.width;
+    pos = fields.pos;
+    d = fields.d;
+  }
+  static void ExtractOpfieldsRRR(const uint8_t* data, uint8_t& op1,
+                                 uint8_t& op2, uint8_t& s1, uint8_t& s2,
+                                 uint8_t& n, uint8_t& s3, uint8_t& d) {
+    const auto fields = Opfields<Format::RRR>::Decode(Load32(data));
+    op1 = fields.op1;
+    op2 = fields.op2;
+    s1 = fields.s1;
+    s2 = fields.s2;
+    n = fields.n;
+    s3 = fields.s3;
+    d = fields.d;
+  }
+  static void ExtractOpfieldsRRR1(const uint8_t* data, uint8_t& op1,
+                                  uint8_t& op2, uint8_t& s1, uint8_t& s2,
+                                  uint8_t& n, uint8_t& s3, uint8_t& d) {
+    const auto fields = Opfields<Format::RRR1>::Decode(Load32(data));
+    op1 = fields.op1;
+    op2 = fields.op2;
+    s1 = fields.s1;
+    s2 = fields.s2;
+    n = fields.n;
+    s3 = fields.s3;
+    d = fields.d;
+  }
+  static void ExtractOpfieldsRRR2(const uint8_t* data, uint8_t& op1,
+                                  uint8_t& op2, uint8_t& s1, uint8_t& s2,
+                                  uint8_t& s3, uint8_t& d) {
+    const auto fields = Opfields<Format::RRR2>::Decode(Load32(data));
+    op1 = fields.op1;
+    op2 = fields.op2;
+    s1 = fields.s1;
+    s2 = fields.s2;
+    s3 = fields.s3;
+    d = fields.d;
+  }
+  static void ExtractOpfieldsRRRR(const uint8_t* data, uint8_t& op1,
+                                  uint8_t& op2, uint8_t& s1, uint8_t& s2,
+                                  uint8_t& s3, uint8_t& d) {
+    const auto fields = Opfields<Format::RRRR>::Decode(Load32(data));
+    op1 = fields.op1;
+    op2 = fields.op2;
+    s1 = fields.s1;
+    s2 = fields.s2;
+    s3 = fields.s3;
+    d = fields.d;
+  }
+  static void ExtractOpfieldsRRRW(const uint8_t* data, uint8_t& op1,
+                                  uint8_t& op2, uint8_t& s1, uint8_t& s2,
+                                  uint8_t& width, uint8_t& s3, uint8_t& d) {
+    const auto fields = Opfields<Format::RRRW>::Decode(Load32(data));
+    op1 = fields.op1;
+    op2 = fields.op2;
+    s1 = fields.s1;
+    s2 = fields.s2;
+    width = fields.width;
+    s3 = fields.s3;
+    d = fields.d;
+  }
+  static void ExtractOpfieldsSYS(const uint8_t* data, uint8_t& op1,
+                                 uint8_t& op2, uint8_t& s1d) {
+    const auto fields = Opfields<Format::SYS>::Decode(Load32(data));
+    op1 = fields.op1;
+    op2 = fields.op2;
+    s1d = fields.s1d;
+  }
+
+  static uint32_t ExtractSecondaryOpcode(uint8_t primaryOp,
+                                         const uint8_t* data);
+  static const char* RegToStr(uint32_t rid);
+};
+}  // namespace Tricore
+
+#endif  // BINARYNINJA_API_TRICORE_FIELDS_H
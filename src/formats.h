@@ -0,0 +1,791 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#ifndef BINARYNINJA_API_TRICORE_FORMATS_H
+#define BINARYNINJA_API_TRICORE_FORMATS_H
+
+#include <cstdint>
+
+namespace Tricore {
+// Instruction formats (TriCore Arch, Vol. 2, Section 2.2)
+enum class Format : uint8_t {
+  Invalid,
+  // 16-bit
+  SB,
+  SBC,
+  SBR,
+  SBRN,
+  SC,
+  SLR,
+  SLRO,
+  SR,
+  SRC,
+  SRO,
+  SRR,
+  SRRS,
+  SSR,
+  SSRO,
+  // 32-bit
+  ABS,
+  ABSB,
+  B,
+  BIT,
+  BO,
+  BOL,
+  BRC,
+  BRN,
+  BRR,
+  RC,
+  RCPW,
+  RCR,
+  RCRR,
+  RCRW,
+  RLC,
+  RR,
+  RR1,
+  RR2,
+  RRPW,
+  RRR,
+  RRR1,
+  RRR2,
+  RRRR,
+  RRRW,
+  SYS,
+};
+
+// Sign-extends the low bits of value
+constexpr int32_t SignExtend(uint32_t value, unsigned bits) {
+  const uint32_t sign = 1u << (bits - 1);
+  return static_cast<int32_t>((value ^ sign) - sign);
+}
+
+// Operand fields of one instruction format. Opfields<F>::Decode(raw) splits
+// an instruction word into the fields of format F; it is constexpr and
+// header-only so the extraction folds into the caller and unread fields are
+// dropped. Field names follow the ISA manual, with s1d for a combined
+// source/destination field.
+template <Format F>
+struct Opfields;
+
+// 16-bit formats (TriCore Arch, Vol. 2, Section 2.2.1)
+
+template <>
+struct Opfields<Format::SB> {
+  uint8_t op1;
+  int8_t disp8;
+
+  static constexpr Opfields Decode(uint32_t raw) {
+    return {
+        .op1 = static_cast<uint8_t>(raw & 0xFFu),
+        .disp8 = static_cast<int8_t>((raw >> 8) & 0xFFu),
+    };
+  }
+};
+
+template <>
+struct Opfields<Format::SBC> {
+  uint8_t op1;
+  int8_t disp4;
+  int8_t const4;
+
+  static constexpr Opfields Decode(uint32_t raw) {
+    return {
+        .op1 = static_cast<uint8_t>(raw & 0xFFu),
+        .disp4 = static_cast<int8_t>(SignExtend((raw >> 8) & 0x0Fu, 4)),
+        .const4 = static_cast<int8_t>(SignExtend((raw >> 12) & 0x0Fu, 4)),
+    };
+  }
+};
+
+template <>
+struct Opfields<Format::SBR> {
+  uint8_t op1;
+  int8_t disp4;
+  uint8_t s2;
+
+  static constexpr Opfields Decode(uint32_t raw) {
+    return {
+        .op1 = static_cast<uint8_t>(raw & 0xFFu),
+        .disp4 = static_cast<int8_t>(SignExtend((raw >> 8) & 0x0Fu, 4)),
+        .s2 = static_cast<uint8_t>((raw >> 12) & 0x0Fu),
+    };
+  }
+};
+
+template <>
+struct Opfields<Format::SBRN> {
+  uint8_t op1;
+  int8_t disp4;
+  uint8_t n;
+
+  static constexpr Opfields Decode(uint32_t raw) {
+    return {
+        .op1 = static_cast<uint8_t>(raw & 0xFFu),
+        .disp4 = static_cast<int8_t>(SignExtend((raw >> 8) & 0x0Fu, 4)),
+        .n = static_cast<uint8_t>((raw >> 12) & 0x0Fu),
+    };
+  }
+};
+
+template <>
+struct Opfields<Format::SC> {
+  uint8_t op1;
+  int8_t const8;
+
+  static constexpr Opfields Decode(uint32_t raw) {
+    return {
+        .op1 = static_cast<uint8_t>(raw & 0xFFu),
+        .const8 = static_cast<int8_t>((raw >> 8) & 0xFFu),
+    };
+  }
+};
+
+template <>
+struct Opfields<Format::SLR> {
+  uint8_t op1;
+  uint8_t d;
+  uint8_t s2;
+
+  static constexpr Opfields Decode(uint32_t raw) {
+    return {
+        .op1 = static_cast<uint8_t>(raw & 0xFFu),
+        .d = static_cast<uint8_t>((raw >> 8) & 0x0Fu),
+        .s2 = static_cast<uint8_t>((raw >> 12) & 0x0Fu),
+    };
+  }
+};
+
+template <>
+struct Opfields<Format::SLRO> {
+  uint8_t op1;
+  uint8_t d;
+  int8_t off4;
+
+  static constexpr Opfields Decode(uint32_t raw) {
+    return {
+        .op1 = static_cast<uint8_t>(raw & 0xFFu),
+        .d = static_cast<uint8_t>((raw >> 8) & 0x0Fu),
+        .off4 = static_cast<int8_t>(SignExtend((raw >> 12) & 0x0Fu, 4)),
+    };
+  }
+};
+
+template <>
+struct Opfields<Format::SR> {
+  uint8_t op1;
+  uint8_t s1d;
+  uint8_t op2;
+
+  static constexpr Opfields Decode(uint32_t raw) {
+    return {
+        .op1 = static_cast<uint8_t>(raw & 0xFFu),
+        .s1d = static_cast<uint8_t>((raw >> 8) & 0x0Fu),
+        .op2 = static_cast<uint8_t>((raw >> 12) & 0x0Fu),
+    };
+  }
+};
+
+template <>
+struct Opfields<Format::SRC> {
+  uint8_t op1;
+  uint8_t s1d;
+  int8_t const4;
+
+  static constexpr Opfields Decode(uint32_t raw) {
+    return {
+        .op1 = static_cast<uint8_t>(raw & 0xFFu),
+        .s1d = static_cast<uint8_t>((raw >> 8) & 0x0Fu),
+        .const4 = static_cast<int8_t>(SignExtend((raw >> 12) & 0x0Fu, 4)),
+    };
+  }
+};
+
+template <>
+struct Opfields<Format::SRO> {
+  uint8_t op1;
+  int8_t off4;
+  uint8_t s2;
+
+  static constexpr Opfields Decode(uint32_t raw) {
+    return {
+        .op1 = static_cast<uint8_t>(raw & 0xFFu),
+        .off4 = static_cast<int8_t>(SignExtend((raw >> 8) & 0x0Fu, 4)),
+        .s2 = static_cast<uint8_t>((raw >> 12) & 0x0Fu),
+    };
+  }
+};
+
+template <>
+struct Opfields<Format::SRR> {
+  uint8_t op1;
+  uint8_t s1d;
+  uint8_t s2;
+
+  static constexpr Opfields Decode(uint32_t raw) {
+    return {
+        .op1 = static_cast<uint8_t>(raw & 0xFFu),
+        .s1d = static_cast<uint8_t>((raw >> 8) & 0x0Fu),
+        .s2 = static_cast<uint8_t>((raw >> 12) & 0x0Fu),
+    };
+  }
+};
+
+template <>
+struct Opfields<Format::SRRS> {
+  uint8_t op1;
+  uint8_t n;
+  uint8_t s1d;
+  uint8_t s2;
+
+  static constexpr Opfields Decode(uint32_t raw) {
+    return {
+        .op1 = static_cast<uint8_t>(raw & 0x3Fu),
+        .n = static_cast<uint8_t>((raw >> 6) & 0x03u),
+        .s1d = static_cast<uint8_t>((raw >> 8) & 0x0Fu),
+        .s2 = static_cast<uint8_t>((raw >> 12) & 0x0Fu),
+    };
+  }
+};
+
+template <>
+struct Opfields<Format::SSR> {
+  uint8_t op1;
+  uint8_t s1;
+  uint8_t s2;
+
+  static constexpr Opfields Decode(uint32_t raw) {
+    return {
+        .op1 = static_cast<uint8_t>(raw & 0xFFu),
+        .s1 = static_cast<uint8_t>((raw >> 8) & 0x0Fu),
+        .s2 = static_cast<uint8_t>((raw >> 12) & 0x0Fu),
+    };
+  }
+};
+
+template <>
+struct Opfields<Format::SSRO> {
+  uint8_t op1;
+  uint8_t s1;
+  int8_t off4;
+
+  static constexpr Opfields Decode(uint32_t raw) {
+    return {
+        .op1 = static_cast<uint8_t>(raw & 0xFFu),
+        .s1 = static_cast<uint8_t>((raw >> 8) & 0x0Fu),
+        .off4 = static_cast<int8_t>(SignExtend((raw >> 12) & 0x0Fu, 4)),
+    };
+  }
+};
+
+// 32-bit formats (TriCore Arch, Vol. 2, Section 2.2.2)
+
+template <>
+struct Opfields<Format::ABS> {
+  uint8_t op1;
+  uint8_t op2;
+  uint8_t s1d;
+  uint32_t ea;
+
+  static constexpr Opfields Decode(uint32_t raw) {
+    return {
+        .op1 = static_cast<uint8_t>(raw & 0xFFu),
+        .op2 = static_cast<uint8_t>((raw >> 26) & 0x03u),
+        .s1d = static_cast<uint8_t>((raw >> 8) & 0x0Fu),
+        .ea = static_cast<uint32_t>(
+            ((raw << 16) & 0xF0000000u) | ((raw >> 12) & 0x3C00u) |
+            ((raw >> 22) & 0x3C0u) | ((raw >> 16) & 0x3Fu)),
+    };
+  }
+};
+
+template <>
+struct Opfields<Format::ABSB> {
+  uint8_t op1;
+  uint8_t op2;
+  uint8_t b;
+  uint8_t bpos3;
+  uint32_t ea;
+
+  static constexpr Opfields Decode(uint32_t raw) {
+    return {
+        .op1 = static_cast<uint8_t>(raw & 0xFFu),
+        .op2 = static_cast<uint8_t>((raw >> 26) & 0x03u),
+        .b = static_cast<uint8_t>((raw >> 11) & 0x01u),
+        .bpos3 = static_cast<uint8_t>((raw >> 8) & 0x07u),
+        .ea = static_cast<uint32_t>(
+            ((raw << 16) & 0xF0000000u) | ((raw >> 12) & 0x3C00u) |
+            ((raw >> 22) & 0x3C0u) | ((raw >> 16) & 0x3Fu)),
+    };
+  }
+};
+
+template <>
+struct Opfields<Format::B> {
+  uint8_t op1;
+  int32_t disp24;
+
+  static constexpr Opfields Decode(uint32_t raw) {
+    return {
+        .op1 = static_cast<uint8_t>(raw & 0xFFu),
+        .disp24 = SignExtend(
+            ((raw >> 16) & 0xFFFFu) | ((raw << 8) & 0xFF0000u), 24),
+    };
+  }
+};
+
+template <>
+struct Opfields<Format::BIT> {
+  uint8_t op1;
+  uint8_t op2;
+  uint8_t s1;
+  uint8_t s2;
+  uint8_t pos1;
+  uint8_t pos2;
+  uint8_t d;
+
+  static constexpr Opfields Decode(uint32_t raw) {
+    return {
+        .op1 = static_cast<uint8_t>(raw & 0xFFu),
+        .op2 = static_cast<uint8_t>((raw >> 21) & 0x03u),
+        .s1 = static_cast<uint8_t>((raw >> 8) & 0x0Fu),
+        .s2 = static_cast<uint8_t>((raw >> 12) & 0x0Fu),
+        .pos1 = static_cast<uint8_t>((raw >> 16) & 0x1Fu),
+        .pos2 = static_cast<uint8_t>((raw >> 23) & 0x1Fu),
+        .d = static_cast<uint8_t>((raw >> 28) & 0x0Fu),
+    };
+  }
+};
+
+template <>
+struct Opfields<Format::BO> {
+  uint8_t op1;
+  uint8_t op2;
+  uint8_t s1d;
+  uint8_t s2;
+  int16_t off10;
+
+  static constexpr Opfields Decode(uint32_t raw) {
+    return {
+        .op1 = static_cast<uint8_t>(raw & 0xFFu),
+        .op2 = static_cast<uint8_t>((raw >> 22) & 0x3Fu),
+        .s1d = static_cast<uint8_t>((raw >> 8) & 0x0Fu),
+        .s2 = static_cast<uint8_t>((raw >> 12) & 0x0Fu),
+        .off10 = static_cast<int16_t>(SignExtend(
+            ((raw >> 16) & 0x3Fu) | ((raw >> 22) & 0x3C0u), 10)),
+    };
+  }
+};
+
+template <>
+struct Opfields<Format::BOL> {
+  uint8_t op1;
+  uint8_t s1d;
+  uint8_t s2;
+  int16_t off16;
+
+  static constexpr Opfields Decode(uint32_t raw) {
+    return {
+        .op1 = static_cast<uint8_t>(raw & 0xFFu),
+        .s1d = static_cast<uint8_t>((raw >> 8) & 0x0Fu),
+        .s2 = static_cast<uint8_t>((raw >> 12) & 0x0Fu),
+        .off16 = static_cast<int16_t>(((raw >> 16) & 0x3Fu) |
+                                      ((raw >> 22) & 0x3C0u) |
+                                      ((raw >> 12) & 0xFC00u)),
+    };
+  }
+};
+
+template <>
+struct Opfields<Format::BRC> {
+  uint8_t op1;
+  uint8_t op2;
+  uint8_t s1;
+  int8_t const4;
+  int16_t disp15;
+
+  static constexpr Opfields Decode(uint32_t raw) {
+    return {
+        .op1 = static_cast<uint8_t>(raw & 0xFFu),
+        .op2 = static_cast<uint8_t>((raw >> 31) & 0x01u),
+        .s1 = static_cast<uint8_t>((raw >> 8) & 0x0Fu),
+        .const4 = static_cast<int8_t>(SignExtend((raw >> 12) & 0x0Fu, 4)),
+        .disp15 = static_cast<int16_t>(SignExtend((raw >> 16) & 0x7FFFu, 15)),
+    };
+  }
+};
+
+template <>
+struct Opfields<Format::BRN> {
+  uint8_t op1;
+  uint8_t op2;
+  uint8_t n;
+  uint8_t s1;
+  int16_t disp15;
+
+  static constexpr Opfields Decode(uint32_t raw) {
+    return {
+        .op1 = static_cast<uint8_t>(raw & 0x7Fu),
+        .op2 = static_cast<uint8_t>((raw >> 31) & 0x01u),
+        .n = static_cast<uint8_t>(((raw >> 12) & 0x0Fu) | ((raw >> 3) & 0x10u)),
+        .s1 = static_cast<uint8_t>((raw >> 8) & 0x0Fu),
+        .disp15 = static_cast<int16_t>(SignExtend((raw >> 16) & 0x7FFFu, 15)),
+    };
+  }
+};
+
+template <>
+struct Opfields<Format::BRR> {
+  uint8_t op1;
+  uint8_t op2;
+  uint8_t s1;
+  uint8_t s2;
+  int16_t disp15;
+
+  static constexpr Opfields Decode(uint32_t raw) {
+    return {
+        .op1 = static_cast<uint8_t>(raw & 0xFFu),
+        .op2 = static_cast<uint8_t>((raw >> 31) & 0x01u),
+        .s1 = static_cast<uint8_t>((raw >> 8) & 0x0Fu),
+        .s2 = static_cast<uint8_t>((raw >> 12) & 0x0Fu),
+        .disp15 = static_cast<int16_t>(SignExtend((raw >> 16) & 0x7FFFu, 15)),
+    };
+  }
+};
+
+template <>
+struct Opfields<Format::RC> {
+  uint8_t op1;
+  uint8_t op2;
+  uint8_t s1;
+  uint8_t d;
+  int16_t const9;
+
+  static constexpr Opfields Decode(uint32_t raw) {
+    return {
+        .op1 = static_cast<uint8_t>(raw & 0xFFu),
+        .op2 = static_cast<uint8_t>((raw >> 21) & 0x7Fu),
+        .s1 = static_cast<uint8_t>((raw >> 8) & 0x0Fu),
+        .d = static_cast<uint8_t>((raw >> 28) & 0x0Fu),
+        .const9 = static_cast<int16_t>(SignExtend((raw >> 12) & 0x1FFu, 9)),
+    };
+  }
+};
+
+template <>
+struct Opfields<Format::RCPW> {
+  uint8_t op1;
+  uint8_t op2;
+  uint8_t s1;
+  int8_t const4;
+  uint8_t width;
+  uint8_t pos;
+  uint8_t d;
+
+  static constexpr Opfields Decode(uint32_t raw) {
+    return {
+        .op1 = static_cast<uint8_t>(raw & 0xFFu),
+        .op2 = static_cast<uint8_t>((raw >> 21) & 0x03u),
+        .s1 = static_cast<uint8_t>((raw >> 8) & 0x0Fu),
+        .const4 = static_cast<int8_t>(SignExtend((raw >> 12) & 0x0Fu, 4)),
+        .width = static_cast<uint8_t>((raw >> 16) & 0x1Fu),
+        .pos = static_cast<uint8_t>((raw >> 23) & 0x1Fu),
+        .d = static_cast<uint8_t>((raw >> 28) & 0x0Fu),
+    };
+  }
+};
+
+template <>
+struct Opfields<Format::RCR> {
+  uint8_t op1;
+  uint8_t op2;
+  uint8_t s1;
+  int16_t const9;
+  uint8_t s3;
+  uint8_t d;
+
+  static constexpr Opfields Decode(uint32_t raw) {
+    return {
+        .op1 = static_cast<uint8_t>(raw & 0xFFu),
+        .op2 = static_cast<uint8_t>((raw >> 21) & 0x07u),
+        .s1 = static_cast<uint8_t>((raw >> 8) & 0x0Fu),
+        .const9 = static_cast<int16_t>(SignExtend((raw >> 12) & 0x1FFu, 9)),
+        .s3 = static_cast<uint8_t>((raw >> 24) & 0x0Fu),
+        .d = static_cast<uint8_t>((raw >> 28) & 0x0Fu),
+    };
+  }
+};
+
+template <>
+struct Opfields<Format::RCRR> {
+  uint8_t op1;
+  uint8_t op2;
+  uint8_t s1;
+  int8_t const4;
+  uint8_t s3;
+  uint8_t d;
+
+  static constexpr Opfields Decode(uint32_t raw) {
+    return {
+        .op1 = static_cast<uint8_t>(raw & 0xFFu),
+        .op2 = static_cast<uint8_t>((raw >> 21) & 0x07u),
+        .s1 = static_cast<uint8_t>((raw >> 8) & 0x0Fu),
+        .const4 = static_cast<int8_t>(SignExtend((raw >> 12) & 0x0Fu, 4)),
+        .s3 = static_cast<uint8_t>((raw >> 24) & 0x0Fu),
+        .d = static_cast<uint8_t>((raw >> 28) & 0x0Fu),
+    };
+  }
+};
+
+template <>
+struct Opfields<Format::RCRW> {
+  uint8_t op1;
+  uint8_t op2;
+  uint8_t s1;
+  int8_t const4;
+  uint8_t width;
+  uint8_t s3;
+  uint8_t d;
+
+  static constexpr Opfields Decode(uint32_t raw) {
+    return {
+        .op1 = static_cast<uint8_t>(raw & 0xFFu),
+        .op2 = static_cast<uint8_t>((raw >> 21) & 0x07u),
+        .s1 = static_cast<uint8_t>((raw >> 8) & 0x0Fu),
+        .const4 = static_cast<int8_t>(SignExtend((raw >> 12) & 0x0Fu, 4)),
+        .width = static_cast<uint8_t>((raw >> 16) & 0x1Fu),
+        .s3 = static_cast<uint8_t>((raw >> 24) & 0x0Fu),
+        .d = static_cast<uint8_t>((raw >> 28) & 0x0Fu),
+    };
+  }
+};
+
+template <>
+struct Opfields<Format::RLC> {
+  uint8_t op1;
+  uint8_t s1;
+  int16_t const16;
+  uint8_t d;
+
+  static constexpr Opfields Decode(uint32_t raw) {
+    return {
+        .op1 = static_cast<uint8_t>(raw & 0xFFu),
+        .s1 = static_cast<uint8_t>((raw >> 8) & 0x0Fu),
+        .const16 = static_cast<int16_t>((raw >> 12) & 0xFFFFu),
+        .d = static_cast<uint8_t>((raw >> 28) & 0x0Fu),
+    };
+  }
+};
+
+template <>
+struct Opfields<Format::RR> {
+  uint8_t op1;
+  uint8_t op2;
+  uint8_t s1;
+  uint8_t s2;
+  uint8_t n;
+  uint8_t d;
+
+  static constexpr Opfields Decode(uint32_t raw) {
+    return {
+        .op1 = static_cast<uint8_t>(raw & 0xFFu),
+        .op2 = static_cast<uint8_t>((raw >> 20) & 0xFFu),
+        .s1 = static_cast<uint8_t>((raw >> 8) & 0x0Fu),
+        .s2 = static_cast<uint8_t>((raw >> 12) & 0x0Fu),
+        .n = static_cast<uint8_t>((raw >> 16) & 0x03u),
+        .d = static_cast<uint8_t>((raw >> 28) & 0x0Fu),
+    };
+  }
+};
+
+// op2 is wider than 8 bits in RR1 and RR2; only the low 8 bits are kept
+template <>
+struct Opfields<Format::RR1> {
+  uint8_t op1;
+  uint8_t op2;
+  uint8_t s1;
+  uint8_t s2;
+  uint8_t n;
+  uint8_t d;
+
+  static constexpr Opfields Decode(uint32_t raw) {
+    return {
+        .op1 = static_cast<uint8_t>(raw & 0xFFu),
+        .op2 = static_cast<uint8_t>((raw >> 18) & 0x3FFu),
+        .s1 = static_cast<uint8_t>((raw >> 8) & 0x0Fu),
+        .s2 = static_cast<uint8_t>((raw >> 12) & 0x0Fu),
+        .n = static_cast<uint8_t>((raw >> 16) & 0x03u),
+        .d = static_cast<uint8_t>((raw >> 28) & 0x0Fu),
+    };
+  }
+};
+
+template <>
+struct Opfields<Format::RR2> {
+  uint8_t op1;
+  uint8_t op2;
+  uint8_t s1;
+  uint8_t s2;
+  uint8_t d;
+
+  static constexpr Opfields Decode(uint32_t raw) {
+    return {
+        .op1 = static_cast<uint8_t>(raw & 0xFFu),
+        .op2 = static_cast<uint8_t>((raw >> 16) & 0xFFFu),
+        .s1 = static_cast<uint8_t>((raw >> 8) & 0x0Fu),
+        .s2 = static_cast<uint8_t>((raw >> 12) & 0x0Fu),
+        .d = static_cast<uint8_t>((raw >> 28) & 0x0Fu),
+    };
+  }
+};
+
+template <>
+struct Opfields<Format::RRPW> {
+  uint8_t op1;
+  uint8_t op2;
+  uint8_t s1;
+  uint8_t s2;
+  uint8_t width;
+  uint8_t pos;
+  uint8_t d;
+
+  static constexpr Opfields Decode(uint32_t raw) {
+    return {
+        .op1 = static_cast<uint8_t>(raw & 0xFFu),
+        .op2 = static_cast<uint8_t>((raw >> 21) & 0x03u),
+        .s1 = static_cast<uint8_t>((raw >> 8) & 0x0Fu),
+        .s2 = static_cast<uint8_t>((raw >> 12) & 0x0Fu),
+        .width = static_cast<uint8_t>((raw >> 16) & 0x1Fu),
+        .pos = static_cast<uint8_t>((raw >> 23) & 0x1Fu),
+        .d = static_cast<uint8_t>((raw >> 28) & 0x0Fu),
+    };
+  }
+};
+
+template <>
+struct Opfields<Format::RRR> {
+  uint8_t op1;
+  uint8_t op2;
+  uint8_t s1;
+  uint8_t s2;
+  uint8_t n;
+  uint8_t s3;
+  uint8_t d;
+
+  static constexpr Opfields Decode(uint32_t raw) {
+    return {
+        .op1 = static_cast<uint8_t>(raw & 0xFFu),
+        .op2 = static_cast<uint8_t>((raw >> 20) & 0x0Fu),
+        .s1 = static_cast<uint8_t>((raw >> 8) & 0x0Fu),
+        .s2 = static_cast<uint8_t>((raw >> 12) & 0x0Fu),
+        .n = static_cast<uint8_t>((raw >> 16) & 0x03u),
+        .s3 = static_cast<uint8_t>((raw >> 24) & 0x0Fu),
+        .d = static_cast<uint8_t>((raw >> 28) & 0x0Fu),
+    };
+  }
+};
+
+template <>
+struct Opfields<Format::RRR1> {
+  uint8_t op1;
+  uint8_t op2;
+  uint8_t s1;
+  uint8_t s2;
+  uint8_t n;
+  uint8_t s3;
+  uint8_t d;
+
+  static constexpr Opfields Decode(uint32_t raw) {
+    return {
+        .op1 = static_cast<uint8_t>(raw & 0xFFu),
+        .op2 = static_cast<uint8_t>((raw >> 18) & 0x3Fu),
+        .s1 = static_cast<uint8_t>((raw >> 8) & 0x0Fu),
+        .s2 = static_cast<uint8_t>((raw >> 12) & 0x0Fu),
+        .n = static_cast<uint8_t>((raw >> 16) & 0x03u),
+        .s3 = static_cast<uint8_t>((raw >> 24) & 0x0Fu),
+        .d = static_cast<uint8_t>((raw >> 28) & 0x0Fu),
+    };
+  }
+};
+
+template <>
+struct Opfields<Format::RRR2> {
+  uint8_t op1;
+  uint8_t op2;
+  uint8_t s1;
+  uint8_t s2;
+  uint8_t s3;
+  uint8_t d;
+
+  static constexpr Opfields Decode(uint32_t raw) {
+    return {
+        .op1 = static_cast<uint8_t>(raw & 0xFFu),
+        .op2 = static_cast<uint8_t>((raw >> 16) & 0xFFu),
+        .s1 = static_cast<uint8_t>((raw >> 8) & 0x0Fu),
+        .s2 = static_cast<uint8_t>((raw >> 12) & 0x0Fu),
+        .s3 = static_cast<uint8_t>((raw >> 24) & 0x0Fu),
+        .d = static_cast<uint8_t>((raw >> 28) & 0x0Fu),
+    };
+  }
+};
+
+template <>
+struct Opfields<Format::RRRR> {
+  uint8_t op1;
+  uint8_t op2;
+  uint8_t s1;
+  uint8_t s2;
+  uint8_t s3;
+  uint8_t d;
+
+  static constexpr Opfields Decode(uint32_t raw) {
+    return {
+        .op1 = static_cast<uint8_t>(raw & 0xFFu),
+        .op2 = static_cast<uint8_t>((raw >> 21) & 0x03u),
+        .s1 = static_cast<uint8_t>((raw >> 8) & 0x0Fu),
+        .s2 = static_cast<uint8_t>((raw >> 12) & 0x0Fu),
+        .s3 = static_cast<uint8_t>((raw >> 24) & 0x0Fu),
+        .d = static_cast<uint8_t>((raw >> 28) & 0x0Fu),
+    };
+  }
+};
+
+template <>
+struct Opfields<Format::RRRW> {
+  uint8_t op1;
+  uint8_t op2;
+  uint8_t s1;
+  uint8_t s2;
+  uint8_t width;
+  uint8_t s3;
+  uint8_t d;
+
+  static constexpr Opfields Decode(uint32_t raw) {
+    return {
+        .op1 = static_cast<uint8_t>(raw & 0xFFu),
+        .op2 = static_cast<uint8_t>((raw >> 21) & 0x03u),
+        .s1 = static_cast<uint8_t>((raw >> 8) & 0x0Fu),
+        .s2 = static_cast<uint8_t>((raw >> 12) & 0x0Fu),
+        .width = static_cast<uint8_t>((raw >> 16) & 0x1Fu),
+        .s3 = static_cast<uint8_t>((raw >> 24) & 0x0Fu),
+        .d = static_cast<uint8_t>((raw >> 28) & 0x0Fu),
+    };
+  }
+};
+
+template <>
+struct Opfields<Format::SYS> {
+  uint8_t op1;
+  uint8_t op2;
+  uint8_t s1d;
+
+  static constexpr Opfields Decode(uint32_t raw) {
+    return {
+        .op1 = static_cast<uint8_t>(raw & 0xFFu),
+        .op2 = static_cast<uint8_t>((raw >> 22) & 0x3Fu),
+        .s1d = static_cast<uint8_t>((raw >> 8) & 0x0Fu),
+    };
+  }
+};
+}  // namespace Tricore
+
+#endif  // BINARYNINJA_API_TRICORE_FORMATS_H
@@ -0,0 +1,171 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#include "instruction_stats.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <iterator>
+#include <mutex>
+
+namespace Tricore {
+// In InstructionId order
+static const char* const kInstructionNames[] = {
+    "Invalid",
+#define TRICORE_INSTRUCTION(name, written_flags, signature) #name,
+#include "instruction_table.def"
+};
+static_assert(std::size(kInstructionNames) == kInstructionIds);
+
+const char* InstructionName(InstructionId id) {
+  const size_t index = static_cast<size_t>(id);
+  return index < kInstructionIds ? kInstructionNames[index] : "?";
+}
+
+namespace {
+// One thread's counters. Only the owning thread writes them, so a relaxed
+// load and store is enough to increment and Collect() may read them at any
+// time.
+struct ThreadCounters {
+  ThreadCounters();
+  ~ThreadCounters();
+
+  std::atomic<uint64_t> counts[kInstructionIds][kInstructionEvents] = {};
+  std::atomic<uint64_t> lengthDecodes = 0;
+  InstructionId lifting = InstructionId::Invalid;
+};
+
+// The live threads' tables and the totals of the threads that have exited
+struct Registry {
+  std::mutex lock;
+  std::vector<const ThreadCounters*> threads;
+  uint64_t retired[kInstructionIds][kInstructionEvents] = {};
+  uint64_t retiredLengthDecodes = 0;
+};
+}  // namespace
+
+static Registry& GetRegistry() {
+  // Never destroyed, so threads exiting after static destruction has begun
+  // can still retire their counters
+  static Registry* registry = new Registry;
+  return *registry;
+}
+
+ThreadCounters::ThreadCounters() {
+  Registry& registry = GetRegistry();
+  std::lock_guard<std::mutex> guard(registry.lock);
+  registry.threads.push_back(this);
+}
+
+ThreadCounters::~ThreadCounters() {
+  Registry& registry = GetRegistry();
+  std::lock_guard<std::mutex> guard(registry.lock);
+  for (size_t id = 0; id < kInstructionIds; id++)
+    for (size_t event = 0; event < kInstructionEvents; event++)
+      registry.retired[id][event] +=
+          counts[id][event].load(std::memory_order_relaxed);
+  registry.retiredLengthDecodes +=
+      lengthDecodes.load(std::memory_order_relaxed);
+  std::erase(registry.threads, this);
+}
+
+static ThreadCounters& LocalCounters() {
+  thread_local ThreadCounters counters;
+  return counters;
+}
+
+static void Increment(std::atomic<uint64_t>& count) {
+  count.store(count.load(std::memory_order_relaxed) + 1,
+              std::memory_order_relaxed);
+}
+
+static void Increment(ThreadCounters& counters, InstructionId id,
+                      InstructionEvent event) {
+  Increment(
+      counters.counts[static_cast<size_t>(id)][static_cast<size_t>(event)]);
+}
+
+void InstructionStats::Count(InstructionId id, InstructionEvent event) {
+  Increment(LocalCounters(), id, event);
+}
+
+void InstructionStats::BeginLift(InstructionId id) {
+  LocalCounters().lifting = id;
+}
+
+void InstructionStats::CountUnimplemented() {
+  ThreadCounters& counters = LocalCounters();
+  Increment(counters, counters.lifting, InstructionEvent::Unimplemented);
+}
+
+void InstructionStats::CountLengthDecode() {
+  Increment(LocalCounters().lengthDecodes);
+}
+
+uint64_t InstructionStats::LengthDecodes() {
+  Registry& registry = GetRegistry();
+  std::lock_guard<std::mutex> guard(registry.lock);
+  uint64_t sum = registry.retiredLengthDecodes;
+  for (const ThreadCounters* thread : registry.threads)
+    sum += thread->lengthDecodes.load(std::memory_order_relaxed);
+  return sum;
+}
+
+std::vector<InstructionCounts> InstructionStats::Collect() {
+  std::vector<InstructionCounts> totals(kInstructionIds);
+  {
+    Registry& registry = GetRegistry();
+    std::lock_guard<std::mutex> guard(registry.lock);
+    for (size_t id = 0; id < kInstructionIds; id++) {
+      totals[id].id = static_cast<InstructionId>(id);
+      for (size_t event = 0; event < kInstructionEvents; event++) {
+        uint64_t sum = registry.retired[id][event];
+        for (const ThreadCounters* thread : registry.threads)
+          sum += thread->counts[id][event].load(std::memory_order_relaxed);
+        totals[id].counts[event] = sum;
+      }
+    }
+  }
+  std::erase_if(totals, [](const InstructionCounts& row) {
+    return std::all_of(std::begin(row.counts), std::end(row.counts),
+                       [](uint64_t count) { return count == 0; });
+  });
+  return totals;
+}
+
+std::string InstructionStats::Report() {
+  std::vector<InstructionCounts> rows = Collect();
+  auto total = [](const InstructionCounts& row) {
+    uint64_t sum = 0;
+    for (uint64_t count : row.counts) sum += count;
+    return sum;
+  };
+  std::stable_sort(rows.begin(), rows.end(),
+                   [&](const InstructionCounts& a, const InstructionCounts& b) {
+                     return total(a) > total(b);
+                   });
+
+  std::string report;
+  char line[128];
+  std::snprintf(line, sizeof(line), "%-20s %13s %13s %13s %13s %13s\n",
+                "instruction", "decoded", "rendered", "lifted",
+                "unimplemented", "rejected");
+  report += line;
+  for (const InstructionCounts& row : rows) {
+    std::snprintf(line, sizeof(line),
+                  "%-20s %13llu %13llu %13llu %13llu %13llu\n",
+                  InstructionName(row.id),
+                  static_cast<unsigned long long>(row.counts[0]),
+                  static_cast<unsigned long long>(row.counts[1]),
+                  static_cast<unsigned long long>(row.counts[2]),
+                  static_cast<unsigned long long>(row.counts[3]),
+                  static_cast<unsigned long long>(row.counts[4]));
+    report += line;
+  }
+  std::snprintf(line, sizeof(line), "%-20s %13llu\n", "(length only)",
+                static_cast<unsigned long long>(LengthDecodes()));
+  report += line;
+  return report;
+}
+}  // namespace Tricore
@@ -0,0 +1,67 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#ifndef BINARYNINJA_API_TRICORE_INSTRUCTION_STATS_H
+#define BINARYNINJA_API_TRICORE_INSTRUCTION_STATS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "decoder.h"
+
+namespace Tricore {
+// What the plugin did with an instruction. Cache hits are not counted, so
+// the counts measure the work done by the decoder and the handlers.
+enum class InstructionEvent : uint8_t {
+  Decoded,        // full decode; failed decodes count as Invalid, Rejected.
+                  // GetInstructionInfo's length-only decodes of instructions
+                  // that are not control flow are counted separately, see
+                  // InstructionStats::LengthDecodes()
+  Rendered,       // Text handler succeeded
+  Lifted,         // Lift handler succeeded
+  Unimplemented,  // lifted as il.Unimplemented()
+  Rejected,       // handler refused the decoded encoding
+};
+inline constexpr size_t kInstructionEvents = 5;
+
+struct InstructionCounts {
+  InstructionId id;
+  uint64_t counts[kInstructionEvents];
+
+  uint64_t operator[](InstructionEvent event) const {
+    return counts[static_cast<size_t>(event)];
+  }
+};
+
+// Per-instruction event counters. Each thread counts into its own table, so
+// counting is a thread-local increment with no shared cache lines; Collect()
+// sums the tables of the live threads and of those that have exited.
+class InstructionStats {
+ public:
+  static void Count(InstructionId id, InstructionEvent event);
+
+  // The Lift handlers have no InstructionId of their own, so the caller
+  // names the instruction being lifted and UNIMPLEMENTED counts against it
+  static void BeginLift(InstructionId id);
+  static void CountUnimplemented();
+
+  // The GetInstructionInfo fast path checks 16-bit encodings against a
+  // bitmap and never learns their InstructionId, so its decodes are only
+  // counted in total
+  static void CountLengthDecode();
+  static uint64_t LengthDecodes();
+
+  // Totals of every instruction with a nonzero count, in InstructionId order
+  static std::vector<InstructionCounts> Collect();
+  // Collect() as a table, one line per instruction, busiest first, followed
+  // by LengthDecodes()
+  static std::string Report();
+};
+
+// Name of the handler class decoding id
+const char* InstructionName(InstructionId id);
+}  // namespace Tricore
+
+#endif  // BINARYNINJA_API_TRICORE_INSTRUCTION_STATS_H
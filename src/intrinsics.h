@@ -0,0 +1,41 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#ifndef BINARYNINJA_API_TRICORE_INTRINSICS_H
+#define BINARYNINJA_API_TRICORE_INTRINSICS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+
+namespace Tricore {
+// How a packed operation handles a lane result that does not fit the lane
+enum class Saturation : uint8_t {
+  None,
+  Signed,
+  Unsigned,
+};
+
+// Intrinsic ids of the packed operations, from intrinsic_table.def
+enum class PackedOp : uint32_t {
+#define TRICORE_PACKED_OP(id, name, lane_bits, saturation, inputs) id,
+#include "intrinsic_table.def"
+};
+
+struct PackedOpInfo {
+  const char* name;
+  uint8_t laneBits;  // 8 for byte lanes, 16 for halfword lanes
+  Saturation saturation;
+  uint8_t inputs;  // data registers read
+};
+
+inline constexpr PackedOpInfo kPackedOps[] = {
+#define TRICORE_PACKED_OP(id, name, lane_bits, saturation, inputs) \
+  {name, lane_bits, Saturation::saturation, inputs},
+#include "intrinsic_table.def"
+};
+
+inline constexpr size_t kPackedOpCount = std::size(kPackedOps);
+}  // namespace Tricore
+
+#endif  // BINARYNINJA_API_TRICORE_INTRINSICS_H
@@ -6,101 +6,110 @@
 #include <cmath>
 #include <cstdint>
 
+#include "instruction_stats.h"
 #include "instructions.h"
+#include "intrinsics.h"
 #include "opcodes.h"
 #include "registers.h"
+#include "reject_log.h"
 #include "util.h"
 
 using namespace std;
 using namespace BinaryNinja;
 
-#define UNIMPLEMENTED(length)            \
-  il.AddInstruction(il.Unimplemented()); \
-  len = length;                          \
+#define UNIMPLEMENTED(length)             \
+  InstructionStats::CountUnimplemented(); \
+  il.AddInstruction(il.Unimplemented());  \
+  len = length;                           \
   return true;
 #define REGTOA(reg) reg += 16;
 #define REGTOE(reg) reg += 32;
 #define REGTOP(reg) reg += 48;
 
 namespace Tricore {
-void ssov(ExprId x, ExprId y, uint32_t result_reg, LowLevelILFunction& il,
-          size_t size) {
-  ExprId max_pos, max_neg, condition;
-  LowLevelILLabel trueLabel1, falseLabel1, trueLabel2, falseLabel2, doneLabel1;
-  max_pos = il.Sub(
-      size,
-      il.ShiftLeft(size, il.Const(size, 1), il.Sub(size, y, il.Const(size, 1))),
-      il.Const(size, 1));
-  max_neg = il.Neg(size, il.ShiftLeft(size, il.Const(size, 1),
-                                      il.Sub(size, y, il.Const(size, 1))));
-
-  condition = il.CompareSignedGreaterThan(size, x, max_pos);
-  il.AddInstruction(il.If(condition, trueLabel1, falseLabel1));
-  il.MarkLabel(trueLabel1);
-  il.AddInstruction(il.SetRegister(size, result_reg, max_pos));
-  il.AddInstruction(il.Goto(doneLabel1));
-
-  il.MarkLabel(falseLabel1);
-  condition = il.CompareSignedLessThan(size, x, max_neg);
-  il.AddInstruction(il.If(condition, trueLabel2, falseLabel2));
-  il.MarkLabel(trueLabel2);
-  il.AddInstruction(il.SetRegister(size, result_reg, max_neg));
-  il.AddInstruction(il.Goto(doneLabel1));
-
-  il.MarkLabel(falseLabel2);
-  il.AddInstruction(il.SetRegister(size, result_reg, x));
-  il.AddInstruction(il.Goto(doneLabel1));
+// result_reg = bound if past holds, else result_reg, as
+// result_reg ^ ((result_reg ^ bound) & -past) so the block is not split
+static void ClampTo(uint32_t result_reg, uint64_t bound, ExprId past,
+                    LowLevelILFunction& il, size_t size) {
+  il.AddInstruction(il.SetRegister(
+      size, result_reg,
+      il.Xor(size, il.Register(size, result_reg),
+             il.And(size,
+                    il.Xor(size, il.Register(size, result_reg),
+                           il.Const(size, bound)),
+                    il.Neg(size, il.BoolToInt(size, past))))));
+}
+
+// Temporary holding the condition mask of SelectTo
+static const uint32_t kSelectMask = 1002;
+
+// dest = condition ? if_true : if_false, selected with a bool-to-int mask
+// instead of an If so the basic block is not split. if_true and if_false
+// are both read before dest is written.
+static void SelectTo(uint32_t dest, ExprId condition, ExprId if_true,
+                     ExprId if_false, LowLevelILFunction& il, size_t size) {
+  il.AddInstruction(
+      il.SetRegister(size, LLIL_TEMP(kSelectMask),
+                     il.Neg(size, il.BoolToInt(size, condition))));
+  il.AddInstruction(il.SetRegister(
+      size, dest,
+      il.Or(size,
+            il.And(size, if_true, il.Register(size, LLIL_TEMP(kSelectMask))),
+            il.And(size, if_false,
+                   il.Not(size, il.Register(size, LLIL_TEMP(kSelectMask)))))));
+}
 
-  il.MarkLabel(doneLabel1);
-  return;
+// dest = op(inputs) for a packed byte or halfword operation, as one
+// intrinsic rather than an expansion per lane (see intrinsic_table.def)
+static void PackedTo(uint32_t dest, PackedOp op,
+                     const std::vector<ExprId>& inputs, uint32_t flags,
+                     LowLevelILFunction& il) {
+  il.AddInstruction(il.Intrinsic({RegisterOrFlag::Register(dest)},
+                                 static_cast<uint32_t>(op), inputs, flags));
 }
 
-void suov(ExprId x, ExprId y, uint32_t result_reg, LowLevelILFunction& il,
+// Saturates x to a y-bit signed value in result_reg
+void ssov(ExprId x, uint32_t y, uint32_t result_reg, LowLevelILFunction& il,
           size_t size) {
-  ExprId max_pos, condition;
-  LowLevelILLabel trueLabel1, falseLabel1, trueLabel2, falseLabel2, doneLabel1;
-  max_pos =
-      il.Sub(size, il.ShiftLeft(size, il.Const(size, 1), y), il.Const(size, 1));
-
-  condition = il.CompareUnsignedGreaterThan(size, x, max_pos);
-  il.AddInstruction(il.If(condition, trueLabel1, falseLabel1));
-  il.MarkLabel(trueLabel1);
-  il.AddInstruction(il.SetRegister(size, result_reg, max_pos));
-  il.AddInstruction(il.Goto(doneLabel1));
-
-  il.MarkLabel(falseLabel1);
-  condition = il.CompareUnsignedLessThan(size, x, il.Const(size, 0));
-  il.AddInstruction(il.If(condition, trueLabel2, falseLabel2));
-  il.MarkLabel(trueLabel2);
-  il.AddInstruction(il.SetRegister(size, result_reg, il.Const(size, 0)));
-  il.AddInstruction(il.Goto(doneLabel1));
-
-  il.MarkLabel(falseLabel2);
+  const uint64_t mask =
+      size >= 8 ? ~uint64_t{0} : (uint64_t{1} << size * 8) - 1;
+  const uint64_t max_pos = (uint64_t{1} << (y - 1)) - 1;
+  const uint64_t max_neg = ~max_pos & mask;
+
   il.AddInstruction(il.SetRegister(size, result_reg, x));
-  il.AddInstruction(il.Goto(doneLabel1));
+  ClampTo(result_reg, max_pos,
+          il.CompareSignedGreaterThan(size, il.Register(size, result_reg),
+                                      il.Const(size, max_pos)),
+          il, size);
+  ClampTo(result_reg, max_neg,
+          il.CompareSignedLessThan(size, il.Register(size, result_reg),
+                                   il.Const(size, max_neg)),
+          il, size);
+}
+
+// Saturates x to a y-bit unsigned value in result_reg
+void suov(ExprId x, uint32_t y, uint32_t result_reg, LowLevelILFunction& il,
+          size_t size) {
+  const uint64_t max_pos = y >= 64 ? ~uint64_t{0} : (uint64_t{1} << y) - 1;
 
-  il.MarkLabel(doneLabel1);
-  return;
+  il.AddInstruction(il.SetRegister(size, result_reg, x));
+  ClampTo(result_reg, max_pos,
+          il.CompareUnsignedGreaterThan(size, il.Register(size, result_reg),
+                                        il.Const(size, max_pos)),
+          il, size);
 }
 
+// result_reg = |x| as (x ^ (x >> 31)) - (x >> 31), without a branch
 void abs(ExprId x, uint32_t result_reg, LowLevelILFunction& il) {
-  ExprId absCondition;
-  LowLevelILLabel absTrue, absFalse, absDone;
-
-  absCondition = il.CompareSignedLessThan(WORD, x, il.Const(WORD, 0));
-  il.AddInstruction(il.If(absCondition, absTrue, absFalse));
-
-  il.MarkLabel(absTrue);
-  il.AddInstruction(
-      il.SetRegister(WORD, result_reg, il.Sub(WORD, il.Const(WORD, 0), x)));
-  il.AddInstruction(il.Goto(absDone));
-
-  il.MarkLabel(absFalse);
   il.AddInstruction(il.SetRegister(WORD, result_reg, x));
-  il.AddInstruction(il.Goto(absDone));
-
-  il.MarkLabel(absDone);
-  return;
+  il.AddInstruction(il.SetRegister(
+      WORD, result_reg,
+      il.Sub(WORD,
+             il.Xor(WORD, il.Register(WORD, result_reg),
+                    il.ArithShiftRight(WORD, il.Register(WORD, result_reg),
+                                       il.Const(WORD, 31))),
+             il.ArithShiftRight(WORD, il.Register(WORD, result_reg),
+                                il.Const(WORD, 31)))));
 }
 
 void float_is_nan(ExprId f, uint32_t result_reg, LowLevelILFunction& il) {
@@ -145,35 +154,524 @@ void float_is_denormal(ExprId f, uint32_t result_reg, LowLevelILFunction& il) {
   return;
 }
 
+// Fixed-point multiplies
+//
+// The .q and .h multiplies treat their operands as signed fractions (Q31
+// words and Q15 halfwords) and shift the product left by n, 0 or 1. With
+// n = 1 the halfword product 0x8000 * 0x8000 (-1.0 * -1.0) is saturated to
+// 0x7FFFFFFF. Everything is lifted as plain arithmetic on 64-bit values, so
+// dataflow follows the fixed-point loops through the multiply-accumulates.
+
+// Temporaries of the fixed-point helpers: the products and lane results of
+// the upper (+1) and lower (+0) halfwords, and the sums being saturated
+static const uint32_t kMacProduct = 1010;
+static const uint32_t kMacLane = 1012;
+static const uint32_t kMacSum = 1014;
+
+// Operand of a .q multiply: a whole data register or one of its halfwords
+enum class QOperand : uint8_t {
+  Word,
+  Lower,
+  Upper,
+};
+
+// Halfwords of Db multiplied with the upper and lower halfwords of Da by a
+// packed .h multiply, as in "mul.h e2, d4, d5 lu, #1"
+enum class HalfwordPair : uint8_t {
+  LL,
+  LU,
+  UL,
+  UU,
+};
+
+// How a packed .h multiply-accumulate applies the products of the upper
+// (word 1) and lower (word 0) halfwords of Da to its accumulator
+enum class PairMac : uint8_t {
+  Add,     // madd.h, maddm.h, maddr.h
+  Sub,     // msub.h, msubm.h, msubr.h
+  AddSub,  // maddsu.h, maddsum.h, maddsur.h: word 1 added, word 0 subtracted
+  SubAdd,  // msubad.h, msubadm.h, msubadr.h
+};
+
+// The upper or lower halfword of reg, sign extended to 32 bits
+static ExprId Halfword(uint8_t reg, bool upper, LowLevelILFunction& il) {
+  if (upper)
+    return il.ArithShiftRight(WORD, il.Register(WORD, reg), il.Const(WORD, 16));
+  return il.SignExtend(WORD, il.LowPart(HWORD, il.Register(WORD, reg)));
+}
+
+// Upper and lower words of the register pair reg_e
+static ExprId HighWord(uint32_t reg_e, LowLevelILFunction& il) {
+  return il.LowPart(WORD, il.LogicalShiftRight(DWORD, il.Register(DWORD, reg_e),
+                                               il.Const(WORD, 32)));
+}
+
+static ExprId LowWord(uint32_t reg_e, LowLevelILFunction& il) {
+  return il.LowPart(WORD, il.Register(DWORD, reg_e));
+}
+
+// reg_e = {high, low} for 32-bit high and low
+static void SetPairTo(uint32_t reg_e, ExprId high, ExprId low,
+                      LowLevelILFunction& il) {
+  il.AddInstruction(il.SetRegister(
+      DWORD, reg_e,
+      il.Or(DWORD,
+            il.ShiftLeft(DWORD, il.ZeroExtend(DWORD, high), il.Const(WORD, 32)),
+            il.ZeroExtend(DWORD, low))));
+}
+
+// dest = (a * b) << n for sign-extended halfwords a and b, saturating
+// 0x8000 * 0x8000 << 1 to 0x7FFFFFFF. That is the only product that comes
+// out as 0x80000000, so one is subtracted when it does.
+static void QMulHalfwordsTo(uint32_t dest, ExprId a, ExprId b, uint8_t n,
+                            LowLevelILFunction& il) {
+  il.AddInstruction(il.SetRegister(
+      WORD, dest,
+      il.ShiftLeft(WORD, il.Mult(WORD, a, b), il.Const(WORD, n))));
+  if (n != 1)
+    return;
+  il.AddInstruction(il.SetRegister(
+      WORD, dest,
+      il.Sub(WORD, il.Register(WORD, dest),
+             il.BoolToInt(WORD, il.CompareEqual(WORD, il.Register(WORD, dest),
+                                                il.Const(WORD, 0x80000000))))));
+}
+
+// The .q product of Da and Db, shifted left by n, as a 64-bit value at the
+// bit position its result accumulates at: a 64-bit (wide) result takes the
+// 32 x 32 and 32 x 16 bit products as they are and the 16 x 16 bit product
+// << 16, a 32-bit result takes bits [63:32] and [47:16] of the first two and
+// the 16 x 16 bit product as it is. Those bits are shifted out of the exact
+// product, which fits; only 0x80000000 * 0x80000000 << 1 wraps to -2^63 when
+// taken whole.
+static ExprId QProduct(uint8_t reg_da, QOperand a, uint8_t reg_db, QOperand b,
+                       uint8_t n, bool wide, LowLevelILFunction& il) {
+  if (a != QOperand::Word) {
+    QMulHalfwordsTo(LLIL_TEMP(kMacProduct),
+                    Halfword(reg_da, a == QOperand::Upper, il),
+                    Halfword(reg_db, b == QOperand::Upper, il), n, il);
+    const ExprId product =
+        il.SignExtend(DWORD, il.Register(WORD, LLIL_TEMP(kMacProduct)));
+    return wide ? il.ShiftLeft(DWORD, product, il.Const(WORD, 16)) : product;
+  }
+  const ExprId db = b == QOperand::Word
+                        ? il.Register(WORD, reg_db)
+                        : Halfword(reg_db, b == QOperand::Upper, il);
+  const ExprId product =
+      il.MultDoublePrecSigned(DWORD, il.Register(WORD, reg_da), db);
+  if (wide)
+    return il.ShiftLeft(DWORD, product, il.Const(WORD, n));
+  return il.ArithShiftRight(
+      DWORD, product, il.Const(WORD, (b == QOperand::Word ? 32 : 16) - n));
+}
+
+// dest = acc + value, or acc - value when subtract is set, for a size-byte
+// (WORD or DWORD) acc and a 64-bit value. With saturate the exact result is
+// saturated to the signed range of size bytes; round adds 0x8000 to the
+// 32-bit results first.
+static void MacTo(uint32_t dest, ExprId acc, ExprId value, bool subtract,
+                  bool saturate, bool round, size_t size,
+                  LowLevelILFunction& il) {
+  const auto combine = [&](size_t width, ExprId x, ExprId y) {
+    ExprId result = subtract ? il.Sub(width, x, y) : il.Add(width, x, y);
+    return round ? il.Add(width, result, il.Const(width, 0x8000)) : result;
+  };
+  const uint32_t sum = LLIL_TEMP(kMacSum);
+  if (size == WORD) {
+    if (!saturate) {
+      il.AddInstruction(il.SetRegister(
+          WORD, dest, combine(WORD, acc, il.LowPart(WORD, value))));
+      return;
+    }
+    ssov(combine(DWORD, il.SignExtend(DWORD, acc), value), 32, sum, il, DWORD);
+    il.AddInstruction(il.SetRegister(
+        WORD, dest, il.LowPart(WORD, il.Register(DWORD, sum))));
+    return;
+  }
+  if (!saturate) {
+    il.AddInstruction(il.SetRegister(DWORD, dest, combine(DWORD, acc, value)));
+    return;
+  }
+  // A 64-bit sum has no wider type to saturate from: it overflowed when its
+  // sign differs from both operands' (from acc's and not value's for a
+  // difference), and then saturates towards the sign of acc.
+  const uint32_t x = LLIL_TEMP(kMacSum + 1), y = LLIL_TEMP(kMacSum + 2);
+  il.AddInstruction(il.SetRegister(DWORD, x, acc));
+  il.AddInstruction(il.SetRegister(DWORD, y, value));
+  il.AddInstruction(il.SetRegister(
+      DWORD, sum,
+      combine(DWORD, il.Register(DWORD, x), il.Register(DWORD, y))));
+  const ExprId overflow =
+      subtract
+          ? il.And(DWORD,
+                   il.Xor(DWORD, il.Register(DWORD, x), il.Register(DWORD, y)),
+                   il.Xor(DWORD, il.Register(DWORD, x),
+                          il.Register(DWORD, sum)))
+          : il.And(DWORD,
+                   il.Xor(DWORD, il.Register(DWORD, x),
+                          il.Register(DWORD, sum)),
+                   il.Xor(DWORD, il.Register(DWORD, y),
+                          il.Register(DWORD, sum)));
+  const ExprId past = il.CompareSignedLessThan(DWORD, overflow,
+                                               il.Const(DWORD, 0));
+  const ExprId bound =
+      il.Xor(DWORD,
+             il.ArithShiftRight(DWORD, il.Register(DWORD, x),
+                                il.Const(WORD, 63)),
+             il.Const(DWORD, 0x7FFFFFFFFFFFFFFF));
+  il.AddInstruction(il.SetRegister(
+      DWORD, sum,
+      il.Xor(DWORD, il.Register(DWORD, sum),
+             il.And(DWORD, il.Xor(DWORD, il.Register(DWORD, sum), bound),
+                    il.Neg(DWORD, il.BoolToInt(DWORD, past))))));
+  il.AddInstruction(il.SetRegister(DWORD, dest, il.Register(DWORD, sum)));
+}
+
+// dest = Da * Db << n for mul.q, taking the upper word of the 64-bit
+// product when dest is 32 bits (size WORD)
+static void MulQTo(uint32_t dest, uint8_t reg_da, QOperand a, uint8_t reg_db,
+                   QOperand b, uint8_t n, size_t size, LowLevelILFunction& il) {
+  if (size == WORD && a != QOperand::Word) {
+    QMulHalfwordsTo(dest, Halfword(reg_da, a == QOperand::Upper, il),
+                    Halfword(reg_db, b == QOperand::Upper, il), n, il);
+    return;
+  }
+  const ExprId product = QProduct(reg_da, a, reg_db, b, n, size == DWORD, il);
+  il.AddInstruction(il.SetRegister(
+      size, dest, size == WORD ? il.LowPart(WORD, product) : product));
+}
+
+// dest = acc + (Da * Db << n), or acc - ..., for madd.q and msub.q
+static void MacQTo(uint32_t dest, ExprId acc, uint8_t reg_da, QOperand a,
+                   uint8_t reg_db, QOperand b, uint8_t n, bool subtract,
+                   bool saturate, size_t size, LowLevelILFunction& il) {
+  MacTo(dest, acc, QProduct(reg_da, a, reg_db, b, n, size == DWORD, il),
+        subtract, saturate, false, size, il);
+}
+
+// reg_dc = (acc +- (Da.x * Db.x << n) + 0x8000) & 0xFFFF0000, for the upper
+// or lower halfwords x, as maddr.q and msubr.q
+static void MacRoundedQTo(uint32_t reg_dc, ExprId acc, uint8_t reg_da,
+                          uint8_t reg_db, bool upper, uint8_t n, bool subtract,
+                          bool saturate, LowLevelILFunction& il) {
+  const QOperand half = upper ? QOperand::Upper : QOperand::Lower;
+  MacTo(reg_dc, acc, QProduct(reg_da, half, reg_db, half, n, false, il),
+        subtract, saturate, true, WORD, il);
+  il.AddInstruction(il.SetRegister(
+      WORD, reg_dc,
+      il.And(WORD, il.Register(WORD, reg_dc), il.Const(WORD, 0xFFFF0000))));
+}
+
+// reg_dc = ((Da.x * Db.x << n) + 0x8000) & 0xFFFF0000 for mulr.q
+static void MulRoundedQTo(uint32_t reg_dc, uint8_t reg_da, uint8_t reg_db,
+                          bool upper, uint8_t n, LowLevelILFunction& il) {
+  QMulHalfwordsTo(LLIL_TEMP(kMacProduct), Halfword(reg_da, upper, il),
+                  Halfword(reg_db, upper, il), n, il);
+  il.AddInstruction(il.SetRegister(
+      WORD, reg_dc,
+      il.And(WORD,
+             il.Add(WORD, il.Register(WORD, LLIL_TEMP(kMacProduct)),
+                    il.Const(WORD, 0x8000)),
+             il.Const(WORD, 0xFFFF0000))));
+}
+
+// The products of a packed .h multiply, into LLIL_TEMP(kMacProduct + 1) for
+// the upper halfword of Da and LLIL_TEMP(kMacProduct) for the lower one
+static void QMulPairTo(uint8_t reg_da, uint8_t reg_db, HalfwordPair pair,
+                       uint8_t n, LowLevelILFunction& il) {
+  const bool upper1 = pair == HalfwordPair::UL || pair == HalfwordPair::UU;
+  const bool upper0 = pair == HalfwordPair::LU || pair == HalfwordPair::UU;
+  QMulHalfwordsTo(LLIL_TEMP(kMacProduct + 1), Halfword(reg_da, true, il),
+                  Halfword(reg_db, upper1, il), n, il);
+  QMulHalfwordsTo(LLIL_TEMP(kMacProduct), Halfword(reg_da, false, il),
+                  Halfword(reg_db, upper0, il), n, il);
+}
+
+// Product of word 1 or word 0 from QMulPairTo, sign extended to 64 bits
+static ExprId PairProduct(uint32_t word, LowLevelILFunction& il) {
+  return il.SignExtend(DWORD,
+                       il.Register(WORD, LLIL_TEMP(kMacProduct + word)));
+}
+
+// Whether mac subtracts the product of word 1 or word 0
+static bool PairSubtracts(PairMac mac, uint32_t word) {
+  return mac == PairMac::Sub ||
+         mac == (word ? PairMac::SubAdd : PairMac::AddSub);
+}
+
+// reg_ec = {word 1, word 0} for mul.h
+static void MulPairTo(uint32_t reg_ec, uint8_t reg_da, uint8_t reg_db,
+                      HalfwordPair pair, uint8_t n, LowLevelILFunction& il) {
+  QMulPairTo(reg_da, reg_db, pair, n, il);
+  SetPairTo(reg_ec, il.Register(WORD, LLIL_TEMP(kMacProduct + 1)),
+            il.Register(WORD, LLIL_TEMP(kMacProduct)), il);
+}
+
+// reg_ec = {Ed[63:32] +- word 1, Ed[31:0] +- word 0} for madd.h, msubad.h,
+// ..., each word saturated on its own
+static void MacPairTo(uint32_t reg_ec, uint32_t reg_ed, uint8_t reg_da,
+                      uint8_t reg_db, HalfwordPair pair, uint8_t n,
+                      PairMac mac, bool saturate, LowLevelILFunction& il) {
+  QMulPairTo(reg_da, reg_db, pair, n, il);
+  MacTo(LLIL_TEMP(kMacLane + 1), HighWord(reg_ed, il), PairProduct(1, il),
+        PairSubtracts(mac, 1), saturate, false, WORD, il);
+  MacTo(LLIL_TEMP(kMacLane), LowWord(reg_ed, il), PairProduct(0, il),
+        PairSubtracts(mac, 0), saturate, false, WORD, il);
+  SetPairTo(reg_ec, il.Register(WORD, LLIL_TEMP(kMacLane + 1)),
+            il.Register(WORD, LLIL_TEMP(kMacLane)), il);
+}
+
+// The sum of the two products, or their difference for maddsum.h and
+// msubadm.h, << 16 as the multi-precision forms accumulate it
+static ExprId PairSum(PairMac mac, LowLevelILFunction& il) {
+  const ExprId sum =
+      mac == PairMac::AddSub || mac == PairMac::SubAdd
+          ? il.Sub(DWORD, PairProduct(1, il), PairProduct(0, il))
+          : il.Add(DWORD, PairProduct(1, il), PairProduct(0, il));
+  return il.ShiftLeft(DWORD, sum, il.Const(WORD, 16));
+}
+
+// reg_ec = (word 1 + word 0) << 16 for mulm.h
+static void MulMultiPrecisionTo(uint32_t reg_ec, uint8_t reg_da,
+                                uint8_t reg_db, HalfwordPair pair, uint8_t n,
+                                LowLevelILFunction& il) {
+  QMulPairTo(reg_da, reg_db, pair, n, il);
+  il.AddInstruction(il.SetRegister(DWORD, reg_ec, PairSum(PairMac::Add, il)));
+}
+
+// reg_ec = Ed +- ((word 1 +- word 0) << 16) for maddm.h, msubadm.h, ...
+static void MacMultiPrecisionTo(uint32_t reg_ec, uint32_t reg_ed,
+                                uint8_t reg_da, uint8_t reg_db,
+                                HalfwordPair pair, uint8_t n, PairMac mac,
+                                bool saturate, LowLevelILFunction& il) {
+  QMulPairTo(reg_da, reg_db, pair, n, il);
+  MacTo(reg_ec, il.Register(DWORD, reg_ed), PairSum(mac, il),
+        mac == PairMac::Sub || mac == PairMac::SubAdd, saturate, false, DWORD,
+        il);
+}
+
+// reg_dc = {upper halfwords of the two rounded lane results}
+static void PackRoundedTo(uint32_t reg_dc, LowLevelILFunction& il) {
+  il.AddInstruction(il.SetRegister(
+      WORD, reg_dc,
+      il.Or(WORD,
+            il.And(WORD, il.Register(WORD, LLIL_TEMP(kMacLane + 1)),
+                   il.Const(WORD, 0xFFFF0000)),
+            il.LogicalShiftRight(WORD, il.Register(WORD, LLIL_TEMP(kMacLane)),
+                                 il.Const(WORD, 16)))));
+}
+
+// reg_dc = {(word 1 + 0x8000)[31:16], (word 0 + 0x8000)[31:16]} for mulr.h
+static void MulRoundedPairTo(uint32_t reg_dc, uint8_t reg_da, uint8_t reg_db,
+                             HalfwordPair pair, uint8_t n,
+                             LowLevelILFunction& il) {
+  QMulPairTo(reg_da, reg_db, pair, n, il);
+  for (uint32_t word = 0; word < 2; word++) {
+    il.AddInstruction(il.SetRegister(
+        WORD, LLIL_TEMP(kMacLane + word),
+        il.Add(WORD, il.Register(WORD, LLIL_TEMP(kMacProduct + word)),
+               il.Const(WORD, 0x8000))));
+  }
+  PackRoundedTo(reg_dc, il);
+}
+
+// reg_dc = {(acc1 +- word 1 + 0x8000)[31:16], (acc0 +- word 0 + 0x8000)[31:16]}
+// for maddr.h, msubadr.h, ..., where acc1 and acc0 are the halfwords of Dd
+// << 16 when reg_acc is a data register (acc_size WORD), or the words of Ed
+static void MacRoundedPairTo(uint32_t reg_dc, uint32_t reg_acc,
+                             size_t acc_size, uint8_t reg_da, uint8_t reg_db,
+                             HalfwordPair pair, uint8_t n, PairMac mac,
+                             bool saturate, LowLevelILFunction& il) {
+  ExprId acc1, acc0;
+  if (acc_size == DWORD) {
+    acc1 = HighWord(reg_acc, il);
+    acc0 = LowWord(reg_acc, il);
+  } else {
+    acc1 = il.And(WORD, il.Register(WORD, reg_acc), il.Const(WORD, 0xFFFF0000));
+    acc0 = il.ShiftLeft(WORD, il.Register(WORD, reg_acc), il.Const(WORD, 16));
+  }
+  QMulPairTo(reg_da, reg_db, pair, n, il);
+  MacTo(LLIL_TEMP(kMacLane + 1), acc1, PairProduct(1, il),
+        PairSubtracts(mac, 1), saturate, true, WORD, il);
+  MacTo(LLIL_TEMP(kMacLane), acc0, PairProduct(0, il), PairSubtracts(mac, 0),
+        saturate, true, WORD, il);
+  PackRoundedTo(reg_dc, il);
+}
+
+// Context save areas
+//
+// CALL and RET, the context instructions (svlcx, rslcx, stucx, ...) and
+// RTOS task switches move the upper and lower contexts through 16-word
+// context save areas (CSAs) in memory. The free CSAs form a list headed by
+// FCX and the saved contexts a list headed by PCXI, linked through word 0 of
+// each CSA. Both are lifted as loads and stores of the CSA words and updates
+// of the links in bits [19:0] of FCX and PCXI. The call depth counter, the
+// PCXI.UL, PIE and PCPN bits and the CSA list traps are not modelled.
+
+// Registers of the upper and lower contexts, in CSA word order
+static const uint32_t kUpperContext[16] = {
+    TRICORE_REG_PCXI, TRICORE_REG_PSW, TRICORE_REG_A10, TRICORE_REG_A11,
+    TRICORE_REG_D8,   TRICORE_REG_D9,  TRICORE_REG_D10, TRICORE_REG_D11,
+    TRICORE_REG_A12,  TRICORE_REG_A13, TRICORE_REG_A14, TRICORE_REG_A15,
+    TRICORE_REG_D12,  TRICORE_REG_D13, TRICORE_REG_D14, TRICORE_REG_D15};
+static const uint32_t kLowerContext[16] = {
+    TRICORE_REG_PCXI, TRICORE_REG_A11, TRICORE_REG_A2, TRICORE_REG_A3,
+    TRICORE_REG_D0,   TRICORE_REG_D1,  TRICORE_REG_D2, TRICORE_REG_D3,
+    TRICORE_REG_A4,   TRICORE_REG_A5,  TRICORE_REG_A6, TRICORE_REG_A7,
+    TRICORE_REG_D4,   TRICORE_REG_D5,  TRICORE_REG_D6, TRICORE_REG_D7};
+
+// Temporaries of the context helpers: the CSA address, the link read from
+// its word 0, the return address of RET, the target of CALLI, and the
+// caller's upper context and FCX kept across a call (17 words)
+static const uint32_t kCsaAddress = 1020;
+static const uint32_t kCsaLink = 1021;
+static const uint32_t kReturnAddress = 1022;
+static const uint32_t kCallTarget = 1023;
+static const uint32_t kCallerContext = 1024;
+
+// Address of the CSA a link (FCX, PCXI or a CSA word 0) points to: segment
+// bits [19:16] go to [31:28] and offset bits [15:0] to [21:6]
+static ExprId CsaAddress(ExprId link, LowLevelILFunction& il) {
+  return il.Or(WORD,
+               il.ShiftLeft(WORD, il.And(WORD, link, il.Const(WORD, 0xF0000)),
+                            il.Const(WORD, 12)),
+               il.ShiftLeft(WORD, il.And(WORD, link, il.Const(WORD, 0xFFFF)),
+                            il.Const(WORD, 6)));
+}
+
+// Address of word i of the CSA at LLIL_TEMP(kCsaAddress)
+static ExprId CsaWord(uint32_t i, LowLevelILFunction& il) {
+  const ExprId base = il.Register(WORD, LLIL_TEMP(kCsaAddress));
+  return i ? il.Add(WORD, base, il.Const(WORD, 4 * i)) : base;
+}
+
+// reg = (reg & 0xFFF00000) | (link & 0x000FFFFF), pointing FCX or PCXI at
+// another CSA
+static void LinkTo(uint32_t reg, ExprId link, LowLevelILFunction& il) {
+  il.AddInstruction(il.SetRegister(
+      WORD, reg,
+      il.Or(WORD,
+            il.And(WORD, il.Register(WORD, reg), il.Const(WORD, 0xFFF00000)),
+            il.And(WORD, link, il.Const(WORD, 0x000FFFFF)))));
+}
+
+// Stores the 16 words of context to the CSA at LLIL_TEMP(kCsaAddress)
+static void StoreContext(const uint32_t (&context)[16],
+                         LowLevelILFunction& il) {
+  for (uint32_t i = 0; i < 16; i++) {
+    il.AddInstruction(
+        il.Store(WORD, CsaWord(i, il), il.Register(WORD, context[i])));
+  }
+}
+
+// Loads words first to 15 of context from the CSA at LLIL_TEMP(kCsaAddress)
+static void LoadContext(const uint32_t (&context)[16], uint32_t first,
+                        LowLevelILFunction& il) {
+  for (uint32_t i = first; i < 16; i++) {
+    il.AddInstruction(
+        il.SetRegister(WORD, context[i], il.Load(WORD, CsaWord(i, il))));
+  }
+}
+
+// Saves context (CALL, SVLCX) to the CSA at the head of the free list, which
+// moves to the head of the saved list: FCX takes the CSA's link and PCXI,
+// saved in its word 0, points at it
+static void SaveContext(const uint32_t (&context)[16], LowLevelILFunction& il) {
+  il.AddInstruction(
+      il.SetRegister(WORD, LLIL_TEMP(kCsaAddress),
+                     CsaAddress(il.Register(WORD, TRICORE_REG_FCX), il)));
+  il.AddInstruction(il.SetRegister(WORD, LLIL_TEMP(kCsaLink),
+                                   il.Load(WORD, CsaWord(0, il))));
+  StoreContext(context, il);
+  LinkTo(TRICORE_REG_PCXI, il.Register(WORD, TRICORE_REG_FCX), il);
+  LinkTo(TRICORE_REG_FCX, il.Register(WORD, LLIL_TEMP(kCsaLink)), il);
+}
+
+// Restores context (RET, RSLCX) from the CSA at the head of the saved list,
+// which moves back to the head of the free list: PCXI takes the link in its
+// word 0, which is replaced by FCX, and FCX points at it
+static void RestoreContext(const uint32_t (&context)[16],
+                           LowLevelILFunction& il) {
+  il.AddInstruction(
+      il.SetRegister(WORD, LLIL_TEMP(kCsaAddress),
+                     CsaAddress(il.Register(WORD, TRICORE_REG_PCXI), il)));
+  il.AddInstruction(il.SetRegister(WORD, LLIL_TEMP(kCsaLink),
+                                   il.Load(WORD, CsaWord(0, il))));
+  LoadContext(context, 1, il);
+  il.AddInstruction(
+      il.Store(WORD, CsaWord(0, il), il.Register(WORD, TRICORE_REG_FCX)));
+  LinkTo(TRICORE_REG_FCX, il.Register(WORD, TRICORE_REG_PCXI), il);
+  il.AddInstruction(il.SetRegister(WORD, TRICORE_REG_PCXI,
+                                   il.Register(WORD, LLIL_TEMP(kCsaLink))));
+}
+
+// Sets LLIL_TEMP(kCsaAddress) to the ABS or BO operand address of ldlcx,
+// lducx, stlcx or stucx
+static void SetCsaOperand(uint8_t op1, const uint8_t* data,
+                          LowLevelILFunction& il) {
+  if (op1 == OP1_x15_ABS) {
+    uint8_t op1, op2, reg_aa;
+    uint32_t ea;
+    Instruction::ExtractOpfieldsABS(data, op1, op2, reg_aa, ea);
+    il.AddInstruction(il.SetRegister(WORD, LLIL_TEMP(kCsaAddress),
+                                     il.ConstPointer(WORD, ea)));
+    return;
+  }
+  uint8_t op2, reg_aa, reg_ab;
+  int16_t off10;
+  Instruction::ExtractOpfieldsBO(data, op1, op2, reg_aa, reg_ab, off10);
+  REGTOA(reg_ab)
+  il.AddInstruction(il.SetRegister(
+      WORD, LLIL_TEMP(kCsaAddress),
+      il.Add(WORD, il.Register(WORD, reg_ab),
+             il.SignExtend(WORD, il.Const(HWORD, off10)))));
+}
+
+// The caller's side of CALL, CALLA and CALLI: saves the upper context, sets
+// A11 to the return address and calls target, which is read after A11 is
+// set. The callee's RET restores the caller's upper context, PCXI and FCX,
+// so they are set back after the call from copies taken before it, rather
+// than reloaded from a CSA the callee may have written.
+static void CallWithContext(ExprId target, uint64_t return_address,
+                            LowLevelILFunction& il) {
+  for (uint32_t i = 0; i < 16; i++) {
+    il.AddInstruction(il.SetRegister(WORD, LLIL_TEMP(kCallerContext + i),
+                                     il.Register(WORD, kUpperContext[i])));
+  }
+  il.AddInstruction(il.SetRegister(WORD, LLIL_TEMP(kCallerContext + 16),
+                                   il.Register(WORD, TRICORE_REG_FCX)));
+  SaveContext(kUpperContext, il);
+  il.AddInstruction(il.SetRegister(WORD, TRICORE_REG_A11,
+                                   il.ConstPointer(WORD, return_address)));
+  il.AddInstruction(il.Call(target));
+  for (uint32_t i = 0; i < 16; i++) {
+    il.AddInstruction(
+        il.SetRegister(WORD, kUpperContext[i],
+                       il.Register(WORD, LLIL_TEMP(kCallerContext + i))));
+  }
+  il.AddInstruction(
+      il.SetRegister(WORD, TRICORE_REG_FCX,
+                     il.Register(WORD, LLIL_TEMP(kCallerContext + 16))));
+}
+
 bool Abs::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                size_t& len, LowLevelILFunction& il) {
   if (op1 != OP1_x0B_RR || op2 != ABS_DC_DB) {
-    LogDebug("0x%lx: Abs::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT("0x%lx: Abs::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
     return false;
   }
   {
     ExprId condition;
-    LowLevelILLabel trueLabel, falseLabel, doneLabel;
     len = 4;
     uint8_t reg_dc, reg_db, op1, op2, s1, n;
     char buf[32];
     Instruction::ExtractOpfieldsRR(data, op1, op2, s1, reg_db, n, reg_dc);
     condition = il.CompareSignedGreaterEqual(WORD, il.Register(WORD, reg_db),
                                              il.Const(WORD, 0));
-    il.AddInstruction(il.If(condition, trueLabel, falseLabel));
-
-    il.MarkLabel(trueLabel);
-    il.AddInstruction(il.SetRegister(WORD, reg_dc, il.Register(WORD, reg_db)));
-    il.AddInstruction(il.Goto(doneLabel));
-
-    il.MarkLabel(falseLabel);
-    il.AddInstruction(il.SetRegister(
-        WORD, reg_dc,
-        il.Sub(WORD, il.Const(WORD, 0), il.Register(WORD, reg_db))));
-    il.AddInstruction(il.Goto(doneLabel));
-
-    il.MarkLabel(doneLabel);
+    SelectTo(reg_dc, condition, il.Register(WORD, reg_db),
+             il.Sub(WORD, il.Const(WORD, 0), il.Register(WORD, reg_db)), il,
+             WORD);
     return true;
   }
 }
@@ -181,153 +679,30 @@ bool Abs::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Absbh::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                  size_t& len, LowLevelILFunction& il) {
   if (op1 != OP1_x0B_RR) {
-    LogDebug("0x%lx: Absbh::%s received invalid opcode 1 0x%x", addr, __func__,
-             op1);
+    TRICORE_LOG_REJECT("0x%lx: Absbh::%s received invalid opcode 1 0x%x", addr,
+                       __func__, op1);
     return false;
   }
   switch (op2) {
     case ABSB_DC_DB: {
-      ExprId result_byte0, result_byte1, result_byte2, result_byte3, result,
-          condition;
-      LowLevelILLabel trueLabel, falseLabel, doneLabel;
       len = 4;
       uint8_t reg_dc, reg_db, op1, op2, s1, n;
       Instruction::ExtractOpfieldsRR(data, op1, op2, s1, reg_db, n, reg_dc);
-      result_byte0 =
-          il.And(WORD, il.Register(WORD, reg_db), il.Const(WORD, 0x000000FF));
-      result_byte1 =
-          il.And(WORD,
-                 il.LogicalShiftRight(WORD, il.Register(WORD, reg_db),
-                                      il.Const(WORD, 8)),
-                 il.Const(WORD, 0x000000FF));
-      result_byte2 =
-          il.And(WORD,
-                 il.LogicalShiftRight(WORD, il.Register(WORD, reg_db),
-                                      il.Const(WORD, 16)),
-                 il.Const(WORD, 0x000000FF));
-      result_byte3 =
-          il.And(WORD,
-                 il.LogicalShiftRight(WORD, il.Register(WORD, reg_db),
-                                      il.Const(WORD, 24)),
-                 il.Const(WORD, 0x000000FF));
-
-      il.AddInstruction(il.SetRegister(BYTE, LLIL_TEMP(0), result_byte0));
-      il.AddInstruction(il.SetRegister(BYTE, LLIL_TEMP(1), result_byte1));
-      il.AddInstruction(il.SetRegister(BYTE, LLIL_TEMP(2), result_byte2));
-      il.AddInstruction(il.SetRegister(BYTE, LLIL_TEMP(3), result_byte3));
-
-      condition = il.CompareSignedGreaterEqual(
-          BYTE, il.Register(BYTE, LLIL_TEMP(0)), il.Const(BYTE, 0));
-      il.AddInstruction(il.If(condition, trueLabel, falseLabel));
-      il.MarkLabel(trueLabel);
-      il.AddInstruction(il.Goto(doneLabel));
-      il.MarkLabel(falseLabel);
-      il.AddInstruction(il.SetRegister(
-          BYTE, LLIL_TEMP(0),
-          il.Sub(BYTE, il.Const(BYTE, 0), il.Register(BYTE, LLIL_TEMP(0)))));
-      il.AddInstruction(il.Goto(doneLabel));
-
-      il.MarkLabel(doneLabel);
-      condition = il.CompareSignedGreaterEqual(
-          BYTE, il.Register(BYTE, LLIL_TEMP(1)), il.Const(BYTE, 0));
-      il.AddInstruction(il.If(condition, trueLabel, falseLabel));
-      il.MarkLabel(trueLabel);
-      il.AddInstruction(il.Goto(doneLabel));
-      il.MarkLabel(falseLabel);
-      il.AddInstruction(il.SetRegister(
-          BYTE, LLIL_TEMP(1),
-          il.Sub(BYTE, il.Const(BYTE, 0), il.Register(BYTE, LLIL_TEMP(1)))));
-      il.AddInstruction(il.Goto(doneLabel));
-
-      il.MarkLabel(doneLabel);
-      condition = il.CompareSignedGreaterEqual(
-          BYTE, il.Register(BYTE, LLIL_TEMP(2)), il.Const(BYTE, 0));
-      il.AddInstruction(il.If(condition, trueLabel, falseLabel));
-      il.MarkLabel(trueLabel);
-      il.AddInstruction(il.Goto(doneLabel));
-      il.MarkLabel(falseLabel);
-      il.AddInstruction(il.SetRegister(
-          BYTE, LLIL_TEMP(2),
-          il.Sub(BYTE, il.Const(BYTE, 0), il.Register(BYTE, LLIL_TEMP(2)))));
-      il.AddInstruction(il.Goto(doneLabel));
-
-      il.MarkLabel(doneLabel);
-      condition = il.CompareSignedGreaterEqual(
-          BYTE, il.Register(BYTE, LLIL_TEMP(3)), il.Const(BYTE, 0));
-      il.AddInstruction(il.If(condition, trueLabel, falseLabel));
-      il.MarkLabel(trueLabel);
-      il.AddInstruction(il.Goto(doneLabel));
-      il.MarkLabel(falseLabel);
-      il.AddInstruction(il.SetRegister(
-          BYTE, LLIL_TEMP(3),
-          il.Sub(BYTE, il.Const(BYTE, 0), il.Register(BYTE, LLIL_TEMP(3)))));
-      il.AddInstruction(il.Goto(doneLabel));
-
-      il.MarkLabel(doneLabel);
-      result = il.Or(WORD,
-                     il.Or(WORD,
-                           il.ShiftLeft(WORD, il.Register(WORD, LLIL_TEMP(3)),
-                                        il.Const(WORD, 24)),
-                           il.ShiftLeft(WORD, il.Register(WORD, LLIL_TEMP(2)),
-                                        il.Const(WORD, 16))),
-                     il.Or(WORD,
-                           il.ShiftLeft(WORD, il.Register(WORD, LLIL_TEMP(1)),
-                                        il.Const(WORD, 8)),
-                           il.Register(WORD, LLIL_TEMP(0))));
-      il.AddInstruction(il.SetRegister(WORD, reg_dc, result));
+      PackedTo(reg_dc, PackedOp::AbsB, {il.Register(WORD, reg_db)},
+               Absbh::flags, il);
       return true;
     }
     case ABSH_DC_DB: {
-      ExprId result_hword0, result_hword1, result, condition;
-      LowLevelILLabel trueLabel, falseLabel, doneLabel;
       len = 4;
       uint8_t reg_dc, reg_db, op1, op2, s1, n;
       Instruction::ExtractOpfieldsRR(data, op1, op2, s1, reg_db, n, reg_dc);
-      result_hword0 =
-          il.And(WORD, il.Register(WORD, reg_db), il.Const(WORD, 0x0000FFFF));
-      result_hword1 =
-          il.And(WORD,
-                 il.LogicalShiftRight(WORD, il.Register(WORD, reg_db),
-                                      il.Const(WORD, 16)),
-                 il.Const(WORD, 0x0000FFFF));
-
-      il.AddInstruction(il.SetRegister(HWORD, LLIL_TEMP(0), result_hword0));
-      il.AddInstruction(il.SetRegister(HWORD, LLIL_TEMP(1), result_hword1));
-
-      condition = il.CompareSignedGreaterEqual(HWORD, result_hword0,
-                                               il.Const(HWORD, 0));
-      il.AddInstruction(il.If(condition, trueLabel, falseLabel));
-      il.MarkLabel(trueLabel);
-      il.AddInstruction(il.Goto(doneLabel));
-      il.MarkLabel(falseLabel);
-      il.AddInstruction(il.SetRegister(
-          HWORD, LLIL_TEMP(0),
-          il.Sub(HWORD, il.Const(HWORD, 0), il.Register(HWORD, LLIL_TEMP(0)))));
-      il.AddInstruction(il.Goto(doneLabel));
-
-      il.MarkLabel(doneLabel);
-      condition = il.CompareSignedGreaterEqual(HWORD, result_hword1,
-                                               il.Const(HWORD, 0));
-      il.AddInstruction(il.If(condition, trueLabel, falseLabel));
-      il.MarkLabel(trueLabel);
-      il.AddInstruction(il.Goto(doneLabel));
-      il.MarkLabel(falseLabel);
-      il.AddInstruction(il.SetRegister(
-          HWORD, LLIL_TEMP(1),
-          il.Sub(HWORD, il.Const(HWORD, 0), il.Register(HWORD, LLIL_TEMP(1)))));
-      il.AddInstruction(il.Goto(doneLabel));
-
-      il.MarkLabel(doneLabel);
-      result = il.Or(WORD,
-                     il.ShiftLeft(WORD, il.Register(WORD, LLIL_TEMP(1)),
-                                  il.Const(WORD, 16)),
-                     il.Register(WORD, LLIL_TEMP(0)));
-      il.AddInstruction(il.SetRegister(WORD, reg_dc, result));
+      PackedTo(reg_dc, PackedOp::AbsH, {il.Register(WORD, reg_db)},
+               Absbh::flags, il);
       return true;
     }
     default:
-      LogDebug("0x%lx: Absbh::%s received invalid opcode 2 0x%x", addr,
-               __func__, op2);
+      TRICORE_LOG_REJECT("0x%lx: Absbh::%s received invalid opcode 2 0x%x",
+                         addr, __func__, op2);
       return false;
   }
 }
@@ -337,13 +712,12 @@ bool Absdif::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
   switch (op1) {
     case OP1_x8B_RC:
       if (op2 != ABSDIF_DC_DA_CONST9) {
-        LogDebug("0x%lx: Absdif::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Absdif::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       {
         ExprId condition;
-        LowLevelILLabel trueLabel, falseLabel, doneLabel;
         len = 4;
         uint8_t reg_da, reg_dc, op1, op2;
         int16_t const9;
@@ -351,67 +725,74 @@ bool Absdif::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
         condition = il.CompareSignedGreaterThan(
             WORD, il.Register(WORD, reg_da),
             il.SignExtend(WORD, il.Const(HWORD, const9)));
-        il.AddInstruction(il.If(condition, trueLabel, falseLabel));
-
-        il.MarkLabel(trueLabel);
-        il.AddInstruction(il.SetRegister(
-            WORD, reg_dc,
-            il.Sub(WORD, il.Register(WORD, reg_da),
-                   il.SignExtend(WORD, il.Const(HWORD, const9)))));
-        il.AddInstruction(il.Goto(doneLabel));
-
-        il.MarkLabel(falseLabel);
-        il.AddInstruction(il.SetRegister(
-            WORD, reg_dc,
-            il.Sub(WORD, il.SignExtend(WORD, il.Const(HWORD, const9)),
-                   il.Register(WORD, reg_da))));
-        il.AddInstruction(il.Goto(doneLabel));
-
-        il.MarkLabel(doneLabel);
+        SelectTo(reg_dc, condition,
+                 il.Sub(WORD, il.Register(WORD, reg_da),
+                        il.SignExtend(WORD, il.Const(HWORD, const9))),
+                 il.Sub(WORD, il.SignExtend(WORD, il.Const(HWORD, const9)),
+                        il.Register(WORD, reg_da)),
+                 il, WORD);
         return true;
       }
     case OP1_x0B_RR:
       if (op2 != ABSDIF_DC_DA_DB) {
-        LogDebug("0x%lx: Absdif::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Absdif::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       {
         ExprId condition;
-        LowLevelILLabel trueLabel, falseLabel, doneLabel;
         len = 4;
         uint8_t reg_dc, reg_da, reg_db, op1, op2, n;
         Instruction::ExtractOpfieldsRR(data, op1, op2, reg_da, reg_db, n,
                                        reg_dc);
         condition = il.CompareSignedGreaterThan(WORD, il.Register(WORD, reg_da),
                                                 il.Register(WORD, reg_db));
-        il.AddInstruction(il.If(condition, trueLabel, falseLabel));
-
-        il.MarkLabel(trueLabel);
-        il.AddInstruction(il.SetRegister(WORD, reg_dc,
-                                         il.Sub(WORD, il.Register(WORD, reg_da),
-                                                il.Register(WORD, reg_db))));
-        il.AddInstruction(il.Goto(doneLabel));
-
-        il.MarkLabel(falseLabel);
-        il.AddInstruction(il.SetRegister(WORD, reg_dc,
-                                         il.Sub(WORD, il.Register(WORD, reg_db),
-                                                il.Register(WORD, reg_da))));
-        il.AddInstruction(il.Goto(doneLabel));
-
-        il.MarkLabel(doneLabel);
+        SelectTo(reg_dc, condition,
+                 il.Sub(WORD, il.Register(WORD, reg_da),
+                        il.Register(WORD, reg_db)),
+                 il.Sub(WORD, il.Register(WORD, reg_db),
+                        il.Register(WORD, reg_da)),
+                 il, WORD);
         return true;
       }
     default:
-      LogDebug("0x%lx: Absdif::%s received invalid opcode 1 0x%x", addr,
-               __func__, op1);
+      TRICORE_LOG_REJECT("0x%lx: Absdif::%s received invalid opcode 1 0x%x",
+                         addr, __func__, op1);
       return false;
   }
 }
 
 bool Absdifbh::Lift(uint8_t op1, uint8_t op2, const uint8_t* data,
                     uint64_t addr, size_t& len, LowLevelILFunction& il) {
-  UNIMPLEMENTED(*((const uint16_t*)data) & 0x1 ? 4 : 2)
+  if (op1 != OP1_x0B_RR) {
+    TRICORE_LOG_REJECT("0x%lx: Absdifbh::%s received invalid opcode 1 0x%x",
+                       addr, __func__, op1);
+    return false;
+  }
+  switch (op2) {
+    case ABSDIFB_DC_DA_DB: {
+      len = 4;
+      uint8_t reg_dc, reg_da, reg_db, op1, op2, n;
+      Instruction::ExtractOpfieldsRR(data, op1, op2, reg_da, reg_db, n, reg_dc);
+      PackedTo(reg_dc, PackedOp::AbsdifB,
+               {il.Register(WORD, reg_da), il.Register(WORD, reg_db)},
+               Absdifbh::flags, il);
+      return true;
+    }
+    case ABSDIFH_DC_DA_DB: {
+      len = 4;
+      uint8_t reg_dc, reg_da, reg_db, op1, op2, n;
+      Instruction::ExtractOpfieldsRR(data, op1, op2, reg_da, reg_db, n, reg_dc);
+      PackedTo(reg_dc, PackedOp::AbsdifH,
+               {il.Register(WORD, reg_da), il.Register(WORD, reg_db)},
+               Absdifbh::flags, il);
+      return true;
+    }
+    default:
+      TRICORE_LOG_REJECT("0x%lx: Absdifbh::%s received invalid opcode 2 0x%x",
+                         addr, __func__, op2);
+      return false;
+  }
 }
 
 bool Absdifs::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
@@ -419,13 +800,12 @@ bool Absdifs::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
   switch (op1) {
     case OP1_x8B_RC:
       if (op2 != ABSDIFS_DC_DA_CONST9) {
-        LogDebug("0x%lx: Absdifs::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Absdifs::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       {
-        ExprId condition, result;
-        LowLevelILLabel trueLabel, falseLabel, doneLabel;
+        ExprId condition;
         len = 4;
         uint8_t reg_da, reg_dc, op1, op2;
         int16_t const9;
@@ -433,107 +813,87 @@ bool Absdifs::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
         condition = il.CompareSignedGreaterThan(
             WORD, il.Register(WORD, reg_da),
             il.SignExtend(WORD, il.Const(HWORD, const9)));
-        il.AddInstruction(il.If(condition, trueLabel, falseLabel));
-
-        il.MarkLabel(trueLabel);
-        result = il.Sub(WORD, il.Register(WORD, reg_da),
-                        il.SignExtend(WORD, il.Const(HWORD, const9)));
-        il.AddInstruction(il.SetRegister(WORD, LLIL_TEMP(0), result));
-        il.AddInstruction(il.Goto(doneLabel));
-
-        il.MarkLabel(falseLabel);
-        result = il.Sub(WORD, il.SignExtend(WORD, il.Const(HWORD, const9)),
-                        il.Register(WORD, reg_da));
-        il.AddInstruction(il.SetRegister(WORD, LLIL_TEMP(0), result));
-        il.AddInstruction(il.Goto(doneLabel));
-
-        il.MarkLabel(doneLabel);
-        ssov(il.Register(WORD, LLIL_TEMP(0)), il.Const(WORD, 32), LLIL_TEMP(1),
-             il, WORD);
+        SelectTo(LLIL_TEMP(0), condition,
+                 il.Sub(WORD, il.Register(WORD, reg_da),
+                        il.SignExtend(WORD, il.Const(HWORD, const9))),
+                 il.Sub(WORD, il.SignExtend(WORD, il.Const(HWORD, const9)),
+                        il.Register(WORD, reg_da)),
+                 il, WORD);
+        ssov(il.Register(WORD, LLIL_TEMP(0)), 32, LLIL_TEMP(1), il, WORD);
         il.AddInstruction(
             il.SetRegister(WORD, reg_dc, il.Register(WORD, LLIL_TEMP(1))));
         return true;
       }
     case OP1_x0B_RR:
       if (op2 != ABSDIFS_DC_DA_DB) {
-        LogDebug("0x%lx: Absdifs::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Absdifs::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       {
-        ExprId condition, result;
-        LowLevelILLabel trueLabel, falseLabel, doneLabel;
+        ExprId condition;
         len = 4;
         uint8_t reg_dc, reg_da, reg_db, op1, op2, n;
         Instruction::ExtractOpfieldsRR(data, op1, op2, reg_da, reg_db, n,
                                        reg_dc);
         condition = il.CompareSignedGreaterThan(WORD, il.Register(WORD, reg_da),
                                                 il.Register(WORD, reg_db));
-        il.AddInstruction(il.If(condition, trueLabel, falseLabel));
-
-        il.MarkLabel(trueLabel);
-        result =
-            il.Sub(WORD, il.Register(WORD, reg_da), il.Register(WORD, reg_db));
-        il.AddInstruction(il.SetRegister(WORD, LLIL_TEMP(0), result));
-        il.AddInstruction(il.Goto(doneLabel));
-
-        il.MarkLabel(falseLabel);
-        result =
-            il.Sub(WORD, il.Register(WORD, reg_db), il.Register(WORD, reg_da));
-        il.AddInstruction(il.SetRegister(WORD, LLIL_TEMP(0), result));
-        il.AddInstruction(il.Goto(doneLabel));
-
-        il.MarkLabel(doneLabel);
-        ssov(il.Register(WORD, LLIL_TEMP(0)), il.Const(WORD, 32), LLIL_TEMP(1),
-             il, WORD);
+        SelectTo(LLIL_TEMP(0), condition,
+                 il.Sub(WORD, il.Register(WORD, reg_da),
+                        il.Register(WORD, reg_db)),
+                 il.Sub(WORD, il.Register(WORD, reg_db),
+                        il.Register(WORD, reg_da)),
+                 il, WORD);
+        ssov(il.Register(WORD, LLIL_TEMP(0)), 32, LLIL_TEMP(1), il, WORD);
         il.AddInstruction(
             il.SetRegister(WORD, reg_dc, il.Register(WORD, LLIL_TEMP(1))));
         return true;
       }
     default:
-      LogDebug("0x%lx: Absdifs::%s received invalid opcode 1 0x%x", addr,
-               __func__, op1);
+      TRICORE_LOG_REJECT("0x%lx: Absdifs::%s received invalid opcode 1 0x%x",
+                         addr, __func__, op1);
       return false;
   }
 }
 
 bool Absdifsh::Lift(uint8_t op1, uint8_t op2, const uint8_t* data,
                     uint64_t addr, size_t& len, LowLevelILFunction& il) {
-  UNIMPLEMENTED(*((const uint16_t*)data) & 0x1 ? 4 : 2)
+  if (op1 != OP1_x0B_RR || op2 != ABSDIFSH_DC_DA_DB) {
+    TRICORE_LOG_REJECT(
+        "0x%lx: Absdifsh::%s received invalid opcode(s) 0x%x, 0x%x",
+        addr, __func__, op1, op2);
+    return false;
+  }
+  {
+    len = 4;
+    uint8_t reg_dc, reg_da, reg_db, op1, op2, n;
+    Instruction::ExtractOpfieldsRR(data, op1, op2, reg_da, reg_db, n, reg_dc);
+    PackedTo(reg_dc, PackedOp::AbsdifsH,
+             {il.Register(WORD, reg_da), il.Register(WORD, reg_db)},
+             Absdifsh::flags, il);
+    return true;
+  }
 }
 
 bool Abss::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                 size_t& len, LowLevelILFunction& il) {
   if (op1 != OP1_x0B_RR || op2 != ABSS_DC_DB) {
-    LogDebug("0x%lx: Abss::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT("0x%lx: Abss::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
     return false;
   }
   {
     ExprId condition;
-    LowLevelILLabel trueLabel, falseLabel, doneLabel;
     len = 4;
     uint8_t reg_dc, reg_db, op1, op2, s1, n;
     char buf[32];
     Instruction::ExtractOpfieldsRR(data, op1, op2, s1, reg_db, n, reg_dc);
     condition = il.CompareSignedGreaterEqual(WORD, il.Register(WORD, reg_db),
                                              il.Const(WORD, 0));
-    il.AddInstruction(il.If(condition, trueLabel, falseLabel));
-
-    il.MarkLabel(trueLabel);
-    il.AddInstruction(
-        il.SetRegister(WORD, LLIL_TEMP(0), il.Register(WORD, reg_db)));
-    il.AddInstruction(il.Goto(doneLabel));
-
-    il.MarkLabel(falseLabel);
-    il.AddInstruction(il.SetRegister(
-        WORD, LLIL_TEMP(0),
-        il.Sub(WORD, il.Const(WORD, 0), il.Register(WORD, reg_db))));
-    il.AddInstruction(il.Goto(doneLabel));
-
-    il.MarkLabel(doneLabel);
-    ssov(il.Register(WORD, LLIL_TEMP(0)), il.Const(WORD, 32), LLIL_TEMP(1), il,
-         WORD);
+    SelectTo(LLIL_TEMP(0), condition, il.Register(WORD, reg_db),
+             il.Sub(WORD, il.Const(WORD, 0), il.Register(WORD, reg_db)), il,
+             WORD);
+    ssov(il.Register(WORD, LLIL_TEMP(0)), 32, LLIL_TEMP(1), il, WORD);
     il.AddInstruction(
         il.SetRegister(WORD, reg_dc, il.Register(WORD, LLIL_TEMP(1))));
     return true;
@@ -542,7 +902,19 @@ bool Abss::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 
 bool Abssh::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                  size_t& len, LowLevelILFunction& il) {
-  UNIMPLEMENTED(*((const uint16_t*)data) & 0x1 ? 4 : 2)
+  if (op1 != OP1_x0B_RR || op2 != ABSSH_DC_DB) {
+    TRICORE_LOG_REJECT("0x%lx: Abssh::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
+    return false;
+  }
+  {
+    len = 4;
+    uint8_t reg_dc, reg_db, op1, op2, s1, n;
+    Instruction::ExtractOpfieldsRR(data, op1, op2, s1, reg_db, n, reg_dc);
+    PackedTo(reg_dc, PackedOp::AbssH, {il.Register(WORD, reg_db)}, Abssh::flags,
+             il);
+    return true;
+  }
 }
 
 bool Add::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
@@ -615,8 +987,8 @@ bool Add::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
     // 32-bit instructions
     case OP1_x8B_RC:
       if (op2 != ADD_DC_DA_CONST9) {
-        LogDebug("0x%lx: Add::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Add::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       {  // new scope to prevent redefinitions
@@ -632,8 +1004,8 @@ bool Add::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
       }
     case OP1_x0B_RR:
       if (op2 != ADD_DC_DA_DB) {
-        LogDebug("0x%lx: Add::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Add::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       {
@@ -649,8 +1021,8 @@ bool Add::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
       }
 
     default:
-      LogDebug("0x%lx: Add::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Add::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -686,8 +1058,8 @@ bool Adda::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
     // 32-bit instructions
     case OP1_x01_RR:
       if (op2 != ADDA_AC_AA_AB) {
-        LogDebug("0x%lx: Adda::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Adda::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       {
@@ -705,8 +1077,8 @@ bool Adda::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
         return true;
       }
     default:
-      LogDebug("0x%lx: Adda::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Adda::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -714,87 +1086,32 @@ bool Adda::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Addbh::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                  size_t& len, LowLevelILFunction& il) {
   if (op1 != OP1_x0B_RR) {
-    LogDebug("0x%lx: Addbh::%s received invalid opcode 1 0x%x", addr, __func__,
-             op1);
+    TRICORE_LOG_REJECT("0x%lx: Addbh::%s received invalid opcode 1 0x%x", addr,
+                       __func__, op1);
     return false;
   }
   switch (op2) {
     case ADDB_DC_DA_DB: {
-      ExprId result_byte0, result_byte1, result_byte2, result_byte3, result;
       len = 4;
       uint8_t reg_dc, reg_da, reg_db, op1, op2, n;
       Instruction::ExtractOpfieldsRR(data, op1, op2, reg_da, reg_db, n, reg_dc);
-      result_byte0 = il.Add(
-          BYTE,
-          il.And(WORD, il.Register(WORD, reg_da), il.Const(WORD, 0x000000FF)),
-          il.And(WORD, il.Register(WORD, reg_db), il.Const(WORD, 0x000000FF)));
-      result_byte1 =
-          il.Add(BYTE,
-                 il.And(WORD,
-                        il.LogicalShiftRight(WORD, il.Register(WORD, reg_da),
-                                             il.Const(WORD, 8)),
-                        il.Const(WORD, 0x000000FF)),
-                 il.And(WORD,
-                        il.LogicalShiftRight(WORD, il.Register(WORD, reg_db),
-                                             il.Const(WORD, 8)),
-                        il.Const(WORD, 0x000000FF)));
-      result_byte2 =
-          il.Add(BYTE,
-                 il.And(WORD,
-                        il.LogicalShiftRight(WORD, il.Register(WORD, reg_da),
-                                             il.Const(WORD, 16)),
-                        il.Const(WORD, 0x000000FF)),
-                 il.And(WORD,
-                        il.LogicalShiftRight(WORD, il.Register(WORD, reg_db),
-                                             il.Const(WORD, 16)),
-                        il.Const(WORD, 0x000000FF)));
-      result_byte3 =
-          il.Add(BYTE,
-                 il.And(WORD,
-                        il.LogicalShiftRight(WORD, il.Register(WORD, reg_da),
-                                             il.Const(WORD, 24)),
-                        il.Const(WORD, 0x000000FF)),
-                 il.And(WORD,
-                        il.LogicalShiftRight(WORD, il.Register(WORD, reg_db),
-                                             il.Const(WORD, 24)),
-                        il.Const(WORD, 0x000000FF)));
-      result = il.Or(
-          WORD,
-          il.Or(WORD, il.ShiftLeft(WORD, result_byte3, il.Const(WORD, 24)),
-                il.ShiftLeft(WORD, result_byte2, il.Const(WORD, 16))),
-          il.Or(WORD, il.ShiftLeft(WORD, result_byte1, il.Const(WORD, 8)),
-                result_byte0));
-      il.AddInstruction(il.SetRegister(WORD, reg_dc, result));
+      PackedTo(reg_dc, PackedOp::AddB,
+               {il.Register(WORD, reg_da), il.Register(WORD, reg_db)},
+               Addbh::flags, il);
       return true;
     }
     case ADDH_DC_DA_DB: {
-      ExprId result_hword0, result_hword1, result;
       len = 4;
       uint8_t reg_dc, reg_da, reg_db, op1, op2, n;
       Instruction::ExtractOpfieldsRR(data, op1, op2, reg_da, reg_db, n, reg_dc);
-      result_hword0 = il.Add(
-          HWORD,
-          il.And(WORD, il.Register(WORD, reg_da), il.Const(WORD, 0x0000FFFF)),
-          il.And(WORD, il.Register(WORD, reg_db), il.Const(WORD, 0x0000FFFF)));
-      result_hword1 =
-          il.Add(HWORD,
-                 il.And(WORD,
-                        il.LogicalShiftRight(WORD, il.Register(WORD, reg_da),
-                                             il.Const(WORD, 16)),
-                        il.Const(WORD, 0x0000FFFF)),
-                 il.And(WORD,
-                        il.LogicalShiftRight(WORD, il.Register(WORD, reg_db),
-                                             il.Const(WORD, 16)),
-                        il.Const(WORD, 0x0000FFFF)));
-      result =
-          il.Or(WORD, il.ShiftLeft(WORD, result_hword1, il.Const(WORD, 16)),
-                result_hword0);
-      il.AddInstruction(il.SetRegister(WORD, reg_dc, result));
+      PackedTo(reg_dc, PackedOp::AddH,
+               {il.Register(WORD, reg_da), il.Register(WORD, reg_db)},
+               Addbh::flags, il);
       return true;
     }
     default:
-      LogDebug("0x%lx: Addbh::%s received invalid opcode 2 0x%x", addr,
-               __func__, op2);
+      TRICORE_LOG_REJECT("0x%lx: Addbh::%s received invalid opcode 2 0x%x",
+                         addr, __func__, op2);
       return false;
   }
 }
@@ -808,8 +1125,8 @@ bool Addi::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                 size_t& len, LowLevelILFunction& il) {
   // 32-bit, single opcode
   if (op1 != ADDI_DC_DA_CONST16) {
-    LogDebug("0x%lx: Addi::%s received invalid opcode 1 0x%x", addr, __func__,
-             op1);
+    TRICORE_LOG_REJECT("0x%lx: Addi::%s received invalid opcode 1 0x%x", addr,
+                       __func__, op1);
     return false;
   }
   {
@@ -829,8 +1146,8 @@ bool Addih::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                  size_t& len, LowLevelILFunction& il) {
   // 32-bit, single opcode
   if (op1 != ADDIH_DC_DA_CONST16) {
-    LogDebug("0x%lx: Addih::%s received invalid opcode 1 0x%x", addr, __func__,
-             op1);
+    TRICORE_LOG_REJECT("0x%lx: Addih::%s received invalid opcode 1 0x%x", addr,
+                       __func__, op1);
     return false;
   }
   {
@@ -852,8 +1169,8 @@ bool Addiha::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                   size_t& len, LowLevelILFunction& il) {
   // 32-bit, single opcode
   if (op1 != ADDIHA_AC_AA_CONST16) {
-    LogDebug("0x%lx: Addiha::%s received invalid opcode 1 0x%x", addr, __func__,
-             op1);
+    TRICORE_LOG_REJECT("0x%lx: Addiha::%s received invalid opcode 1 0x%x", addr,
+                       __func__, op1);
     return false;
   }
   {
@@ -883,16 +1200,15 @@ bool Adds::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
       il.AddInstruction(il.SetRegister(
           WORD, LLIL_TEMP(0),
           il.Add(WORD, il.Register(WORD, reg_da), il.Register(WORD, reg_db))));
-      ssov(il.Register(WORD, LLIL_TEMP(0)), il.Const(WORD, 32), LLIL_TEMP(1),
-           il, WORD);
+      ssov(il.Register(WORD, LLIL_TEMP(0)), 32, LLIL_TEMP(1), il, WORD);
       il.AddInstruction(
           il.SetRegister(WORD, reg_da, il.Register(WORD, LLIL_TEMP(1))));
       return true;
     }
     case OP1_x8B_RC:
       if (op2 != ADDS_DC_DA_CONST9) {
-        LogDebug("0x%lx: Adds::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Adds::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       {
@@ -904,16 +1220,15 @@ bool Adds::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
             WORD, LLIL_TEMP(0),
             il.Add(WORD, il.Register(WORD, reg_da),
                    il.SignExtend(WORD, il.Const(HWORD, const9)))));
-        ssov(il.Register(WORD, LLIL_TEMP(0)), il.Const(WORD, 32), LLIL_TEMP(1),
-             il, WORD);
+        ssov(il.Register(WORD, LLIL_TEMP(0)), 32, LLIL_TEMP(1), il, WORD);
         il.AddInstruction(
             il.SetRegister(WORD, reg_dc, il.Register(WORD, LLIL_TEMP(1))));
         return true;
       }
     case OP1_x0B_RR:
       if (op2 != ADDS_DC_DA_DB) {
-        LogDebug("0x%lx: Adds::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Adds::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       {
@@ -924,15 +1239,14 @@ bool Adds::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
         il.AddInstruction(il.SetRegister(WORD, LLIL_TEMP(0),
                                          il.Add(WORD, il.Register(WORD, reg_da),
                                                 il.Register(WORD, reg_db))));
-        ssov(il.Register(WORD, LLIL_TEMP(0)), il.Const(WORD, 32), LLIL_TEMP(1),
-             il, WORD);
+        ssov(il.Register(WORD, LLIL_TEMP(0)), 32, LLIL_TEMP(1), il, WORD);
         il.AddInstruction(
             il.SetRegister(WORD, reg_dc, il.Register(WORD, LLIL_TEMP(1))));
         return true;
       }
     default:
-      LogDebug("0x%lx: Adds::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Adds::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -940,70 +1254,32 @@ bool Adds::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Addshhu::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                    size_t& len, LowLevelILFunction& il) {
   if (op1 != OP1_x0B_RR) {
-    LogDebug("0x%lx: Addshhu::%s received invalid opcode 1 0x%x", addr,
-             __func__, op1);
+    TRICORE_LOG_REJECT("0x%lx: Addshhu::%s received invalid opcode 1 0x%x",
+                       addr, __func__, op1);
     return false;
   }
   switch (op2) {
     case ADDSH_DC_DA_DB: {
-      ExprId result_hword0, result_hword1, result;
       len = 4;
       uint8_t reg_dc, reg_da, reg_db, op1, op2, n;
       Instruction::ExtractOpfieldsRR(data, op1, op2, reg_da, reg_db, n, reg_dc);
-      result_hword0 = il.Add(
-          HWORD,
-          il.And(WORD, il.Register(WORD, reg_da), il.Const(WORD, 0x0000FFFF)),
-          il.And(WORD, il.Register(WORD, reg_db), il.Const(WORD, 0x0000FFFF)));
-      result_hword1 =
-          il.Add(HWORD,
-                 il.And(WORD,
-                        il.LogicalShiftRight(WORD, il.Register(WORD, reg_da),
-                                             il.Const(WORD, 16)),
-                        il.Const(WORD, 0x0000FFFF)),
-                 il.And(WORD,
-                        il.LogicalShiftRight(WORD, il.Register(WORD, reg_db),
-                                             il.Const(WORD, 16)),
-                        il.Const(WORD, 0x0000FFFF)));
-      ssov(result_hword0, il.Const(HWORD, 16), LLIL_TEMP(0), il, HWORD);
-      ssov(result_hword1, il.Const(HWORD, 16), LLIL_TEMP(1), il, HWORD);
-      result = il.Or(WORD,
-                     il.ShiftLeft(WORD, il.Register(WORD, LLIL_TEMP(1)),
-                                  il.Const(WORD, 16)),
-                     il.Register(WORD, LLIL_TEMP(0)));
-      il.AddInstruction(il.SetRegister(WORD, reg_dc, result));
+      PackedTo(reg_dc, PackedOp::AddsH,
+               {il.Register(WORD, reg_da), il.Register(WORD, reg_db)},
+               Addshhu::flags, il);
       return true;
     }
     case ADDSHU_DC_DA_DB: {
-      ExprId result_hword0, result_hword1, result;
       len = 4;
       uint8_t reg_dc, reg_da, reg_db, op1, op2, n;
       Instruction::ExtractOpfieldsRR(data, op1, op2, reg_da, reg_db, n, reg_dc);
-      result_hword0 = il.Add(
-          HWORD,
-          il.And(WORD, il.Register(WORD, reg_da), il.Const(WORD, 0x0000FFFF)),
-          il.And(WORD, il.Register(WORD, reg_db), il.Const(WORD, 0x0000FFFF)));
-      result_hword1 =
-          il.Add(HWORD,
-                 il.And(WORD,
-                        il.LogicalShiftRight(WORD, il.Register(WORD, reg_da),
-                                             il.Const(WORD, 16)),
-                        il.Const(WORD, 0x0000FFFF)),
-                 il.And(WORD,
-                        il.LogicalShiftRight(WORD, il.Register(WORD, reg_db),
-                                             il.Const(WORD, 16)),
-                        il.Const(WORD, 0x0000FFFF)));
-      suov(result_hword0, il.Const(HWORD, 16), LLIL_TEMP(0), il, HWORD);
-      suov(result_hword1, il.Const(HWORD, 16), LLIL_TEMP(1), il, HWORD);
-      result = il.Or(WORD,
-                     il.ShiftLeft(WORD, il.Register(WORD, LLIL_TEMP(1)),
-                                  il.Const(WORD, 16)),
-                     il.Register(WORD, LLIL_TEMP(0)));
-      il.AddInstruction(il.SetRegister(WORD, reg_dc, result));
+      PackedTo(reg_dc, PackedOp::AddsHu,
+               {il.Register(WORD, reg_da), il.Register(WORD, reg_db)},
+               Addshhu::flags, il);
       return true;
     }
     default:
-      LogDebug("0x%lx: Addshhu::%s received invalid opcode 2 0x%x", addr,
-               __func__, op2);
+      TRICORE_LOG_REJECT("0x%lx: Addshhu::%s received invalid opcode 2 0x%x",
+                         addr, __func__, op2);
       return false;
   }
 }
@@ -1015,8 +1291,8 @@ bool Addsu::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
   switch (op1) {
     case OP1_x8B_RC:
       if (op2 != ADDSU_DC_DA_CONST9) {
-        LogDebug("0x%lx: Addsu::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Addsu::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       {
@@ -1028,14 +1304,13 @@ bool Addsu::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
             WORD, LLIL_TEMP(0),
             il.Add(WORD, il.Register(WORD, reg_da),
                    il.SignExtend(WORD, il.Const(HWORD, const9)))));
-        ssov(il.Register(WORD, LLIL_TEMP(0)), il.Const(WORD, 32), reg_dc, il,
-             WORD);
+        ssov(il.Register(WORD, LLIL_TEMP(0)), 32, reg_dc, il, WORD);
         return true;
       }
     case OP1_x0B_RR:
       if (op2 != ADDSU_DC_DA_DB) {
-        LogDebug("0x%lx: Addsu::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Addsu::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       {
@@ -1046,13 +1321,12 @@ bool Addsu::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
         il.AddInstruction(il.SetRegister(WORD, LLIL_TEMP(0),
                                          il.Add(WORD, il.Register(WORD, reg_da),
                                                 il.Register(WORD, reg_db))));
-        suov(il.Register(WORD, LLIL_TEMP(0)), il.Const(WORD, 32), reg_dc, il,
-             WORD);
+        suov(il.Register(WORD, LLIL_TEMP(0)), 32, reg_dc, il, WORD);
         return true;
       }
     default:
-      LogDebug("0x%lx: Addsu::%s received invalid opcode 1 0x%x", addr,
-               __func__, op1);
+      TRICORE_LOG_REJECT("0x%lx: Addsu::%s received invalid opcode 1 0x%x",
+                         addr, __func__, op1);
       return false;
   }
 }
@@ -1109,13 +1383,14 @@ bool Addscaat::Lift(uint8_t op1, uint8_t op2, const uint8_t* data,
           return true;
         }
         default:
-          LogDebug("0x%lx: Addscaat::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT(
+              "0x%lx: Addscaat::%s received invalid opcode 2 0x%x",
+              addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Addscaat::%s received invalid opcode 1 0x%x", addr,
-               __func__, op1);
+      TRICORE_LOG_REJECT("0x%lx: Addscaat::%s received invalid opcode 1 0x%x",
+                         addr, __func__, op1);
       return false;
   }
 }
@@ -1125,8 +1400,8 @@ bool Addx::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
   switch (op1) {
     case OP1_x8B_RC:
       if (op2 != ADDX_DC_DA_CONST9) {
-        LogDebug("0x%lx: Addx::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Addx::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       {
@@ -1143,8 +1418,8 @@ bool Addx::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
       }
     case OP1_x0B_RR:
       if (op2 != ADDX_DC_DA_DB) {
-        LogDebug("0x%lx: Addx::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Addx::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       {
@@ -1159,8 +1434,8 @@ bool Addx::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
         // TODO: handle carry
       }
     default:
-      LogDebug("0x%lx: Addx::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Addx::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -1191,8 +1466,8 @@ bool And::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
     }
     case OP1_x8F_RC:
       if (op2 != AND_DC_DA_CONST9) {
-        LogDebug("0x%lx: And::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: And::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       {
@@ -1209,8 +1484,8 @@ bool And::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
       }
     case OP1_x0F_RR:
       if (op2 != AND_DC_DA_DB) {
-        LogDebug("0x%lx: And::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: And::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       {
@@ -1225,8 +1500,8 @@ bool And::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
         return true;
       }
     default:
-      LogDebug("0x%lx: And::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: And::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -1234,8 +1509,9 @@ bool And::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool AndAndnNorOrT::Lift(uint8_t op1, uint8_t op2, const uint8_t* data,
                          uint64_t addr, size_t& len, LowLevelILFunction& il) {
   if (op1 != OP1_x47_BIT) {
-    LogDebug("0x%lx: AndAndnNorOrT::%s received invalid opcode 1 0x%x", addr,
-             __func__, op1);
+    TRICORE_LOG_REJECT(
+        "0x%lx: AndAndnNorOrT::%s received invalid opcode 1 0x%x",
+        addr, __func__, op1);
     return false;
   }
   switch (op2) {
@@ -1340,8 +1616,9 @@ bool AndAndnNorOrT::Lift(uint8_t op1, uint8_t op2, const uint8_t* data,
       return true;
     }
     default:
-      LogDebug("0x%lx: AndAndnNorOrT::%s received invalid opcode 2 0x%x", addr,
-               __func__, op2);
+      TRICORE_LOG_REJECT(
+          "0x%lx: AndAndnNorOrT::%s received invalid opcode 2 0x%x",
+          addr, __func__, op2);
       return false;
   }
 }
@@ -1351,8 +1628,8 @@ bool Andeq::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
   switch (op1) {
     case OP1_x8B_RC:
       if (op2 != ANDEQ_DC_DA_CONST9) {
-        LogDebug("0x%lx: Andeq::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Andeq::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       {
@@ -1371,8 +1648,8 @@ bool Andeq::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
       }
     case OP1_x0B_RR:
       if (op2 != ANDEQ_DC_DA_DB) {
-        LogDebug("0x%lx: Andeq::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Andeq::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       {
@@ -1388,8 +1665,8 @@ bool Andeq::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
         return true;
       }
     default:
-      LogDebug("0x%lx: Andeq::%s received invalid opcode 1 0x%x", addr,
-               __func__, op1);
+      TRICORE_LOG_REJECT("0x%lx: Andeq::%s received invalid opcode 1 0x%x",
+                         addr, __func__, op1);
       return false;
   }
 }
@@ -1431,8 +1708,9 @@ bool AndgeGeU::Lift(uint8_t op1, uint8_t op2, const uint8_t* data,
           return true;
         }
         default:
-          LogDebug("0x%lx: AndgeGeU::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT(
+              "0x%lx: AndgeGeU::%s received invalid opcode 2 0x%x",
+              addr, __func__, op2);
           return false;
       }
     case OP1_x0B_RR:
@@ -1464,13 +1742,14 @@ bool AndgeGeU::Lift(uint8_t op1, uint8_t op2, const uint8_t* data,
           return true;
         }
         default:
-          LogDebug("0x%lx: AndgeGeU::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT(
+              "0x%lx: AndgeGeU::%s received invalid opcode 2 0x%x",
+              addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: AndgeGeU::%s received invalid opcode 1 0x%x", addr,
-               __func__, op1);
+      TRICORE_LOG_REJECT("0x%lx: AndgeGeU::%s received invalid opcode 1 0x%x",
+                         addr, __func__, op1);
       return false;
   }
 }
@@ -1512,8 +1791,9 @@ bool AndltLtU::Lift(uint8_t op1, uint8_t op2, const uint8_t* data,
           return true;
         }
         default:
-          LogDebug("0x%lx: AndltLtU::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT(
+              "0x%lx: AndltLtU::%s received invalid opcode 2 0x%x",
+              addr, __func__, op2);
           return false;
       }
     case OP1_x0B_RR:
@@ -1545,13 +1825,14 @@ bool AndltLtU::Lift(uint8_t op1, uint8_t op2, const uint8_t* data,
           return true;
         }
         default:
-          LogDebug("0x%lx: AndltLtU::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT(
+              "0x%lx: AndltLtU::%s received invalid opcode 2 0x%x",
+              addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: AndltLtU::%s received invalid opcode 1 0x%x", addr,
-               __func__, op1);
+      TRICORE_LOG_REJECT("0x%lx: AndltLtU::%s received invalid opcode 1 0x%x",
+                         addr, __func__, op1);
       return false;
   }
 }
@@ -1561,8 +1842,8 @@ bool Andne::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
   switch (op1) {
     case OP1_x8B_RC:
       if (op2 != ANDNE_DC_DA_CONST9) {
-        LogDebug("0x%lx: Andne::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Andne::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       {
@@ -1581,8 +1862,8 @@ bool Andne::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
       }
     case OP1_x0B_RR:
       if (op2 != ANDNE_DC_DA_DB) {
-        LogDebug("0x%lx: Andne::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Andne::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       {
@@ -1599,8 +1880,8 @@ bool Andne::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
         return true;
       }
     default:
-      LogDebug("0x%lx: Andne::%s received invalid opcode 1 0x%x", addr,
-               __func__, op1);
+      TRICORE_LOG_REJECT("0x%lx: Andne::%s received invalid opcode 1 0x%x",
+                         addr, __func__, op1);
       return false;
   }
 }
@@ -1608,8 +1889,8 @@ bool Andne::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Andt::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                 size_t& len, LowLevelILFunction& il) {
   if (op1 != OP1_x87_BIT || op2 != ANDT_DC_DA_POS1_DB_POS2) {
-    LogDebug("0x%lx: Andt::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT("0x%lx: Andt::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
     return false;
   }
   {
@@ -1649,8 +1930,8 @@ bool Andn::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
   switch (op1) {
     case OP1_x8F_RC:
       if (op2 != ANDN_DC_DA_CONST9) {
-        LogDebug("0x%lx: Andn::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Andn::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       {
@@ -1668,8 +1949,8 @@ bool Andn::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
       }
     case OP1_x0F_RR:
       if (op2 != ANDN_DC_DA_DB) {
-        LogDebug("0x%lx: Andn::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Andn::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       {
@@ -1684,8 +1965,8 @@ bool Andn::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
         return true;
       }
     default:
-      LogDebug("0x%lx: Andn::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Andn::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -1693,8 +1974,8 @@ bool Andn::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Andnt::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                  size_t& len, LowLevelILFunction& il) {
   if (op1 != OP1_x87_BIT || op2 != ANDNT_DC_DA_POS1_DB_POS2) {
-    LogDebug("0x%lx: Andnt::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT("0x%lx: Andnt::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
     return false;
   }
   {
@@ -1780,34 +2061,26 @@ bool Cadd::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
   switch (op1) {
     case CADD_DA_D15_CONST4: {
       ExprId condition;
-      LowLevelILLabel trueLabel, doneLabel;
       len = 2;
       uint8_t op1, reg_da;
       int8_t const4;
       Instruction::ExtractOpfieldsSRC(data, op1, reg_da, const4);
       condition = il.CompareNotEqual(WORD, il.Register(WORD, TRICORE_REG_D15),
                                      il.Const(WORD, 0));
-      il.AddInstruction(il.If(condition, trueLabel, doneLabel));
-
-      il.MarkLabel(trueLabel);
-      il.AddInstruction(
-          il.SetRegister(WORD, reg_da,
-                         il.Add(WORD, il.Register(WORD, reg_da),
-                                il.SignExtend(WORD, il.Const(BYTE, const4)))));
-      il.AddInstruction(il.Goto(doneLabel));
-
-      il.MarkLabel(doneLabel);
+      SelectTo(reg_da, condition,
+               il.Add(WORD, il.Register(WORD, reg_da),
+                      il.SignExtend(WORD, il.Const(BYTE, const4))),
+               il.Register(WORD, reg_da), il, WORD);
       return true;
     }
     case OP1_xAB_RCR:
       if (op2 != CADD_DC_DD_DA_CONST9) {
-        LogDebug("0x%lx: Cadd::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Cadd::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       {
         ExprId condition;
-        LowLevelILLabel trueLabel, falseLabel, doneLabel;
         len = 4;
         uint8_t op1, op2, reg_da, reg_dd, reg_dc;
         int16_t const9;
@@ -1815,57 +2088,35 @@ bool Cadd::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                                         reg_dc);
         condition = il.CompareNotEqual(WORD, il.Register(WORD, reg_dd),
                                        il.Const(WORD, 0));
-        il.AddInstruction(il.If(condition, trueLabel, falseLabel));
-
-        il.MarkLabel(trueLabel);
-        il.AddInstruction(il.SetRegister(
-            WORD, reg_dc,
-            il.Add(WORD, il.Register(WORD, reg_da),
-                   il.SignExtend(WORD, il.Const(HWORD, const9)))));
-        il.AddInstruction(il.Goto(doneLabel));
-
-        il.MarkLabel(falseLabel);
-        il.AddInstruction(
-            il.SetRegister(WORD, reg_dc, il.Register(WORD, reg_da)));
-        il.AddInstruction(il.Goto(doneLabel));
-
-        il.MarkLabel(doneLabel);
+        SelectTo(reg_dc, condition,
+                 il.Add(WORD, il.Register(WORD, reg_da),
+                        il.SignExtend(WORD, il.Const(HWORD, const9))),
+                 il.Register(WORD, reg_da), il, WORD);
         return true;
       }
     case OP1_x2B_RRR:
       if (op2 != CADD_DC_DD_DA_DB) {
-        LogDebug("0x%lx: Cadd::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Cadd::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       {
         ExprId condition;
-        LowLevelILLabel trueLabel, falseLabel, doneLabel;
         len = 4;
         uint8_t op1, op2, reg_da, reg_db, n, reg_dd, reg_dc;
         Instruction::ExtractOpfieldsRRR(data, op1, op2, reg_da, reg_db, n,
                                         reg_dd, reg_dc);
         condition = il.CompareNotEqual(WORD, il.Register(WORD, reg_dd),
                                        il.Const(WORD, 0));
-        il.AddInstruction(il.If(condition, trueLabel, falseLabel));
-
-        il.MarkLabel(trueLabel);
-        il.AddInstruction(il.SetRegister(WORD, reg_dc,
-                                         il.Add(WORD, il.Register(WORD, reg_da),
-                                                il.Register(WORD, reg_db))));
-        il.AddInstruction(il.Goto(doneLabel));
-
-        il.MarkLabel(falseLabel);
-        il.AddInstruction(
-            il.SetRegister(WORD, reg_dc, il.Register(WORD, reg_da)));
-        il.AddInstruction(il.Goto(doneLabel));
-
-        il.MarkLabel(doneLabel);
+        SelectTo(reg_dc, condition,
+                 il.Add(WORD, il.Register(WORD, reg_da),
+                        il.Register(WORD, reg_db)),
+                 il.Register(WORD, reg_da), il, WORD);
         return true;
       }
     default:
-      LogDebug("0x%lx: Cadd::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Cadd::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -1875,34 +2126,26 @@ bool Caddn::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
   switch (op1) {
     case CADDN_DA_D15_CONST4: {
       ExprId condition;
-      LowLevelILLabel trueLabel, doneLabel;
       len = 2;
       uint8_t op1, reg_da;
       int8_t const4;
       Instruction::ExtractOpfieldsSRC(data, op1, reg_da, const4);
       condition = il.CompareEqual(WORD, il.Register(WORD, TRICORE_REG_D15),
                                   il.Const(WORD, 0));
-      il.AddInstruction(il.If(condition, trueLabel, doneLabel));
-
-      il.MarkLabel(trueLabel);
-      il.AddInstruction(
-          il.SetRegister(WORD, reg_da,
-                         il.Add(WORD, il.Register(WORD, reg_da),
-                                il.SignExtend(WORD, il.Const(BYTE, const4)))));
-      il.AddInstruction(il.Goto(doneLabel));
-
-      il.MarkLabel(doneLabel);
+      SelectTo(reg_da, condition,
+               il.Add(WORD, il.Register(WORD, reg_da),
+                      il.SignExtend(WORD, il.Const(BYTE, const4))),
+               il.Register(WORD, reg_da), il, WORD);
       return true;
     }
     case OP1_xAB_RCR:
       if (op2 != CADDN_DC_DD_DA_CONST9) {
-        LogDebug("0x%lx: Caddn::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Caddn::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       {
         ExprId condition;
-        LowLevelILLabel trueLabel, falseLabel, doneLabel;
         len = 4;
         uint8_t op1, op2, reg_da, reg_dd, reg_dc;
         int16_t const9;
@@ -1910,101 +2153,74 @@ bool Caddn::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                                         reg_dc);
         condition =
             il.CompareEqual(WORD, il.Register(WORD, reg_dd), il.Const(WORD, 0));
-        il.AddInstruction(il.If(condition, trueLabel, falseLabel));
-
-        il.MarkLabel(trueLabel);
-        il.AddInstruction(il.SetRegister(
-            WORD, reg_dc,
-            il.Add(WORD, il.Register(WORD, reg_da),
-                   il.SignExtend(WORD, il.Const(HWORD, const9)))));
-        il.AddInstruction(il.Goto(doneLabel));
-
-        il.MarkLabel(falseLabel);
-        il.AddInstruction(
-            il.SetRegister(WORD, reg_dc, il.Register(WORD, reg_da)));
-        il.AddInstruction(il.Goto(doneLabel));
-
-        il.MarkLabel(doneLabel);
+        SelectTo(reg_dc, condition,
+                 il.Add(WORD, il.Register(WORD, reg_da),
+                        il.SignExtend(WORD, il.Const(HWORD, const9))),
+                 il.Register(WORD, reg_da), il, WORD);
         return true;
       }
     case OP1_x2B_RRR:
       if (op2 != CADDN_DC_DD_DA_DB) {
-        LogDebug("0x%lx: Caddn::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Caddn::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       {
         ExprId condition;
-        LowLevelILLabel trueLabel, falseLabel, doneLabel;
         len = 4;
         uint8_t op1, op2, reg_da, reg_db, n, reg_dd, reg_dc;
         Instruction::ExtractOpfieldsRRR(data, op1, op2, reg_da, reg_db, n,
                                         reg_dd, reg_dc);
         condition =
             il.CompareEqual(WORD, il.Register(WORD, reg_dd), il.Const(WORD, 0));
-        il.AddInstruction(il.If(condition, trueLabel, falseLabel));
-
-        il.MarkLabel(trueLabel);
-        il.AddInstruction(il.SetRegister(WORD, reg_dc,
-                                         il.Add(WORD, il.Register(WORD, reg_da),
-                                                il.Register(WORD, reg_db))));
-        il.AddInstruction(il.Goto(doneLabel));
-
-        il.MarkLabel(falseLabel);
-        il.AddInstruction(
-            il.SetRegister(WORD, reg_dc, il.Register(WORD, reg_da)));
-        il.AddInstruction(il.Goto(doneLabel));
-
-        il.MarkLabel(doneLabel);
+        SelectTo(reg_dc, condition,
+                 il.Add(WORD, il.Register(WORD, reg_da),
+                        il.Register(WORD, reg_db)),
+                 il.Register(WORD, reg_da), il, WORD);
         return true;
       }
     default:
-      LogDebug("0x%lx: Caddn::%s received invalid opcode 1 0x%x", addr,
-               __func__, op1);
+      TRICORE_LOG_REJECT("0x%lx: Caddn::%s received invalid opcode 1 0x%x",
+                         addr, __func__, op1);
       return false;
   }
 }
 
 bool Call::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
-                size_t& len, LowLevelILFunction& il) {
-  // TODO: add LLIL to save state
+                size_t& len, LowLevelILFunction& il, uint32_t target) {
   switch (op1) {
     case CALL_DISP8:
       len = 2;
-      il.AddInstruction(
-          il.Call(il.ConstPointer(WORD, Call::GetTarget(data, addr, len))));
+      CallWithContext(il.ConstPointer(WORD, target), addr + len, il);
       return true;
     case CALL_DISP24:
       len = 4;
-      il.AddInstruction(
-          il.Call(il.ConstPointer(WORD, Call::GetTarget(data, addr, len))));
+      CallWithContext(il.ConstPointer(WORD, target), addr + len, il);
       return true;
     default:
-      LogDebug("0x%lx: Call::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Call::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
 
 bool Calla::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
-                 size_t& len, LowLevelILFunction& il) {
-  // TODO: add LLIL to save state
+                 size_t& len, LowLevelILFunction& il, uint32_t target) {
   if (op1 != CALLA_DISP24) {
-    LogDebug("0x%lx: Calla::%s received invalid opcode 1 0x%x", addr, __func__,
-             op1);
+    TRICORE_LOG_REJECT("0x%lx: Calla::%s received invalid opcode 1 0x%x", addr,
+                       __func__, op1);
     return false;
   }
   len = 4;
-  il.AddInstruction(
-      il.Call(il.ConstPointer(WORD, Calla::GetTarget(data, addr, len))));
+  CallWithContext(il.ConstPointer(WORD, target), addr + len, il);
   return true;
 }
 
 bool Calli::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                  size_t& len, LowLevelILFunction& il) {
   if (op1 != OP1_x2D_RR || op2 != CALLI_AA) {
-    LogDebug("0x%lx: Calli::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT("0x%lx: Calli::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
     return false;
   }
   {
@@ -2012,7 +2228,11 @@ bool Calli::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
     uint8_t op1, op2, reg_aa, s2, n, d;
     Instruction::ExtractOpfieldsRR(data, op1, op2, reg_aa, s2, n, d);
     REGTOA(reg_aa)
-    il.AddInstruction(il.Call(il.Register(WORD, reg_aa)));
+    // calli a11 jumps to the old A11, not the return address
+    il.AddInstruction(il.SetRegister(WORD, LLIL_TEMP(kCallTarget),
+                                     il.Register(WORD, reg_aa)));
+    CallWithContext(il.Register(WORD, LLIL_TEMP(kCallTarget)), addr + len,
+                    il);
     return true;
   }
 }
@@ -2024,7 +2244,19 @@ bool Clo::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 
 bool Cloh::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                 size_t& len, LowLevelILFunction& il) {
-  UNIMPLEMENTED(*((const uint16_t*)data) & 0x1 ? 4 : 2)
+  if (op1 != OP1_x0F_RR || op2 != CLOH_DC_DA) {
+    TRICORE_LOG_REJECT("0x%lx: Cloh::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
+    return false;
+  }
+  {
+    len = 4;
+    uint8_t reg_dc, reg_da, op1, op2, s2, n;
+    Instruction::ExtractOpfieldsRR(data, op1, op2, reg_da, s2, n, reg_dc);
+    PackedTo(reg_dc, PackedOp::CloH, {il.Register(WORD, reg_da)}, Cloh::flags,
+             il);
+    return true;
+  }
 }
 
 bool Cls::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
@@ -2034,7 +2266,19 @@ bool Cls::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 
 bool Clsh::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                 size_t& len, LowLevelILFunction& il) {
-  UNIMPLEMENTED(*((const uint16_t*)data) & 0x1 ? 4 : 2)
+  if (op1 != OP1_x0F_RR || op2 != CLSH_DC_DA) {
+    TRICORE_LOG_REJECT("0x%lx: Clsh::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
+    return false;
+  }
+  {
+    len = 4;
+    uint8_t reg_dc, reg_da, op1, op2, s2, n;
+    Instruction::ExtractOpfieldsRR(data, op1, op2, reg_da, s2, n, reg_dc);
+    PackedTo(reg_dc, PackedOp::ClsH, {il.Register(WORD, reg_da)}, Clsh::flags,
+             il);
+    return true;
+  }
 }
 
 bool Clz::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
@@ -2044,7 +2288,19 @@ bool Clz::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 
 bool Clzh::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                 size_t& len, LowLevelILFunction& il) {
-  UNIMPLEMENTED(*((const uint16_t*)data) & 0x1 ? 4 : 2)
+  if (op1 != OP1_x0F_RR || op2 != CLZH_DC_DA) {
+    TRICORE_LOG_REJECT("0x%lx: Clzh::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
+    return false;
+  }
+  {
+    len = 4;
+    uint8_t reg_dc, reg_da, op1, op2, s2, n;
+    Instruction::ExtractOpfieldsRR(data, op1, op2, reg_da, s2, n, reg_dc);
+    PackedTo(reg_dc, PackedOp::ClzH, {il.Register(WORD, reg_da)}, Clzh::flags,
+             il);
+    return true;
+  }
 }
 
 bool Cmov::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
@@ -2052,44 +2308,30 @@ bool Cmov::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
   switch (op1) {
     case CMOV_DA_D15_CONST4: {
       ExprId condition;
-      LowLevelILLabel trueLabel, doneLabel;
       len = 2;
       uint8_t op1, reg_da;
       int8_t const4;
       Instruction::ExtractOpfieldsSRC(data, op1, reg_da, const4);
       condition = il.CompareNotEqual(WORD, il.Register(WORD, TRICORE_REG_D15),
                                      il.Const(WORD, 0));
-      il.AddInstruction(il.If(condition, trueLabel, doneLabel));
-
-      il.MarkLabel(trueLabel);
-      il.AddInstruction(il.SetRegister(
-          WORD, reg_da, il.SignExtend(WORD, il.Const(BYTE, const4))));
-      il.AddInstruction(il.Goto(doneLabel));
-
-      il.MarkLabel(doneLabel);
+      SelectTo(reg_da, condition, il.SignExtend(WORD, il.Const(BYTE, const4)),
+               il.Register(WORD, reg_da), il, WORD);
       return true;
     }
     case CMOV_DA_D15_DB: {
       ExprId condition;
-      LowLevelILLabel trueLabel, doneLabel;
       len = 2;
       uint8_t op1, reg_da, reg_db;
       Instruction::ExtractOpfieldsSRR(data, op1, reg_da, reg_db);
       condition = il.CompareNotEqual(WORD, il.Register(WORD, TRICORE_REG_D15),
                                      il.Const(WORD, 0));
-      il.AddInstruction(il.If(condition, trueLabel, doneLabel));
-
-      il.MarkLabel(trueLabel);
-      il.AddInstruction(
-          il.SetRegister(WORD, reg_da, il.Register(WORD, reg_db)));
-      il.AddInstruction(il.Goto(doneLabel));
-
-      il.MarkLabel(doneLabel);
+      SelectTo(reg_da, condition, il.Register(WORD, reg_db),
+               il.Register(WORD, reg_da), il, WORD);
       return true;
     }
     default:
-      LogDebug("0x%lx: Cmov::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Cmov::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -2099,44 +2341,30 @@ bool Cmovn::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
   switch (op1) {
     case CMOVN_DA_D15_CONST4: {
       ExprId condition;
-      LowLevelILLabel trueLabel, doneLabel;
       len = 2;
       uint8_t op1, reg_da;
       int8_t const4;
       Instruction::ExtractOpfieldsSRC(data, op1, reg_da, const4);
       condition = il.CompareEqual(WORD, il.Register(WORD, TRICORE_REG_D15),
                                   il.Const(WORD, 0));
-      il.AddInstruction(il.If(condition, trueLabel, doneLabel));
-
-      il.MarkLabel(trueLabel);
-      il.AddInstruction(il.SetRegister(
-          WORD, reg_da, il.SignExtend(WORD, il.Const(BYTE, const4))));
-      il.AddInstruction(il.Goto(doneLabel));
-
-      il.MarkLabel(doneLabel);
+      SelectTo(reg_da, condition, il.SignExtend(WORD, il.Const(BYTE, const4)),
+               il.Register(WORD, reg_da), il, WORD);
       return true;
     }
     case CMOVN_DA_D15_DB: {
       ExprId condition;
-      LowLevelILLabel trueLabel, doneLabel;
       len = 2;
       uint8_t op1, reg_da, reg_db;
       Instruction::ExtractOpfieldsSRR(data, op1, reg_da, reg_db);
       condition = il.CompareEqual(WORD, il.Register(WORD, TRICORE_REG_D15),
                                   il.Const(WORD, 0));
-      il.AddInstruction(il.If(condition, trueLabel, doneLabel));
-
-      il.MarkLabel(trueLabel);
-      il.AddInstruction(
-          il.SetRegister(WORD, reg_da, il.Register(WORD, reg_db)));
-      il.AddInstruction(il.Goto(doneLabel));
-
-      il.MarkLabel(doneLabel);
+      SelectTo(reg_da, condition, il.Register(WORD, reg_db),
+               il.Register(WORD, reg_da), il, WORD);
       return true;
     }
     default:
-      LogDebug("0x%lx: Cmovn::%s received invalid opcode 1 0x%x", addr,
-               __func__, op1);
+      TRICORE_LOG_REJECT("0x%lx: Cmovn::%s received invalid opcode 1 0x%x",
+                         addr, __func__, op1);
       return false;
   }
 }
@@ -2156,32 +2384,21 @@ bool Crc32::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Csub::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                 size_t& len, LowLevelILFunction& il) {
   if (op1 != OP1_x2B_RRR || op2 != CSUB_DC_DD_DA_DB) {
-    LogDebug("0x%lx: Csub::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT("0x%lx: Csub::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
     return false;
   }
   {
     ExprId condition;
-    LowLevelILLabel trueLabel, falseLabel, doneLabel;
     len = 4;
     uint8_t op1, op2, reg_da, reg_db, n, reg_dd, reg_dc;
     Instruction::ExtractOpfieldsRRR(data, op1, op2, reg_da, reg_db, n, reg_dd,
                                     reg_dc);
     condition =
         il.CompareNotEqual(WORD, il.Register(WORD, reg_dd), il.Const(WORD, 0));
-    il.AddInstruction(il.If(condition, trueLabel, falseLabel));
-
-    il.MarkLabel(trueLabel);
-    il.AddInstruction(il.SetRegister(
-        WORD, reg_dc,
-        il.Sub(WORD, il.Register(WORD, reg_da), il.Register(WORD, reg_db))));
-    il.AddInstruction(il.Goto(doneLabel));
-
-    il.MarkLabel(falseLabel);
-    il.AddInstruction(il.SetRegister(WORD, reg_dc, il.Register(WORD, reg_da)));
-    il.AddInstruction(il.Goto(doneLabel));
-
-    il.MarkLabel(doneLabel);
+    SelectTo(reg_dc, condition,
+             il.Sub(WORD, il.Register(WORD, reg_da), il.Register(WORD, reg_db)),
+             il.Register(WORD, reg_da), il, WORD);
     return true;
   }
 }
@@ -2189,32 +2406,21 @@ bool Csub::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Csubn::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                  size_t& len, LowLevelILFunction& il) {
   if (op1 != OP1_x2B_RRR || op2 != CSUBN_DC_DD_DA_DB) {
-    LogDebug("0x%lx: Csubn::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT("0x%lx: Csubn::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
     return false;
   }
   {
     ExprId condition;
-    LowLevelILLabel trueLabel, falseLabel, doneLabel;
     len = 4;
     uint8_t op1, op2, reg_da, reg_db, n, reg_dd, reg_dc;
     Instruction::ExtractOpfieldsRRR(data, op1, op2, reg_da, reg_db, n, reg_dd,
                                     reg_dc);
     condition =
         il.CompareEqual(WORD, il.Register(WORD, reg_dd), il.Const(WORD, 0));
-    il.AddInstruction(il.If(condition, trueLabel, falseLabel));
-
-    il.MarkLabel(trueLabel);
-    il.AddInstruction(il.SetRegister(
-        WORD, reg_dc,
-        il.Sub(WORD, il.Register(WORD, reg_da), il.Register(WORD, reg_db))));
-    il.AddInstruction(il.Goto(doneLabel));
-
-    il.MarkLabel(falseLabel);
-    il.AddInstruction(il.SetRegister(WORD, reg_dc, il.Register(WORD, reg_da)));
-    il.AddInstruction(il.Goto(doneLabel));
-
-    il.MarkLabel(doneLabel);
+    SelectTo(reg_dc, condition,
+             il.Sub(WORD, il.Register(WORD, reg_da), il.Register(WORD, reg_db)),
+             il.Register(WORD, reg_da), il, WORD);
     return true;
   }
 }
@@ -2256,8 +2462,8 @@ bool Dsync::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Dvadj::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                  size_t& len, LowLevelILFunction& il) {
   if (op1 != OP1_x6B_RRR || op2 != DVADJ_EC_ED_DB) {
-    LogDebug("0x%lx: Dvadj::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT("0x%lx: Dvadj::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
     return false;
   }
   {
@@ -2343,8 +2549,8 @@ bool Dvinit::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                   size_t& len, LowLevelILFunction& il) {
   // TODO: handle flags
   if (op1 != OP1_x4B_RR) {
-    LogDebug("0x%lx: Dvinit::%s received invalid opcode 1 0x%x", addr, __func__,
-             op1);
+    TRICORE_LOG_REJECT("0x%lx: Dvinit::%s received invalid opcode 1 0x%x", addr,
+                       __func__, op1);
     return false;
   }
   switch (op2) {
@@ -2458,8 +2664,8 @@ bool Dvinit::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
       return true;
     }
     default:
-      LogDebug("0x%lx: Dvinit::%s received invalid opcode 2 0x%x", addr,
-               __func__, op2);
+      TRICORE_LOG_REJECT("0x%lx: Dvinit::%s received invalid opcode 2 0x%x",
+                         addr, __func__, op2);
       return false;
   }
 }
@@ -2467,8 +2673,8 @@ bool Dvinit::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Dvstep::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                   size_t& len, LowLevelILFunction& il) {
   if (op1 != OP1_x6B_RRR) {
-    LogDebug("0x%lx: Dvstep::%s received invalid opcode 1 0x%x", addr, __func__,
-             op1);
+    TRICORE_LOG_REJECT("0x%lx: Dvstep::%s received invalid opcode 1 0x%x", addr,
+                       __func__, op1);
     return false;
   }
   switch (op2) {
@@ -2694,8 +2900,8 @@ bool Dvstep::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
       return true;
     }
     default:
-      LogDebug("0x%lx: Dvstep::%s received invalid opcode 2 0x%x", addr,
-               __func__, op2);
+      TRICORE_LOG_REJECT("0x%lx: Dvstep::%s received invalid opcode 2 0x%x",
+                         addr, __func__, op2);
       return false;
   }
 }
@@ -2737,8 +2943,8 @@ bool Eq::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
     }
     case OP1_x8B_RC:
       if (op2 != EQ_DC_DA_CONST9) {
-        LogDebug("0x%lx: Eq::%s received invalid opcode 2 0x%x", addr, __func__,
-                 op2);
+        TRICORE_LOG_REJECT("0x%lx: Eq::%s received invalid opcode 2 0x%x", addr,
+                           __func__, op2);
         return false;
       }
       {
@@ -2758,8 +2964,8 @@ bool Eq::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
       }
     case OP1_x0B_RR:
       if (op2 != EQ_DC_DA_DB) {
-        LogDebug("0x%lx: Eq::%s received invalid opcode 2 0x%x", addr, __func__,
-                 op2);
+        TRICORE_LOG_REJECT("0x%lx: Eq::%s received invalid opcode 2 0x%x", addr,
+                           __func__, op2);
         return false;
       }
       {
@@ -2776,8 +2982,8 @@ bool Eq::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
         return true;
       }
     default:
-      LogDebug("0x%lx: Eq::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Eq::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -2785,8 +2991,8 @@ bool Eq::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Eqa::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                size_t& len, LowLevelILFunction& il) {
   if (op1 != OP1_x01_RR || op2 != EQA_DC_AA_AB) {
-    LogDebug("0x%lx: Eqa::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT("0x%lx: Eqa::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
     return false;
   }
   {
@@ -2808,194 +3014,44 @@ bool Eqa::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Eqbhw::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                  size_t& len, LowLevelILFunction& il) {
   if (op1 != OP1_x0B_RR) {
-    LogDebug("0x%lx: Eqbhw::%s received invalid opcode 1 0x%x", addr, __func__,
-             op1);
+    TRICORE_LOG_REJECT("0x%lx: Eqbhw::%s received invalid opcode 1 0x%x", addr,
+                       __func__, op1);
     return false;
   }
   switch (op2) {
     case EQB_DC_DA_DB: {
-      ExprId cond_byte0, cond_byte1, cond_byte2, cond_byte3;
-      LowLevelILLabel trueLabel0, trueLabel1, trueLabel2, trueLabel3,
-          falseLabel0, falseLabel1, falseLabel2, doneLabel;
       len = 4;
       uint8_t reg_dc, reg_da, reg_db, op1, op2, n;
       Instruction::ExtractOpfieldsRR(data, op1, op2, reg_da, reg_db, n, reg_dc);
-
-      il.AddInstruction(il.SetRegister(
-          WORD, LLIL_TEMP(3),
-          il.BoolToInt(
-              WORD,
-              il.CompareEqual(
-                  WORD,
-                  il.And(WORD,
-                         il.LogicalShiftRight(WORD, il.Register(WORD, reg_da),
-                                              il.Const(WORD, 24)),
-                         il.Const(WORD, 0xFF)),
-                  il.And(WORD,
-                         il.LogicalShiftRight(WORD, il.Register(WORD, reg_db),
-                                              il.Const(WORD, 24)),
-                         il.Const(WORD, 0xFF))))));
-      il.AddInstruction(il.SetRegister(
-          WORD, LLIL_TEMP(2),
-          il.BoolToInt(
-              WORD,
-              il.CompareEqual(
-                  WORD,
-                  il.And(WORD,
-                         il.LogicalShiftRight(WORD, il.Register(WORD, reg_da),
-                                              il.Const(WORD, 16)),
-                         il.Const(WORD, 0xFF)),
-                  il.And(WORD,
-                         il.LogicalShiftRight(WORD, il.Register(WORD, reg_db),
-                                              il.Const(WORD, 16)),
-                         il.Const(WORD, 0xFF))))));
-      il.AddInstruction(il.SetRegister(
-          WORD, LLIL_TEMP(1),
-          il.BoolToInt(
-              WORD,
-              il.CompareEqual(
-                  WORD,
-                  il.And(WORD,
-                         il.LogicalShiftRight(WORD, il.Register(WORD, reg_da),
-                                              il.Const(WORD, 8)),
-                         il.Const(WORD, 0xFF)),
-                  il.And(WORD,
-                         il.LogicalShiftRight(WORD, il.Register(WORD, reg_db),
-                                              il.Const(WORD, 8)),
-                         il.Const(WORD, 0xFF))))));
-      il.AddInstruction(il.SetRegister(
-          WORD, LLIL_TEMP(0),
-          il.BoolToInt(WORD,
-                       il.CompareEqual(WORD,
-                                       il.And(WORD, il.Register(WORD, reg_da),
-                                              il.Const(WORD, 0xFF)),
-                                       il.And(WORD, il.Register(WORD, reg_db),
-                                              il.Const(WORD, 0xFF))))));
-
-      cond_byte0 = il.CompareEqual(WORD, il.Register(WORD, LLIL_TEMP(0)),
-                                   il.Const(WORD, 1));
-      cond_byte1 = il.CompareEqual(WORD, il.Register(WORD, LLIL_TEMP(1)),
-                                   il.Const(WORD, 1));
-      cond_byte2 = il.CompareEqual(WORD, il.Register(WORD, LLIL_TEMP(2)),
-                                   il.Const(WORD, 1));
-      cond_byte3 = il.CompareEqual(WORD, il.Register(WORD, LLIL_TEMP(3)),
-                                   il.Const(WORD, 1));
-
-      il.AddInstruction(il.SetRegister(WORD, reg_dc, il.Const(WORD, 0)));
-
-      il.AddInstruction(il.If(cond_byte0, trueLabel0, falseLabel0));
-      il.MarkLabel(trueLabel0);
-      il.AddInstruction(il.SetRegister(
-          WORD, reg_dc,
-          il.Or(WORD, il.Register(WORD, reg_dc), il.Const(WORD, 0xFF))));
-      il.AddInstruction(il.Goto(falseLabel0));
-
-      il.MarkLabel(falseLabel0);
-      il.AddInstruction(il.If(cond_byte1, trueLabel1, falseLabel1));
-      il.MarkLabel(trueLabel1);
-      il.AddInstruction(il.SetRegister(
-          WORD, reg_dc,
-          il.Or(WORD, il.Register(WORD, reg_dc), il.Const(WORD, 0xFF00))));
-      il.AddInstruction(il.Goto(falseLabel1));
-
-      il.MarkLabel(falseLabel1);
-      il.AddInstruction(il.If(cond_byte2, trueLabel2, falseLabel2));
-      il.MarkLabel(trueLabel2);
-      il.AddInstruction(il.SetRegister(
-          WORD, reg_dc,
-          il.Or(WORD, il.Register(WORD, reg_dc), il.Const(WORD, 0xFF0000))));
-      il.AddInstruction(il.Goto(falseLabel2));
-
-      il.MarkLabel(falseLabel2);
-      il.AddInstruction(il.If(cond_byte3, trueLabel3, doneLabel));
-      il.MarkLabel(trueLabel3);
-      il.AddInstruction(il.SetRegister(
-          WORD, reg_dc,
-          il.Or(WORD, il.Register(WORD, reg_dc), il.Const(WORD, 0xFF000000))));
-      il.AddInstruction(il.Goto(doneLabel));
-
-      il.MarkLabel(doneLabel);
+      PackedTo(reg_dc, PackedOp::EqB,
+               {il.Register(WORD, reg_da), il.Register(WORD, reg_db)},
+               Eqbhw::flags, il);
       return true;
     }
     case EQH_DC_DA_DB: {
-      ExprId cond_hword0, cond_hword1;
-      LowLevelILLabel trueLabel0, trueLabel1, trueLabel2, trueLabel3,
-          falseLabel0, falseLabel1, falseLabel2, doneLabel;
       len = 4;
       uint8_t reg_dc, reg_da, reg_db, op1, op2, n;
       Instruction::ExtractOpfieldsRR(data, op1, op2, reg_da, reg_db, n, reg_dc);
-
-      il.AddInstruction(il.SetRegister(
-          WORD, LLIL_TEMP(1),
-          il.BoolToInt(
-              WORD,
-              il.CompareEqual(
-                  WORD,
-                  il.And(WORD,
-                         il.LogicalShiftRight(WORD, il.Register(WORD, reg_da),
-                                              il.Const(WORD, 16)),
-                         il.Const(WORD, 0xFFFF)),
-                  il.And(WORD,
-                         il.LogicalShiftRight(WORD, il.Register(WORD, reg_db),
-                                              il.Const(WORD, 16)),
-                         il.Const(WORD, 0xFFFF))))));
-      il.AddInstruction(il.SetRegister(
-          WORD, LLIL_TEMP(0),
-          il.BoolToInt(WORD,
-                       il.CompareEqual(WORD,
-                                       il.And(WORD, il.Register(WORD, reg_da),
-                                              il.Const(WORD, 0xFFFF)),
-                                       il.And(WORD, il.Register(WORD, reg_db),
-                                              il.Const(WORD, 0xFFFF))))));
-
-      cond_hword0 = il.CompareEqual(WORD, il.Register(WORD, LLIL_TEMP(0)),
-                                    il.Const(WORD, 1));
-      cond_hword1 = il.CompareEqual(WORD, il.Register(WORD, LLIL_TEMP(1)),
-                                    il.Const(WORD, 1));
-
-      il.AddInstruction(il.SetRegister(WORD, reg_dc, il.Const(WORD, 0)));
-
-      il.AddInstruction(il.If(cond_hword0, trueLabel0, falseLabel0));
-      il.MarkLabel(trueLabel0);
-      il.AddInstruction(il.SetRegister(
-          WORD, reg_dc,
-          il.Or(WORD, il.Register(WORD, reg_dc), il.Const(WORD, 0xFFFF))));
-      il.AddInstruction(il.Goto(falseLabel0));
-
-      il.MarkLabel(falseLabel0);
-      il.AddInstruction(il.If(cond_hword1, trueLabel1, doneLabel));
-      il.MarkLabel(trueLabel1);
-      il.AddInstruction(il.SetRegister(
-          WORD, reg_dc,
-          il.Or(WORD, il.Register(WORD, reg_dc), il.Const(WORD, 0xFFFF0000))));
-      il.AddInstruction(il.Goto(doneLabel));
-
-      il.MarkLabel(doneLabel);
+      PackedTo(reg_dc, PackedOp::EqH,
+               {il.Register(WORD, reg_da), il.Register(WORD, reg_db)},
+               Eqbhw::flags, il);
       return true;
     }
     case EQW_DC_DA_DB: {
       ExprId condition;
-      LowLevelILLabel trueLabel, doneLabel;
       len = 4;
       uint8_t reg_dc, reg_da, reg_db, op1, op2, n;
       Instruction::ExtractOpfieldsRR(data, op1, op2, reg_da, reg_db, n, reg_dc);
-
       condition = il.CompareEqual(WORD, il.Register(WORD, reg_da),
                                   il.Register(WORD, reg_db));
-      il.AddInstruction(il.SetRegister(WORD, reg_dc, il.Const(WORD, 0)));
-      il.AddInstruction(il.If(condition, trueLabel, doneLabel));
-
-      il.MarkLabel(trueLabel);
-      il.AddInstruction(
-          il.SetRegister(WORD, reg_dc, il.Const(WORD, 0xFFFFFFFF)));
-      il.AddInstruction(il.Goto(doneLabel));
-
-      il.MarkLabel(doneLabel);
+      // All ones when equal
+      il.AddInstruction(il.SetRegister(
+          WORD, reg_dc, il.Neg(WORD, il.BoolToInt(WORD, condition))));
       return true;
     }
     default:
-      LogDebug("0x%lx: Eqbhw::%s received invalid opcode 2 0x%x", addr,
-               __func__, op2);
+      TRICORE_LOG_REJECT("0x%lx: Eqbhw::%s received invalid opcode 2 0x%x",
+                         addr, __func__, op2);
       return false;
   }
 }
@@ -3006,322 +3062,64 @@ bool Eqanybh::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
     case OP1_x8B_RC:
       switch (op2) {
         case EQANYB_DC_DA_CONST9: {
-          ExprId cond_byte0, cond_byte1, cond_byte2, cond_byte3, constant;
-          LowLevelILLabel trueLabel0, trueLabel1, trueLabel2, trueLabel3,
-              falseLabel0, falseLabel1, falseLabel2, doneLabel;
           len = 4;
           uint8_t reg_da, reg_dc, op1, op2;
           int16_t const9;
           Instruction::ExtractOpfieldsRC(data, op1, op2, reg_da, reg_dc,
                                          const9);
-          constant = il.SignExtend(WORD, il.Const(HWORD, const9));
-
-          il.AddInstruction(il.SetRegister(
-              WORD, LLIL_TEMP(3),
-              il.BoolToInt(WORD,
-                           il.CompareEqual(
-                               WORD,
-                               il.And(WORD,
-                                      il.LogicalShiftRight(
-                                          WORD, il.Register(WORD, reg_da),
-                                          il.Const(WORD, 24)),
-                                      il.Const(WORD, 0xFF)),
-                               il.And(WORD,
-                                      il.LogicalShiftRight(WORD, constant,
-                                                           il.Const(WORD, 24)),
-                                      il.Const(WORD, 0xFF))))));
-          il.AddInstruction(il.SetRegister(
-              WORD, LLIL_TEMP(2),
-              il.BoolToInt(WORD,
-                           il.CompareEqual(
-                               WORD,
-                               il.And(WORD,
-                                      il.LogicalShiftRight(
-                                          WORD, il.Register(WORD, reg_da),
-                                          il.Const(WORD, 16)),
-                                      il.Const(WORD, 0xFF)),
-                               il.And(WORD,
-                                      il.LogicalShiftRight(WORD, constant,
-                                                           il.Const(WORD, 16)),
-                                      il.Const(WORD, 0xFF))))));
-          il.AddInstruction(il.SetRegister(
-              WORD, LLIL_TEMP(1),
-              il.BoolToInt(
-                  WORD,
-                  il.CompareEqual(WORD,
-                                  il.And(WORD,
-                                         il.LogicalShiftRight(
-                                             WORD, il.Register(WORD, reg_da),
-                                             il.Const(WORD, 8)),
-                                         il.Const(WORD, 0xFF)),
-                                  il.And(WORD,
-                                         il.LogicalShiftRight(
-                                             WORD, constant, il.Const(WORD, 8)),
-                                         il.Const(WORD, 0xFF))))));
-          il.AddInstruction(il.SetRegister(
-              WORD, LLIL_TEMP(0),
-              il.BoolToInt(WORD,
-                           il.CompareEqual(
-                               WORD,
-                               il.And(WORD, il.Register(WORD, reg_da),
-                                      il.Const(WORD, 0xFF)),
-                               il.And(WORD, constant, il.Const(WORD, 0xFF))))));
-
-          cond_byte0 = il.CompareEqual(WORD, il.Register(WORD, LLIL_TEMP(0)),
-                                       il.Const(WORD, 1));
-          cond_byte1 = il.CompareEqual(WORD, il.Register(WORD, LLIL_TEMP(1)),
-                                       il.Const(WORD, 1));
-          cond_byte2 = il.CompareEqual(WORD, il.Register(WORD, LLIL_TEMP(2)),
-                                       il.Const(WORD, 1));
-          cond_byte3 = il.CompareEqual(WORD, il.Register(WORD, LLIL_TEMP(3)),
-                                       il.Const(WORD, 1));
-
-          il.AddInstruction(il.SetRegister(WORD, reg_dc, il.Const(WORD, 0)));
-
-          il.AddInstruction(il.If(cond_byte0, trueLabel0, falseLabel0));
-          il.MarkLabel(trueLabel0);
-          il.AddInstruction(il.SetRegister(WORD, reg_dc, il.Const(WORD, 1)));
-          il.AddInstruction(il.Goto(doneLabel));
-
-          il.MarkLabel(falseLabel0);
-          il.AddInstruction(il.If(cond_byte1, trueLabel1, falseLabel1));
-          il.MarkLabel(trueLabel1);
-          il.AddInstruction(il.SetRegister(WORD, reg_dc, il.Const(WORD, 1)));
-          il.AddInstruction(il.Goto(doneLabel));
-
-          il.MarkLabel(falseLabel1);
-          il.AddInstruction(il.If(cond_byte2, trueLabel2, falseLabel2));
-          il.MarkLabel(trueLabel2);
-          il.AddInstruction(il.SetRegister(WORD, reg_dc, il.Const(WORD, 1)));
-          il.AddInstruction(il.Goto(doneLabel));
-
-          il.MarkLabel(falseLabel2);
-          il.AddInstruction(il.If(cond_byte3, trueLabel3, doneLabel));
-          il.MarkLabel(trueLabel3);
-          il.AddInstruction(il.SetRegister(WORD, reg_dc, il.Const(WORD, 1)));
-          il.AddInstruction(il.Goto(doneLabel));
-
-          il.MarkLabel(doneLabel);
+          PackedTo(reg_dc, PackedOp::EqanyB,
+                   {il.Register(WORD, reg_da), il.Const(WORD, const9)},
+                   Eqanybh::flags, il);
           return true;
         }
         case EQANYH_DC_DA_CONST9: {
-          ExprId cond_hword0, cond_hword1, constant;
-          LowLevelILLabel trueLabel0, trueLabel1, falseLabel0, doneLabel;
           len = 4;
           uint8_t reg_da, reg_dc, op1, op2;
           int16_t const9;
           Instruction::ExtractOpfieldsRC(data, op1, op2, reg_da, reg_dc,
                                          const9);
-          constant = il.SignExtend(WORD, il.Const(HWORD, const9));
-
-          il.AddInstruction(il.SetRegister(
-              WORD, LLIL_TEMP(1),
-              il.BoolToInt(WORD,
-                           il.CompareEqual(
-                               WORD,
-                               il.And(WORD,
-                                      il.LogicalShiftRight(
-                                          WORD, il.Register(WORD, reg_da),
-                                          il.Const(WORD, 16)),
-                                      il.Const(WORD, 0xFFFF)),
-                               il.And(WORD,
-                                      il.LogicalShiftRight(WORD, constant,
-                                                           il.Const(WORD, 16)),
-                                      il.Const(WORD, 0xFFFF))))));
-          il.AddInstruction(il.SetRegister(
-              WORD, LLIL_TEMP(0),
-              il.BoolToInt(
-                  WORD, il.CompareEqual(
-                            WORD,
-                            il.And(WORD, il.Register(WORD, reg_da),
-                                   il.Const(WORD, 0xFFFF)),
-                            il.And(WORD, constant, il.Const(WORD, 0xFFFF))))));
-
-          cond_hword0 = il.CompareEqual(WORD, il.Register(WORD, LLIL_TEMP(0)),
-                                        il.Const(WORD, 1));
-          cond_hword1 = il.CompareEqual(WORD, il.Register(WORD, LLIL_TEMP(1)),
-                                        il.Const(WORD, 1));
-
-          il.AddInstruction(il.SetRegister(WORD, reg_dc, il.Const(WORD, 0)));
-
-          il.AddInstruction(il.If(cond_hword0, trueLabel0, falseLabel0));
-          il.MarkLabel(trueLabel0);
-          il.AddInstruction(il.SetRegister(WORD, reg_dc, il.Const(WORD, 1)));
-          il.AddInstruction(il.Goto(doneLabel));
-
-          il.MarkLabel(falseLabel0);
-          il.AddInstruction(il.If(cond_hword1, trueLabel1, doneLabel));
-          il.MarkLabel(trueLabel1);
-          il.AddInstruction(il.SetRegister(WORD, reg_dc, il.Const(WORD, 1)));
-          il.AddInstruction(il.Goto(doneLabel));
-
-          il.MarkLabel(doneLabel);
+          PackedTo(reg_dc, PackedOp::EqanyH,
+                   {il.Register(WORD, reg_da), il.Const(WORD, const9)},
+                   Eqanybh::flags, il);
           return true;
         }
         default:
-          LogDebug("0x%lx: Eqanybh::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT(
+              "0x%lx: Eqanybh::%s received invalid opcode 2 0x%x",
+              addr, __func__, op2);
           return false;
       }
     case OP1_x0B_RR:
       switch (op2) {
         case EQANYB_DC_DA_DB: {
-          ExprId cond_byte0, cond_byte1, cond_byte2, cond_byte3;
-          LowLevelILLabel trueLabel0, trueLabel1, trueLabel2, trueLabel3,
-              falseLabel0, falseLabel1, falseLabel2, doneLabel;
           len = 4;
           uint8_t reg_dc, reg_da, reg_db, op1, op2, n;
           Instruction::ExtractOpfieldsRR(data, op1, op2, reg_da, reg_db, n,
                                          reg_dc);
-
-          il.AddInstruction(il.SetRegister(
-              WORD, LLIL_TEMP(3),
-              il.BoolToInt(WORD, il.CompareEqual(
-                                     WORD,
-                                     il.And(WORD,
-                                            il.LogicalShiftRight(
-                                                WORD, il.Register(WORD, reg_da),
-                                                il.Const(WORD, 24)),
-                                            il.Const(WORD, 0xFF)),
-                                     il.And(WORD,
-                                            il.LogicalShiftRight(
-                                                WORD, il.Register(WORD, reg_db),
-                                                il.Const(WORD, 24)),
-                                            il.Const(WORD, 0xFF))))));
-          il.AddInstruction(il.SetRegister(
-              WORD, LLIL_TEMP(2),
-              il.BoolToInt(WORD, il.CompareEqual(
-                                     WORD,
-                                     il.And(WORD,
-                                            il.LogicalShiftRight(
-                                                WORD, il.Register(WORD, reg_da),
-                                                il.Const(WORD, 16)),
-                                            il.Const(WORD, 0xFF)),
-                                     il.And(WORD,
-                                            il.LogicalShiftRight(
-                                                WORD, il.Register(WORD, reg_db),
-                                                il.Const(WORD, 16)),
-                                            il.Const(WORD, 0xFF))))));
-          il.AddInstruction(il.SetRegister(
-              WORD, LLIL_TEMP(1),
-              il.BoolToInt(WORD, il.CompareEqual(
-                                     WORD,
-                                     il.And(WORD,
-                                            il.LogicalShiftRight(
-                                                WORD, il.Register(WORD, reg_da),
-                                                il.Const(WORD, 8)),
-                                            il.Const(WORD, 0xFF)),
-                                     il.And(WORD,
-                                            il.LogicalShiftRight(
-                                                WORD, il.Register(WORD, reg_db),
-                                                il.Const(WORD, 8)),
-                                            il.Const(WORD, 0xFF))))));
-          il.AddInstruction(il.SetRegister(
-              WORD, LLIL_TEMP(0),
-              il.BoolToInt(
-                  WORD, il.CompareEqual(WORD,
-                                        il.And(WORD, il.Register(WORD, reg_da),
-                                               il.Const(WORD, 0xFF)),
-                                        il.And(WORD, il.Register(WORD, reg_db),
-                                               il.Const(WORD, 0xFF))))));
-
-          cond_byte0 = il.CompareEqual(WORD, il.Register(WORD, LLIL_TEMP(0)),
-                                       il.Const(WORD, 1));
-          cond_byte1 = il.CompareEqual(WORD, il.Register(WORD, LLIL_TEMP(1)),
-                                       il.Const(WORD, 1));
-          cond_byte2 = il.CompareEqual(WORD, il.Register(WORD, LLIL_TEMP(2)),
-                                       il.Const(WORD, 1));
-          cond_byte3 = il.CompareEqual(WORD, il.Register(WORD, LLIL_TEMP(3)),
-                                       il.Const(WORD, 1));
-
-          il.AddInstruction(il.SetRegister(WORD, reg_dc, il.Const(WORD, 0)));
-
-          il.AddInstruction(il.If(cond_byte0, trueLabel0, falseLabel0));
-          il.MarkLabel(trueLabel0);
-          il.AddInstruction(il.SetRegister(WORD, reg_dc, il.Const(WORD, 1)));
-          il.AddInstruction(il.Goto(doneLabel));
-
-          il.MarkLabel(falseLabel0);
-          il.AddInstruction(il.If(cond_byte1, trueLabel1, falseLabel1));
-          il.MarkLabel(trueLabel1);
-          il.AddInstruction(il.SetRegister(WORD, reg_dc, il.Const(WORD, 1)));
-          il.AddInstruction(il.Goto(doneLabel));
-
-          il.MarkLabel(falseLabel1);
-          il.AddInstruction(il.If(cond_byte2, trueLabel2, falseLabel2));
-          il.MarkLabel(trueLabel2);
-          il.AddInstruction(il.SetRegister(WORD, reg_dc, il.Const(WORD, 1)));
-          il.AddInstruction(il.Goto(doneLabel));
-
-          il.MarkLabel(falseLabel2);
-          il.AddInstruction(il.If(cond_byte3, trueLabel3, doneLabel));
-          il.MarkLabel(trueLabel3);
-          il.AddInstruction(il.SetRegister(WORD, reg_dc, il.Const(WORD, 1)));
-          il.AddInstruction(il.Goto(doneLabel));
-
-          il.MarkLabel(doneLabel);
+          PackedTo(reg_dc, PackedOp::EqanyB,
+                   {il.Register(WORD, reg_da), il.Register(WORD, reg_db)},
+                   Eqanybh::flags, il);
           return true;
         }
         case EQANYH_DC_DA_DB: {
-          ExprId cond_hword0, cond_hword1;
-          LowLevelILLabel trueLabel0, trueLabel1, falseLabel0, doneLabel;
           len = 4;
           uint8_t reg_dc, reg_da, reg_db, op1, op2, n;
           Instruction::ExtractOpfieldsRR(data, op1, op2, reg_da, reg_db, n,
                                          reg_dc);
-
-          il.AddInstruction(il.SetRegister(
-              WORD, LLIL_TEMP(1),
-              il.BoolToInt(WORD, il.CompareEqual(
-                                     WORD,
-                                     il.And(WORD,
-                                            il.LogicalShiftRight(
-                                                WORD, il.Register(WORD, reg_da),
-                                                il.Const(WORD, 16)),
-                                            il.Const(WORD, 0xFFFF)),
-                                     il.And(WORD,
-                                            il.LogicalShiftRight(
-                                                WORD, il.Register(WORD, reg_db),
-                                                il.Const(WORD, 16)),
-                                            il.Const(WORD, 0xFFFF))))));
-          il.AddInstruction(il.SetRegister(
-              WORD, LLIL_TEMP(0),
-              il.BoolToInt(
-                  WORD, il.CompareEqual(WORD,
-                                        il.And(WORD, il.Register(WORD, reg_da),
-                                               il.Const(WORD, 0xFFFF)),
-                                        il.And(WORD, il.Register(WORD, reg_db),
-                                               il.Const(WORD, 0xFFFF))))));
-
-          cond_hword0 = il.CompareEqual(WORD, il.Register(WORD, LLIL_TEMP(0)),
-                                        il.Const(WORD, 1));
-          cond_hword1 = il.CompareEqual(WORD, il.Register(WORD, LLIL_TEMP(1)),
-                                        il.Const(WORD, 1));
-
-          il.AddInstruction(il.SetRegister(WORD, reg_dc, il.Const(WORD, 0)));
-
-          il.AddInstruction(il.If(cond_hword0, trueLabel0, falseLabel0));
-          il.MarkLabel(trueLabel0);
-          il.AddInstruction(il.SetRegister(WORD, reg_dc, il.Const(WORD, 1)));
-          il.AddInstruction(il.Goto(doneLabel));
-
-          il.MarkLabel(falseLabel0);
-          il.AddInstruction(il.If(cond_hword1, trueLabel1, doneLabel));
-          il.MarkLabel(trueLabel1);
-          il.AddInstruction(il.SetRegister(WORD, reg_dc, il.Const(WORD, 1)));
-          il.AddInstruction(il.Goto(doneLabel));
-
-          il.MarkLabel(doneLabel);
+          PackedTo(reg_dc, PackedOp::EqanyH,
+                   {il.Register(WORD, reg_da), il.Register(WORD, reg_db)},
+                   Eqanybh::flags, il);
           return true;
         }
         default:
-          LogDebug("0x%lx: Eqanybh::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT(
+              "0x%lx: Eqanybh::%s received invalid opcode 2 0x%x",
+              addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Eqanybh::%s received invalid opcode 1 0x%x", addr,
-               __func__, op1);
+      TRICORE_LOG_REJECT("0x%lx: Eqanybh::%s received invalid opcode 1 0x%x",
+                         addr, __func__, op1);
       return false;
   }
 }
@@ -3329,8 +3127,8 @@ bool Eqanybh::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Eqza::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                 size_t& len, LowLevelILFunction& il) {
   if (op1 != OP1_x01_RR || op2 != EQZA_DC_AA) {
-    LogDebug("0x%lx: Eqza::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT("0x%lx: Eqza::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
     return false;
   }
   {
@@ -3402,8 +3200,8 @@ bool Extr::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return true;
         }
         default:
-          LogDebug("0x%lx: Extr::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Extr::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x17_RRRR:
@@ -3471,8 +3269,8 @@ bool Extr::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return true;
         }
         default:
-          LogDebug("0x%lx: Extr::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Extr::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x57_RRRW:
@@ -3525,54 +3323,55 @@ bool Extr::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return true;
         }
         default:
-          LogDebug("0x%lx: Extr::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Extr::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Extr::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Extr::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
 
 bool Fcall::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
-                 size_t& len, LowLevelILFunction& il) {
+                 size_t& len, LowLevelILFunction& il, uint32_t target) {
   // TODO: add LLIL to save state
   switch (op1) {
     case FCALL_DISP24:
       len = 4;
       // FCALL gets the target the same way CALL does
       il.AddInstruction(
-          il.Call(il.ConstPointer(WORD, Call::GetTarget(data, addr, len))));
+          il.Call(il.ConstPointer(WORD, target)));
       return true;
     default:
-      LogDebug("0x%lx: Fcall::%s received invalid opcode 1 0x%x", addr,
-               __func__, op1);
+      TRICORE_LOG_REJECT("0x%lx: Fcall::%s received invalid opcode 1 0x%x",
+                         addr, __func__, op1);
       return false;
   }
 }
 
 bool Fcalla::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
-                  size_t& len, LowLevelILFunction& il) {
+                  size_t& len, LowLevelILFunction& il, uint32_t target) {
   // TODO: add LLIL to save state
   if (op1 != FCALLA_DISP24) {
-    LogDebug("0x%lx: Fcalla::%s received invalid opcode 1 0x%x", addr, __func__,
-             op1);
+    TRICORE_LOG_REJECT("0x%lx: Fcalla::%s received invalid opcode 1 0x%x", addr,
+                       __func__, op1);
     return false;
   }
   len = 4;
   // FCALLA gets the target the same way CALLA does
   il.AddInstruction(
-      il.Call(il.ConstPointer(WORD, Calla::GetTarget(data, addr, len))));
+      il.Call(il.ConstPointer(WORD, target)));
   return true;
 }
 
 bool Fcalli::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                   size_t& len, LowLevelILFunction& il) {
   if (op1 != OP1_x2D_RR || op2 != FCALLI_AA) {
-    LogDebug("0x%lx: Fcalli::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT(
+        "0x%lx: Fcalli::%s received invalid opcode(s) 0x%x, 0x%x",
+        addr, __func__, op1, op2);
     return false;
   }
   {
@@ -3629,8 +3428,8 @@ bool Ge::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return true;
         }
         default:
-          LogDebug("0x%lx: Ge::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Ge::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x0B_RR:
@@ -3660,13 +3459,13 @@ bool Ge::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return true;
         }
         default:
-          LogDebug("0x%lx: Ge::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Ge::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Ge::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Ge::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -3674,8 +3473,8 @@ bool Ge::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Gea::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                size_t& len, LowLevelILFunction& il) {
   if (op1 != OP1_x01_RR || op2 != GEA_DC_AA_AB) {
-    LogDebug("0x%lx: Gea::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT("0x%lx: Gea::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
     return false;
   }
   {
@@ -3708,8 +3507,8 @@ bool Insert::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
   switch (op1) {
     case OP1_xB7_RCPW:
       if (op2 != INSERT_DC_DA_CONST4_POS_WIDTH) {
-        LogDebug("0x%lx: Insert::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Insert::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       {
@@ -3737,16 +3536,16 @@ bool Insert::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
       // TODO: I don't know how to do an exponent operation with the LLIL, which
       // is necessary for this instruction
       if (op2 != INSERT_DC_DA_CONST4_ED) {
-        LogDebug("0x%lx: Insert::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Insert::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       len = 4;
       UNIMPLEMENTED(*((const uint16_t*)data) & 0x1 ? 4 : 2)
     case OP1_xD7_RCRW:
       if (op2 != INSERT_DC_DA_CONST4_DD_WIDTH) {
-        LogDebug("0x%lx: Insert::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Insert::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       {
@@ -3772,8 +3571,8 @@ bool Insert::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
       }
     case OP1_x37_RRPW:
       if (op2 != INSERT_DC_DA_DB_POS_WIDTH) {
-        LogDebug("0x%lx: Insert::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Insert::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       {
@@ -3798,16 +3597,16 @@ bool Insert::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
       // TODO: I don't know how to do an exponent operation with the LLIL, which
       // is necessary for this instruction
       if (op2 != INSERT_DC_DA_DB_ED) {
-        LogDebug("0x%lx: Insert::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Insert::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       len = 4;
       UNIMPLEMENTED(*((const uint16_t*)data) & 0x1 ? 4 : 2)
     case OP1_x57_RRRW:
       if (op2 != INSERT_DC_DA_DB_DD_WIDTH) {
-        LogDebug("0x%lx: Insert::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Insert::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       {
@@ -3828,8 +3627,8 @@ bool Insert::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
         return true;
       }
     default:
-      LogDebug("0x%lx: Insert::%s received invalid opcode 1 0x%x", addr,
-               __func__, op1);
+      TRICORE_LOG_REJECT("0x%lx: Insert::%s received invalid opcode 1 0x%x",
+                         addr, __func__, op1);
       return false;
   }
 }
@@ -3850,42 +3649,41 @@ bool Ixmin::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 }
 
 bool J::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
-             size_t& len, LowLevelILFunction& il) {
+             size_t& len, LowLevelILFunction& il, uint32_t target) {
   switch (op1) {
     case J_DISP8:
       len = 2;
       il.AddInstruction(
-          il.Jump(il.ConstPointer(WORD, J::GetTarget(data, addr, len))));
+          il.Jump(il.ConstPointer(WORD, target)));
       return true;
     case J_DISP24:
       len = 4;
       il.AddInstruction(
-          il.Jump(il.ConstPointer(WORD, J::GetTarget(data, addr, len))));
+          il.Jump(il.ConstPointer(WORD, target)));
       return true;
     default:
-      LogDebug("0x%lx: J::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: J::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
 
 bool Ja::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
-              size_t& len, LowLevelILFunction& il) {
+              size_t& len, LowLevelILFunction& il, uint32_t target) {
   if (op1 != JA_DISP24) {
-    LogDebug("0x%lx: Ja::%s received invalid opcode 1 0x%x", addr, __func__,
-             op1);
+    TRICORE_LOG_REJECT("0x%lx: Ja::%s received invalid opcode 1 0x%x", addr,
+                       __func__, op1);
     return false;
   }
   len = 4;
   il.AddInstruction(
-      il.Jump(il.ConstPointer(WORD, Ja::GetTarget(data, addr, len))));
+      il.Jump(il.ConstPointer(WORD, target)));
   return true;
 }
 
 bool Jeq::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                size_t& len, LowLevelILFunction& il,
-               BinaryNinja::Architecture* arch) {
-  uint32_t target = 0;
+               BinaryNinja::Architecture* arch, uint32_t target) {
   BNLowLevelILLabel *t, *f;
   ExprId condition;
 
@@ -3900,12 +3698,11 @@ bool Jeq::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
       Instruction::ExtractOpfieldsSBC(data, op1, disp4, const4);
       condition = il.CompareEqual(WORD, il.Register(WORD, TRICORE_REG_D15),
                                   il.SignExtend(WORD, il.Const(BYTE, const4)));
-      target = Jeq::GetTarget(data, addr, len);
       t = il.GetLabelForAddress(arch, target);
       f = il.GetLabelForAddress(arch, addr + len);
       if (!t || !f) {
-        LogDebug("0x%lx: Jeq::%s Failed to find true/false labels!", addr,
-                 __func__);
+        TRICORE_LOG_DEBUG("0x%lx: Jeq::%s Failed to find true/false labels!",
+                          addr, __func__);
         return false;
       }
       il.AddInstruction(il.If(condition, *t, *f));
@@ -3920,12 +3717,11 @@ bool Jeq::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
       Instruction::ExtractOpfieldsSBR(data, op1, disp4, reg_db);
       condition = il.CompareEqual(WORD, il.Register(WORD, TRICORE_REG_D15),
                                   il.Register(WORD, reg_db));
-      target = Jeq::GetTarget(data, addr, len);
       t = il.GetLabelForAddress(arch, target);
       f = il.GetLabelForAddress(arch, addr + len);
       if (!t || !f) {
-        LogDebug("0x%lx: Jeq::%s Failed to find true/false labels!", addr,
-                 __func__);
+        TRICORE_LOG_DEBUG("0x%lx: Jeq::%s Failed to find true/false labels!",
+                          addr, __func__);
         return false;
       }
       il.AddInstruction(il.If(condition, *t, *f));
@@ -3933,8 +3729,8 @@ bool Jeq::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
     }
     case OP1_xDF_BRC:
       if (op2 != JEQ_DA_CONST4_DISP15) {
-        LogDebug("0x%lx: Jeq::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Jeq::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       {
@@ -3946,12 +3742,11 @@ bool Jeq::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
         condition =
             il.CompareEqual(WORD, il.Register(WORD, reg_da),
                             il.SignExtend(WORD, il.Const(BYTE, const4)));
-        target = Jeq::GetTarget(data, addr, len);
         t = il.GetLabelForAddress(arch, target);
         f = il.GetLabelForAddress(arch, addr + len);
         if (!t || !f) {
-          LogDebug("0x%lx: Jeq::%s Failed to find true/false labels!", addr,
-                   __func__);
+          TRICORE_LOG_DEBUG("0x%lx: Jeq::%s Failed to find true/false labels!",
+                            addr, __func__);
           return false;
         }
         il.AddInstruction(il.If(condition, *t, *f));
@@ -3959,8 +3754,8 @@ bool Jeq::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
       }
     case OP1_x5F_BRR:
       if (op2 != JEQ_DA_DB_DISP15) {
-        LogDebug("0x%lx: Jeq::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Jeq::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       {
@@ -3970,34 +3765,32 @@ bool Jeq::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
         Instruction::ExtractOpfieldsBRR(data, op1, op2, reg_da, reg_db, disp15);
         condition = il.CompareEqual(WORD, il.Register(WORD, reg_da),
                                     il.Register(WORD, reg_db));
-        target = Jeq::GetTarget(data, addr, len);
         t = il.GetLabelForAddress(arch, target);
         f = il.GetLabelForAddress(arch, addr + len);
         if (!t || !f) {
-          LogDebug("0x%lx: Jeq::%s Failed to find true/false labels!", addr,
-                   __func__);
+          TRICORE_LOG_DEBUG("0x%lx: Jeq::%s Failed to find true/false labels!",
+                            addr, __func__);
           return false;
         }
         il.AddInstruction(il.If(condition, *t, *f));
         return true;
       }
     default:
-      LogDebug("0x%lx: Jeq::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Jeq::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
 
 bool Jeqa::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                 size_t& len, LowLevelILFunction& il,
-                BinaryNinja::Architecture* arch) {
-  uint32_t target = 0;
+                BinaryNinja::Architecture* arch, uint32_t target) {
   BNLowLevelILLabel *t, *f;
   ExprId condition;
 
   if (op1 != OP1_x7D_BRR || op2 != JEQA_AA_AB_DISP15) {
-    LogDebug("0x%lx: Jeqa::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT("0x%lx: Jeqa::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
     return false;
   }
   {
@@ -4009,12 +3802,11 @@ bool Jeqa::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
     REGTOA(reg_ab)
     condition = il.CompareEqual(WORD, il.Register(WORD, reg_aa),
                                 il.Register(WORD, reg_ab));
-    target = Jeqa::GetTarget(data, addr, len);
     t = il.GetLabelForAddress(arch, target);
     f = il.GetLabelForAddress(arch, addr + len);
     if (!t || !f) {
-      LogDebug("0x%lx: Jeq::%s Failed to find true/false labels!", addr,
-               __func__);
+      TRICORE_LOG_DEBUG("0x%lx: Jeq::%s Failed to find true/false labels!",
+                        addr, __func__);
       return false;
     }
     il.AddInstruction(il.If(condition, *t, *f));
@@ -4024,8 +3816,7 @@ bool Jeqa::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 
 bool Jge::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                size_t& len, LowLevelILFunction& il,
-               BinaryNinja::Architecture* arch) {
-  uint32_t target = 0;
+               BinaryNinja::Architecture* arch, uint32_t target) {
   BNLowLevelILLabel *t, *f;
   ExprId condition;
 
@@ -4042,12 +3833,12 @@ bool Jge::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           condition = il.CompareSignedGreaterEqual(
               WORD, il.Register(WORD, reg_da),
               il.SignExtend(WORD, il.Const(BYTE, const4)));
-          target = Jge::GetTarget(data, addr, len);
           t = il.GetLabelForAddress(arch, target);
           f = il.GetLabelForAddress(arch, addr + len);
           if (!t || !f) {
-            LogDebug("0x%lx: Jge::%s Failed to find true/false labels!", addr,
-                     __func__);
+            TRICORE_LOG_DEBUG(
+                "0x%lx: Jge::%s Failed to find true/false labels!",
+                addr, __func__);
             return false;
           }
           il.AddInstruction(il.If(condition, *t, *f));
@@ -4064,20 +3855,20 @@ bool Jge::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           condition = il.CompareUnsignedGreaterEqual(
               WORD, il.Register(WORD, reg_da),
               il.SignExtend(WORD, il.Const(BYTE, const4)));
-          target = Jge::GetTarget(data, addr, len);
           t = il.GetLabelForAddress(arch, target);
           f = il.GetLabelForAddress(arch, addr + len);
           if (!t || !f) {
-            LogDebug("0x%lx: Jge::%s Failed to find true/false labels!", addr,
-                     __func__);
+            TRICORE_LOG_DEBUG(
+                "0x%lx: Jge::%s Failed to find true/false labels!",
+                addr, __func__);
             return false;
           }
           il.AddInstruction(il.If(condition, *t, *f));
           return true;
         }
         default:
-          LogDebug("0x%lx: Jge::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Jge::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x7F_BRR:
@@ -4090,12 +3881,12 @@ bool Jge::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                                           disp15);
           condition = il.CompareSignedGreaterEqual(
               WORD, il.Register(WORD, reg_da), il.Register(WORD, reg_db));
-          target = Jge::GetTarget(data, addr, len);
           t = il.GetLabelForAddress(arch, target);
           f = il.GetLabelForAddress(arch, addr + len);
           if (!t || !f) {
-            LogDebug("0x%lx: Jge::%s Failed to find true/false labels!", addr,
-                     __func__);
+            TRICORE_LOG_DEBUG(
+                "0x%lx: Jge::%s Failed to find true/false labels!",
+                addr, __func__);
             return false;
           }
           il.AddInstruction(il.If(condition, *t, *f));
@@ -4109,39 +3900,38 @@ bool Jge::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                                           disp15);
           condition = il.CompareUnsignedGreaterEqual(
               WORD, il.Register(WORD, reg_da), il.Register(WORD, reg_db));
-          target = Jge::GetTarget(data, addr, len);
           t = il.GetLabelForAddress(arch, target);
           f = il.GetLabelForAddress(arch, addr + len);
           if (!t || !f) {
-            LogDebug("0x%lx: Jge::%s Failed to find true/false labels!", addr,
-                     __func__);
+            TRICORE_LOG_DEBUG(
+                "0x%lx: Jge::%s Failed to find true/false labels!",
+                addr, __func__);
             return false;
           }
           il.AddInstruction(il.If(condition, *t, *f));
           return true;
         }
         default:
-          LogDebug("0x%lx: Jge::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Jge::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Jge::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Jge::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
 
 bool Jgez::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                 size_t& len, LowLevelILFunction& il,
-                BinaryNinja::Architecture* arch) {
-  uint32_t target = 0;
+                BinaryNinja::Architecture* arch, uint32_t target) {
   BNLowLevelILLabel *t, *f;
   ExprId condition;
 
   if (op1 != JGEZ_DB_DISP4) {
-    LogDebug("0x%lx: Jgez::%s received invalid opcode 1 0x%x", addr, __func__,
-             op1);
+    TRICORE_LOG_REJECT("0x%lx: Jgez::%s received invalid opcode 1 0x%x", addr,
+                       __func__, op1);
     return false;
   }
   {
@@ -4151,12 +3941,11 @@ bool Jgez::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
     Instruction::ExtractOpfieldsSBR(data, op1, disp4, reg_db);
     condition = il.CompareSignedGreaterEqual(WORD, il.Register(WORD, reg_db),
                                              il.Const(WORD, 0));
-    target = Jgez::GetTarget(data, addr, len);
     t = il.GetLabelForAddress(arch, target);
     f = il.GetLabelForAddress(arch, addr + len);
     if (!t || !f) {
-      LogDebug("0x%lx: Jgez::%s Failed to find true/false labels!", addr,
-               __func__);
+      TRICORE_LOG_DEBUG("0x%lx: Jgez::%s Failed to find true/false labels!",
+                        addr, __func__);
       return false;
     }
     il.AddInstruction(il.If(condition, *t, *f));
@@ -4166,14 +3955,13 @@ bool Jgez::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 
 bool Jgtz::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                 size_t& len, LowLevelILFunction& il,
-                BinaryNinja::Architecture* arch) {
-  uint32_t target = 0;
+                BinaryNinja::Architecture* arch, uint32_t target) {
   BNLowLevelILLabel *t, *f;
   ExprId condition;
 
   if (op1 != JGTZ_DB_DISP4) {
-    LogDebug("0x%lx: Jgtz::%s received invalid opcode 1 0x%x", addr, __func__,
-             op1);
+    TRICORE_LOG_REJECT("0x%lx: Jgtz::%s received invalid opcode 1 0x%x", addr,
+                       __func__, op1);
     return false;
   }
   {
@@ -4183,12 +3971,11 @@ bool Jgtz::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
     Instruction::ExtractOpfieldsSBR(data, op1, disp4, reg_db);
     condition = il.CompareSignedGreaterThan(WORD, il.Register(WORD, reg_db),
                                             il.Const(WORD, 0));
-    target = Jgez::GetTarget(data, addr, len);
     t = il.GetLabelForAddress(arch, target);
     f = il.GetLabelForAddress(arch, addr + len);
     if (!t || !f) {
-      LogDebug("0x%lx: Jgtz::%s Failed to find true/false labels!", addr,
-               __func__);
+      TRICORE_LOG_DEBUG("0x%lx: Jgtz::%s Failed to find true/false labels!",
+                        addr, __func__);
       return false;
     }
     il.AddInstruction(il.If(condition, *t, *f));
@@ -4201,8 +3988,8 @@ bool Ji::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
   switch (op1) {
     case OP1_xDC_SR:
       if (op2 != JI_AA_16) {
-        LogDebug("0x%lx: Ji::%s received invalid opcode 2 0x%x", addr, __func__,
-                 op2);
+        TRICORE_LOG_REJECT("0x%lx: Ji::%s received invalid opcode 2 0x%x", addr,
+                           __func__, op2);
         return false;
       }
       {
@@ -4217,8 +4004,8 @@ bool Ji::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
       }
     case OP1_x2D_RR:
       if (op2 != JI_AA_32) {
-        LogDebug("0x%lx: Ji::%s received invalid opcode 2 0x%x", addr, __func__,
-                 op2);
+        TRICORE_LOG_REJECT("0x%lx: Ji::%s received invalid opcode 2 0x%x", addr,
+                           __func__, op2);
         return false;
       }
       {
@@ -4232,52 +4019,51 @@ bool Ji::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
         return true;
       }
     default:
-      LogDebug("0x%lx: Ji::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Ji::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
 
 bool Jl::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
-              size_t& len, LowLevelILFunction& il) {
+              size_t& len, LowLevelILFunction& il, uint32_t target) {
   if (op1 != JL_DISP24) {
-    LogDebug("0x%lx: Jl::%s received invalid opcode 1 0x%x", addr, __func__,
-             op1);
+    TRICORE_LOG_REJECT("0x%lx: Jl::%s received invalid opcode 1 0x%x", addr,
+                       __func__, op1);
     return false;
   }
   len = 4;
   il.AddInstruction(il.Store(WORD, il.Register(WORD, TRICORE_REG_A11),
                              il.Const(WORD, addr + 4)));
   il.AddInstruction(
-      il.Jump(il.ConstPointer(WORD, Jl::GetTarget(data, addr, len))));
+      il.Jump(il.ConstPointer(WORD, target)));
   return true;
 }
 
 bool Jla::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
-               size_t& len, LowLevelILFunction& il) {
+               size_t& len, LowLevelILFunction& il, uint32_t target) {
   if (op1 != JLA_DISP24) {
-    LogDebug("0x%lx: Jla::%s received invalid opcode 1 0x%x", addr, __func__,
-             op1);
+    TRICORE_LOG_REJECT("0x%lx: Jla::%s received invalid opcode 1 0x%x", addr,
+                       __func__, op1);
     return false;
   }
   len = 4;
   il.AddInstruction(il.Store(WORD, il.Register(WORD, TRICORE_REG_A11),
                              il.Const(WORD, addr + 4)));
   il.AddInstruction(
-      il.Jump(il.ConstPointer(WORD, Jla::GetTarget(data, addr, len))));
+      il.Jump(il.ConstPointer(WORD, target)));
   return true;
 }
 
 bool Jlez::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                 size_t& len, LowLevelILFunction& il,
-                BinaryNinja::Architecture* arch) {
-  uint32_t target = 0;
+                BinaryNinja::Architecture* arch, uint32_t target) {
   BNLowLevelILLabel *t, *f;
   ExprId condition;
 
   if (op1 != JLEZ_DB_DISP4) {
-    LogDebug("0x%lx: Jlez::%s received invalid opcode 1 0x%x", addr, __func__,
-             op1);
+    TRICORE_LOG_REJECT("0x%lx: Jlez::%s received invalid opcode 1 0x%x", addr,
+                       __func__, op1);
     return false;
   }
   {
@@ -4287,12 +4073,11 @@ bool Jlez::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
     Instruction::ExtractOpfieldsSBR(data, op1, disp4, reg_db);
     condition = il.CompareSignedLessEqual(WORD, il.Register(WORD, reg_db),
                                           il.Const(WORD, 0));
-    target = Jlez::GetTarget(data, addr, len);
     t = il.GetLabelForAddress(arch, target);
     f = il.GetLabelForAddress(arch, addr + len);
     if (!t || !f) {
-      LogDebug("0x%lx: Jlez::%s Failed to find true/false labels!", addr,
-               __func__);
+      TRICORE_LOG_DEBUG("0x%lx: Jlez::%s Failed to find true/false labels!",
+                        addr, __func__);
       return false;
     }
     il.AddInstruction(il.If(condition, *t, *f));
@@ -4303,8 +4088,8 @@ bool Jlez::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Jli::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                size_t& len, LowLevelILFunction& il) {
   if (op1 != OP1_x2D_RR || op2 != JLI_AA) {
-    LogDebug("0x%lx: Jli::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT("0x%lx: Jli::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
     return false;
   }
   {
@@ -4323,8 +4108,7 @@ bool Jli::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 
 bool Jlt::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                size_t& len, LowLevelILFunction& il,
-               BinaryNinja::Architecture* arch) {
-  uint32_t target = 0;
+               BinaryNinja::Architecture* arch, uint32_t target) {
   BNLowLevelILLabel *t, *f;
   ExprId condition;
 
@@ -4341,12 +4125,12 @@ bool Jlt::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           condition = il.CompareSignedLessEqual(
               WORD, il.Register(WORD, reg_da),
               il.SignExtend(WORD, il.Const(BYTE, const4)));
-          target = Jlt::GetTarget(data, addr, len);
           t = il.GetLabelForAddress(arch, target);
           f = il.GetLabelForAddress(arch, addr + len);
           if (!t || !f) {
-            LogDebug("0x%lx: Jlt::%s Failed to find true/false labels!", addr,
-                     __func__);
+            TRICORE_LOG_DEBUG(
+                "0x%lx: Jlt::%s Failed to find true/false labels!",
+                addr, __func__);
             return false;
           }
           il.AddInstruction(il.If(condition, *t, *f));
@@ -4363,20 +4147,20 @@ bool Jlt::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           condition = il.CompareUnsignedLessEqual(
               WORD, il.Register(WORD, reg_da),
               il.SignExtend(WORD, il.Const(BYTE, const4)));
-          target = Jlt::GetTarget(data, addr, len);
           t = il.GetLabelForAddress(arch, target);
           f = il.GetLabelForAddress(arch, addr + len);
           if (!t || !f) {
-            LogDebug("0x%lx: Jlt::%s Failed to find true/false labels!", addr,
-                     __func__);
+            TRICORE_LOG_DEBUG(
+                "0x%lx: Jlt::%s Failed to find true/false labels!",
+                addr, __func__);
             return false;
           }
           il.AddInstruction(il.If(condition, *t, *f));
           return true;
         }
         default:
-          LogDebug("0x%lx: Jlt::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Jlt::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x3F_BRR:
@@ -4389,12 +4173,12 @@ bool Jlt::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                                           disp15);
           condition = il.CompareSignedLessEqual(WORD, il.Register(WORD, reg_da),
                                                 il.Register(WORD, reg_db));
-          target = Jlt::GetTarget(data, addr, len);
           t = il.GetLabelForAddress(arch, target);
           f = il.GetLabelForAddress(arch, addr + len);
           if (!t || !f) {
-            LogDebug("0x%lx: Jlt::%s Failed to find true/false labels!", addr,
-                     __func__);
+            TRICORE_LOG_DEBUG(
+                "0x%lx: Jlt::%s Failed to find true/false labels!",
+                addr, __func__);
             return false;
           }
           il.AddInstruction(il.If(condition, *t, *f));
@@ -4408,39 +4192,38 @@ bool Jlt::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                                           disp15);
           condition = il.CompareUnsignedLessEqual(
               WORD, il.Register(WORD, reg_da), il.Register(WORD, reg_db));
-          target = Jlt::GetTarget(data, addr, len);
           t = il.GetLabelForAddress(arch, target);
           f = il.GetLabelForAddress(arch, addr + len);
           if (!t || !f) {
-            LogDebug("0x%lx: Jlt::%s Failed to find true/false labels!", addr,
-                     __func__);
+            TRICORE_LOG_DEBUG(
+                "0x%lx: Jlt::%s Failed to find true/false labels!",
+                addr, __func__);
             return false;
           }
           il.AddInstruction(il.If(condition, *t, *f));
           return true;
         }
         default:
-          LogDebug("0x%lx: Jlt::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Jlt::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Jlt::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Jlt::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
 
 bool Jltz::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                 size_t& len, LowLevelILFunction& il,
-                BinaryNinja::Architecture* arch) {
-  uint32_t target = 0;
+                BinaryNinja::Architecture* arch, uint32_t target) {
   BNLowLevelILLabel *t, *f;
   ExprId condition;
 
   if (op1 != JLTZ_DB_DISP4) {
-    LogDebug("0x%lx: Jltz::%s received invalid opcode 1 0x%x", addr, __func__,
-             op1);
+    TRICORE_LOG_REJECT("0x%lx: Jltz::%s received invalid opcode 1 0x%x", addr,
+                       __func__, op1);
     return false;
   }
   {
@@ -4450,12 +4233,11 @@ bool Jltz::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
     Instruction::ExtractOpfieldsSBR(data, op1, disp4, reg_db);
     condition = il.CompareSignedLessThan(WORD, il.Register(WORD, reg_db),
                                          il.Const(WORD, 0));
-    target = Jltz::GetTarget(data, addr, len);
     t = il.GetLabelForAddress(arch, target);
     f = il.GetLabelForAddress(arch, addr + len);
     if (!t || !f) {
-      LogDebug("0x%lx: Jltz::%s Failed to find true/false labels!", addr,
-               __func__);
+      TRICORE_LOG_DEBUG("0x%lx: Jltz::%s Failed to find true/false labels!",
+                        addr, __func__);
       return false;
     }
     il.AddInstruction(il.If(condition, *t, *f));
@@ -4465,16 +4247,15 @@ bool Jltz::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 
 bool Jne::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                size_t& len, LowLevelILFunction& il,
-               BinaryNinja::Architecture* arch) {
-  uint32_t target = 0;
+               BinaryNinja::Architecture* arch, uint32_t target) {
   BNLowLevelILLabel *t, *f;
   ExprId condition;
 
   switch (op1) {
     case OP1_xDF_BRC:
       if (op2 != JNE_DA_CONST4_DISP15) {
-        LogDebug("0x%lx: Jne::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Jne::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       {
@@ -4486,12 +4267,11 @@ bool Jne::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
         condition =
             il.CompareNotEqual(WORD, il.Register(WORD, reg_da),
                                il.SignExtend(WORD, il.Const(BYTE, const4)));
-        target = Jne::GetTarget(data, addr, len);
         t = il.GetLabelForAddress(arch, target);
         f = il.GetLabelForAddress(arch, addr + len);
         if (!t || !f) {
-          LogDebug("0x%lx: Jne::%s Failed to find true/false labels!", addr,
-                   __func__);
+          TRICORE_LOG_DEBUG("0x%lx: Jne::%s Failed to find true/false labels!",
+                            addr, __func__);
           return false;
         }
         il.AddInstruction(il.If(condition, *t, *f));
@@ -4499,8 +4279,8 @@ bool Jne::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
       }
     case OP1_x5F_BRR:
       if (op2 != JNE_DA_DB_DISP15) {
-        LogDebug("0x%lx: Jne::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Jne::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       {
@@ -4510,12 +4290,11 @@ bool Jne::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
         Instruction::ExtractOpfieldsBRR(data, op1, op2, reg_da, reg_db, disp15);
         condition = il.CompareNotEqual(WORD, il.Register(WORD, reg_da),
                                        il.Register(WORD, reg_db));
-        target = Jne::GetTarget(data, addr, len);
         t = il.GetLabelForAddress(arch, target);
         f = il.GetLabelForAddress(arch, addr + len);
         if (!t || !f) {
-          LogDebug("0x%lx: Jne::%s Failed to find true/false labels!", addr,
-                   __func__);
+          TRICORE_LOG_DEBUG("0x%lx: Jne::%s Failed to find true/false labels!",
+                            addr, __func__);
           return false;
         }
         il.AddInstruction(il.If(condition, *t, *f));
@@ -4531,12 +4310,11 @@ bool Jne::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
       condition =
           il.CompareNotEqual(WORD, il.Register(WORD, TRICORE_REG_D15),
                              il.SignExtend(WORD, il.Const(BYTE, const4)));
-      target = Jne::GetTarget(data, addr, len);
       t = il.GetLabelForAddress(arch, target);
       f = il.GetLabelForAddress(arch, addr + len);
       if (!t || !f) {
-        LogDebug("0x%lx: Jne::%s Failed to find true/false labels!", addr,
-                 __func__);
+        TRICORE_LOG_DEBUG("0x%lx: Jne::%s Failed to find true/false labels!",
+                          addr, __func__);
         return false;
       }
       il.AddInstruction(il.If(condition, *t, *f));
@@ -4551,34 +4329,32 @@ bool Jne::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
       Instruction::ExtractOpfieldsSBR(data, op1, disp4, reg_db);
       condition = il.CompareNotEqual(WORD, il.Register(WORD, TRICORE_REG_D15),
                                      il.Register(WORD, reg_db));
-      target = Jne::GetTarget(data, addr, len);
       t = il.GetLabelForAddress(arch, target);
       f = il.GetLabelForAddress(arch, addr + len);
       if (!t || !f) {
-        LogDebug("0x%lx: Jne::%s Failed to find true/false labels!", addr,
-                 __func__);
+        TRICORE_LOG_DEBUG("0x%lx: Jne::%s Failed to find true/false labels!",
+                          addr, __func__);
         return false;
       }
       il.AddInstruction(il.If(condition, *t, *f));
       return true;
     }
     default:
-      LogDebug("0x%lx: Jne::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Jne::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
 
 bool Jnea::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                 size_t& len, LowLevelILFunction& il,
-                BinaryNinja::Architecture* arch) {
-  uint32_t target = 0;
+                BinaryNinja::Architecture* arch, uint32_t target) {
   BNLowLevelILLabel *t, *f;
   ExprId condition;
 
   if (op1 != OP1_x7D_BRR || op2 != JNEA_AA_AB_DISP15) {
-    LogDebug("0x%lx: Jnea::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT("0x%lx: Jnea::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
     return false;
   }
   {
@@ -4590,12 +4366,11 @@ bool Jnea::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
     REGTOA(reg_ab)
     condition = il.CompareNotEqual(WORD, il.Register(WORD, reg_aa),
                                    il.Register(WORD, reg_ab));
-    target = Jnea::GetTarget(data, addr, len);
     t = il.GetLabelForAddress(arch, target);
     f = il.GetLabelForAddress(arch, addr + len);
     if (!t || !f) {
-      LogDebug("0x%lx: Jnea::%s Failed to find true/false labels!", addr,
-               __func__);
+      TRICORE_LOG_DEBUG("0x%lx: Jnea::%s Failed to find true/false labels!",
+                        addr, __func__);
       return false;
     }
     il.AddInstruction(il.If(condition, *t, *f));
@@ -4605,16 +4380,15 @@ bool Jnea::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 
 bool Jned::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                 size_t& len, LowLevelILFunction& il,
-                BinaryNinja::Architecture* arch) {
-  uint32_t target = 0;
+                BinaryNinja::Architecture* arch, uint32_t target) {
   BNLowLevelILLabel *t, *f;
   ExprId condition;
 
   switch (op1) {
     case OP1_x9F_BRC:
       if (op2 != JNED_DA_CONST4_DISP15) {
-        LogDebug("0x%lx: Jned::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Jned::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       {
@@ -4626,12 +4400,11 @@ bool Jned::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
         condition =
             il.CompareNotEqual(WORD, il.Register(WORD, reg_da),
                                il.SignExtend(WORD, il.Const(BYTE, const4)));
-        target = Jned::GetTarget(data, addr, len);
         t = il.GetLabelForAddress(arch, target);
         f = il.GetLabelForAddress(arch, addr + len);
         if (!t || !f) {
-          LogDebug("0x%lx: Jned::%s Failed to find true/false labels!", addr,
-                   __func__);
+          TRICORE_LOG_DEBUG("0x%lx: Jned::%s Failed to find true/false labels!",
+                            addr, __func__);
           return false;
         }
         il.AddInstruction(il.If(condition, *t, *f));
@@ -4642,8 +4415,8 @@ bool Jned::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
       }
     case OP1_x1F_BRR:
       if (op2 != JNED_DA_DB_DISP15) {
-        LogDebug("0x%lx: Jned::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Jned::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       {
@@ -4653,12 +4426,11 @@ bool Jned::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
         Instruction::ExtractOpfieldsBRR(data, op1, op2, reg_da, reg_db, disp15);
         condition = il.CompareNotEqual(WORD, il.Register(WORD, reg_da),
                                        il.Register(WORD, reg_db));
-        target = Jned::GetTarget(data, addr, len);
         t = il.GetLabelForAddress(arch, target);
         f = il.GetLabelForAddress(arch, addr + len);
         if (!t || !f) {
-          LogDebug("0x%lx: Jned::%s Failed to find true/false labels!", addr,
-                   __func__);
+          TRICORE_LOG_DEBUG("0x%lx: Jned::%s Failed to find true/false labels!",
+                            addr, __func__);
           return false;
         }
         il.AddInstruction(il.If(condition, *t, *f));
@@ -4668,24 +4440,23 @@ bool Jned::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
         return true;
       }
     default:
-      LogDebug("0x%lx: Jned::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Jned::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
 
 bool Jnei::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                 size_t& len, LowLevelILFunction& il,
-                BinaryNinja::Architecture* arch) {
-  uint32_t target = 0;
+                BinaryNinja::Architecture* arch, uint32_t target) {
   BNLowLevelILLabel *t, *f;
   ExprId condition;
 
   switch (op1) {
     case OP1_x9F_BRC:
       if (op2 != JNEI_DA_CONST4_DISP15) {
-        LogDebug("0x%lx: Jnei::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Jnei::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       {
@@ -4697,12 +4468,11 @@ bool Jnei::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
         condition =
             il.CompareNotEqual(WORD, il.Register(WORD, reg_da),
                                il.SignExtend(WORD, il.Const(BYTE, const4)));
-        target = Jnei::GetTarget(data, addr, len);
         t = il.GetLabelForAddress(arch, target);
         f = il.GetLabelForAddress(arch, addr + len);
         if (!t || !f) {
-          LogDebug("0x%lx: Jnei::%s Failed to find true/false labels!", addr,
-                   __func__);
+          TRICORE_LOG_DEBUG("0x%lx: Jnei::%s Failed to find true/false labels!",
+                            addr, __func__);
           return false;
         }
         il.AddInstruction(il.If(condition, *t, *f));
@@ -4713,8 +4483,8 @@ bool Jnei::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
       }
     case OP1_x1F_BRR:
       if (op2 != JNEI_DA_DB_DISP15) {
-        LogDebug("0x%lx: Jnei::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Jnei::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       {
@@ -4724,12 +4494,11 @@ bool Jnei::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
         Instruction::ExtractOpfieldsBRR(data, op1, op2, reg_da, reg_db, disp15);
         condition = il.CompareNotEqual(WORD, il.Register(WORD, reg_da),
                                        il.Register(WORD, reg_db));
-        target = Jnei::GetTarget(data, addr, len);
         t = il.GetLabelForAddress(arch, target);
         f = il.GetLabelForAddress(arch, addr + len);
         if (!t || !f) {
-          LogDebug("0x%lx: Jnei::%s Failed to find true/false labels!", addr,
-                   __func__);
+          TRICORE_LOG_DEBUG("0x%lx: Jnei::%s Failed to find true/false labels!",
+                            addr, __func__);
           return false;
         }
         il.AddInstruction(il.If(condition, *t, *f));
@@ -4739,16 +4508,15 @@ bool Jnei::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
         return true;
       }
     default:
-      LogDebug("0x%lx: Jnei::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Jnei::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
 
 bool Jnz::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                size_t& len, LowLevelILFunction& il,
-               BinaryNinja::Architecture* arch) {
-  uint32_t target = 0;
+               BinaryNinja::Architecture* arch, uint32_t target) {
   BNLowLevelILLabel *t, *f;
   ExprId condition;
 
@@ -4757,12 +4525,11 @@ bool Jnz::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
       len = 2;
       condition = il.CompareNotEqual(WORD, il.Register(WORD, TRICORE_REG_D15),
                                      il.Const(WORD, 0));
-      target = Jnz::GetTarget(data, addr, len);
       t = il.GetLabelForAddress(arch, target);
       f = il.GetLabelForAddress(arch, addr + len);
       if (!t || !f) {
-        LogDebug("0x%lx: Jnz::%s Failed to find true/false labels!", addr,
-                 __func__);
+        TRICORE_LOG_DEBUG("0x%lx: Jnz::%s Failed to find true/false labels!",
+                          addr, __func__);
         return false;
       }
       il.AddInstruction(il.If(condition, *t, *f));
@@ -4774,28 +4541,26 @@ bool Jnz::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
       Instruction::ExtractOpfieldsSBR(data, op1, disp4, reg_db);
       condition = il.CompareNotEqual(WORD, il.Register(WORD, reg_db),
                                      il.Const(WORD, 0));
-      target = Jnz::GetTarget(data, addr, len);
       t = il.GetLabelForAddress(arch, target);
       f = il.GetLabelForAddress(arch, addr + len);
       if (!t || !f) {
-        LogDebug("0x%lx: Jnz::%s Failed to find true/false labels!", addr,
-                 __func__);
+        TRICORE_LOG_DEBUG("0x%lx: Jnz::%s Failed to find true/false labels!",
+                          addr, __func__);
         return false;
       }
       il.AddInstruction(il.If(condition, *t, *f));
       return true;
     }
     default:
-      LogDebug("0x%lx: Jnz::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Jnz::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
 
 bool Jnza::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                 size_t& len, LowLevelILFunction& il,
-                BinaryNinja::Architecture* arch) {
-  uint32_t target = 0;
+                BinaryNinja::Architecture* arch, uint32_t target) {
   BNLowLevelILLabel *t, *f;
   ExprId condition;
 
@@ -4808,12 +4573,11 @@ bool Jnza::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
       REGTOA(reg_ab)
       condition = il.CompareNotEqual(WORD, il.Register(WORD, reg_ab),
                                      il.Const(WORD, 0));
-      target = Jnza::GetTarget(data, addr, len);
       t = il.GetLabelForAddress(arch, target);
       f = il.GetLabelForAddress(arch, addr + len);
       if (!t || !f) {
-        LogDebug("0x%lx: Jnza::%s Failed to find true/false labels!", addr,
-                 __func__);
+        TRICORE_LOG_DEBUG("0x%lx: Jnza::%s Failed to find true/false labels!",
+                          addr, __func__);
         return false;
       }
       il.AddInstruction(il.If(condition, *t, *f));
@@ -4821,8 +4585,8 @@ bool Jnza::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
     }
     case OP1_xBD_BRR:
       if (op2 != JNZA_AA_DISP15) {
-        LogDebug("0x%lx: Jnza::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Jnza::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       {
@@ -4833,28 +4597,26 @@ bool Jnza::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
         REGTOA(reg_aa)
         condition = il.CompareNotEqual(WORD, il.Register(WORD, reg_aa),
                                        il.Const(WORD, 0));
-        target = Jnza::GetTarget(data, addr, len);
         t = il.GetLabelForAddress(arch, target);
         f = il.GetLabelForAddress(arch, addr + len);
         if (!t || !f) {
-          LogDebug("0x%lx: Jnza::%s Failed to find true/false labels!", addr,
-                   __func__);
+          TRICORE_LOG_DEBUG("0x%lx: Jnza::%s Failed to find true/false labels!",
+                            addr, __func__);
           return false;
         }
         il.AddInstruction(il.If(condition, *t, *f));
         return true;
       }
     default:
-      LogDebug("0x%lx: Jnza::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Jnza::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
 
 bool Jnzt::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                 size_t& len, LowLevelILFunction& il,
-                BinaryNinja::Architecture* arch) {
-  uint32_t target = 0;
+                BinaryNinja::Architecture* arch, uint32_t target) {
   BNLowLevelILLabel *t, *f;
   ExprId condition, bit;
   switch (op1) {
@@ -4867,12 +4629,11 @@ bool Jnzt::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
       condition = il.CompareNotEqual(
           WORD, il.And(WORD, il.Register(WORD, TRICORE_REG_D15), bit),
           il.Const(WORD, 0));
-      target = Jnzt::GetTarget(data, addr, len);
       t = il.GetLabelForAddress(arch, target);
       f = il.GetLabelForAddress(arch, addr + len);
       if (!t || !f) {
-        LogDebug("0x%lx: Jnzt::%s Failed to find true/false labels!", addr,
-                 __func__);
+        TRICORE_LOG_DEBUG("0x%lx: Jnzt::%s Failed to find true/false labels!",
+                          addr, __func__);
         return false;
       }
       il.AddInstruction(il.If(condition, *t, *f));
@@ -4880,8 +4641,8 @@ bool Jnzt::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
     }
     case OP1_x6F_BRN:
       if (op2 != JNZT_DA_N_DISP15) {
-        LogDebug("0x%lx: Jnzt::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Jnzt::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       {
@@ -4893,28 +4654,26 @@ bool Jnzt::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
         condition = il.CompareNotEqual(
             WORD, il.And(WORD, il.Register(WORD, reg_da), bit),
             il.Const(WORD, 0));
-        target = Jnzt::GetTarget(data, addr, len);
         t = il.GetLabelForAddress(arch, target);
         f = il.GetLabelForAddress(arch, addr + len);
         if (!t || !f) {
-          LogDebug("0x%lx: Jnzt::%s Failed to find true/false labels!", addr,
-                   __func__);
+          TRICORE_LOG_DEBUG("0x%lx: Jnzt::%s Failed to find true/false labels!",
+                            addr, __func__);
           return false;
         }
         il.AddInstruction(il.If(condition, *t, *f));
         return true;
       }
     default:
-      LogDebug("0x%lx: Jnzt::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Jnzt::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
 
 bool Jz::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
               size_t& len, LowLevelILFunction& il,
-              BinaryNinja::Architecture* arch) {
-  uint32_t target = 0;
+              BinaryNinja::Architecture* arch, uint32_t target) {
   BNLowLevelILLabel *t, *f;
   ExprId condition;
 
@@ -4926,12 +4685,11 @@ bool Jz::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
       Instruction::ExtractOpfieldsSB(data, op1, disp8);
       condition = il.CompareEqual(WORD, il.Register(WORD, TRICORE_REG_D15),
                                   il.Const(WORD, 0));
-      target = Jz::GetTarget(data, addr, len);
       t = il.GetLabelForAddress(arch, target);
       f = il.GetLabelForAddress(arch, addr + len);
       if (!t || !f) {
-        LogDebug("0x%lx: Jz::%s Failed to find true/false labels!", addr,
-                 __func__);
+        TRICORE_LOG_DEBUG("0x%lx: Jz::%s Failed to find true/false labels!",
+                          addr, __func__);
         return false;
       }
       il.AddInstruction(il.If(condition, *t, *f));
@@ -4944,28 +4702,26 @@ bool Jz::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
       Instruction::ExtractOpfieldsSBR(data, op1, disp4, reg_db);
       condition =
           il.CompareEqual(WORD, il.Register(WORD, reg_db), il.Const(WORD, 0));
-      target = Jz::GetTarget(data, addr, len);
       t = il.GetLabelForAddress(arch, target);
       f = il.GetLabelForAddress(arch, addr + len);
       if (!t || !f) {
-        LogDebug("0x%lx: Jz::%s Failed to find true/false labels!", addr,
-                 __func__);
+        TRICORE_LOG_DEBUG("0x%lx: Jz::%s Failed to find true/false labels!",
+                          addr, __func__);
         return false;
       }
       il.AddInstruction(il.If(condition, *t, *f));
       return true;
     }
     default:
-      LogDebug("0x%lx: Jz::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Jz::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
 
 bool Jza::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                size_t& len, LowLevelILFunction& il,
-               BinaryNinja::Architecture* arch) {
-  uint32_t target = 0;
+               BinaryNinja::Architecture* arch, uint32_t target) {
   BNLowLevelILLabel *t, *f;
   ExprId condition;
 
@@ -4978,12 +4734,11 @@ bool Jza::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
       REGTOA(reg_ab)
       condition =
           il.CompareEqual(WORD, il.Register(WORD, reg_ab), il.Const(WORD, 0));
-      target = Jza::GetTarget(data, addr, len);
       t = il.GetLabelForAddress(arch, target);
       f = il.GetLabelForAddress(arch, addr + len);
       if (!t || !f) {
-        LogDebug("0x%lx: Jza::%s Failed to find true/false labels!", addr,
-                 __func__);
+        TRICORE_LOG_DEBUG("0x%lx: Jza::%s Failed to find true/false labels!",
+                          addr, __func__);
         return false;
       }
       il.AddInstruction(il.If(condition, *t, *f));
@@ -4991,8 +4746,8 @@ bool Jza::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
     }
     case OP1_xBD_BRR:
       if (op2 != JZA_AA_DISP15) {
-        LogDebug("0x%lx: Jza::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Jza::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       {
@@ -5003,28 +4758,26 @@ bool Jza::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
         REGTOA(reg_aa)
         condition =
             il.CompareEqual(WORD, il.Register(WORD, reg_aa), il.Const(WORD, 0));
-        target = Jza::GetTarget(data, addr, len);
         t = il.GetLabelForAddress(arch, target);
         f = il.GetLabelForAddress(arch, addr + len);
         if (!t || !f) {
-          LogDebug("0x%lx: Jza::%s Failed to find true/false labels!", addr,
-                   __func__);
+          TRICORE_LOG_DEBUG("0x%lx: Jza::%s Failed to find true/false labels!",
+                            addr, __func__);
           return false;
         }
         il.AddInstruction(il.If(condition, *t, *f));
         return true;
       }
     default:
-      LogDebug("0x%lx: Jza::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Jza::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
 
 bool Jzt::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                size_t& len, LowLevelILFunction& il,
-               BinaryNinja::Architecture* arch) {
-  uint32_t target = 0;
+               BinaryNinja::Architecture* arch, uint32_t target) {
   BNLowLevelILLabel *t, *f;
   ExprId condition, bit;
   switch (op1) {
@@ -5037,12 +4790,11 @@ bool Jzt::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
       condition = il.CompareEqual(
           WORD, il.And(WORD, il.Register(WORD, TRICORE_REG_D15), bit),
           il.Const(WORD, 0));
-      target = Jzt::GetTarget(data, addr, len);
       t = il.GetLabelForAddress(arch, target);
       f = il.GetLabelForAddress(arch, addr + len);
       if (!t || !f) {
-        LogDebug("0x%lx: Jzt::%s Failed to find true/false labels!", addr,
-                 __func__);
+        TRICORE_LOG_DEBUG("0x%lx: Jzt::%s Failed to find true/false labels!",
+                          addr, __func__);
         return false;
       }
       il.AddInstruction(il.If(condition, *t, *f));
@@ -5050,8 +4802,8 @@ bool Jzt::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
     }
     case OP1_x6F_BRN:
       if (op2 != JZT_DA_N_DISP15) {
-        LogDebug("0x%lx: Jzt::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Jzt::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       {
@@ -5063,20 +4815,19 @@ bool Jzt::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
         condition =
             il.CompareEqual(WORD, il.And(WORD, il.Register(WORD, reg_da), bit),
                             il.Const(WORD, 0));
-        target = Jzt::GetTarget(data, addr, len);
         t = il.GetLabelForAddress(arch, target);
         f = il.GetLabelForAddress(arch, addr + len);
         if (!t || !f) {
-          LogDebug("0x%lx: Jnzt::%s Failed to find true/false labels!", addr,
-                   __func__);
+          TRICORE_LOG_DEBUG("0x%lx: Jnzt::%s Failed to find true/false labels!",
+                            addr, __func__);
           return false;
         }
         il.AddInstruction(il.If(condition, *t, *f));
         return true;
       }
     default:
-      LogDebug("0x%lx: Jzt::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Jzt::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -5163,8 +4914,8 @@ bool Lda::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
     }
     case OP1_x85_ABS:
       if (op2 != LDA_AA_OFF18) {
-        LogDebug("0x%lx: Lda::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Lda::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       {
@@ -5227,8 +4978,8 @@ bool Lda::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return true;
         }
         default:
-          LogDebug("0x%lx: Lda::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Lda::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x29_BO:
@@ -5240,13 +4991,13 @@ bool Lda::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           len = 4;
           UNIMPLEMENTED(*((const uint16_t*)data) & 0x1 ? 4 : 2)
         default:
-          LogDebug("0x%lx: Lda::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Lda::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Lda::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Lda::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -5360,8 +5111,8 @@ bool Ldb::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return true;
         }
         default:
-          LogDebug("0x%lx: Ldb::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Ldb::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x09_BO:
@@ -5465,8 +5216,8 @@ bool Ldb::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return true;
         }
         default:
-          LogDebug("0x%lx: Ldb::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Ldb::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x29_BO:
@@ -5484,13 +5235,13 @@ bool Ldb::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           len = 4;
           UNIMPLEMENTED(*((const uint16_t*)data) & 0x1 ? 4 : 2)
         default:
-          LogDebug("0x%lx: Ldb::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Ldb::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Ldb::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Ldb::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -5500,8 +5251,8 @@ bool Ldd::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
   switch (op1) {
     case OP1_x85_ABS:
       if (op2 != LDD_EA_OFF18) {
-        LogDebug("0x%lx: Ldd::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Ldd::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       {
@@ -5564,8 +5315,8 @@ bool Ldd::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return true;
         }
         default:
-          LogDebug("0x%lx: Ldd::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Ldd::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x29_BO:
@@ -5577,13 +5328,13 @@ bool Ldd::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           len = 4;
           UNIMPLEMENTED(*((const uint16_t*)data) & 0x1 ? 4 : 2)
         default:
-          LogDebug("0x%lx: Ldd::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Ldd::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Ldd::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Ldd::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -5593,8 +5344,8 @@ bool Ldda::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
   switch (op1) {
     case OP1_x85_ABS:
       if (op2 != LDDA_PA_OFF18) {
-        LogDebug("0x%lx: Ldda::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Ldda::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       {
@@ -5657,8 +5408,8 @@ bool Ldda::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return true;
         }
         default:
-          LogDebug("0x%lx: Ldda::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Ldda::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x29_BO:
@@ -5670,13 +5421,13 @@ bool Ldda::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           len = 4;
           UNIMPLEMENTED(*((const uint16_t*)data) & 0x1 ? 4 : 2)
         default:
-          LogDebug("0x%lx: Ldda::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Ldda::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Ldda::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Ldda::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -5766,8 +5517,8 @@ bool Ldh::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return true;
         }
         default:
-          LogDebug("0x%lx: Ldh::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Ldh::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x09_BO:
@@ -5822,8 +5573,8 @@ bool Ldh::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return true;
         }
         default:
-          LogDebug("0x%lx: Ldh::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Ldh::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x29_BO:
@@ -5835,13 +5586,13 @@ bool Ldh::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           len = 4;
           UNIMPLEMENTED(*((const uint16_t*)data) & 0x1 ? 4 : 2)
         default:
-          LogDebug("0x%lx: Ldh::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Ldh::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Ldh::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Ldh::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -5878,8 +5629,8 @@ bool Ldhu::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return true;
         }
         default:
-          LogDebug("0x%lx: Ldhu::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Ldhu::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x09_BO:
@@ -5934,8 +5685,8 @@ bool Ldhu::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return true;
         }
         default:
-          LogDebug("0x%lx: Ldhu::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Ldhu::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x29_BO:
@@ -5947,13 +5698,13 @@ bool Ldhu::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           len = 4;
           UNIMPLEMENTED(*((const uint16_t*)data) & 0x1 ? 4 : 2)
         default:
-          LogDebug("0x%lx: Ldhu::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Ldhu::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Ldhu::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Ldhu::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -5977,8 +5728,8 @@ bool Ldq::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return true;
         }
         default:
-          LogDebug("0x%lx: Ldq::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Ldq::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x09_BO:
@@ -6040,8 +5791,8 @@ bool Ldq::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return true;
         }
         default:
-          LogDebug("0x%lx: Ldq::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Ldq::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x29_BO:
@@ -6115,13 +5866,13 @@ bool Ldq::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return true;
         }
         default:
-          LogDebug("0x%lx: Ldq::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Ldq::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Ldq::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Ldq::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -6214,8 +5965,8 @@ bool Ldw::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return true;
         }
         default:
-          LogDebug("0x%lx: Ldw::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Ldw::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x09_BO:
@@ -6265,8 +6016,8 @@ bool Ldw::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return true;
         }
         default:
-          LogDebug("0x%lx: Ldw::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Ldw::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x29_BO:
@@ -6276,20 +6027,44 @@ bool Ldw::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
         case LDW_DA_PB_OFF10:
           UNIMPLEMENTED(*((const uint16_t*)data) & 0x1 ? 4 : 2)
         default:
-          LogDebug("0x%lx: Ldw::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Ldw::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Ldw::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Ldw::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
 
 bool Ldlcx::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                  size_t& len, LowLevelILFunction& il) {
-  UNIMPLEMENTED(*((const uint16_t*)data) & 0x1 ? 4 : 2)
+  switch (op1) {
+    case OP1_x15_ABS:
+      if (op2 != LDLCX_OFF18) {
+        TRICORE_LOG_REJECT("0x%lx: Ldlcx::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
+        return false;
+      }
+      break;
+    case OP1_x49_BO:
+      if (op2 != LDLCX_AB_OFF10) {
+        TRICORE_LOG_REJECT("0x%lx: Ldlcx::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
+        return false;
+      }
+      break;
+    default:
+      TRICORE_LOG_REJECT("0x%lx: Ldlcx::%s received invalid opcode 1 0x%x",
+                         addr, __func__, op1);
+      return false;
+  }
+  len = 4;
+  SetCsaOperand(op1, data, il);
+  // Words 0 and 1 (PCXI and A11) are not loaded
+  LoadContext(kLowerContext, 2, il);
+  return true;
 }
 
 bool Ldmst::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
@@ -6299,7 +6074,31 @@ bool Ldmst::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 
 bool Lducx::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                  size_t& len, LowLevelILFunction& il) {
-  UNIMPLEMENTED(*((const uint16_t*)data) & 0x1 ? 4 : 2)
+  switch (op1) {
+    case OP1_x15_ABS:
+      if (op2 != LDUCX_OFF18) {
+        TRICORE_LOG_REJECT("0x%lx: Lducx::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
+        return false;
+      }
+      break;
+    case OP1_x49_BO:
+      if (op2 != LDUCX_AB_OFF10) {
+        TRICORE_LOG_REJECT("0x%lx: Lducx::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
+        return false;
+      }
+      break;
+    default:
+      TRICORE_LOG_REJECT("0x%lx: Lducx::%s received invalid opcode 1 0x%x",
+                         addr, __func__, op1);
+      return false;
+  }
+  len = 4;
+  SetCsaOperand(op1, data, il);
+  // Words 0 and 1 (PCXI and PSW) are not loaded
+  LoadContext(kUpperContext, 2, il);
+  return true;
 }
 
 bool Lea::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
@@ -6330,8 +6129,8 @@ bool Lea::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return true;
         }
         default:
-          LogDebug("0x%lx: Lea::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Lea::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x49_BO:
@@ -6350,19 +6149,19 @@ bool Lea::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return true;
         }
         default:
-          LogDebug("0x%lx: Lea::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Lea::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Lea::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Lea::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
 
 bool Loop::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
-                size_t& len, LowLevelILFunction& il) {
+                size_t& len, LowLevelILFunction& il, uint32_t target) {
   switch (op1) {
     case LOOP_AB_DISP4: {
       ExprId condition;
@@ -6381,7 +6180,7 @@ bool Loop::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           WORD, reg_ab,
           il.Sub(WORD, il.Register(WORD, reg_ab), il.Const(WORD, 1))));
       il.AddInstruction(
-          il.Jump(il.ConstPointer(WORD, Loop::GetTarget(data, addr, len))));
+          il.Jump(il.ConstPointer(WORD, target)));
 
       il.MarkLabel(doneLabel);
       return true;
@@ -6406,41 +6205,41 @@ bool Loop::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
               WORD, reg_ab,
               il.Sub(WORD, il.Register(WORD, reg_ab), il.Const(WORD, 1))));
           il.AddInstruction(
-              il.Jump(il.ConstPointer(WORD, Loop::GetTarget(data, addr, len))));
+              il.Jump(il.ConstPointer(WORD, target)));
 
           il.MarkLabel(doneLabel);
           return true;
         }
         default:
-          LogDebug("0x%lx: Loop::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Loop::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Loop::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Loop::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
 
 bool Loopu::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
-                 size_t& len, LowLevelILFunction& il) {
+                 size_t& len, LowLevelILFunction& il, uint32_t target) {
   switch (op1) {
     case OP1_xFD_BRR:
       switch (op2) {
         case LOOPU_DISP15:
           len = 4;
           il.AddInstruction(il.Jump(
-              il.ConstPointer(WORD, Loopu::GetTarget(data, addr, len))));
+              il.ConstPointer(WORD, target)));
           return true;
         default:
-          LogDebug("0x%lx: Loopu::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Loopu::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Loopu::%s received invalid opcode 1 0x%x", addr,
-               __func__, op1);
+      TRICORE_LOG_REJECT("0x%lx: Loopu::%s received invalid opcode 1 0x%x",
+                         addr, __func__, op1);
       return false;
   }
 }
@@ -6503,8 +6302,8 @@ bool Lt::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return true;
         }
         default:
-          LogDebug("0x%lx: Lt::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Lt::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x0B_RR:
@@ -6534,13 +6333,13 @@ bool Lt::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return true;
         }
         default:
-          LogDebug("0x%lx: Lt::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Lt::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Lt::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Lt::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -6548,8 +6347,8 @@ bool Lt::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Lta::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                size_t& len, LowLevelILFunction& il) {
   if (op1 != OP1_x01_RR || op2 != LTA_DC_AA_AB) {
-    LogDebug("0x%lx: Lta::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT("0x%lx: Lta::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
     return false;
   }
   {
@@ -6570,222 +6369,32 @@ bool Lta::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Ltb::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                size_t& len, LowLevelILFunction& il) {
   if (op1 != OP1_x0B_RR) {
-    LogDebug("0x%lx: Ltb::%s received invalid opcode 1 0x%x", addr, __func__,
-             op1);
+    TRICORE_LOG_REJECT("0x%lx: Ltb::%s received invalid opcode 1 0x%x", addr,
+                       __func__, op1);
     return false;
   }
   switch (op2) {
     case LTB_DC_DA_DB: {
-      ExprId cond_byte0, cond_byte1, cond_byte2, cond_byte3;
-      LowLevelILLabel trueLabel0, trueLabel1, trueLabel2, trueLabel3,
-          falseLabel0, falseLabel1, falseLabel2, doneLabel;
       len = 4;
       uint8_t reg_dc, reg_da, reg_db, op1, op2, n;
       Instruction::ExtractOpfieldsRR(data, op1, op2, reg_da, reg_db, n, reg_dc);
-
-      il.AddInstruction(il.SetRegister(
-          WORD, LLIL_TEMP(3),
-          il.BoolToInt(
-              WORD,
-              il.CompareSignedLessThan(
-                  WORD,
-                  il.And(WORD,
-                         il.LogicalShiftRight(WORD, il.Register(WORD, reg_da),
-                                              il.Const(WORD, 24)),
-                         il.Const(WORD, 0xFF)),
-                  il.And(WORD,
-                         il.LogicalShiftRight(WORD, il.Register(WORD, reg_db),
-                                              il.Const(WORD, 24)),
-                         il.Const(WORD, 0xFF))))));
-      il.AddInstruction(il.SetRegister(
-          WORD, LLIL_TEMP(2),
-          il.BoolToInt(
-              WORD,
-              il.CompareSignedLessThan(
-                  WORD,
-                  il.And(WORD,
-                         il.LogicalShiftRight(WORD, il.Register(WORD, reg_da),
-                                              il.Const(WORD, 16)),
-                         il.Const(WORD, 0xFF)),
-                  il.And(WORD,
-                         il.LogicalShiftRight(WORD, il.Register(WORD, reg_db),
-                                              il.Const(WORD, 16)),
-                         il.Const(WORD, 0xFF))))));
-      il.AddInstruction(il.SetRegister(
-          WORD, LLIL_TEMP(1),
-          il.BoolToInt(
-              WORD,
-              il.CompareSignedLessThan(
-                  WORD,
-                  il.And(WORD,
-                         il.LogicalShiftRight(WORD, il.Register(WORD, reg_da),
-                                              il.Const(WORD, 8)),
-                         il.Const(WORD, 0xFF)),
-                  il.And(WORD,
-                         il.LogicalShiftRight(WORD, il.Register(WORD, reg_db),
-                                              il.Const(WORD, 8)),
-                         il.Const(WORD, 0xFF))))));
-      il.AddInstruction(il.SetRegister(
-          WORD, LLIL_TEMP(0),
-          il.BoolToInt(WORD, il.CompareSignedLessThan(
-                                 WORD,
-                                 il.And(WORD, il.Register(WORD, reg_da),
-                                        il.Const(WORD, 0xFF)),
-                                 il.And(WORD, il.Register(WORD, reg_db),
-                                        il.Const(WORD, 0xFF))))));
-
-      cond_byte0 = il.CompareEqual(WORD, il.Register(WORD, LLIL_TEMP(0)),
-                                   il.Const(WORD, 1));
-      cond_byte1 = il.CompareEqual(WORD, il.Register(WORD, LLIL_TEMP(1)),
-                                   il.Const(WORD, 1));
-      cond_byte2 = il.CompareEqual(WORD, il.Register(WORD, LLIL_TEMP(2)),
-                                   il.Const(WORD, 1));
-      cond_byte3 = il.CompareEqual(WORD, il.Register(WORD, LLIL_TEMP(3)),
-                                   il.Const(WORD, 1));
-
-      il.AddInstruction(il.SetRegister(WORD, reg_dc, il.Const(WORD, 0)));
-
-      il.AddInstruction(il.If(cond_byte0, trueLabel0, falseLabel0));
-      il.MarkLabel(trueLabel0);
-      il.AddInstruction(il.SetRegister(
-          WORD, reg_dc,
-          il.Or(WORD, il.Register(WORD, reg_dc), il.Const(WORD, 0xFF))));
-      il.AddInstruction(il.Goto(falseLabel0));
-
-      il.MarkLabel(falseLabel0);
-      il.AddInstruction(il.If(cond_byte1, trueLabel1, falseLabel1));
-      il.MarkLabel(trueLabel1);
-      il.AddInstruction(il.SetRegister(
-          WORD, reg_dc,
-          il.Or(WORD, il.Register(WORD, reg_dc), il.Const(WORD, 0xFF00))));
-      il.AddInstruction(il.Goto(falseLabel1));
-
-      il.MarkLabel(falseLabel1);
-      il.AddInstruction(il.If(cond_byte2, trueLabel2, falseLabel2));
-      il.MarkLabel(trueLabel2);
-      il.AddInstruction(il.SetRegister(
-          WORD, reg_dc,
-          il.Or(WORD, il.Register(WORD, reg_dc), il.Const(WORD, 0xFF0000))));
-      il.AddInstruction(il.Goto(falseLabel2));
-
-      il.MarkLabel(falseLabel2);
-      il.AddInstruction(il.If(cond_byte3, trueLabel3, doneLabel));
-      il.MarkLabel(trueLabel3);
-      il.AddInstruction(il.SetRegister(
-          WORD, reg_dc,
-          il.Or(WORD, il.Register(WORD, reg_dc), il.Const(WORD, 0xFF000000))));
-      il.AddInstruction(il.Goto(doneLabel));
-
-      il.MarkLabel(doneLabel);
+      PackedTo(reg_dc, PackedOp::LtB,
+               {il.Register(WORD, reg_da), il.Register(WORD, reg_db)},
+               Ltb::flags, il);
       return true;
     }
     case LTBU_DC_DA_DB: {
-      ExprId cond_byte0, cond_byte1, cond_byte2, cond_byte3;
-      LowLevelILLabel trueLabel0, trueLabel1, trueLabel2, trueLabel3,
-          falseLabel0, falseLabel1, falseLabel2, doneLabel;
       len = 4;
       uint8_t reg_dc, reg_da, reg_db, op1, op2, n;
       Instruction::ExtractOpfieldsRR(data, op1, op2, reg_da, reg_db, n, reg_dc);
-
-      il.AddInstruction(il.SetRegister(
-          WORD, LLIL_TEMP(3),
-          il.BoolToInt(
-              WORD,
-              il.CompareUnsignedLessThan(
-                  WORD,
-                  il.And(WORD,
-                         il.LogicalShiftRight(WORD, il.Register(WORD, reg_da),
-                                              il.Const(WORD, 24)),
-                         il.Const(WORD, 0xFF)),
-                  il.And(WORD,
-                         il.LogicalShiftRight(WORD, il.Register(WORD, reg_db),
-                                              il.Const(WORD, 24)),
-                         il.Const(WORD, 0xFF))))));
-      il.AddInstruction(il.SetRegister(
-          WORD, LLIL_TEMP(2),
-          il.BoolToInt(
-              WORD,
-              il.CompareUnsignedLessThan(
-                  WORD,
-                  il.And(WORD,
-                         il.LogicalShiftRight(WORD, il.Register(WORD, reg_da),
-                                              il.Const(WORD, 16)),
-                         il.Const(WORD, 0xFF)),
-                  il.And(WORD,
-                         il.LogicalShiftRight(WORD, il.Register(WORD, reg_db),
-                                              il.Const(WORD, 16)),
-                         il.Const(WORD, 0xFF))))));
-      il.AddInstruction(il.SetRegister(
-          WORD, LLIL_TEMP(1),
-          il.BoolToInt(
-              WORD,
-              il.CompareUnsignedLessThan(
-                  WORD,
-                  il.And(WORD,
-                         il.LogicalShiftRight(WORD, il.Register(WORD, reg_da),
-                                              il.Const(WORD, 8)),
-                         il.Const(WORD, 0xFF)),
-                  il.And(WORD,
-                         il.LogicalShiftRight(WORD, il.Register(WORD, reg_db),
-                                              il.Const(WORD, 8)),
-                         il.Const(WORD, 0xFF))))));
-      il.AddInstruction(il.SetRegister(
-          WORD, LLIL_TEMP(0),
-          il.BoolToInt(WORD, il.CompareUnsignedLessThan(
-                                 WORD,
-                                 il.And(WORD, il.Register(WORD, reg_da),
-                                        il.Const(WORD, 0xFF)),
-                                 il.And(WORD, il.Register(WORD, reg_db),
-                                        il.Const(WORD, 0xFF))))));
-
-      cond_byte0 = il.CompareEqual(WORD, il.Register(WORD, LLIL_TEMP(0)),
-                                   il.Const(WORD, 1));
-      cond_byte1 = il.CompareEqual(WORD, il.Register(WORD, LLIL_TEMP(1)),
-                                   il.Const(WORD, 1));
-      cond_byte2 = il.CompareEqual(WORD, il.Register(WORD, LLIL_TEMP(2)),
-                                   il.Const(WORD, 1));
-      cond_byte3 = il.CompareEqual(WORD, il.Register(WORD, LLIL_TEMP(3)),
-                                   il.Const(WORD, 1));
-
-      il.AddInstruction(il.SetRegister(WORD, reg_dc, il.Const(WORD, 0)));
-
-      il.AddInstruction(il.If(cond_byte0, trueLabel0, falseLabel0));
-      il.MarkLabel(trueLabel0);
-      il.AddInstruction(il.SetRegister(
-          WORD, reg_dc,
-          il.Or(WORD, il.Register(WORD, reg_dc), il.Const(WORD, 0xFF))));
-      il.AddInstruction(il.Goto(falseLabel0));
-
-      il.MarkLabel(falseLabel0);
-      il.AddInstruction(il.If(cond_byte1, trueLabel1, falseLabel1));
-      il.MarkLabel(trueLabel1);
-      il.AddInstruction(il.SetRegister(
-          WORD, reg_dc,
-          il.Or(WORD, il.Register(WORD, reg_dc), il.Const(WORD, 0xFF00))));
-      il.AddInstruction(il.Goto(falseLabel1));
-
-      il.MarkLabel(falseLabel1);
-      il.AddInstruction(il.If(cond_byte2, trueLabel2, falseLabel2));
-      il.MarkLabel(trueLabel2);
-      il.AddInstruction(il.SetRegister(
-          WORD, reg_dc,
-          il.Or(WORD, il.Register(WORD, reg_dc), il.Const(WORD, 0xFF0000))));
-      il.AddInstruction(il.Goto(falseLabel2));
-
-      il.MarkLabel(falseLabel2);
-      il.AddInstruction(il.If(cond_byte3, trueLabel3, doneLabel));
-      il.MarkLabel(trueLabel3);
-      il.AddInstruction(il.SetRegister(
-          WORD, reg_dc,
-          il.Or(WORD, il.Register(WORD, reg_dc), il.Const(WORD, 0xFF000000))));
-      il.AddInstruction(il.Goto(doneLabel));
-
-      il.MarkLabel(doneLabel);
+      PackedTo(reg_dc, PackedOp::LtBu,
+               {il.Register(WORD, reg_da), il.Register(WORD, reg_db)},
+               Ltb::flags, il);
       return true;
     }
     default:
-      LogDebug("0x%lx: Ltb::%s received invalid opcode 2 0x%x", addr, __func__,
-               op2);
+      TRICORE_LOG_REJECT("0x%lx: Ltb::%s received invalid opcode 2 0x%x", addr,
+                         __func__, op2);
       return false;
   }
 }
@@ -6793,126 +6402,32 @@ bool Ltb::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Lth::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                size_t& len, LowLevelILFunction& il) {
   if (op1 != OP1_x0B_RR) {
-    LogDebug("0x%lx: Lth::%s received invalid opcode 1 0x%x", addr, __func__,
-             op1);
+    TRICORE_LOG_REJECT("0x%lx: Lth::%s received invalid opcode 1 0x%x", addr,
+                       __func__, op1);
     return false;
   }
   switch (op2) {
     case LTH_DC_DA_DB: {
-      ExprId cond_hword0, cond_hword1;
-      LowLevelILLabel trueLabel0, trueLabel1, trueLabel2, trueLabel3,
-          falseLabel0, falseLabel1, falseLabel2, doneLabel;
       len = 4;
       uint8_t reg_dc, reg_da, reg_db, op1, op2, n;
       Instruction::ExtractOpfieldsRR(data, op1, op2, reg_da, reg_db, n, reg_dc);
-
-      il.AddInstruction(il.SetRegister(
-          WORD, LLIL_TEMP(1),
-          il.BoolToInt(
-              WORD,
-              il.CompareSignedLessThan(
-                  WORD,
-                  il.And(WORD,
-                         il.LogicalShiftRight(WORD, il.Register(WORD, reg_da),
-                                              il.Const(WORD, 16)),
-                         il.Const(WORD, 0xFFFF)),
-                  il.And(WORD,
-                         il.LogicalShiftRight(WORD, il.Register(WORD, reg_db),
-                                              il.Const(WORD, 16)),
-                         il.Const(WORD, 0xFFFF))))));
-      il.AddInstruction(il.SetRegister(
-          WORD, LLIL_TEMP(0),
-          il.BoolToInt(WORD, il.CompareSignedLessThan(
-                                 WORD,
-                                 il.And(WORD, il.Register(WORD, reg_da),
-                                        il.Const(WORD, 0xFFFF)),
-                                 il.And(WORD, il.Register(WORD, reg_db),
-                                        il.Const(WORD, 0xFFFF))))));
-
-      cond_hword0 = il.CompareEqual(WORD, il.Register(WORD, LLIL_TEMP(0)),
-                                    il.Const(WORD, 1));
-      cond_hword1 = il.CompareEqual(WORD, il.Register(WORD, LLIL_TEMP(1)),
-                                    il.Const(WORD, 1));
-
-      il.AddInstruction(il.SetRegister(WORD, reg_dc, il.Const(WORD, 0)));
-
-      il.AddInstruction(il.If(cond_hword0, trueLabel0, falseLabel0));
-      il.MarkLabel(trueLabel0);
-      il.AddInstruction(il.SetRegister(
-          WORD, reg_dc,
-          il.Or(WORD, il.Register(WORD, reg_dc), il.Const(WORD, 0xFFFF))));
-      il.AddInstruction(il.Goto(falseLabel0));
-
-      il.MarkLabel(falseLabel0);
-      il.AddInstruction(il.If(cond_hword1, trueLabel1, doneLabel));
-      il.MarkLabel(trueLabel1);
-      il.AddInstruction(il.SetRegister(
-          WORD, reg_dc,
-          il.Or(WORD, il.Register(WORD, reg_dc), il.Const(WORD, 0xFFFF0000))));
-      il.AddInstruction(il.Goto(doneLabel));
-
-      il.MarkLabel(doneLabel);
+      PackedTo(reg_dc, PackedOp::LtH,
+               {il.Register(WORD, reg_da), il.Register(WORD, reg_db)},
+               Lth::flags, il);
       return true;
     }
     case LTHU_DC_DA_DB: {
-      ExprId cond_hword0, cond_hword1;
-      LowLevelILLabel trueLabel0, trueLabel1, trueLabel2, trueLabel3,
-          falseLabel0, falseLabel1, falseLabel2, doneLabel;
       len = 4;
       uint8_t reg_dc, reg_da, reg_db, op1, op2, n;
       Instruction::ExtractOpfieldsRR(data, op1, op2, reg_da, reg_db, n, reg_dc);
-
-      il.AddInstruction(il.SetRegister(
-          WORD, LLIL_TEMP(1),
-          il.BoolToInt(
-              WORD,
-              il.CompareUnsignedLessThan(
-                  WORD,
-                  il.And(WORD,
-                         il.LogicalShiftRight(WORD, il.Register(WORD, reg_da),
-                                              il.Const(WORD, 16)),
-                         il.Const(WORD, 0xFFFF)),
-                  il.And(WORD,
-                         il.LogicalShiftRight(WORD, il.Register(WORD, reg_db),
-                                              il.Const(WORD, 16)),
-                         il.Const(WORD, 0xFFFF))))));
-      il.AddInstruction(il.SetRegister(
-          WORD, LLIL_TEMP(0),
-          il.BoolToInt(WORD, il.CompareUnsignedLessThan(
-                                 WORD,
-                                 il.And(WORD, il.Register(WORD, reg_da),
-                                        il.Const(WORD, 0xFFFF)),
-                                 il.And(WORD, il.Register(WORD, reg_db),
-                                        il.Const(WORD, 0xFFFF))))));
-
-      cond_hword0 = il.CompareEqual(WORD, il.Register(WORD, LLIL_TEMP(0)),
-                                    il.Const(WORD, 1));
-      cond_hword1 = il.CompareEqual(WORD, il.Register(WORD, LLIL_TEMP(1)),
-                                    il.Const(WORD, 1));
-
-      il.AddInstruction(il.SetRegister(WORD, reg_dc, il.Const(WORD, 0)));
-
-      il.AddInstruction(il.If(cond_hword0, trueLabel0, falseLabel0));
-      il.MarkLabel(trueLabel0);
-      il.AddInstruction(il.SetRegister(
-          WORD, reg_dc,
-          il.Or(WORD, il.Register(WORD, reg_dc), il.Const(WORD, 0xFFFF))));
-      il.AddInstruction(il.Goto(falseLabel0));
-
-      il.MarkLabel(falseLabel0);
-      il.AddInstruction(il.If(cond_hword1, trueLabel1, doneLabel));
-      il.MarkLabel(trueLabel1);
-      il.AddInstruction(il.SetRegister(
-          WORD, reg_dc,
-          il.Or(WORD, il.Register(WORD, reg_dc), il.Const(WORD, 0xFFFF0000))));
-      il.AddInstruction(il.Goto(doneLabel));
-
-      il.MarkLabel(doneLabel);
+      PackedTo(reg_dc, PackedOp::LtHu,
+               {il.Register(WORD, reg_da), il.Register(WORD, reg_db)},
+               Lth::flags, il);
       return true;
     }
     default:
-      LogDebug("0x%lx: Lth::%s received invalid opcode 2 0x%x", addr, __func__,
-               op2);
+      TRICORE_LOG_REJECT("0x%lx: Lth::%s received invalid opcode 2 0x%x", addr,
+                         __func__, op2);
       return false;
   }
 }
@@ -6920,8 +6435,8 @@ bool Lth::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Ltw::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                size_t& len, LowLevelILFunction& il) {
   if (op1 != OP1_x0B_RR) {
-    LogDebug("0x%lx: Ltw::%s received invalid opcode 1 0x%x", addr, __func__,
-             op1);
+    TRICORE_LOG_REJECT("0x%lx: Ltw::%s received invalid opcode 1 0x%x", addr,
+                       __func__, op1);
     return false;
   }
   switch (op2) {
@@ -6966,8 +6481,8 @@ bool Ltw::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
       return true;
     }
     default:
-      LogDebug("0x%lx: Ltw::%s received invalid opcode 2 0x%x", addr, __func__,
-               op2);
+      TRICORE_LOG_REJECT("0x%lx: Ltw::%s received invalid opcode 2 0x%x", addr,
+                         __func__, op2);
       return false;
   }
 }
@@ -7019,8 +6534,7 @@ bool Madd::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                      il.MultDoublePrecSigned(
                          WORD, il.Register(WORD, reg_da),
                          il.SignExtend(WORD, il.Const(HWORD, const9))))));
-          ssov(il.Register(WORD, LLIL_TEMP(0)), il.Const(WORD, 32),
-               LLIL_TEMP(1), il, WORD);
+          ssov(il.Register(WORD, LLIL_TEMP(0)), 32, LLIL_TEMP(1), il, WORD);
           il.AddInstruction(
               il.SetRegister(WORD, reg_dc, il.Register(WORD, LLIL_TEMP(1))));
           return true;
@@ -7039,15 +6553,14 @@ bool Madd::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                      il.MultDoublePrecSigned(
                          DWORD, il.Register(WORD, reg_da),
                          il.SignExtend(WORD, il.Const(HWORD, const9))))));
-          ssov(il.Register(DWORD, LLIL_TEMP(0)), il.Const(WORD, 64),
-               LLIL_TEMP(1), il, DWORD);
+          ssov(il.Register(DWORD, LLIL_TEMP(0)), 64, LLIL_TEMP(1), il, DWORD);
           il.AddInstruction(
               il.SetRegister(DWORD, reg_ec, il.Register(DWORD, LLIL_TEMP(1))));
           return true;
         }
         default:
-          LogDebug("0x%lx: Madd::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Madd::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x03_RRR2:
@@ -7088,8 +6601,7 @@ bool Madd::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
               il.Add(WORD, il.Register(WORD, reg_dd),
                      il.MultDoublePrecSigned(WORD, il.Register(WORD, reg_da),
                                              il.Register(WORD, reg_db)))));
-          ssov(il.Register(WORD, LLIL_TEMP(0)), il.Const(WORD, 32),
-               LLIL_TEMP(1), il, WORD);
+          ssov(il.Register(WORD, LLIL_TEMP(0)), 32, LLIL_TEMP(1), il, WORD);
           il.AddInstruction(
               il.SetRegister(WORD, reg_dc, il.Register(WORD, LLIL_TEMP(1))));
           return true;
@@ -7106,127 +6618,1078 @@ bool Madd::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
               il.Add(DWORD, il.Register(DWORD, reg_ed),
                      il.MultDoublePrecSigned(DWORD, il.Register(WORD, reg_da),
                                              il.Register(WORD, reg_db)))));
-          ssov(il.Register(DWORD, LLIL_TEMP(0)), il.Const(WORD, 32),
-               LLIL_TEMP(1), il, DWORD);
+          ssov(il.Register(DWORD, LLIL_TEMP(0)), 32, LLIL_TEMP(1), il, DWORD);
           il.AddInstruction(
               il.SetRegister(DWORD, reg_ec, il.Register(DWORD, LLIL_TEMP(1))));
           return true;
         }
         default:
-          LogDebug("0x%lx: Madd::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Madd::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Madd::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Madd::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
 
 bool Maddh::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                  size_t& len, LowLevelILFunction& il) {
-  UNIMPLEMENTED(*((const uint16_t*)data) & 0x1 ? 4 : 2)
+  if (op1 != OP1_x83_RRR1) {
+    TRICORE_LOG_REJECT("0x%lx: Maddh::%s received invalid opcode 1 0x%x", addr,
+                       __func__, op1);
+    return false;
+  }
+  switch (op2) {
+    case MADDH_EC_ED_DA_DBLL_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_ed, reg_ec;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_ed, reg_ec);
+      REGTOE(reg_ed)
+      REGTOE(reg_ec)
+      MacPairTo(reg_ec, reg_ed, reg_da, reg_db, HalfwordPair::LL, n,
+                PairMac::Add, false, il);
+      return true;
+    }
+    case MADDH_EC_ED_DA_DBLU_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_ed, reg_ec;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_ed, reg_ec);
+      REGTOE(reg_ed)
+      REGTOE(reg_ec)
+      MacPairTo(reg_ec, reg_ed, reg_da, reg_db, HalfwordPair::LU, n,
+                PairMac::Add, false, il);
+      return true;
+    }
+    case MADDH_EC_ED_DA_DBUL_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_ed, reg_ec;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_ed, reg_ec);
+      REGTOE(reg_ed)
+      REGTOE(reg_ec)
+      MacPairTo(reg_ec, reg_ed, reg_da, reg_db, HalfwordPair::UL, n,
+                PairMac::Add, false, il);
+      return true;
+    }
+    case MADDH_EC_ED_DA_DBUU_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_ed, reg_ec;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_ed, reg_ec);
+      REGTOE(reg_ed)
+      REGTOE(reg_ec)
+      MacPairTo(reg_ec, reg_ed, reg_da, reg_db, HalfwordPair::UU, n,
+                PairMac::Add, false, il);
+      return true;
+    }
+    case MADDSH_EC_ED_DA_DBLL_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_ed, reg_ec;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_ed, reg_ec);
+      REGTOE(reg_ed)
+      REGTOE(reg_ec)
+      MacPairTo(reg_ec, reg_ed, reg_da, reg_db, HalfwordPair::LL, n,
+                PairMac::Add, true, il);
+      return true;
+    }
+    case MADDSH_EC_ED_DA_DBLU_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_ed, reg_ec;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_ed, reg_ec);
+      REGTOE(reg_ed)
+      REGTOE(reg_ec)
+      MacPairTo(reg_ec, reg_ed, reg_da, reg_db, HalfwordPair::LU, n,
+                PairMac::Add, true, il);
+      return true;
+    }
+    case MADDSH_EC_ED_DA_DBUL_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_ed, reg_ec;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_ed, reg_ec);
+      REGTOE(reg_ed)
+      REGTOE(reg_ec)
+      MacPairTo(reg_ec, reg_ed, reg_da, reg_db, HalfwordPair::UL, n,
+                PairMac::Add, true, il);
+      return true;
+    }
+    case MADDSH_EC_ED_DA_DBUU_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_ed, reg_ec;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_ed, reg_ec);
+      REGTOE(reg_ed)
+      REGTOE(reg_ec)
+      MacPairTo(reg_ec, reg_ed, reg_da, reg_db, HalfwordPair::UU, n,
+                PairMac::Add, true, il);
+      return true;
+    }
+    default:
+      TRICORE_LOG_REJECT("0x%lx: Maddh::%s received invalid opcode 2 0x%x",
+                         addr, __func__, op2);
+      return false;
+  }
 }
 
 bool Maddq::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                  size_t& len, LowLevelILFunction& il) {
-  UNIMPLEMENTED(*((const uint16_t*)data) & 0x1 ? 4 : 2)
-}
-
-bool Maddu::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
-                 size_t& len, LowLevelILFunction& il) {
-  UNIMPLEMENTED(*((const uint16_t*)data) & 0x1 ? 4 : 2)
-}
-
-bool MaddmhSh::Lift(uint8_t op1, uint8_t op2, const uint8_t* data,
-                    uint64_t addr, size_t& len, LowLevelILFunction& il) {
-  UNIMPLEMENTED(*((const uint16_t*)data) & 0x1 ? 4 : 2)
-}
-
-bool MaddrhSh::Lift(uint8_t op1, uint8_t op2, const uint8_t* data,
-                    uint64_t addr, size_t& len, LowLevelILFunction& il) {
-  UNIMPLEMENTED(*((const uint16_t*)data) & 0x1 ? 4 : 2)
-}
-
-bool Maddrq::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
-                  size_t& len, LowLevelILFunction& il) {
-  UNIMPLEMENTED(*((const uint16_t*)data) & 0x1 ? 4 : 2)
-}
-
-bool MaddsuhSh::Lift(uint8_t op1, uint8_t op2, const uint8_t* data,
-                     uint64_t addr, size_t& len, LowLevelILFunction& il) {
-  UNIMPLEMENTED(*((const uint16_t*)data) & 0x1 ? 4 : 2)
-}
-
-bool MaddsumhSh::Lift(uint8_t op1, uint8_t op2, const uint8_t* data,
-                      uint64_t addr, size_t& len, LowLevelILFunction& il) {
-  UNIMPLEMENTED(*((const uint16_t*)data) & 0x1 ? 4 : 2)
-}
-
-bool MaddsurhSh::Lift(uint8_t op1, uint8_t op2, const uint8_t* data,
-                      uint64_t addr, size_t& len, LowLevelILFunction& il) {
-  UNIMPLEMENTED(*((const uint16_t*)data) & 0x1 ? 4 : 2)
-}
-
-bool Max::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
-               size_t& len, LowLevelILFunction& il) {
-  ExprId condition;
-  LowLevelILLabel trueLabel, falseLabel, doneLabel;
-  switch (op1) {
-    case OP1_x8B_RC:
-      switch (op2) {
-        case MAX_DC_DA_CONST9: {
-          len = 4;
-          uint8_t reg_da, reg_dc, op1, op2;
-          int16_t const9;
-          Instruction::ExtractOpfieldsRC(data, op1, op2, reg_da, reg_dc,
-                                         const9);
-          condition = il.CompareSignedGreaterThan(
-              WORD, il.Register(WORD, reg_da),
-              il.SignExtend(WORD, il.Const(HWORD, const9)));
-          il.AddInstruction(il.If(condition, trueLabel, falseLabel));
-
-          il.MarkLabel(trueLabel);
-          il.AddInstruction(
-              il.SetRegister(WORD, reg_dc, il.Register(WORD, reg_da)));
-          il.AddInstruction(il.Goto(doneLabel));
-
-          il.MarkLabel(falseLabel);
-          il.AddInstruction(il.SetRegister(
-              WORD, reg_dc, il.SignExtend(WORD, il.Const(HWORD, const9))));
-          il.AddInstruction(il.Goto(doneLabel));
-
-          il.MarkLabel(doneLabel);
-          return true;
-        }
-        case MAXU_DC_DA_CONST9: {
-          len = 4;
-          uint8_t reg_da, reg_dc, op1, op2;
-          int16_t const9;
-          Instruction::ExtractOpfieldsRC(data, op1, op2, reg_da, reg_dc,
-                                         const9);
-          condition = il.CompareUnsignedGreaterThan(
-              WORD, il.Register(WORD, reg_da),
-              il.ZeroExtend(WORD, il.Const(HWORD, const9)));
-          il.AddInstruction(il.If(condition, trueLabel, falseLabel));
+  if (op1 != OP1_x43_RRR1) {
+    TRICORE_LOG_REJECT("0x%lx: Maddq::%s received invalid opcode 1 0x%x", addr,
+                       __func__, op1);
+    return false;
+  }
+  switch (op2) {
+    case MADDQ_DC_DD_DA_DB_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_dd, reg_dc;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_dd, reg_dc);
+      MacQTo(reg_dc, il.Register(WORD, reg_dd), reg_da, QOperand::Word, reg_db,
+             QOperand::Word, n, false, false, WORD, il);
+      return true;
+    }
+    case MADDQ_EC_ED_DA_DB_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_ed, reg_ec;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_ed, reg_ec);
+      REGTOE(reg_ed)
+      REGTOE(reg_ec)
+      MacQTo(reg_ec, il.Register(DWORD, reg_ed), reg_da, QOperand::Word, reg_db,
+             QOperand::Word, n, false, false, DWORD, il);
+      return true;
+    }
+    case MADDQ_DC_DD_DA_DBL_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_dd, reg_dc;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_dd, reg_dc);
+      MacQTo(reg_dc, il.Register(WORD, reg_dd), reg_da, QOperand::Word, reg_db,
+             QOperand::Lower, n, false, false, WORD, il);
+      return true;
+    }
+    case MADDQ_EC_ED_DA_DBL_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_ed, reg_ec;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_ed, reg_ec);
+      REGTOE(reg_ed)
+      REGTOE(reg_ec)
+      MacQTo(reg_ec, il.Register(DWORD, reg_ed), reg_da, QOperand::Word, reg_db,
+             QOperand::Lower, n, false, false, DWORD, il);
+      return true;
+    }
+    case MADDQ_DC_DD_DA_DBU_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_dd, reg_dc;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_dd, reg_dc);
+      MacQTo(reg_dc, il.Register(WORD, reg_dd), reg_da, QOperand::Word, reg_db,
+             QOperand::Upper, n, false, false, WORD, il);
+      return true;
+    }
+    case MADDQ_EC_ED_DA_DBU_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_ed, reg_ec;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_ed, reg_ec);
+      REGTOE(reg_ed)
+      REGTOE(reg_ec)
+      MacQTo(reg_ec, il.Register(DWORD, reg_ed), reg_da, QOperand::Word, reg_db,
+             QOperand::Upper, n, false, false, DWORD, il);
+      return true;
+    }
+    case MADDQ_DC_DD_DAL_DBL_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_dd, reg_dc;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_dd, reg_dc);
+      MacQTo(reg_dc, il.Register(WORD, reg_dd), reg_da, QOperand::Lower, reg_db,
+             QOperand::Lower, n, false, false, WORD, il);
+      return true;
+    }
+    case MADDQ_EC_ED_DAL_DBL_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_ed, reg_ec;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_ed, reg_ec);
+      REGTOE(reg_ed)
+      REGTOE(reg_ec)
+      MacQTo(reg_ec, il.Register(DWORD, reg_ed), reg_da, QOperand::Lower,
+             reg_db, QOperand::Lower, n, false, false, DWORD, il);
+      return true;
+    }
+    case MADDQ_DC_DD_DAU_DBU_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_dd, reg_dc;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_dd, reg_dc);
+      MacQTo(reg_dc, il.Register(WORD, reg_dd), reg_da, QOperand::Upper, reg_db,
+             QOperand::Upper, n, false, false, WORD, il);
+      return true;
+    }
+    case MADDQ_EC_ED_DAU_DBU_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_ed, reg_ec;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_ed, reg_ec);
+      REGTOE(reg_ed)
+      REGTOE(reg_ec)
+      MacQTo(reg_ec, il.Register(DWORD, reg_ed), reg_da, QOperand::Upper,
+             reg_db, QOperand::Upper, n, false, false, DWORD, il);
+      return true;
+    }
+    case MADDSQ_DC_DD_DA_DB_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_dd, reg_dc;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_dd, reg_dc);
+      MacQTo(reg_dc, il.Register(WORD, reg_dd), reg_da, QOperand::Word, reg_db,
+             QOperand::Word, n, false, true, WORD, il);
+      return true;
+    }
+    case MADDSQ_EC_ED_DA_DB_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_ed, reg_ec;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_ed, reg_ec);
+      REGTOE(reg_ed)
+      REGTOE(reg_ec)
+      MacQTo(reg_ec, il.Register(DWORD, reg_ed), reg_da, QOperand::Word, reg_db,
+             QOperand::Word, n, false, true, DWORD, il);
+      return true;
+    }
+    case MADDSQ_DC_DD_DA_DBL_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_dd, reg_dc;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_dd, reg_dc);
+      MacQTo(reg_dc, il.Register(WORD, reg_dd), reg_da, QOperand::Word, reg_db,
+             QOperand::Lower, n, false, true, WORD, il);
+      return true;
+    }
+    case MADDSQ_EC_ED_DA_DBL_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_ed, reg_ec;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_ed, reg_ec);
+      REGTOE(reg_ed)
+      REGTOE(reg_ec)
+      MacQTo(reg_ec, il.Register(DWORD, reg_ed), reg_da, QOperand::Word, reg_db,
+             QOperand::Lower, n, false, true, DWORD, il);
+      return true;
+    }
+    case MADDSQ_DC_DD_DA_DBU_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_dd, reg_dc;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_dd, reg_dc);
+      MacQTo(reg_dc, il.Register(WORD, reg_dd), reg_da, QOperand::Word, reg_db,
+             QOperand::Upper, n, false, true, WORD, il);
+      return true;
+    }
+    case MADDSQ_EC_ED_DA_DBU_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_ed, reg_ec;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_ed, reg_ec);
+      REGTOE(reg_ed)
+      REGTOE(reg_ec)
+      MacQTo(reg_ec, il.Register(DWORD, reg_ed), reg_da, QOperand::Word, reg_db,
+             QOperand::Upper, n, false, true, DWORD, il);
+      return true;
+    }
+    case MADDSQ_DC_DD_DAL_DBL_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_dd, reg_dc;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_dd, reg_dc);
+      MacQTo(reg_dc, il.Register(WORD, reg_dd), reg_da, QOperand::Lower, reg_db,
+             QOperand::Lower, n, false, true, WORD, il);
+      return true;
+    }
+    case MADDSQ_EC_ED_DAL_DBL_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_ed, reg_ec;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_ed, reg_ec);
+      REGTOE(reg_ed)
+      REGTOE(reg_ec)
+      MacQTo(reg_ec, il.Register(DWORD, reg_ed), reg_da, QOperand::Lower,
+             reg_db, QOperand::Lower, n, false, true, DWORD, il);
+      return true;
+    }
+    case MADDSQ_DC_DD_DAU_DBU_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_dd, reg_dc;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_dd, reg_dc);
+      MacQTo(reg_dc, il.Register(WORD, reg_dd), reg_da, QOperand::Upper, reg_db,
+             QOperand::Upper, n, false, true, WORD, il);
+      return true;
+    }
+    case MADDSQ_EC_ED_DAU_DBU_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_ed, reg_ec;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_ed, reg_ec);
+      REGTOE(reg_ed)
+      REGTOE(reg_ec)
+      MacQTo(reg_ec, il.Register(DWORD, reg_ed), reg_da, QOperand::Upper,
+             reg_db, QOperand::Upper, n, false, true, DWORD, il);
+      return true;
+    }
+    default:
+      TRICORE_LOG_REJECT("0x%lx: Maddq::%s received invalid opcode 2 0x%x",
+                         addr, __func__, op2);
+      return false;
+  }
+}
+
+bool Maddu::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
+                 size_t& len, LowLevelILFunction& il) {
+  switch (op1) {
+    case OP1_x13_RCR:
+      switch (op2) {
+        case MADDU_EC_ED_DA_CONST9: {
+          len = 4;
+          uint8_t op1, op2, reg_da, reg_ed, reg_ec;
+          int16_t const9;
+          Instruction::ExtractOpfieldsRCR(data, op1, op2, reg_da, const9,
+                                          reg_ed, reg_ec);
+          REGTOE(reg_ed)
+          REGTOE(reg_ec)
+          const9 &= 0x1FF;
+          il.AddInstruction(il.SetRegister(
+              DWORD, reg_ec,
+              il.Add(DWORD, il.Register(DWORD, reg_ed),
+                     il.MultDoublePrecUnsigned(
+                         DWORD, il.Register(WORD, reg_da),
+                         il.ZeroExtend(WORD, il.Const(HWORD, const9))))));
+          return true;
+        }
+        case MADDSU_DC_DD_DA_CONST9: {
+          len = 4;
+          uint8_t op1, op2, reg_da, reg_dd, reg_dc;
+          int16_t const9;
+          Instruction::ExtractOpfieldsRCR(data, op1, op2, reg_da, const9,
+                                          reg_dd, reg_dc);
+          const9 &= 0x1FF;
+          il.AddInstruction(il.SetRegister(
+              DWORD, LLIL_TEMP(0),
+              il.Add(DWORD, il.ZeroExtend(DWORD, il.Register(WORD, reg_dd)),
+                     il.MultDoublePrecUnsigned(
+                         DWORD, il.Register(WORD, reg_da),
+                         il.ZeroExtend(WORD, il.Const(HWORD, const9))))));
+          suov(il.Register(DWORD, LLIL_TEMP(0)), 32, LLIL_TEMP(1), il, DWORD);
+          il.AddInstruction(il.SetRegister(
+              WORD, reg_dc,
+              il.LowPart(WORD, il.Register(DWORD, LLIL_TEMP(1)))));
+          return true;
+        }
+        case MADDSU_EC_ED_DA_CONST9: {
+          len = 4;
+          uint8_t op1, op2, reg_da, reg_ed, reg_ec;
+          int16_t const9;
+          Instruction::ExtractOpfieldsRCR(data, op1, op2, reg_da, const9,
+                                          reg_ed, reg_ec);
+          REGTOE(reg_ed)
+          REGTOE(reg_ec)
+          const9 &= 0x1FF;
+          il.AddInstruction(il.SetRegister(
+              DWORD, LLIL_TEMP(0),
+              il.Add(DWORD, il.Register(DWORD, reg_ed),
+                     il.MultDoublePrecUnsigned(
+                         DWORD, il.Register(WORD, reg_da),
+                         il.ZeroExtend(WORD, il.Const(HWORD, const9))))));
+          // The 64-bit sum overflowed when it wrapped around below Ed
+          ClampTo(LLIL_TEMP(0), ~uint64_t{0},
+                  il.CompareUnsignedLessThan(DWORD,
+                                             il.Register(DWORD, LLIL_TEMP(0)),
+                                             il.Register(DWORD, reg_ed)),
+                  il, DWORD);
+          il.AddInstruction(
+              il.SetRegister(DWORD, reg_ec, il.Register(DWORD, LLIL_TEMP(0))));
+          return true;
+        }
+        default:
+          TRICORE_LOG_REJECT("0x%lx: Maddu::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
+          return false;
+      }
+    case OP1_x03_RRR2:
+      switch (op2) {
+        case MADDU_EC_ED_DA_DB: {
+          len = 4;
+          uint8_t op1, op2, reg_da, reg_db, reg_ed, reg_ec;
+          Instruction::ExtractOpfieldsRRR2(data, op1, op2, reg_da, reg_db,
+                                           reg_ed, reg_ec);
+          REGTOE(reg_ed)
+          REGTOE(reg_ec)
+          il.AddInstruction(il.SetRegister(
+              DWORD, reg_ec,
+              il.Add(DWORD, il.Register(DWORD, reg_ed),
+                     il.MultDoublePrecUnsigned(DWORD, il.Register(WORD, reg_da),
+                                               il.Register(WORD, reg_db)))));
+          return true;
+        }
+        case MADDSU_DC_DD_DA_DB: {
+          len = 4;
+          uint8_t op1, op2, reg_da, reg_db, reg_dd, reg_dc;
+          Instruction::ExtractOpfieldsRRR2(data, op1, op2, reg_da, reg_db,
+                                           reg_dd, reg_dc);
+          il.AddInstruction(il.SetRegister(
+              DWORD, LLIL_TEMP(0),
+              il.Add(DWORD, il.ZeroExtend(DWORD, il.Register(WORD, reg_dd)),
+                     il.MultDoublePrecUnsigned(DWORD, il.Register(WORD, reg_da),
+                                               il.Register(WORD, reg_db)))));
+          suov(il.Register(DWORD, LLIL_TEMP(0)), 32, LLIL_TEMP(1), il, DWORD);
+          il.AddInstruction(il.SetRegister(
+              WORD, reg_dc,
+              il.LowPart(WORD, il.Register(DWORD, LLIL_TEMP(1)))));
+          return true;
+        }
+        case MADDSU_EC_ED_DA_DB: {
+          len = 4;
+          uint8_t op1, op2, reg_da, reg_db, reg_ed, reg_ec;
+          Instruction::ExtractOpfieldsRRR2(data, op1, op2, reg_da, reg_db,
+                                           reg_ed, reg_ec);
+          REGTOE(reg_ed)
+          REGTOE(reg_ec)
+          il.AddInstruction(il.SetRegister(
+              DWORD, LLIL_TEMP(0),
+              il.Add(DWORD, il.Register(DWORD, reg_ed),
+                     il.MultDoublePrecUnsigned(DWORD, il.Register(WORD, reg_da),
+                                               il.Register(WORD, reg_db)))));
+          // The 64-bit sum overflowed when it wrapped around below Ed
+          ClampTo(LLIL_TEMP(0), ~uint64_t{0},
+                  il.CompareUnsignedLessThan(DWORD,
+                                             il.Register(DWORD, LLIL_TEMP(0)),
+                                             il.Register(DWORD, reg_ed)),
+                  il, DWORD);
+          il.AddInstruction(
+              il.SetRegister(DWORD, reg_ec, il.Register(DWORD, LLIL_TEMP(0))));
+          return true;
+        }
+        default:
+          TRICORE_LOG_REJECT("0x%lx: Maddu::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
+          return false;
+      }
+    default:
+      TRICORE_LOG_REJECT("0x%lx: Maddu::%s received invalid opcode 1 0x%x",
+                         addr, __func__, op1);
+      return false;
+  }
+}
+
+bool MaddmhSh::Lift(uint8_t op1, uint8_t op2, const uint8_t* data,
+                    uint64_t addr, size_t& len, LowLevelILFunction& il) {
+  if (op1 != OP1_x83_RRR1) {
+    TRICORE_LOG_REJECT("0x%lx: MaddmhSh::%s received invalid opcode 1 0x%x",
+                       addr, __func__, op1);
+    return false;
+  }
+  switch (op2) {
+    case MADDMH_EC_ED_DA_DBLL_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_ed, reg_ec;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_ed, reg_ec);
+      REGTOE(reg_ed)
+      REGTOE(reg_ec)
+      MacMultiPrecisionTo(reg_ec, reg_ed, reg_da, reg_db, HalfwordPair::LL, n,
+                          PairMac::Add, false, il);
+      return true;
+    }
+    case MADDMH_EC_ED_DA_DBLU_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_ed, reg_ec;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_ed, reg_ec);
+      REGTOE(reg_ed)
+      REGTOE(reg_ec)
+      MacMultiPrecisionTo(reg_ec, reg_ed, reg_da, reg_db, HalfwordPair::LU, n,
+                          PairMac::Add, false, il);
+      return true;
+    }
+    case MADDMH_EC_ED_DA_DBUL_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_ed, reg_ec;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_ed, reg_ec);
+      REGTOE(reg_ed)
+      REGTOE(reg_ec)
+      MacMultiPrecisionTo(reg_ec, reg_ed, reg_da, reg_db, HalfwordPair::UL, n,
+                          PairMac::Add, false, il);
+      return true;
+    }
+    case MADDMH_EC_ED_DA_DBUU_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_ed, reg_ec;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_ed, reg_ec);
+      REGTOE(reg_ed)
+      REGTOE(reg_ec)
+      MacMultiPrecisionTo(reg_ec, reg_ed, reg_da, reg_db, HalfwordPair::UU, n,
+                          PairMac::Add, false, il);
+      return true;
+    }
+    case MADDMSH_EC_ED_DA_DBLL_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_ed, reg_ec;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_ed, reg_ec);
+      REGTOE(reg_ed)
+      REGTOE(reg_ec)
+      MacMultiPrecisionTo(reg_ec, reg_ed, reg_da, reg_db, HalfwordPair::LL, n,
+                          PairMac::Add, true, il);
+      return true;
+    }
+    case MADDMSH_EC_ED_DA_DBLU_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_ed, reg_ec;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_ed, reg_ec);
+      REGTOE(reg_ed)
+      REGTOE(reg_ec)
+      MacMultiPrecisionTo(reg_ec, reg_ed, reg_da, reg_db, HalfwordPair::LU, n,
+                          PairMac::Add, true, il);
+      return true;
+    }
+    case MADDMSH_EC_ED_DA_DBUL_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_ed, reg_ec;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_ed, reg_ec);
+      REGTOE(reg_ed)
+      REGTOE(reg_ec)
+      MacMultiPrecisionTo(reg_ec, reg_ed, reg_da, reg_db, HalfwordPair::UL, n,
+                          PairMac::Add, true, il);
+      return true;
+    }
+    case MADDMSH_EC_ED_DA_DBUU_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_ed, reg_ec;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_ed, reg_ec);
+      REGTOE(reg_ed)
+      REGTOE(reg_ec)
+      MacMultiPrecisionTo(reg_ec, reg_ed, reg_da, reg_db, HalfwordPair::UU, n,
+                          PairMac::Add, true, il);
+      return true;
+    }
+    default:
+      TRICORE_LOG_REJECT("0x%lx: MaddmhSh::%s received invalid opcode 2 0x%x",
+                         addr, __func__, op2);
+      return false;
+  }
+}
+
+bool MaddrhSh::Lift(uint8_t op1, uint8_t op2, const uint8_t* data,
+                    uint64_t addr, size_t& len, LowLevelILFunction& il) {
+  switch (op1) {
+    case OP1_x83_RRR1:
+      switch (op2) {
+        case MADDRH_DC_DD_DA_DBLL_N: {
+          len = 4;
+          uint8_t op1, op2, reg_da, reg_db, n, reg_dd, reg_dc;
+          Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                           reg_dd, reg_dc);
+          MacRoundedPairTo(reg_dc, reg_dd, WORD, reg_da, reg_db,
+                           HalfwordPair::LL, n, PairMac::Add, false, il);
+          return true;
+        }
+        case MADDRH_DC_DD_DA_DBLU_N: {
+          len = 4;
+          uint8_t op1, op2, reg_da, reg_db, n, reg_dd, reg_dc;
+          Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                           reg_dd, reg_dc);
+          MacRoundedPairTo(reg_dc, reg_dd, WORD, reg_da, reg_db,
+                           HalfwordPair::LU, n, PairMac::Add, false, il);
+          return true;
+        }
+        case MADDRH_DC_DD_DA_DBUL_N: {
+          len = 4;
+          uint8_t op1, op2, reg_da, reg_db, n, reg_dd, reg_dc;
+          Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                           reg_dd, reg_dc);
+          MacRoundedPairTo(reg_dc, reg_dd, WORD, reg_da, reg_db,
+                           HalfwordPair::UL, n, PairMac::Add, false, il);
+          return true;
+        }
+        case MADDRH_DC_DD_DA_DBUU_N: {
+          len = 4;
+          uint8_t op1, op2, reg_da, reg_db, n, reg_dd, reg_dc;
+          Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                           reg_dd, reg_dc);
+          MacRoundedPairTo(reg_dc, reg_dd, WORD, reg_da, reg_db,
+                           HalfwordPair::UU, n, PairMac::Add, false, il);
+          return true;
+        }
+        case MADDRSH_DC_DD_DA_DBLL_N: {
+          len = 4;
+          uint8_t op1, op2, reg_da, reg_db, n, reg_dd, reg_dc;
+          Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                           reg_dd, reg_dc);
+          MacRoundedPairTo(reg_dc, reg_dd, WORD, reg_da, reg_db,
+                           HalfwordPair::LL, n, PairMac::Add, true, il);
+          return true;
+        }
+        case MADDRSH_DC_DD_DA_DBLU_N: {
+          len = 4;
+          uint8_t op1, op2, reg_da, reg_db, n, reg_dd, reg_dc;
+          Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                           reg_dd, reg_dc);
+          MacRoundedPairTo(reg_dc, reg_dd, WORD, reg_da, reg_db,
+                           HalfwordPair::LU, n, PairMac::Add, true, il);
+          return true;
+        }
+        case MADDRSH_DC_DD_DA_DBUL_N: {
+          len = 4;
+          uint8_t op1, op2, reg_da, reg_db, n, reg_dd, reg_dc;
+          Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                           reg_dd, reg_dc);
+          MacRoundedPairTo(reg_dc, reg_dd, WORD, reg_da, reg_db,
+                           HalfwordPair::UL, n, PairMac::Add, true, il);
+          return true;
+        }
+        case MADDRSH_DC_DD_DA_DBUU_N: {
+          len = 4;
+          uint8_t op1, op2, reg_da, reg_db, n, reg_dd, reg_dc;
+          Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                           reg_dd, reg_dc);
+          MacRoundedPairTo(reg_dc, reg_dd, WORD, reg_da, reg_db,
+                           HalfwordPair::UU, n, PairMac::Add, true, il);
+          return true;
+        }
+        default:
+          TRICORE_LOG_REJECT(
+              "0x%lx: MaddrhSh::%s received invalid opcode 2 0x%x",
+              addr, __func__, op2);
+          return false;
+      }
+    case OP1_x43_RRR1:
+      switch (op2) {
+        case MADDRH_DC_ED_DA_DBUL_N: {
+          len = 4;
+          uint8_t op1, op2, reg_da, reg_db, n, reg_ed, reg_dc;
+          Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                           reg_ed, reg_dc);
+          REGTOE(reg_ed)
+          MacRoundedPairTo(reg_dc, reg_ed, DWORD, reg_da, reg_db,
+                           HalfwordPair::UL, n, PairMac::Add, false, il);
+          return true;
+        }
+        case MADDRSH_DC_ED_DA_DBUL_N: {
+          len = 4;
+          uint8_t op1, op2, reg_da, reg_db, n, reg_ed, reg_dc;
+          Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                           reg_ed, reg_dc);
+          REGTOE(reg_ed)
+          MacRoundedPairTo(reg_dc, reg_ed, DWORD, reg_da, reg_db,
+                           HalfwordPair::UL, n, PairMac::Add, true, il);
+          return true;
+        }
+        default:
+          TRICORE_LOG_REJECT(
+              "0x%lx: MaddrhSh::%s received invalid opcode 2 0x%x",
+              addr, __func__, op2);
+          return false;
+      }
+    default:
+      TRICORE_LOG_REJECT("0x%lx: MaddrhSh::%s received invalid opcode 1 0x%x",
+                         addr, __func__, op1);
+      return false;
+  }
+}
+
+bool Maddrq::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
+                  size_t& len, LowLevelILFunction& il) {
+  if (op1 != OP1_x43_RRR1) {
+    TRICORE_LOG_REJECT("0x%lx: Maddrq::%s received invalid opcode 1 0x%x", addr,
+                       __func__, op1);
+    return false;
+  }
+  switch (op2) {
+    case MADDRQ_DC_DD_DAL_DBL_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_dd, reg_dc;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_dd, reg_dc);
+      MacRoundedQTo(reg_dc, il.Register(WORD, reg_dd), reg_da, reg_db, false, n,
+                    false, false, il);
+      return true;
+    }
+    case MADDRQ_DC_DD_DAU_DBU_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_dd, reg_dc;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_dd, reg_dc);
+      MacRoundedQTo(reg_dc, il.Register(WORD, reg_dd), reg_da, reg_db, true, n,
+                    false, false, il);
+      return true;
+    }
+    case MADDRSQ_DC_DD_DAL_DBL_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_dd, reg_dc;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_dd, reg_dc);
+      MacRoundedQTo(reg_dc, il.Register(WORD, reg_dd), reg_da, reg_db, false, n,
+                    false, true, il);
+      return true;
+    }
+    case MADDRSQ_DC_DD_DAU_DBU_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_dd, reg_dc;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_dd, reg_dc);
+      MacRoundedQTo(reg_dc, il.Register(WORD, reg_dd), reg_da, reg_db, true, n,
+                    false, true, il);
+      return true;
+    }
+    default:
+      TRICORE_LOG_REJECT("0x%lx: Maddrq::%s received invalid opcode 2 0x%x",
+                         addr, __func__, op2);
+      return false;
+  }
+}
+
+bool MaddsuhSh::Lift(uint8_t op1, uint8_t op2, const uint8_t* data,
+                     uint64_t addr, size_t& len, LowLevelILFunction& il) {
+  if (op1 != OP1_xC3_RRR1) {
+    TRICORE_LOG_REJECT("0x%lx: MaddsuhSh::%s received invalid opcode 1 0x%x",
+                       addr, __func__, op1);
+    return false;
+  }
+  switch (op2) {
+    case MADDSUH_EC_ED_DA_DBLL_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_ed, reg_ec;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_ed, reg_ec);
+      REGTOE(reg_ed)
+      REGTOE(reg_ec)
+      MacPairTo(reg_ec, reg_ed, reg_da, reg_db, HalfwordPair::LL, n,
+                PairMac::AddSub, false, il);
+      return true;
+    }
+    case MADDSUH_EC_ED_DA_DBLU_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_ed, reg_ec;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_ed, reg_ec);
+      REGTOE(reg_ed)
+      REGTOE(reg_ec)
+      MacPairTo(reg_ec, reg_ed, reg_da, reg_db, HalfwordPair::LU, n,
+                PairMac::AddSub, false, il);
+      return true;
+    }
+    case MADDSUH_EC_ED_DA_DBUL_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_ed, reg_ec;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_ed, reg_ec);
+      REGTOE(reg_ed)
+      REGTOE(reg_ec)
+      MacPairTo(reg_ec, reg_ed, reg_da, reg_db, HalfwordPair::UL, n,
+                PairMac::AddSub, false, il);
+      return true;
+    }
+    case MADDSUH_EC_ED_DA_DBUU_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_ed, reg_ec;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_ed, reg_ec);
+      REGTOE(reg_ed)
+      REGTOE(reg_ec)
+      MacPairTo(reg_ec, reg_ed, reg_da, reg_db, HalfwordPair::UU, n,
+                PairMac::AddSub, false, il);
+      return true;
+    }
+    case MADDSUSH_EC_ED_DA_DBLL_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_ed, reg_ec;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_ed, reg_ec);
+      REGTOE(reg_ed)
+      REGTOE(reg_ec)
+      MacPairTo(reg_ec, reg_ed, reg_da, reg_db, HalfwordPair::LL, n,
+                PairMac::AddSub, true, il);
+      return true;
+    }
+    case MADDSUSH_EC_ED_DA_DBLU_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_ed, reg_ec;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_ed, reg_ec);
+      REGTOE(reg_ed)
+      REGTOE(reg_ec)
+      MacPairTo(reg_ec, reg_ed, reg_da, reg_db, HalfwordPair::LU, n,
+                PairMac::AddSub, true, il);
+      return true;
+    }
+    case MADDSUSH_EC_ED_DA_DBUL_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_ed, reg_ec;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_ed, reg_ec);
+      REGTOE(reg_ed)
+      REGTOE(reg_ec)
+      MacPairTo(reg_ec, reg_ed, reg_da, reg_db, HalfwordPair::UL, n,
+                PairMac::AddSub, true, il);
+      return true;
+    }
+    case MADDSUSH_EC_ED_DA_DBUU_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_ed, reg_ec;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_ed, reg_ec);
+      REGTOE(reg_ed)
+      REGTOE(reg_ec)
+      MacPairTo(reg_ec, reg_ed, reg_da, reg_db, HalfwordPair::UU, n,
+                PairMac::AddSub, true, il);
+      return true;
+    }
+    default:
+      TRICORE_LOG_REJECT("0x%lx: MaddsuhSh::%s received invalid opcode 2 0x%x",
+                         addr, __func__, op2);
+      return false;
+  }
+}
 
-          il.MarkLabel(trueLabel);
-          il.AddInstruction(
-              il.SetRegister(WORD, reg_dc, il.Register(WORD, reg_da)));
-          il.AddInstruction(il.Goto(doneLabel));
+bool MaddsumhSh::Lift(uint8_t op1, uint8_t op2, const uint8_t* data,
+                      uint64_t addr, size_t& len, LowLevelILFunction& il) {
+  if (op1 != OP1_xC3_RRR1) {
+    TRICORE_LOG_REJECT("0x%lx: MaddsumhSh::%s received invalid opcode 1 0x%x",
+                       addr, __func__, op1);
+    return false;
+  }
+  switch (op2) {
+    case MADDSUMH_EC_ED_DA_DBLL_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_ed, reg_ec;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_ed, reg_ec);
+      REGTOE(reg_ed)
+      REGTOE(reg_ec)
+      MacMultiPrecisionTo(reg_ec, reg_ed, reg_da, reg_db, HalfwordPair::LL, n,
+                          PairMac::AddSub, false, il);
+      return true;
+    }
+    case MADDSUMH_EC_ED_DA_DBLU_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_ed, reg_ec;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_ed, reg_ec);
+      REGTOE(reg_ed)
+      REGTOE(reg_ec)
+      MacMultiPrecisionTo(reg_ec, reg_ed, reg_da, reg_db, HalfwordPair::LU, n,
+                          PairMac::AddSub, false, il);
+      return true;
+    }
+    case MADDSUMH_EC_ED_DA_DBUL_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_ed, reg_ec;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_ed, reg_ec);
+      REGTOE(reg_ed)
+      REGTOE(reg_ec)
+      MacMultiPrecisionTo(reg_ec, reg_ed, reg_da, reg_db, HalfwordPair::UL, n,
+                          PairMac::AddSub, false, il);
+      return true;
+    }
+    case MADDSUMH_EC_ED_DA_DBUU_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_ed, reg_ec;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_ed, reg_ec);
+      REGTOE(reg_ed)
+      REGTOE(reg_ec)
+      MacMultiPrecisionTo(reg_ec, reg_ed, reg_da, reg_db, HalfwordPair::UU, n,
+                          PairMac::AddSub, false, il);
+      return true;
+    }
+    case MADDSUMSH_EC_ED_DA_DBLL_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_ed, reg_ec;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_ed, reg_ec);
+      REGTOE(reg_ed)
+      REGTOE(reg_ec)
+      MacMultiPrecisionTo(reg_ec, reg_ed, reg_da, reg_db, HalfwordPair::LL, n,
+                          PairMac::AddSub, true, il);
+      return true;
+    }
+    case MADDSUMSH_EC_ED_DA_DBLU_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_ed, reg_ec;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_ed, reg_ec);
+      REGTOE(reg_ed)
+      REGTOE(reg_ec)
+      MacMultiPrecisionTo(reg_ec, reg_ed, reg_da, reg_db, HalfwordPair::LU, n,
+                          PairMac::AddSub, true, il);
+      return true;
+    }
+    case MADDSUMSH_EC_ED_DA_DBUL_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_ed, reg_ec;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_ed, reg_ec);
+      REGTOE(reg_ed)
+      REGTOE(reg_ec)
+      MacMultiPrecisionTo(reg_ec, reg_ed, reg_da, reg_db, HalfwordPair::UL, n,
+                          PairMac::AddSub, true, il);
+      return true;
+    }
+    case MADDSUMSH_EC_ED_DA_DBUU_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_ed, reg_ec;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_ed, reg_ec);
+      REGTOE(reg_ed)
+      REGTOE(reg_ec)
+      MacMultiPrecisionTo(reg_ec, reg_ed, reg_da, reg_db, HalfwordPair::UU, n,
+                          PairMac::AddSub, true, il);
+      return true;
+    }
+    default:
+      TRICORE_LOG_REJECT("0x%lx: MaddsumhSh::%s received invalid opcode 2 0x%x",
+                         addr, __func__, op2);
+      return false;
+  }
+}
 
-          il.MarkLabel(falseLabel);
-          il.AddInstruction(il.SetRegister(
-              WORD, reg_dc, il.ZeroExtend(WORD, il.Const(HWORD, const9))));
-          il.AddInstruction(il.Goto(doneLabel));
+bool MaddsurhSh::Lift(uint8_t op1, uint8_t op2, const uint8_t* data,
+                      uint64_t addr, size_t& len, LowLevelILFunction& il) {
+  if (op1 != OP1_xC3_RRR1) {
+    TRICORE_LOG_REJECT("0x%lx: MaddsurhSh::%s received invalid opcode 1 0x%x",
+                       addr, __func__, op1);
+    return false;
+  }
+  switch (op2) {
+    case MADDSURH_DC_DD_DA_DBLL_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_dd, reg_dc;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_dd, reg_dc);
+      MacRoundedPairTo(reg_dc, reg_dd, WORD, reg_da, reg_db, HalfwordPair::LL,
+                       n, PairMac::AddSub, false, il);
+      return true;
+    }
+    case MADDSURH_DC_DD_DA_DBLU_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_dd, reg_dc;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_dd, reg_dc);
+      MacRoundedPairTo(reg_dc, reg_dd, WORD, reg_da, reg_db, HalfwordPair::LU,
+                       n, PairMac::AddSub, false, il);
+      return true;
+    }
+    case MADDSURH_DC_DD_DA_DBUL_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_dd, reg_dc;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_dd, reg_dc);
+      MacRoundedPairTo(reg_dc, reg_dd, WORD, reg_da, reg_db, HalfwordPair::UL,
+                       n, PairMac::AddSub, false, il);
+      return true;
+    }
+    case MADDSURH_DC_DD_DA_DBUU_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_dd, reg_dc;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_dd, reg_dc);
+      MacRoundedPairTo(reg_dc, reg_dd, WORD, reg_da, reg_db, HalfwordPair::UU,
+                       n, PairMac::AddSub, false, il);
+      return true;
+    }
+    case MADDSURSH_DC_DD_DA_DBLL_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_dd, reg_dc;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_dd, reg_dc);
+      MacRoundedPairTo(reg_dc, reg_dd, WORD, reg_da, reg_db, HalfwordPair::LL,
+                       n, PairMac::AddSub, true, il);
+      return true;
+    }
+    case MADDSURSH_DC_DD_DA_DBLU_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_dd, reg_dc;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_dd, reg_dc);
+      MacRoundedPairTo(reg_dc, reg_dd, WORD, reg_da, reg_db, HalfwordPair::LU,
+                       n, PairMac::AddSub, true, il);
+      return true;
+    }
+    case MADDSURSH_DC_DD_DA_DBUL_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_dd, reg_dc;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_dd, reg_dc);
+      MacRoundedPairTo(reg_dc, reg_dd, WORD, reg_da, reg_db, HalfwordPair::UL,
+                       n, PairMac::AddSub, true, il);
+      return true;
+    }
+    case MADDSURSH_DC_DD_DA_DBUU_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_dd, reg_dc;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_dd, reg_dc);
+      MacRoundedPairTo(reg_dc, reg_dd, WORD, reg_da, reg_db, HalfwordPair::UU,
+                       n, PairMac::AddSub, true, il);
+      return true;
+    }
+    default:
+      TRICORE_LOG_REJECT("0x%lx: MaddsurhSh::%s received invalid opcode 2 0x%x",
+                         addr, __func__, op2);
+      return false;
+  }
+}
 
-          il.MarkLabel(doneLabel);
+bool Max::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
+               size_t& len, LowLevelILFunction& il) {
+  ExprId condition;
+  switch (op1) {
+    case OP1_x8B_RC:
+      switch (op2) {
+        case MAX_DC_DA_CONST9: {
+          len = 4;
+          uint8_t reg_da, reg_dc, op1, op2;
+          int16_t const9;
+          Instruction::ExtractOpfieldsRC(data, op1, op2, reg_da, reg_dc,
+                                         const9);
+          condition = il.CompareSignedGreaterThan(
+              WORD, il.Register(WORD, reg_da),
+              il.SignExtend(WORD, il.Const(HWORD, const9)));
+          SelectTo(reg_dc, condition, il.Register(WORD, reg_da),
+                   il.SignExtend(WORD, il.Const(HWORD, const9)), il, WORD);
+          return true;
+        }
+        case MAXU_DC_DA_CONST9: {
+          len = 4;
+          uint8_t reg_da, reg_dc, op1, op2;
+          int16_t const9;
+          Instruction::ExtractOpfieldsRC(data, op1, op2, reg_da, reg_dc,
+                                         const9);
+          condition = il.CompareUnsignedGreaterThan(
+              WORD, il.Register(WORD, reg_da),
+              il.ZeroExtend(WORD, il.Const(HWORD, const9)));
+          SelectTo(reg_dc, condition, il.Register(WORD, reg_da),
+                   il.ZeroExtend(WORD, il.Const(HWORD, const9)), il, WORD);
           return true;
         }
         default:
-          LogDebug("0x%lx: Max::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Max::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x0B_RR:
@@ -7238,19 +7701,8 @@ bool Max::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                                          reg_dc);
           condition = il.CompareSignedGreaterThan(
               WORD, il.Register(WORD, reg_da), il.Register(WORD, reg_db));
-          il.AddInstruction(il.If(condition, trueLabel, falseLabel));
-
-          il.MarkLabel(trueLabel);
-          il.AddInstruction(
-              il.SetRegister(WORD, reg_dc, il.Register(WORD, reg_da)));
-          il.AddInstruction(il.Goto(doneLabel));
-
-          il.MarkLabel(falseLabel);
-          il.AddInstruction(
-              il.SetRegister(WORD, reg_dc, il.Register(WORD, reg_db)));
-          il.AddInstruction(il.Goto(doneLabel));
-
-          il.MarkLabel(doneLabel);
+          SelectTo(reg_dc, condition, il.Register(WORD, reg_da),
+                   il.Register(WORD, reg_db), il, WORD);
           return true;
         }
         case MAXU_DC_DA_DB: {
@@ -7260,324 +7712,51 @@ bool Max::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                                          reg_dc);
           condition = il.CompareUnsignedGreaterThan(
               WORD, il.Register(WORD, reg_da), il.Register(WORD, reg_db));
-          il.AddInstruction(il.If(condition, trueLabel, falseLabel));
-
-          il.MarkLabel(trueLabel);
-          il.AddInstruction(
-              il.SetRegister(WORD, reg_dc, il.Register(WORD, reg_da)));
-          il.AddInstruction(il.Goto(doneLabel));
-
-          il.MarkLabel(falseLabel);
-          il.AddInstruction(
-              il.SetRegister(WORD, reg_dc, il.Register(WORD, reg_db)));
-          il.AddInstruction(il.Goto(doneLabel));
-
-          il.MarkLabel(doneLabel);
+          SelectTo(reg_dc, condition, il.Register(WORD, reg_da),
+                   il.Register(WORD, reg_db), il, WORD);
           return true;
         }
         default:
-          LogDebug("0x%lx: Max::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Max::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
-      }
-    default:
-      LogDebug("0x%lx: Max::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
-      return false;
-  }
-}
-
-bool Maxb::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
-                size_t& len, LowLevelILFunction& il) {
-  if (op1 != OP1_x0B_RR) {
-    LogDebug("0x%lx: Maxb::%s received invalid opcode 1 0x%x", addr, __func__,
-             op1);
-    return false;
-  }
-  switch (op2) {
-    case MAXB_DC_DA_DB: {
-      ExprId cond_byte0, cond_byte1, cond_byte2, cond_byte3;
-      LowLevelILLabel trueLabel0, trueLabel1, trueLabel2, trueLabel3,
-          falseLabel0, falseLabel1, falseLabel2, doneLabel;
-      len = 4;
-      uint8_t reg_dc, reg_da, reg_db, op1, op2, n;
-      Instruction::ExtractOpfieldsRR(data, op1, op2, reg_da, reg_db, n, reg_dc);
-
-      il.AddInstruction(il.SetRegister(
-          WORD, LLIL_TEMP(3),
-          il.BoolToInt(
-              WORD,
-              il.CompareSignedGreaterThan(
-                  WORD,
-                  il.And(WORD,
-                         il.LogicalShiftRight(WORD, il.Register(WORD, reg_da),
-                                              il.Const(WORD, 24)),
-                         il.Const(WORD, 0xFF)),
-                  il.And(WORD,
-                         il.LogicalShiftRight(WORD, il.Register(WORD, reg_db),
-                                              il.Const(WORD, 24)),
-                         il.Const(WORD, 0xFF))))));
-      il.AddInstruction(il.SetRegister(
-          WORD, LLIL_TEMP(2),
-          il.BoolToInt(
-              WORD,
-              il.CompareSignedGreaterThan(
-                  WORD,
-                  il.And(WORD,
-                         il.LogicalShiftRight(WORD, il.Register(WORD, reg_da),
-                                              il.Const(WORD, 16)),
-                         il.Const(WORD, 0xFF)),
-                  il.And(WORD,
-                         il.LogicalShiftRight(WORD, il.Register(WORD, reg_db),
-                                              il.Const(WORD, 16)),
-                         il.Const(WORD, 0xFF))))));
-      il.AddInstruction(il.SetRegister(
-          WORD, LLIL_TEMP(1),
-          il.BoolToInt(
-              WORD,
-              il.CompareSignedGreaterThan(
-                  WORD,
-                  il.And(WORD,
-                         il.LogicalShiftRight(WORD, il.Register(WORD, reg_da),
-                                              il.Const(WORD, 8)),
-                         il.Const(WORD, 0xFF)),
-                  il.And(WORD,
-                         il.LogicalShiftRight(WORD, il.Register(WORD, reg_db),
-                                              il.Const(WORD, 8)),
-                         il.Const(WORD, 0xFF))))));
-      il.AddInstruction(il.SetRegister(
-          WORD, LLIL_TEMP(0),
-          il.BoolToInt(WORD, il.CompareSignedGreaterThan(
-                                 WORD,
-                                 il.And(WORD, il.Register(WORD, reg_da),
-                                        il.Const(WORD, 0xFF)),
-                                 il.And(WORD, il.Register(WORD, reg_db),
-                                        il.Const(WORD, 0xFF))))));
-
-      cond_byte0 = il.CompareEqual(WORD, il.Register(WORD, LLIL_TEMP(0)),
-                                   il.Const(WORD, 1));
-      cond_byte1 = il.CompareEqual(WORD, il.Register(WORD, LLIL_TEMP(1)),
-                                   il.Const(WORD, 1));
-      cond_byte2 = il.CompareEqual(WORD, il.Register(WORD, LLIL_TEMP(2)),
-                                   il.Const(WORD, 1));
-      cond_byte3 = il.CompareEqual(WORD, il.Register(WORD, LLIL_TEMP(3)),
-                                   il.Const(WORD, 1));
-
-      // Set to false case
-      il.AddInstruction(
-          il.SetRegister(WORD, LLIL_TEMP(4), il.Register(WORD, reg_db)));
-
-      il.AddInstruction(il.If(cond_byte0, trueLabel0, falseLabel0));
-      il.MarkLabel(trueLabel0);
-      // Clear byte
-      il.AddInstruction(
-          il.SetRegister(WORD, LLIL_TEMP(4),
-                         il.And(WORD, il.Register(WORD, LLIL_TEMP(4)),
-                                il.Const(WORD, 0xFFFFFF00))));
-      // Set byte to true case
-      il.AddInstruction(il.SetRegister(
-          WORD, LLIL_TEMP(4),
-          il.Or(
-              WORD, il.Register(WORD, LLIL_TEMP(4)),
-              il.And(WORD, il.Register(WORD, reg_da), il.Const(WORD, 0xFF)))));
-      il.AddInstruction(il.Goto(falseLabel0));
-
-      il.MarkLabel(falseLabel0);
-      il.AddInstruction(il.If(cond_byte1, trueLabel1, falseLabel1));
-      il.MarkLabel(trueLabel1);
-      // Clear byte
-      il.AddInstruction(
-          il.SetRegister(WORD, LLIL_TEMP(4),
-                         il.And(WORD, il.Register(WORD, LLIL_TEMP(4)),
-                                il.Const(WORD, 0xFFFF00FF))));
-      // Set byte to true case
-      il.AddInstruction(
-          il.SetRegister(WORD, LLIL_TEMP(4),
-                         il.Or(WORD, il.Register(WORD, LLIL_TEMP(4)),
-                               il.And(WORD, il.Register(WORD, reg_da),
-                                      il.Const(WORD, 0xFF00)))));
-      il.AddInstruction(il.Goto(falseLabel1));
-
-      il.MarkLabel(falseLabel1);
-      il.AddInstruction(il.If(cond_byte2, trueLabel2, falseLabel2));
-      il.MarkLabel(trueLabel2);
-      // Clear byte
-      il.AddInstruction(
-          il.SetRegister(WORD, LLIL_TEMP(4),
-                         il.And(WORD, il.Register(WORD, LLIL_TEMP(4)),
-                                il.Const(WORD, 0xFF00FFFF))));
-      // Set byte to true case
-      il.AddInstruction(
-          il.SetRegister(WORD, LLIL_TEMP(4),
-                         il.Or(WORD, il.Register(WORD, LLIL_TEMP(4)),
-                               il.And(WORD, il.Register(WORD, reg_da),
-                                      il.Const(WORD, 0xFF0000)))));
-      il.AddInstruction(il.Goto(falseLabel2));
-
-      il.MarkLabel(falseLabel2);
-      il.AddInstruction(il.If(cond_byte3, trueLabel3, doneLabel));
-      il.MarkLabel(trueLabel3);
-      // Clear byte
-      il.AddInstruction(
-          il.SetRegister(WORD, LLIL_TEMP(4),
-                         il.And(WORD, il.Register(WORD, LLIL_TEMP(4)),
-                                il.Const(WORD, 0x00FFFFFF))));
-      // Set byte to true case
-      il.AddInstruction(
-          il.SetRegister(WORD, LLIL_TEMP(4),
-                         il.Or(WORD, il.Register(WORD, LLIL_TEMP(4)),
-                               il.And(WORD, il.Register(WORD, reg_da),
-                                      il.Const(WORD, 0xFF000000)))));
-      il.AddInstruction(il.Goto(doneLabel));
-
-      il.MarkLabel(doneLabel);
-      il.AddInstruction(
-          il.SetRegister(WORD, reg_dc, il.Register(WORD, LLIL_TEMP(4))));
-      return true;
-    }
-    case MAXBU_DC_DA_DB: {
-      ExprId cond_byte0, cond_byte1, cond_byte2, cond_byte3;
-      LowLevelILLabel trueLabel0, trueLabel1, trueLabel2, trueLabel3,
-          falseLabel0, falseLabel1, falseLabel2, doneLabel;
-      len = 4;
-      uint8_t reg_dc, reg_da, reg_db, op1, op2, n;
-      Instruction::ExtractOpfieldsRR(data, op1, op2, reg_da, reg_db, n, reg_dc);
-
-      il.AddInstruction(il.SetRegister(
-          WORD, LLIL_TEMP(3),
-          il.BoolToInt(
-              WORD,
-              il.CompareUnsignedGreaterThan(
-                  WORD,
-                  il.And(WORD,
-                         il.LogicalShiftRight(WORD, il.Register(WORD, reg_da),
-                                              il.Const(WORD, 24)),
-                         il.Const(WORD, 0xFF)),
-                  il.And(WORD,
-                         il.LogicalShiftRight(WORD, il.Register(WORD, reg_db),
-                                              il.Const(WORD, 24)),
-                         il.Const(WORD, 0xFF))))));
-      il.AddInstruction(il.SetRegister(
-          WORD, LLIL_TEMP(2),
-          il.BoolToInt(
-              WORD,
-              il.CompareUnsignedGreaterThan(
-                  WORD,
-                  il.And(WORD,
-                         il.LogicalShiftRight(WORD, il.Register(WORD, reg_da),
-                                              il.Const(WORD, 16)),
-                         il.Const(WORD, 0xFF)),
-                  il.And(WORD,
-                         il.LogicalShiftRight(WORD, il.Register(WORD, reg_db),
-                                              il.Const(WORD, 16)),
-                         il.Const(WORD, 0xFF))))));
-      il.AddInstruction(il.SetRegister(
-          WORD, LLIL_TEMP(1),
-          il.BoolToInt(
-              WORD,
-              il.CompareUnsignedGreaterThan(
-                  WORD,
-                  il.And(WORD,
-                         il.LogicalShiftRight(WORD, il.Register(WORD, reg_da),
-                                              il.Const(WORD, 8)),
-                         il.Const(WORD, 0xFF)),
-                  il.And(WORD,
-                         il.LogicalShiftRight(WORD, il.Register(WORD, reg_db),
-                                              il.Const(WORD, 8)),
-                         il.Const(WORD, 0xFF))))));
-      il.AddInstruction(il.SetRegister(
-          WORD, LLIL_TEMP(0),
-          il.BoolToInt(WORD, il.CompareUnsignedGreaterThan(
-                                 WORD,
-                                 il.And(WORD, il.Register(WORD, reg_da),
-                                        il.Const(WORD, 0xFF)),
-                                 il.And(WORD, il.Register(WORD, reg_db),
-                                        il.Const(WORD, 0xFF))))));
-
-      cond_byte0 = il.CompareEqual(WORD, il.Register(WORD, LLIL_TEMP(0)),
-                                   il.Const(WORD, 1));
-      cond_byte1 = il.CompareEqual(WORD, il.Register(WORD, LLIL_TEMP(1)),
-                                   il.Const(WORD, 1));
-      cond_byte2 = il.CompareEqual(WORD, il.Register(WORD, LLIL_TEMP(2)),
-                                   il.Const(WORD, 1));
-      cond_byte3 = il.CompareEqual(WORD, il.Register(WORD, LLIL_TEMP(3)),
-                                   il.Const(WORD, 1));
-
-      // Set to false case
-      il.AddInstruction(
-          il.SetRegister(WORD, LLIL_TEMP(4), il.Register(WORD, reg_db)));
-
-      il.AddInstruction(il.If(cond_byte0, trueLabel0, falseLabel0));
-      il.MarkLabel(trueLabel0);
-      // Clear byte
-      il.AddInstruction(
-          il.SetRegister(WORD, LLIL_TEMP(4),
-                         il.And(WORD, il.Register(WORD, LLIL_TEMP(4)),
-                                il.Const(WORD, 0xFFFFFF00))));
-      // Set byte to true case
-      il.AddInstruction(il.SetRegister(
-          WORD, LLIL_TEMP(4),
-          il.Or(
-              WORD, il.Register(WORD, LLIL_TEMP(4)),
-              il.And(WORD, il.Register(WORD, reg_da), il.Const(WORD, 0xFF)))));
-      il.AddInstruction(il.Goto(falseLabel0));
-
-      il.MarkLabel(falseLabel0);
-      il.AddInstruction(il.If(cond_byte1, trueLabel1, falseLabel1));
-      il.MarkLabel(trueLabel1);
-      // Clear byte
-      il.AddInstruction(
-          il.SetRegister(WORD, LLIL_TEMP(4),
-                         il.And(WORD, il.Register(WORD, LLIL_TEMP(4)),
-                                il.Const(WORD, 0xFFFF00FF))));
-      // Set byte to true case
-      il.AddInstruction(
-          il.SetRegister(WORD, LLIL_TEMP(4),
-                         il.Or(WORD, il.Register(WORD, LLIL_TEMP(4)),
-                               il.And(WORD, il.Register(WORD, reg_da),
-                                      il.Const(WORD, 0xFF00)))));
-      il.AddInstruction(il.Goto(falseLabel1));
-
-      il.MarkLabel(falseLabel1);
-      il.AddInstruction(il.If(cond_byte2, trueLabel2, falseLabel2));
-      il.MarkLabel(trueLabel2);
-      // Clear byte
-      il.AddInstruction(
-          il.SetRegister(WORD, LLIL_TEMP(4),
-                         il.And(WORD, il.Register(WORD, LLIL_TEMP(4)),
-                                il.Const(WORD, 0xFF00FFFF))));
-      // Set byte to true case
-      il.AddInstruction(
-          il.SetRegister(WORD, LLIL_TEMP(4),
-                         il.Or(WORD, il.Register(WORD, LLIL_TEMP(4)),
-                               il.And(WORD, il.Register(WORD, reg_da),
-                                      il.Const(WORD, 0xFF0000)))));
-      il.AddInstruction(il.Goto(falseLabel2));
-
-      il.MarkLabel(falseLabel2);
-      il.AddInstruction(il.If(cond_byte3, trueLabel3, doneLabel));
-      il.MarkLabel(trueLabel3);
-      // Clear byte
-      il.AddInstruction(
-          il.SetRegister(WORD, LLIL_TEMP(4),
-                         il.And(WORD, il.Register(WORD, LLIL_TEMP(4)),
-                                il.Const(WORD, 0x00FFFFFF))));
-      // Set byte to true case
-      il.AddInstruction(
-          il.SetRegister(WORD, LLIL_TEMP(4),
-                         il.Or(WORD, il.Register(WORD, LLIL_TEMP(4)),
-                               il.And(WORD, il.Register(WORD, reg_da),
-                                      il.Const(WORD, 0xFF000000)))));
-      il.AddInstruction(il.Goto(doneLabel));
+      }
+    default:
+      TRICORE_LOG_REJECT("0x%lx: Max::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
+      return false;
+  }
+}
 
-      il.MarkLabel(doneLabel);
-      il.AddInstruction(
-          il.SetRegister(WORD, reg_dc, il.Register(WORD, LLIL_TEMP(4))));
+bool Maxb::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
+                size_t& len, LowLevelILFunction& il) {
+  if (op1 != OP1_x0B_RR) {
+    TRICORE_LOG_REJECT("0x%lx: Maxb::%s received invalid opcode 1 0x%x", addr,
+                       __func__, op1);
+    return false;
+  }
+  switch (op2) {
+    case MAXB_DC_DA_DB: {
+      len = 4;
+      uint8_t reg_dc, reg_da, reg_db, op1, op2, n;
+      Instruction::ExtractOpfieldsRR(data, op1, op2, reg_da, reg_db, n, reg_dc);
+      PackedTo(reg_dc, PackedOp::MaxB,
+               {il.Register(WORD, reg_da), il.Register(WORD, reg_db)},
+               Maxb::flags, il);
+      return true;
+    }
+    case MAXBU_DC_DA_DB: {
+      len = 4;
+      uint8_t reg_dc, reg_da, reg_db, op1, op2, n;
+      Instruction::ExtractOpfieldsRR(data, op1, op2, reg_da, reg_db, n, reg_dc);
+      PackedTo(reg_dc, PackedOp::MaxBu,
+               {il.Register(WORD, reg_da), il.Register(WORD, reg_db)},
+               Maxb::flags, il);
       return true;
     }
     default:
-      LogDebug("0x%lx: Maxb::%s received invalid opcode 2 0x%x", addr, __func__,
-               op2);
+      TRICORE_LOG_REJECT("0x%lx: Maxb::%s received invalid opcode 2 0x%x", addr,
+                         __func__, op2);
       return false;
   }
 }
@@ -7585,166 +7764,32 @@ bool Maxb::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Maxh::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                 size_t& len, LowLevelILFunction& il) {
   if (op1 != OP1_x0B_RR) {
-    LogDebug("0x%lx: Maxh::%s received invalid opcode 1 0x%x", addr, __func__,
-             op1);
+    TRICORE_LOG_REJECT("0x%lx: Maxh::%s received invalid opcode 1 0x%x", addr,
+                       __func__, op1);
     return false;
   }
   switch (op2) {
     case MAXH_DC_DA_DB: {
-      ExprId cond_hword0, cond_hword1;
-      LowLevelILLabel trueLabel0, trueLabel1, trueLabel2, trueLabel3,
-          falseLabel0, falseLabel1, falseLabel2, doneLabel;
       len = 4;
       uint8_t reg_dc, reg_da, reg_db, op1, op2, n;
       Instruction::ExtractOpfieldsRR(data, op1, op2, reg_da, reg_db, n, reg_dc);
-
-      il.AddInstruction(il.SetRegister(
-          WORD, LLIL_TEMP(1),
-          il.BoolToInt(
-              WORD,
-              il.CompareSignedGreaterThan(
-                  WORD,
-                  il.And(WORD,
-                         il.LogicalShiftRight(WORD, il.Register(WORD, reg_da),
-                                              il.Const(WORD, 16)),
-                         il.Const(WORD, 0xFFFF)),
-                  il.And(WORD,
-                         il.LogicalShiftRight(WORD, il.Register(WORD, reg_db),
-                                              il.Const(WORD, 16)),
-                         il.Const(WORD, 0xFFFF))))));
-      il.AddInstruction(il.SetRegister(
-          WORD, LLIL_TEMP(0),
-          il.BoolToInt(WORD, il.CompareSignedGreaterThan(
-                                 WORD,
-                                 il.And(WORD, il.Register(WORD, reg_da),
-                                        il.Const(WORD, 0xFFFF)),
-                                 il.And(WORD, il.Register(WORD, reg_db),
-                                        il.Const(WORD, 0xFFFF))))));
-
-      cond_hword0 = il.CompareEqual(WORD, il.Register(WORD, LLIL_TEMP(0)),
-                                    il.Const(WORD, 1));
-      cond_hword1 = il.CompareEqual(WORD, il.Register(WORD, LLIL_TEMP(1)),
-                                    il.Const(WORD, 1));
-
-      // Set byte to false case
-      il.AddInstruction(
-          il.SetRegister(WORD, LLIL_TEMP(4), il.Register(WORD, reg_db)));
-
-      il.AddInstruction(il.If(cond_hword0, trueLabel0, falseLabel0));
-      il.MarkLabel(trueLabel0);
-      // Clear byte
-      il.AddInstruction(
-          il.SetRegister(WORD, LLIL_TEMP(4),
-                         il.And(WORD, il.Register(WORD, LLIL_TEMP(4)),
-                                il.Const(WORD, 0xFFFF0000))));
-      // Set byte to true case
-      il.AddInstruction(
-          il.SetRegister(WORD, LLIL_TEMP(4),
-                         il.Or(WORD, il.Register(WORD, LLIL_TEMP(4)),
-                               il.And(WORD, il.Register(WORD, reg_da),
-                                      il.Const(WORD, 0xFFFF)))));
-      il.AddInstruction(il.Goto(falseLabel0));
-
-      il.MarkLabel(falseLabel0);
-      il.AddInstruction(il.If(cond_hword1, trueLabel1, doneLabel));
-      il.MarkLabel(trueLabel1);
-      // Clear byte
-      il.AddInstruction(
-          il.SetRegister(WORD, LLIL_TEMP(4),
-                         il.And(WORD, il.Register(WORD, LLIL_TEMP(4)),
-                                il.Const(WORD, 0x0000FFFF))));
-      // Set byte to true case
-      il.AddInstruction(
-          il.SetRegister(WORD, LLIL_TEMP(4),
-                         il.Or(WORD, il.Register(WORD, LLIL_TEMP(4)),
-                               il.And(WORD, il.Register(WORD, reg_da),
-                                      il.Const(WORD, 0xFFFF0000)))));
-      il.AddInstruction(il.Goto(doneLabel));
-
-      il.MarkLabel(doneLabel);
-      il.AddInstruction(
-          il.SetRegister(WORD, reg_dc, il.Register(WORD, LLIL_TEMP(4))));
+      PackedTo(reg_dc, PackedOp::MaxH,
+               {il.Register(WORD, reg_da), il.Register(WORD, reg_db)},
+               Maxh::flags, il);
       return true;
     }
     case MAXHU_DC_DA_DB: {
-      ExprId cond_hword0, cond_hword1;
-      LowLevelILLabel trueLabel0, trueLabel1, trueLabel2, trueLabel3,
-          falseLabel0, falseLabel1, falseLabel2, doneLabel;
       len = 4;
       uint8_t reg_dc, reg_da, reg_db, op1, op2, n;
       Instruction::ExtractOpfieldsRR(data, op1, op2, reg_da, reg_db, n, reg_dc);
-
-      il.AddInstruction(il.SetRegister(
-          WORD, LLIL_TEMP(1),
-          il.BoolToInt(
-              WORD,
-              il.CompareUnsignedGreaterThan(
-                  WORD,
-                  il.And(WORD,
-                         il.LogicalShiftRight(WORD, il.Register(WORD, reg_da),
-                                              il.Const(WORD, 16)),
-                         il.Const(WORD, 0xFFFF)),
-                  il.And(WORD,
-                         il.LogicalShiftRight(WORD, il.Register(WORD, reg_db),
-                                              il.Const(WORD, 16)),
-                         il.Const(WORD, 0xFFFF))))));
-      il.AddInstruction(il.SetRegister(
-          WORD, LLIL_TEMP(0),
-          il.BoolToInt(WORD, il.CompareUnsignedGreaterThan(
-                                 WORD,
-                                 il.And(WORD, il.Register(WORD, reg_da),
-                                        il.Const(WORD, 0xFFFF)),
-                                 il.And(WORD, il.Register(WORD, reg_db),
-                                        il.Const(WORD, 0xFFFF))))));
-
-      cond_hword0 = il.CompareEqual(WORD, il.Register(WORD, LLIL_TEMP(0)),
-                                    il.Const(WORD, 1));
-      cond_hword1 = il.CompareEqual(WORD, il.Register(WORD, LLIL_TEMP(1)),
-                                    il.Const(WORD, 1));
-
-      // Set byte to false case
-      il.AddInstruction(
-          il.SetRegister(WORD, LLIL_TEMP(4), il.Register(WORD, reg_db)));
-
-      il.AddInstruction(il.If(cond_hword0, trueLabel0, falseLabel0));
-      il.MarkLabel(trueLabel0);
-      // Clear byte
-      il.AddInstruction(
-          il.SetRegister(WORD, LLIL_TEMP(4),
-                         il.And(WORD, il.Register(WORD, LLIL_TEMP(4)),
-                                il.Const(WORD, 0xFFFF0000))));
-      // Set byte to true case
-      il.AddInstruction(
-          il.SetRegister(WORD, LLIL_TEMP(4),
-                         il.Or(WORD, il.Register(WORD, LLIL_TEMP(4)),
-                               il.And(WORD, il.Register(WORD, reg_da),
-                                      il.Const(WORD, 0xFFFF)))));
-      il.AddInstruction(il.Goto(falseLabel0));
-
-      il.MarkLabel(falseLabel0);
-      il.AddInstruction(il.If(cond_hword1, trueLabel1, doneLabel));
-      il.MarkLabel(trueLabel1);
-      // Clear byte
-      il.AddInstruction(
-          il.SetRegister(WORD, LLIL_TEMP(4),
-                         il.And(WORD, il.Register(WORD, LLIL_TEMP(4)),
-                                il.Const(WORD, 0x0000FFFF))));
-      // Set byte to true case
-      il.AddInstruction(
-          il.SetRegister(WORD, LLIL_TEMP(4),
-                         il.Or(WORD, il.Register(WORD, LLIL_TEMP(4)),
-                               il.And(WORD, il.Register(WORD, reg_da),
-                                      il.Const(WORD, 0xFFFF0000)))));
-      il.AddInstruction(il.Goto(doneLabel));
-
-      il.MarkLabel(doneLabel);
-      il.AddInstruction(
-          il.SetRegister(WORD, reg_dc, il.Register(WORD, LLIL_TEMP(4))));
+      PackedTo(reg_dc, PackedOp::MaxHu,
+               {il.Register(WORD, reg_da), il.Register(WORD, reg_db)},
+               Maxh::flags, il);
       return true;
     }
     default:
-      LogDebug("0x%lx: Maxh::%s received invalid opcode 2 0x%x", addr, __func__,
-               op2);
+      TRICORE_LOG_REJECT("0x%lx: Maxh::%s received invalid opcode 2 0x%x", addr,
+                         __func__, op2);
       return false;
   }
 }
@@ -7752,8 +7797,8 @@ bool Maxh::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Mfcr::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                 size_t& len, LowLevelILFunction& il) {
   if (op1 != MFCR_DC_CONST16) {
-    LogDebug("0x%lx: Mfcr::%s received invalid opcode 1 0x%x", addr, __func__,
-             op1);
+    TRICORE_LOG_REJECT("0x%lx: Mfcr::%s received invalid opcode 1 0x%x", addr,
+                       __func__, op1);
     return false;
   }
   {
@@ -7772,7 +7817,6 @@ bool Mfcr::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Min::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                size_t& len, LowLevelILFunction& il) {
   ExprId condition;
-  LowLevelILLabel trueLabel, falseLabel, doneLabel;
   switch (op1) {
     case OP1_x8B_RC:
       switch (op2) {
@@ -7785,19 +7829,8 @@ bool Min::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           condition = il.CompareSignedLessThan(
               WORD, il.Register(WORD, reg_da),
               il.SignExtend(WORD, il.Const(HWORD, const9)));
-          il.AddInstruction(il.If(condition, trueLabel, falseLabel));
-
-          il.MarkLabel(trueLabel);
-          il.AddInstruction(
-              il.SetRegister(WORD, reg_dc, il.Register(WORD, reg_da)));
-          il.AddInstruction(il.Goto(doneLabel));
-
-          il.MarkLabel(falseLabel);
-          il.AddInstruction(il.SetRegister(
-              WORD, reg_dc, il.SignExtend(WORD, il.Const(HWORD, const9))));
-          il.AddInstruction(il.Goto(doneLabel));
-
-          il.MarkLabel(doneLabel);
+          SelectTo(reg_dc, condition, il.Register(WORD, reg_da),
+                   il.SignExtend(WORD, il.Const(HWORD, const9)), il, WORD);
           return true;
         }
         case MINU_DC_DA_CONST9: {
@@ -7809,24 +7842,13 @@ bool Min::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           condition = il.CompareUnsignedLessThan(
               WORD, il.Register(WORD, reg_da),
               il.ZeroExtend(WORD, il.Const(HWORD, const9)));
-          il.AddInstruction(il.If(condition, trueLabel, falseLabel));
-
-          il.MarkLabel(trueLabel);
-          il.AddInstruction(
-              il.SetRegister(WORD, reg_dc, il.Register(WORD, reg_da)));
-          il.AddInstruction(il.Goto(doneLabel));
-
-          il.MarkLabel(falseLabel);
-          il.AddInstruction(il.SetRegister(
-              WORD, reg_dc, il.ZeroExtend(WORD, il.Const(HWORD, const9))));
-          il.AddInstruction(il.Goto(doneLabel));
-
-          il.MarkLabel(doneLabel);
+          SelectTo(reg_dc, condition, il.Register(WORD, reg_da),
+                   il.ZeroExtend(WORD, il.Const(HWORD, const9)), il, WORD);
           return true;
         }
         default:
-          LogDebug("0x%lx: Min::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Min::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x0B_RR:
@@ -7838,19 +7860,8 @@ bool Min::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                                          reg_dc);
           condition = il.CompareSignedLessThan(WORD, il.Register(WORD, reg_da),
                                                il.Register(WORD, reg_db));
-          il.AddInstruction(il.If(condition, trueLabel, falseLabel));
-
-          il.MarkLabel(trueLabel);
-          il.AddInstruction(
-              il.SetRegister(WORD, reg_dc, il.Register(WORD, reg_da)));
-          il.AddInstruction(il.Goto(doneLabel));
-
-          il.MarkLabel(falseLabel);
-          il.AddInstruction(
-              il.SetRegister(WORD, reg_dc, il.Register(WORD, reg_db)));
-          il.AddInstruction(il.Goto(doneLabel));
-
-          il.MarkLabel(doneLabel);
+          SelectTo(reg_dc, condition, il.Register(WORD, reg_da),
+                   il.Register(WORD, reg_db), il, WORD);
           return true;
         }
         case MINU_DC_DA_DB: {
@@ -7860,29 +7871,18 @@ bool Min::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                                          reg_dc);
           condition = il.CompareUnsignedLessThan(
               WORD, il.Register(WORD, reg_da), il.Register(WORD, reg_db));
-          il.AddInstruction(il.If(condition, trueLabel, falseLabel));
-
-          il.MarkLabel(trueLabel);
-          il.AddInstruction(
-              il.SetRegister(WORD, reg_dc, il.Register(WORD, reg_da)));
-          il.AddInstruction(il.Goto(doneLabel));
-
-          il.MarkLabel(falseLabel);
-          il.AddInstruction(
-              il.SetRegister(WORD, reg_dc, il.Register(WORD, reg_db)));
-          il.AddInstruction(il.Goto(doneLabel));
-
-          il.MarkLabel(doneLabel);
+          SelectTo(reg_dc, condition, il.Register(WORD, reg_da),
+                   il.Register(WORD, reg_db), il, WORD);
           return true;
         }
         default:
-          LogDebug("0x%lx: Min::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Min::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Min::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Min::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -7890,294 +7890,32 @@ bool Min::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Minb::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                 size_t& len, LowLevelILFunction& il) {
   if (op1 != OP1_x0B_RR) {
-    LogDebug("0x%lx: Minb::%s received invalid opcode 1 0x%x", addr, __func__,
-             op1);
+    TRICORE_LOG_REJECT("0x%lx: Minb::%s received invalid opcode 1 0x%x", addr,
+                       __func__, op1);
     return false;
   }
   switch (op2) {
     case MINB_DC_DA_DB: {
-      ExprId cond_byte0, cond_byte1, cond_byte2, cond_byte3;
-      LowLevelILLabel trueLabel0, trueLabel1, trueLabel2, trueLabel3,
-          falseLabel0, falseLabel1, falseLabel2, doneLabel;
       len = 4;
       uint8_t reg_dc, reg_da, reg_db, op1, op2, n;
       Instruction::ExtractOpfieldsRR(data, op1, op2, reg_da, reg_db, n, reg_dc);
-
-      il.AddInstruction(il.SetRegister(
-          WORD, LLIL_TEMP(3),
-          il.BoolToInt(
-              WORD,
-              il.CompareSignedLessThan(
-                  WORD,
-                  il.And(WORD,
-                         il.LogicalShiftRight(WORD, il.Register(WORD, reg_da),
-                                              il.Const(WORD, 24)),
-                         il.Const(WORD, 0xFF)),
-                  il.And(WORD,
-                         il.LogicalShiftRight(WORD, il.Register(WORD, reg_db),
-                                              il.Const(WORD, 24)),
-                         il.Const(WORD, 0xFF))))));
-      il.AddInstruction(il.SetRegister(
-          WORD, LLIL_TEMP(2),
-          il.BoolToInt(
-              WORD,
-              il.CompareSignedLessThan(
-                  WORD,
-                  il.And(WORD,
-                         il.LogicalShiftRight(WORD, il.Register(WORD, reg_da),
-                                              il.Const(WORD, 16)),
-                         il.Const(WORD, 0xFF)),
-                  il.And(WORD,
-                         il.LogicalShiftRight(WORD, il.Register(WORD, reg_db),
-                                              il.Const(WORD, 16)),
-                         il.Const(WORD, 0xFF))))));
-      il.AddInstruction(il.SetRegister(
-          WORD, LLIL_TEMP(1),
-          il.BoolToInt(
-              WORD,
-              il.CompareSignedLessThan(
-                  WORD,
-                  il.And(WORD,
-                         il.LogicalShiftRight(WORD, il.Register(WORD, reg_da),
-                                              il.Const(WORD, 8)),
-                         il.Const(WORD, 0xFF)),
-                  il.And(WORD,
-                         il.LogicalShiftRight(WORD, il.Register(WORD, reg_db),
-                                              il.Const(WORD, 8)),
-                         il.Const(WORD, 0xFF))))));
-      il.AddInstruction(il.SetRegister(
-          WORD, LLIL_TEMP(0),
-          il.BoolToInt(WORD, il.CompareSignedLessThan(
-                                 WORD,
-                                 il.And(WORD, il.Register(WORD, reg_da),
-                                        il.Const(WORD, 0xFF)),
-                                 il.And(WORD, il.Register(WORD, reg_db),
-                                        il.Const(WORD, 0xFF))))));
-
-      cond_byte0 = il.CompareEqual(WORD, il.Register(WORD, LLIL_TEMP(0)),
-                                   il.Const(WORD, 1));
-      cond_byte1 = il.CompareEqual(WORD, il.Register(WORD, LLIL_TEMP(1)),
-                                   il.Const(WORD, 1));
-      cond_byte2 = il.CompareEqual(WORD, il.Register(WORD, LLIL_TEMP(2)),
-                                   il.Const(WORD, 1));
-      cond_byte3 = il.CompareEqual(WORD, il.Register(WORD, LLIL_TEMP(3)),
-                                   il.Const(WORD, 1));
-
-      // Set to false case
-      il.AddInstruction(
-          il.SetRegister(WORD, LLIL_TEMP(4), il.Register(WORD, reg_db)));
-
-      il.AddInstruction(il.If(cond_byte0, trueLabel0, falseLabel0));
-      il.MarkLabel(trueLabel0);
-      // Clear byte
-      il.AddInstruction(
-          il.SetRegister(WORD, LLIL_TEMP(4),
-                         il.And(WORD, il.Register(WORD, LLIL_TEMP(4)),
-                                il.Const(WORD, 0xFFFFFF00))));
-      // Set byte to true case
-      il.AddInstruction(il.SetRegister(
-          WORD, LLIL_TEMP(4),
-          il.Or(
-              WORD, il.Register(WORD, LLIL_TEMP(4)),
-              il.And(WORD, il.Register(WORD, reg_da), il.Const(WORD, 0xFF)))));
-      il.AddInstruction(il.Goto(falseLabel0));
-
-      il.MarkLabel(falseLabel0);
-      il.AddInstruction(il.If(cond_byte1, trueLabel1, falseLabel1));
-      il.MarkLabel(trueLabel1);
-      // Clear byte
-      il.AddInstruction(
-          il.SetRegister(WORD, LLIL_TEMP(4),
-                         il.And(WORD, il.Register(WORD, LLIL_TEMP(4)),
-                                il.Const(WORD, 0xFFFF00FF))));
-      // Set byte to true case
-      il.AddInstruction(
-          il.SetRegister(WORD, LLIL_TEMP(4),
-                         il.Or(WORD, il.Register(WORD, LLIL_TEMP(4)),
-                               il.And(WORD, il.Register(WORD, reg_da),
-                                      il.Const(WORD, 0xFF00)))));
-      il.AddInstruction(il.Goto(falseLabel1));
-
-      il.MarkLabel(falseLabel1);
-      il.AddInstruction(il.If(cond_byte2, trueLabel2, falseLabel2));
-      il.MarkLabel(trueLabel2);
-      // Clear byte
-      il.AddInstruction(
-          il.SetRegister(WORD, LLIL_TEMP(4),
-                         il.And(WORD, il.Register(WORD, LLIL_TEMP(4)),
-                                il.Const(WORD, 0xFF00FFFF))));
-      // Set byte to true case
-      il.AddInstruction(
-          il.SetRegister(WORD, LLIL_TEMP(4),
-                         il.Or(WORD, il.Register(WORD, LLIL_TEMP(4)),
-                               il.And(WORD, il.Register(WORD, reg_da),
-                                      il.Const(WORD, 0xFF0000)))));
-      il.AddInstruction(il.Goto(falseLabel2));
-
-      il.MarkLabel(falseLabel2);
-      il.AddInstruction(il.If(cond_byte3, trueLabel3, doneLabel));
-      il.MarkLabel(trueLabel3);
-      // Clear byte
-      il.AddInstruction(
-          il.SetRegister(WORD, LLIL_TEMP(4),
-                         il.And(WORD, il.Register(WORD, LLIL_TEMP(4)),
-                                il.Const(WORD, 0x00FFFFFF))));
-      // Set byte to true case
-      il.AddInstruction(
-          il.SetRegister(WORD, LLIL_TEMP(4),
-                         il.Or(WORD, il.Register(WORD, LLIL_TEMP(4)),
-                               il.And(WORD, il.Register(WORD, reg_da),
-                                      il.Const(WORD, 0xFF000000)))));
-      il.AddInstruction(il.Goto(doneLabel));
-
-      il.MarkLabel(doneLabel);
-      il.AddInstruction(
-          il.SetRegister(WORD, reg_dc, il.Register(WORD, LLIL_TEMP(4))));
+      PackedTo(reg_dc, PackedOp::MinB,
+               {il.Register(WORD, reg_da), il.Register(WORD, reg_db)},
+               Minb::flags, il);
       return true;
     }
     case MINBU_DC_DA_DB: {
-      ExprId cond_byte0, cond_byte1, cond_byte2, cond_byte3;
-      LowLevelILLabel trueLabel0, trueLabel1, trueLabel2, trueLabel3,
-          falseLabel0, falseLabel1, falseLabel2, doneLabel;
       len = 4;
       uint8_t reg_dc, reg_da, reg_db, op1, op2, n;
       Instruction::ExtractOpfieldsRR(data, op1, op2, reg_da, reg_db, n, reg_dc);
-
-      il.AddInstruction(il.SetRegister(
-          WORD, LLIL_TEMP(3),
-          il.BoolToInt(
-              WORD,
-              il.CompareUnsignedLessThan(
-                  WORD,
-                  il.And(WORD,
-                         il.LogicalShiftRight(WORD, il.Register(WORD, reg_da),
-                                              il.Const(WORD, 24)),
-                         il.Const(WORD, 0xFF)),
-                  il.And(WORD,
-                         il.LogicalShiftRight(WORD, il.Register(WORD, reg_db),
-                                              il.Const(WORD, 24)),
-                         il.Const(WORD, 0xFF))))));
-      il.AddInstruction(il.SetRegister(
-          WORD, LLIL_TEMP(2),
-          il.BoolToInt(
-              WORD,
-              il.CompareUnsignedLessThan(
-                  WORD,
-                  il.And(WORD,
-                         il.LogicalShiftRight(WORD, il.Register(WORD, reg_da),
-                                              il.Const(WORD, 16)),
-                         il.Const(WORD, 0xFF)),
-                  il.And(WORD,
-                         il.LogicalShiftRight(WORD, il.Register(WORD, reg_db),
-                                              il.Const(WORD, 16)),
-                         il.Const(WORD, 0xFF))))));
-      il.AddInstruction(il.SetRegister(
-          WORD, LLIL_TEMP(1),
-          il.BoolToInt(
-              WORD,
-              il.CompareUnsignedLessThan(
-                  WORD,
-                  il.And(WORD,
-                         il.LogicalShiftRight(WORD, il.Register(WORD, reg_da),
-                                              il.Const(WORD, 8)),
-                         il.Const(WORD, 0xFF)),
-                  il.And(WORD,
-                         il.LogicalShiftRight(WORD, il.Register(WORD, reg_db),
-                                              il.Const(WORD, 8)),
-                         il.Const(WORD, 0xFF))))));
-      il.AddInstruction(il.SetRegister(
-          WORD, LLIL_TEMP(0),
-          il.BoolToInt(WORD, il.CompareUnsignedLessThan(
-                                 WORD,
-                                 il.And(WORD, il.Register(WORD, reg_da),
-                                        il.Const(WORD, 0xFF)),
-                                 il.And(WORD, il.Register(WORD, reg_db),
-                                        il.Const(WORD, 0xFF))))));
-
-      cond_byte0 = il.CompareEqual(WORD, il.Register(WORD, LLIL_TEMP(0)),
-                                   il.Const(WORD, 1));
-      cond_byte1 = il.CompareEqual(WORD, il.Register(WORD, LLIL_TEMP(1)),
-                                   il.Const(WORD, 1));
-      cond_byte2 = il.CompareEqual(WORD, il.Register(WORD, LLIL_TEMP(2)),
-                                   il.Const(WORD, 1));
-      cond_byte3 = il.CompareEqual(WORD, il.Register(WORD, LLIL_TEMP(3)),
-                                   il.Const(WORD, 1));
-
-      // Set to false case
-      il.AddInstruction(
-          il.SetRegister(WORD, LLIL_TEMP(4), il.Register(WORD, reg_db)));
-
-      il.AddInstruction(il.If(cond_byte0, trueLabel0, falseLabel0));
-      il.MarkLabel(trueLabel0);
-      // Clear byte
-      il.AddInstruction(
-          il.SetRegister(WORD, LLIL_TEMP(4),
-                         il.And(WORD, il.Register(WORD, LLIL_TEMP(4)),
-                                il.Const(WORD, 0xFFFFFF00))));
-      // Set byte to true case
-      il.AddInstruction(il.SetRegister(
-          WORD, LLIL_TEMP(4),
-          il.Or(
-              WORD, il.Register(WORD, LLIL_TEMP(4)),
-              il.And(WORD, il.Register(WORD, reg_da), il.Const(WORD, 0xFF)))));
-      il.AddInstruction(il.Goto(falseLabel0));
-
-      il.MarkLabel(falseLabel0);
-      il.AddInstruction(il.If(cond_byte1, trueLabel1, falseLabel1));
-      il.MarkLabel(trueLabel1);
-      // Clear byte
-      il.AddInstruction(
-          il.SetRegister(WORD, LLIL_TEMP(4),
-                         il.And(WORD, il.Register(WORD, LLIL_TEMP(4)),
-                                il.Const(WORD, 0xFFFF00FF))));
-      // Set byte to true case
-      il.AddInstruction(
-          il.SetRegister(WORD, LLIL_TEMP(4),
-                         il.Or(WORD, il.Register(WORD, LLIL_TEMP(4)),
-                               il.And(WORD, il.Register(WORD, reg_da),
-                                      il.Const(WORD, 0xFF00)))));
-      il.AddInstruction(il.Goto(falseLabel1));
-
-      il.MarkLabel(falseLabel1);
-      il.AddInstruction(il.If(cond_byte2, trueLabel2, falseLabel2));
-      il.MarkLabel(trueLabel2);
-      // Clear byte
-      il.AddInstruction(
-          il.SetRegister(WORD, LLIL_TEMP(4),
-                         il.And(WORD, il.Register(WORD, LLIL_TEMP(4)),
-                                il.Const(WORD, 0xFF00FFFF))));
-      // Set byte to true case
-      il.AddInstruction(
-          il.SetRegister(WORD, LLIL_TEMP(4),
-                         il.Or(WORD, il.Register(WORD, LLIL_TEMP(4)),
-                               il.And(WORD, il.Register(WORD, reg_da),
-                                      il.Const(WORD, 0xFF0000)))));
-      il.AddInstruction(il.Goto(falseLabel2));
-
-      il.MarkLabel(falseLabel2);
-      il.AddInstruction(il.If(cond_byte3, trueLabel3, doneLabel));
-      il.MarkLabel(trueLabel3);
-      // Clear byte
-      il.AddInstruction(
-          il.SetRegister(WORD, LLIL_TEMP(4),
-                         il.And(WORD, il.Register(WORD, LLIL_TEMP(4)),
-                                il.Const(WORD, 0x00FFFFFF))));
-      // Set byte to true case
-      il.AddInstruction(
-          il.SetRegister(WORD, LLIL_TEMP(4),
-                         il.Or(WORD, il.Register(WORD, LLIL_TEMP(4)),
-                               il.And(WORD, il.Register(WORD, reg_da),
-                                      il.Const(WORD, 0xFF000000)))));
-      il.AddInstruction(il.Goto(doneLabel));
-
-      il.MarkLabel(doneLabel);
-      il.AddInstruction(
-          il.SetRegister(WORD, reg_dc, il.Register(WORD, LLIL_TEMP(4))));
+      PackedTo(reg_dc, PackedOp::MinBu,
+               {il.Register(WORD, reg_da), il.Register(WORD, reg_db)},
+               Minb::flags, il);
       return true;
     }
     default:
-      LogDebug("0x%lx: Minb::%s received invalid opcode 2 0x%x", addr, __func__,
-               op2);
+      TRICORE_LOG_REJECT("0x%lx: Minb::%s received invalid opcode 2 0x%x", addr,
+                         __func__, op2);
       return false;
   }
 }
@@ -8185,166 +7923,32 @@ bool Minb::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Minh::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                 size_t& len, LowLevelILFunction& il) {
   if (op1 != OP1_x0B_RR) {
-    LogDebug("0x%lx: Minh::%s received invalid opcode 1 0x%x", addr, __func__,
-             op1);
+    TRICORE_LOG_REJECT("0x%lx: Minh::%s received invalid opcode 1 0x%x", addr,
+                       __func__, op1);
     return false;
   }
   switch (op2) {
     case MINH_DC_DA_DB: {
-      ExprId cond_hword0, cond_hword1;
-      LowLevelILLabel trueLabel0, trueLabel1, trueLabel2, trueLabel3,
-          falseLabel0, falseLabel1, falseLabel2, doneLabel;
       len = 4;
       uint8_t reg_dc, reg_da, reg_db, op1, op2, n;
       Instruction::ExtractOpfieldsRR(data, op1, op2, reg_da, reg_db, n, reg_dc);
-
-      il.AddInstruction(il.SetRegister(
-          WORD, LLIL_TEMP(1),
-          il.BoolToInt(
-              WORD,
-              il.CompareSignedLessThan(
-                  WORD,
-                  il.And(WORD,
-                         il.LogicalShiftRight(WORD, il.Register(WORD, reg_da),
-                                              il.Const(WORD, 16)),
-                         il.Const(WORD, 0xFFFF)),
-                  il.And(WORD,
-                         il.LogicalShiftRight(WORD, il.Register(WORD, reg_db),
-                                              il.Const(WORD, 16)),
-                         il.Const(WORD, 0xFFFF))))));
-      il.AddInstruction(il.SetRegister(
-          WORD, LLIL_TEMP(0),
-          il.BoolToInt(WORD, il.CompareSignedLessThan(
-                                 WORD,
-                                 il.And(WORD, il.Register(WORD, reg_da),
-                                        il.Const(WORD, 0xFFFF)),
-                                 il.And(WORD, il.Register(WORD, reg_db),
-                                        il.Const(WORD, 0xFFFF))))));
-
-      cond_hword0 = il.CompareEqual(WORD, il.Register(WORD, LLIL_TEMP(0)),
-                                    il.Const(WORD, 1));
-      cond_hword1 = il.CompareEqual(WORD, il.Register(WORD, LLIL_TEMP(1)),
-                                    il.Const(WORD, 1));
-
-      // Set byte to false case
-      il.AddInstruction(
-          il.SetRegister(WORD, LLIL_TEMP(4), il.Register(WORD, reg_db)));
-
-      il.AddInstruction(il.If(cond_hword0, trueLabel0, falseLabel0));
-      il.MarkLabel(trueLabel0);
-      // Clear byte
-      il.AddInstruction(
-          il.SetRegister(WORD, LLIL_TEMP(4),
-                         il.And(WORD, il.Register(WORD, LLIL_TEMP(4)),
-                                il.Const(WORD, 0xFFFF0000))));
-      // Set byte to true case
-      il.AddInstruction(
-          il.SetRegister(WORD, LLIL_TEMP(4),
-                         il.Or(WORD, il.Register(WORD, LLIL_TEMP(4)),
-                               il.And(WORD, il.Register(WORD, reg_da),
-                                      il.Const(WORD, 0xFFFF)))));
-      il.AddInstruction(il.Goto(falseLabel0));
-
-      il.MarkLabel(falseLabel0);
-      il.AddInstruction(il.If(cond_hword1, trueLabel1, doneLabel));
-      il.MarkLabel(trueLabel1);
-      // Clear byte
-      il.AddInstruction(
-          il.SetRegister(WORD, LLIL_TEMP(4),
-                         il.And(WORD, il.Register(WORD, LLIL_TEMP(4)),
-                                il.Const(WORD, 0x0000FFFF))));
-      // Set byte to true case
-      il.AddInstruction(
-          il.SetRegister(WORD, LLIL_TEMP(4),
-                         il.Or(WORD, il.Register(WORD, LLIL_TEMP(4)),
-                               il.And(WORD, il.Register(WORD, reg_da),
-                                      il.Const(WORD, 0xFFFF0000)))));
-      il.AddInstruction(il.Goto(doneLabel));
-
-      il.MarkLabel(doneLabel);
-      il.AddInstruction(
-          il.SetRegister(WORD, reg_dc, il.Register(WORD, LLIL_TEMP(4))));
+      PackedTo(reg_dc, PackedOp::MinH,
+               {il.Register(WORD, reg_da), il.Register(WORD, reg_db)},
+               Minh::flags, il);
       return true;
     }
     case MINHU_DC_DA_DB: {
-      ExprId cond_hword0, cond_hword1;
-      LowLevelILLabel trueLabel0, trueLabel1, trueLabel2, trueLabel3,
-          falseLabel0, falseLabel1, falseLabel2, doneLabel;
-      len = 4;
-      uint8_t reg_dc, reg_da, reg_db, op1, op2, n;
-      Instruction::ExtractOpfieldsRR(data, op1, op2, reg_da, reg_db, n, reg_dc);
-
-      il.AddInstruction(il.SetRegister(
-          WORD, LLIL_TEMP(1),
-          il.BoolToInt(
-              WORD,
-              il.CompareUnsignedLessThan(
-                  WORD,
-                  il.And(WORD,
-                         il.LogicalShiftRight(WORD, il.Register(WORD, reg_da),
-                                              il.Const(WORD, 16)),
-                         il.Const(WORD, 0xFFFF)),
-                  il.And(WORD,
-                         il.LogicalShiftRight(WORD, il.Register(WORD, reg_db),
-                                              il.Const(WORD, 16)),
-                         il.Const(WORD, 0xFFFF))))));
-      il.AddInstruction(il.SetRegister(
-          WORD, LLIL_TEMP(0),
-          il.BoolToInt(WORD, il.CompareUnsignedLessThan(
-                                 WORD,
-                                 il.And(WORD, il.Register(WORD, reg_da),
-                                        il.Const(WORD, 0xFFFF)),
-                                 il.And(WORD, il.Register(WORD, reg_db),
-                                        il.Const(WORD, 0xFFFF))))));
-
-      cond_hword0 = il.CompareEqual(WORD, il.Register(WORD, LLIL_TEMP(0)),
-                                    il.Const(WORD, 1));
-      cond_hword1 = il.CompareEqual(WORD, il.Register(WORD, LLIL_TEMP(1)),
-                                    il.Const(WORD, 1));
-
-      // Set byte to false case
-      il.AddInstruction(
-          il.SetRegister(WORD, LLIL_TEMP(4), il.Register(WORD, reg_db)));
-
-      il.AddInstruction(il.If(cond_hword0, trueLabel0, falseLabel0));
-      il.MarkLabel(trueLabel0);
-      // Clear byte
-      il.AddInstruction(
-          il.SetRegister(WORD, LLIL_TEMP(4),
-                         il.And(WORD, il.Register(WORD, LLIL_TEMP(4)),
-                                il.Const(WORD, 0xFFFF0000))));
-      // Set byte to true case
-      il.AddInstruction(
-          il.SetRegister(WORD, LLIL_TEMP(4),
-                         il.Or(WORD, il.Register(WORD, LLIL_TEMP(4)),
-                               il.And(WORD, il.Register(WORD, reg_da),
-                                      il.Const(WORD, 0xFFFF)))));
-      il.AddInstruction(il.Goto(falseLabel0));
-
-      il.MarkLabel(falseLabel0);
-      il.AddInstruction(il.If(cond_hword1, trueLabel1, doneLabel));
-      il.MarkLabel(trueLabel1);
-      // Clear byte
-      il.AddInstruction(
-          il.SetRegister(WORD, LLIL_TEMP(4),
-                         il.And(WORD, il.Register(WORD, LLIL_TEMP(4)),
-                                il.Const(WORD, 0x0000FFFF))));
-      // Set byte to true case
-      il.AddInstruction(
-          il.SetRegister(WORD, LLIL_TEMP(4),
-                         il.Or(WORD, il.Register(WORD, LLIL_TEMP(4)),
-                               il.And(WORD, il.Register(WORD, reg_da),
-                                      il.Const(WORD, 0xFFFF0000)))));
-      il.AddInstruction(il.Goto(doneLabel));
-
-      il.MarkLabel(doneLabel);
-      il.AddInstruction(
-          il.SetRegister(WORD, reg_dc, il.Register(WORD, LLIL_TEMP(4))));
+      len = 4;
+      uint8_t reg_dc, reg_da, reg_db, op1, op2, n;
+      Instruction::ExtractOpfieldsRR(data, op1, op2, reg_da, reg_db, n, reg_dc);
+      PackedTo(reg_dc, PackedOp::MinHu,
+               {il.Register(WORD, reg_da), il.Register(WORD, reg_db)},
+               Minh::flags, il);
       return true;
     }
     default:
-      LogDebug("0x%lx: Minh::%s received invalid opcode 2 0x%x", addr, __func__,
-               op2);
+      TRICORE_LOG_REJECT("0x%lx: Minh::%s received invalid opcode 2 0x%x", addr,
+                         __func__, op2);
       return false;
   }
 }
@@ -8437,13 +8041,13 @@ bool Mov::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           UNIMPLEMENTED(*((const uint16_t*)data) & 0x1 ? 4 : 2)
         }
         default:
-          LogDebug("0x%lx: Mov::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Mov::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Mov::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Mov::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -8483,13 +8087,13 @@ bool Mova::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return true;
         }
         default:
-          LogDebug("0x%lx: Mova::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Mova::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Mova::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Mova::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -8520,13 +8124,13 @@ bool Movaa::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return true;
         }
         default:
-          LogDebug("0x%lx: Movaa::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Movaa::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Movaa::%s received invalid opcode 1 0x%x", addr,
-               __func__, op1);
+      TRICORE_LOG_REJECT("0x%lx: Movaa::%s received invalid opcode 1 0x%x",
+                         addr, __func__, op1);
       return false;
   }
 }
@@ -8555,13 +8159,13 @@ bool Movd::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return true;
         }
         default:
-          LogDebug("0x%lx: Movd::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Movd::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Movd::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Movd::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -8569,8 +8173,8 @@ bool Movd::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Movu::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                 size_t& len, LowLevelILFunction& il) {
   if (op1 != MOVU_DC_CONST16) {
-    LogDebug("0x%lx: Movu::%s received invalid opcode 1 0x%x", addr, __func__,
-             op1);
+    TRICORE_LOG_REJECT("0x%lx: Movu::%s received invalid opcode 1 0x%x", addr,
+                       __func__, op1);
     return false;
   }
   {  // new scope because op1 exists as a parameter to this function
@@ -8587,8 +8191,8 @@ bool Movu::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Movh::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                 size_t& len, LowLevelILFunction& il) {
   if (op1 != MOVH_DC_CONST16) {
-    LogDebug("0x%lx: Movh::%s received invalid opcode 1 0x%x", addr, __func__,
-             op1);
+    TRICORE_LOG_REJECT("0x%lx: Movh::%s received invalid opcode 1 0x%x", addr,
+                       __func__, op1);
     return false;
   }
   {  // new scope because op1 exists as a parameter to this function
@@ -8609,8 +8213,8 @@ bool Movh::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Movha::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                  size_t& len, LowLevelILFunction& il) {
   if (op1 != MOVHA_AC_CONST16) {
-    LogDebug("0x%lx: Movha::%s received invalid opcode 1 0x%x", addr, __func__,
-             op1);
+    TRICORE_LOG_REJECT("0x%lx: Movha::%s received invalid opcode 1 0x%x", addr,
+                       __func__, op1);
     return false;
   }
   {  // new scope because op1 exists as a parameter to this function
@@ -8676,8 +8280,7 @@ bool Msub::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                      il.MultDoublePrecSigned(
                          WORD, il.Register(WORD, reg_da),
                          il.SignExtend(WORD, il.Const(HWORD, const9))))));
-          ssov(il.Register(WORD, LLIL_TEMP(0)), il.Const(WORD, 32),
-               LLIL_TEMP(1), il, WORD);
+          ssov(il.Register(WORD, LLIL_TEMP(0)), 32, LLIL_TEMP(1), il, WORD);
           il.AddInstruction(
               il.SetRegister(WORD, reg_dc, il.Register(WORD, LLIL_TEMP(1))));
           return true;
@@ -8696,15 +8299,14 @@ bool Msub::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                      il.MultDoublePrecSigned(
                          DWORD, il.Register(WORD, reg_da),
                          il.SignExtend(WORD, il.Const(HWORD, const9))))));
-          ssov(il.Register(DWORD, LLIL_TEMP(0)), il.Const(WORD, 64),
-               LLIL_TEMP(1), il, DWORD);
+          ssov(il.Register(DWORD, LLIL_TEMP(0)), 64, LLIL_TEMP(1), il, DWORD);
           il.AddInstruction(
               il.SetRegister(DWORD, reg_ec, il.Register(DWORD, LLIL_TEMP(1))));
           return true;
         }
         default:
-          LogDebug("0x%lx: Msub::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Msub::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x23_RRR2:
@@ -8745,13 +8347,455 @@ bool Msub::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
               il.Sub(WORD, il.Register(WORD, reg_dd),
                      il.MultDoublePrecSigned(WORD, il.Register(WORD, reg_da),
                                              il.Register(WORD, reg_db)))));
-          ssov(il.Register(WORD, LLIL_TEMP(0)), il.Const(WORD, 32),
-               LLIL_TEMP(1), il, WORD);
+          ssov(il.Register(WORD, LLIL_TEMP(0)), 32, LLIL_TEMP(1), il, WORD);
+          il.AddInstruction(
+              il.SetRegister(WORD, reg_dc, il.Register(WORD, LLIL_TEMP(1))));
+          return true;
+        }
+        case MSUBS_EC_ED_DA_DB: {
+          len = 4;
+          uint8_t op1, op2, reg_da, reg_db, reg_ed, reg_ec;
+          Instruction::ExtractOpfieldsRRR2(data, op1, op2, reg_da, reg_db,
+                                           reg_ed, reg_ec);
+          REGTOE(reg_ed)
+          REGTOE(reg_ec)
+          il.AddInstruction(il.SetRegister(
+              DWORD, LLIL_TEMP(0),
+              il.Sub(DWORD, il.Register(DWORD, reg_ed),
+                     il.MultDoublePrecSigned(DWORD, il.Register(WORD, reg_da),
+                                             il.Register(WORD, reg_db)))));
+          ssov(il.Register(DWORD, LLIL_TEMP(0)), 64, LLIL_TEMP(1), il, DWORD);
+          il.AddInstruction(
+              il.SetRegister(DWORD, reg_ec, il.Register(DWORD, LLIL_TEMP(1))));
+          return true;
+        }
+        default:
+          TRICORE_LOG_REJECT("0x%lx: Msub::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
+          return false;
+      }
+    default:
+      TRICORE_LOG_REJECT("0x%lx: Msub::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
+      return false;
+  }
+}
+
+bool Msubh::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
+                 size_t& len, LowLevelILFunction& il) {
+  if (op1 != OP1_xA3_RRR1) {
+    TRICORE_LOG_REJECT("0x%lx: Msubh::%s received invalid opcode 1 0x%x", addr,
+                       __func__, op1);
+    return false;
+  }
+  switch (op2) {
+    case MSUBH_EC_ED_DA_DBLL_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_ed, reg_ec;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_ed, reg_ec);
+      REGTOE(reg_ed)
+      REGTOE(reg_ec)
+      MacPairTo(reg_ec, reg_ed, reg_da, reg_db, HalfwordPair::LL, n,
+                PairMac::Sub, false, il);
+      return true;
+    }
+    case MSUBH_EC_ED_DA_DBLU_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_ed, reg_ec;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_ed, reg_ec);
+      REGTOE(reg_ed)
+      REGTOE(reg_ec)
+      MacPairTo(reg_ec, reg_ed, reg_da, reg_db, HalfwordPair::LU, n,
+                PairMac::Sub, false, il);
+      return true;
+    }
+    case MSUBH_EC_ED_DA_DBUL_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_ed, reg_ec;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_ed, reg_ec);
+      REGTOE(reg_ed)
+      REGTOE(reg_ec)
+      MacPairTo(reg_ec, reg_ed, reg_da, reg_db, HalfwordPair::UL, n,
+                PairMac::Sub, false, il);
+      return true;
+    }
+    case MSUBH_EC_ED_DA_DBUU_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_ed, reg_ec;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_ed, reg_ec);
+      REGTOE(reg_ed)
+      REGTOE(reg_ec)
+      MacPairTo(reg_ec, reg_ed, reg_da, reg_db, HalfwordPair::UU, n,
+                PairMac::Sub, false, il);
+      return true;
+    }
+    case MSUBSH_EC_ED_DA_DBLL_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_ed, reg_ec;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_ed, reg_ec);
+      REGTOE(reg_ed)
+      REGTOE(reg_ec)
+      MacPairTo(reg_ec, reg_ed, reg_da, reg_db, HalfwordPair::LL, n,
+                PairMac::Sub, true, il);
+      return true;
+    }
+    case MSUBSH_EC_ED_DA_DBLU_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_ed, reg_ec;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_ed, reg_ec);
+      REGTOE(reg_ed)
+      REGTOE(reg_ec)
+      MacPairTo(reg_ec, reg_ed, reg_da, reg_db, HalfwordPair::LU, n,
+                PairMac::Sub, true, il);
+      return true;
+    }
+    case MSUBSH_EC_ED_DA_DBUL_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_ed, reg_ec;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_ed, reg_ec);
+      REGTOE(reg_ed)
+      REGTOE(reg_ec)
+      MacPairTo(reg_ec, reg_ed, reg_da, reg_db, HalfwordPair::UL, n,
+                PairMac::Sub, true, il);
+      return true;
+    }
+    case MSUBSH_EC_ED_DA_DBUU_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_ed, reg_ec;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_ed, reg_ec);
+      REGTOE(reg_ed)
+      REGTOE(reg_ec)
+      MacPairTo(reg_ec, reg_ed, reg_da, reg_db, HalfwordPair::UU, n,
+                PairMac::Sub, true, il);
+      return true;
+    }
+    default:
+      TRICORE_LOG_REJECT("0x%lx: Msubh::%s received invalid opcode 2 0x%x",
+                         addr, __func__, op2);
+      return false;
+  }
+}
+
+bool Msubq::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
+                 size_t& len, LowLevelILFunction& il) {
+  if (op1 != OP1_x63_RRR1) {
+    TRICORE_LOG_REJECT("0x%lx: Msubq::%s received invalid opcode 1 0x%x", addr,
+                       __func__, op1);
+    return false;
+  }
+  switch (op2) {
+    case MSUBQ_DC_DD_DA_DB_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_dd, reg_dc;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_dd, reg_dc);
+      MacQTo(reg_dc, il.Register(WORD, reg_dd), reg_da, QOperand::Word, reg_db,
+             QOperand::Word, n, true, false, WORD, il);
+      return true;
+    }
+    case MSUBQ_EC_ED_DA_DB_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_ed, reg_ec;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_ed, reg_ec);
+      REGTOE(reg_ed)
+      REGTOE(reg_ec)
+      MacQTo(reg_ec, il.Register(DWORD, reg_ed), reg_da, QOperand::Word, reg_db,
+             QOperand::Word, n, true, false, DWORD, il);
+      return true;
+    }
+    case MSUBQ_DC_DD_DA_DBL_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_dd, reg_dc;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_dd, reg_dc);
+      MacQTo(reg_dc, il.Register(WORD, reg_dd), reg_da, QOperand::Word, reg_db,
+             QOperand::Lower, n, true, false, WORD, il);
+      return true;
+    }
+    case MSUBQ_EC_ED_DA_DBL_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_ed, reg_ec;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_ed, reg_ec);
+      REGTOE(reg_ed)
+      REGTOE(reg_ec)
+      MacQTo(reg_ec, il.Register(DWORD, reg_ed), reg_da, QOperand::Word, reg_db,
+             QOperand::Lower, n, true, false, DWORD, il);
+      return true;
+    }
+    case MSUBQ_DC_DD_DA_DBU_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_dd, reg_dc;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_dd, reg_dc);
+      MacQTo(reg_dc, il.Register(WORD, reg_dd), reg_da, QOperand::Word, reg_db,
+             QOperand::Upper, n, true, false, WORD, il);
+      return true;
+    }
+    case MSUBQ_EC_ED_DA_DBU_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_ed, reg_ec;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_ed, reg_ec);
+      REGTOE(reg_ed)
+      REGTOE(reg_ec)
+      MacQTo(reg_ec, il.Register(DWORD, reg_ed), reg_da, QOperand::Word, reg_db,
+             QOperand::Upper, n, true, false, DWORD, il);
+      return true;
+    }
+    case MSUBQ_DC_DD_DAL_DBL_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_dd, reg_dc;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_dd, reg_dc);
+      MacQTo(reg_dc, il.Register(WORD, reg_dd), reg_da, QOperand::Lower, reg_db,
+             QOperand::Lower, n, true, false, WORD, il);
+      return true;
+    }
+    case MSUBQ_EC_ED_DAL_DBL_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_ed, reg_ec;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_ed, reg_ec);
+      REGTOE(reg_ed)
+      REGTOE(reg_ec)
+      MacQTo(reg_ec, il.Register(DWORD, reg_ed), reg_da, QOperand::Lower,
+             reg_db, QOperand::Lower, n, true, false, DWORD, il);
+      return true;
+    }
+    case MSUBQ_DC_DD_DAU_DBU_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_dd, reg_dc;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_dd, reg_dc);
+      MacQTo(reg_dc, il.Register(WORD, reg_dd), reg_da, QOperand::Upper, reg_db,
+             QOperand::Upper, n, true, false, WORD, il);
+      return true;
+    }
+    case MSUBQ_EC_ED_DAU_DBU_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_ed, reg_ec;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_ed, reg_ec);
+      REGTOE(reg_ed)
+      REGTOE(reg_ec)
+      MacQTo(reg_ec, il.Register(DWORD, reg_ed), reg_da, QOperand::Upper,
+             reg_db, QOperand::Upper, n, true, false, DWORD, il);
+      return true;
+    }
+    case MSUBSQ_DC_DD_DA_DB_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_dd, reg_dc;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_dd, reg_dc);
+      MacQTo(reg_dc, il.Register(WORD, reg_dd), reg_da, QOperand::Word, reg_db,
+             QOperand::Word, n, true, true, WORD, il);
+      return true;
+    }
+    case MSUBSQ_EC_ED_DA_DB_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_ed, reg_ec;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_ed, reg_ec);
+      REGTOE(reg_ed)
+      REGTOE(reg_ec)
+      MacQTo(reg_ec, il.Register(DWORD, reg_ed), reg_da, QOperand::Word, reg_db,
+             QOperand::Word, n, true, true, DWORD, il);
+      return true;
+    }
+    case MSUBSQ_DC_DD_DA_DBL_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_dd, reg_dc;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_dd, reg_dc);
+      MacQTo(reg_dc, il.Register(WORD, reg_dd), reg_da, QOperand::Word, reg_db,
+             QOperand::Lower, n, true, true, WORD, il);
+      return true;
+    }
+    case MSUBSQ_EC_ED_DA_DBL_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_ed, reg_ec;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_ed, reg_ec);
+      REGTOE(reg_ed)
+      REGTOE(reg_ec)
+      MacQTo(reg_ec, il.Register(DWORD, reg_ed), reg_da, QOperand::Word, reg_db,
+             QOperand::Lower, n, true, true, DWORD, il);
+      return true;
+    }
+    case MSUBSQ_DC_DD_DA_DBU_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_dd, reg_dc;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_dd, reg_dc);
+      MacQTo(reg_dc, il.Register(WORD, reg_dd), reg_da, QOperand::Word, reg_db,
+             QOperand::Upper, n, true, true, WORD, il);
+      return true;
+    }
+    case MSUBSQ_EC_ED_DA_DBU_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_ed, reg_ec;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_ed, reg_ec);
+      REGTOE(reg_ed)
+      REGTOE(reg_ec)
+      MacQTo(reg_ec, il.Register(DWORD, reg_ed), reg_da, QOperand::Word, reg_db,
+             QOperand::Upper, n, true, true, DWORD, il);
+      return true;
+    }
+    case MSUBSQ_DC_DD_DAL_DBL_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_dd, reg_dc;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_dd, reg_dc);
+      MacQTo(reg_dc, il.Register(WORD, reg_dd), reg_da, QOperand::Lower, reg_db,
+             QOperand::Lower, n, true, true, WORD, il);
+      return true;
+    }
+    case MSUBSQ_EC_ED_DAL_DBL_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_ed, reg_ec;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_ed, reg_ec);
+      REGTOE(reg_ed)
+      REGTOE(reg_ec)
+      MacQTo(reg_ec, il.Register(DWORD, reg_ed), reg_da, QOperand::Lower,
+             reg_db, QOperand::Lower, n, true, true, DWORD, il);
+      return true;
+    }
+    case MSUBSQ_DC_DD_DAU_DBU_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_dd, reg_dc;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_dd, reg_dc);
+      MacQTo(reg_dc, il.Register(WORD, reg_dd), reg_da, QOperand::Upper, reg_db,
+             QOperand::Upper, n, true, true, WORD, il);
+      return true;
+    }
+    case MSUBSQ_EC_ED_DAU_DBU_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_ed, reg_ec;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_ed, reg_ec);
+      REGTOE(reg_ed)
+      REGTOE(reg_ec)
+      MacQTo(reg_ec, il.Register(DWORD, reg_ed), reg_da, QOperand::Upper,
+             reg_db, QOperand::Upper, n, true, true, DWORD, il);
+      return true;
+    }
+    default:
+      TRICORE_LOG_REJECT("0x%lx: Msubq::%s received invalid opcode 2 0x%x",
+                         addr, __func__, op2);
+      return false;
+  }
+}
+
+bool Msubu::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
+                 size_t& len, LowLevelILFunction& il) {
+  switch (op1) {
+    case OP1_x33_RCR:
+      switch (op2) {
+        case MSUBU_EC_ED_DA_CONST9: {
+          len = 4;
+          uint8_t op1, op2, reg_da, reg_ed, reg_ec;
+          int16_t const9;
+          Instruction::ExtractOpfieldsRCR(data, op1, op2, reg_da, const9,
+                                          reg_ed, reg_ec);
+          REGTOE(reg_ed)
+          REGTOE(reg_ec)
+          const9 &= 0x1FF;
+          il.AddInstruction(il.SetRegister(
+              DWORD, reg_ec,
+              il.Sub(DWORD, il.Register(DWORD, reg_ed),
+                     il.MultDoublePrecUnsigned(
+                         DWORD, il.Register(WORD, reg_da),
+                         il.ZeroExtend(WORD, il.Const(HWORD, const9))))));
+          return true;
+        }
+        case MSUBSU_DC_DD_DA_CONST9: {
+          len = 4;
+          uint8_t op1, op2, reg_da, reg_dd, reg_dc;
+          int16_t const9;
+          Instruction::ExtractOpfieldsRCR(data, op1, op2, reg_da, const9,
+                                          reg_dd, reg_dc);
+          const9 &= 0x1FF;
+          il.AddInstruction(il.SetRegister(
+              WORD, LLIL_TEMP(0),
+              il.Sub(WORD, il.Register(WORD, reg_dd),
+                     il.MultDoublePrecUnsigned(
+                         WORD, il.Register(WORD, reg_da),
+                         il.ZeroExtend(WORD, il.Const(HWORD, const9))))));
+          suov(il.Register(WORD, LLIL_TEMP(0)), 32, LLIL_TEMP(1), il, WORD);
+          il.AddInstruction(
+              il.SetRegister(WORD, reg_dc, il.Register(WORD, LLIL_TEMP(1))));
+          return true;
+        }
+        case MSUBSU_EC_ED_DA_CONST9: {
+          len = 4;
+          uint8_t op1, op2, reg_da, reg_ed, reg_ec;
+          int16_t const9;
+          Instruction::ExtractOpfieldsRCR(data, op1, op2, reg_da, const9,
+                                          reg_ed, reg_ec);
+          REGTOE(reg_ed)
+          REGTOE(reg_ec)
+          const9 &= 0x1FF;
+          il.AddInstruction(il.SetRegister(
+              DWORD, LLIL_TEMP(0),
+              il.Sub(DWORD, il.Register(DWORD, reg_ed),
+                     il.MultDoublePrecUnsigned(
+                         DWORD, il.Register(WORD, reg_da),
+                         il.ZeroExtend(WORD, il.Const(HWORD, const9))))));
+          suov(il.Register(DWORD, LLIL_TEMP(0)), 64, LLIL_TEMP(1), il, DWORD);
+          il.AddInstruction(
+              il.SetRegister(DWORD, reg_ec, il.Register(DWORD, LLIL_TEMP(1))));
+          return true;
+        }
+        default:
+          TRICORE_LOG_REJECT("0x%lx: Msubu::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
+          return false;
+      }
+    case OP1_x23_RRR2:
+      switch (op2) {
+        case MSUBU_EC_ED_DA_DB: {
+          len = 4;
+          uint8_t op1, op2, reg_da, reg_db, reg_ed, reg_ec;
+          Instruction::ExtractOpfieldsRRR2(data, op1, op2, reg_da, reg_db,
+                                           reg_ed, reg_ec);
+          REGTOE(reg_ed)
+          REGTOE(reg_ec)
+          il.AddInstruction(il.SetRegister(
+              DWORD, reg_ec,
+              il.Sub(DWORD, il.Register(DWORD, reg_ed),
+                     il.MultDoublePrecUnsigned(DWORD, il.Register(WORD, reg_da),
+                                               il.Register(WORD, reg_db)))));
+          return true;
+        }
+        case MSUBSU_DC_DD_DA_DB: {
+          len = 4;
+          uint8_t op1, op2, reg_da, reg_db, reg_dd, reg_dc;
+          Instruction::ExtractOpfieldsRRR2(data, op1, op2, reg_da, reg_db,
+                                           reg_dd, reg_dc);
+          il.AddInstruction(il.SetRegister(
+              WORD, LLIL_TEMP(0),
+              il.Sub(WORD, il.Register(WORD, reg_dd),
+                     il.MultDoublePrecUnsigned(WORD, il.Register(WORD, reg_da),
+                                               il.Register(WORD, reg_db)))));
+          suov(il.Register(WORD, LLIL_TEMP(0)), 32, LLIL_TEMP(1), il, WORD);
           il.AddInstruction(
               il.SetRegister(WORD, reg_dc, il.Register(WORD, LLIL_TEMP(1))));
           return true;
         }
-        case MSUBS_EC_ED_DA_DB: {
+        case MSUBSU_EC_ED_DA_DB: {
           len = 4;
           uint8_t op1, op2, reg_da, reg_db, reg_ed, reg_ec;
           Instruction::ExtractOpfieldsRRR2(data, op1, op2, reg_da, reg_db,
@@ -8761,200 +8805,595 @@ bool Msub::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           il.AddInstruction(il.SetRegister(
               DWORD, LLIL_TEMP(0),
               il.Sub(DWORD, il.Register(DWORD, reg_ed),
-                     il.MultDoublePrecSigned(DWORD, il.Register(WORD, reg_da),
-                                             il.Register(WORD, reg_db)))));
-          ssov(il.Register(DWORD, LLIL_TEMP(0)), il.Const(WORD, 64),
-               LLIL_TEMP(1), il, DWORD);
+                     il.MultDoublePrecUnsigned(DWORD, il.Register(WORD, reg_da),
+                                               il.Register(WORD, reg_db)))));
+          suov(il.Register(DWORD, LLIL_TEMP(0)), 64, LLIL_TEMP(1), il, DWORD);
           il.AddInstruction(
               il.SetRegister(DWORD, reg_ec, il.Register(DWORD, LLIL_TEMP(1))));
           return true;
         }
         default:
-          LogDebug("0x%lx: Msub::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Msubu::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Msub::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Msubu::%s received invalid opcode 1 0x%x",
+                         addr, __func__, op1);
       return false;
   }
 }
 
-bool Msubh::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
-                 size_t& len, LowLevelILFunction& il) {
-  UNIMPLEMENTED(*((const uint16_t*)data) & 0x1 ? 4 : 2)
+bool MsubadhSh::Lift(uint8_t op1, uint8_t op2, const uint8_t* data,
+                     uint64_t addr, size_t& len, LowLevelILFunction& il) {
+  if (op1 != OP1_xE3_RRR1) {
+    TRICORE_LOG_REJECT("0x%lx: MsubadhSh::%s received invalid opcode 1 0x%x",
+                       addr, __func__, op1);
+    return false;
+  }
+  switch (op2) {
+    case MSUBADH_EC_ED_DA_DBLL_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_ed, reg_ec;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_ed, reg_ec);
+      REGTOE(reg_ed)
+      REGTOE(reg_ec)
+      MacPairTo(reg_ec, reg_ed, reg_da, reg_db, HalfwordPair::LL, n,
+                PairMac::SubAdd, false, il);
+      return true;
+    }
+    case MSUBADH_EC_ED_DA_DBLU_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_ed, reg_ec;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_ed, reg_ec);
+      REGTOE(reg_ed)
+      REGTOE(reg_ec)
+      MacPairTo(reg_ec, reg_ed, reg_da, reg_db, HalfwordPair::LU, n,
+                PairMac::SubAdd, false, il);
+      return true;
+    }
+    case MSUBADH_EC_ED_DA_DBUL_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_ed, reg_ec;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_ed, reg_ec);
+      REGTOE(reg_ed)
+      REGTOE(reg_ec)
+      MacPairTo(reg_ec, reg_ed, reg_da, reg_db, HalfwordPair::UL, n,
+                PairMac::SubAdd, false, il);
+      return true;
+    }
+    case MSUBADH_EC_ED_DA_DBUU_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_ed, reg_ec;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_ed, reg_ec);
+      REGTOE(reg_ed)
+      REGTOE(reg_ec)
+      MacPairTo(reg_ec, reg_ed, reg_da, reg_db, HalfwordPair::UU, n,
+                PairMac::SubAdd, false, il);
+      return true;
+    }
+    case MSUBADSH_EC_ED_DA_DBLL_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_ed, reg_ec;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_ed, reg_ec);
+      REGTOE(reg_ed)
+      REGTOE(reg_ec)
+      MacPairTo(reg_ec, reg_ed, reg_da, reg_db, HalfwordPair::LL, n,
+                PairMac::SubAdd, true, il);
+      return true;
+    }
+    case MSUBADSH_EC_ED_DA_DBLU_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_ed, reg_ec;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_ed, reg_ec);
+      REGTOE(reg_ed)
+      REGTOE(reg_ec)
+      MacPairTo(reg_ec, reg_ed, reg_da, reg_db, HalfwordPair::LU, n,
+                PairMac::SubAdd, true, il);
+      return true;
+    }
+    case MSUBADSH_EC_ED_DA_DBUL_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_ed, reg_ec;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_ed, reg_ec);
+      REGTOE(reg_ed)
+      REGTOE(reg_ec)
+      MacPairTo(reg_ec, reg_ed, reg_da, reg_db, HalfwordPair::UL, n,
+                PairMac::SubAdd, true, il);
+      return true;
+    }
+    case MSUBADSH_EC_ED_DA_DBUU_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_ed, reg_ec;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_ed, reg_ec);
+      REGTOE(reg_ed)
+      REGTOE(reg_ec)
+      MacPairTo(reg_ec, reg_ed, reg_da, reg_db, HalfwordPair::UU, n,
+                PairMac::SubAdd, true, il);
+      return true;
+    }
+    default:
+      TRICORE_LOG_REJECT("0x%lx: MsubadhSh::%s received invalid opcode 2 0x%x",
+                         addr, __func__, op2);
+      return false;
+  }
 }
 
-bool Msubq::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
-                 size_t& len, LowLevelILFunction& il) {
-  UNIMPLEMENTED(*((const uint16_t*)data) & 0x1 ? 4 : 2)
+bool MsubadmhSh::Lift(uint8_t op1, uint8_t op2, const uint8_t* data,
+                      uint64_t addr, size_t& len, LowLevelILFunction& il) {
+  if (op1 != OP1_xE3_RRR1) {
+    TRICORE_LOG_REJECT("0x%lx: MsubadmhSh::%s received invalid opcode 1 0x%x",
+                       addr, __func__, op1);
+    return false;
+  }
+  switch (op2) {
+    case MSUBADMH_EC_ED_DA_DBLL_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_ed, reg_ec;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_ed, reg_ec);
+      REGTOE(reg_ed)
+      REGTOE(reg_ec)
+      MacMultiPrecisionTo(reg_ec, reg_ed, reg_da, reg_db, HalfwordPair::LL, n,
+                          PairMac::SubAdd, false, il);
+      return true;
+    }
+    case MSUBADMH_EC_ED_DA_DBLU_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_ed, reg_ec;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_ed, reg_ec);
+      REGTOE(reg_ed)
+      REGTOE(reg_ec)
+      MacMultiPrecisionTo(reg_ec, reg_ed, reg_da, reg_db, HalfwordPair::LU, n,
+                          PairMac::SubAdd, false, il);
+      return true;
+    }
+    case MSUBADMH_EC_ED_DA_DBUL_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_ed, reg_ec;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_ed, reg_ec);
+      REGTOE(reg_ed)
+      REGTOE(reg_ec)
+      MacMultiPrecisionTo(reg_ec, reg_ed, reg_da, reg_db, HalfwordPair::UL, n,
+                          PairMac::SubAdd, false, il);
+      return true;
+    }
+    case MSUBADMH_EC_ED_DA_DBUU_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_ed, reg_ec;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_ed, reg_ec);
+      REGTOE(reg_ed)
+      REGTOE(reg_ec)
+      MacMultiPrecisionTo(reg_ec, reg_ed, reg_da, reg_db, HalfwordPair::UU, n,
+                          PairMac::SubAdd, false, il);
+      return true;
+    }
+    case MSUBADMSH_EC_ED_DA_DBLL_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_ed, reg_ec;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_ed, reg_ec);
+      REGTOE(reg_ed)
+      REGTOE(reg_ec)
+      MacMultiPrecisionTo(reg_ec, reg_ed, reg_da, reg_db, HalfwordPair::LL, n,
+                          PairMac::SubAdd, true, il);
+      return true;
+    }
+    case MSUBADMSH_EC_ED_DA_DBLU_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_ed, reg_ec;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_ed, reg_ec);
+      REGTOE(reg_ed)
+      REGTOE(reg_ec)
+      MacMultiPrecisionTo(reg_ec, reg_ed, reg_da, reg_db, HalfwordPair::LU, n,
+                          PairMac::SubAdd, true, il);
+      return true;
+    }
+    case MSUBADMSH_EC_ED_DA_DBUL_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_ed, reg_ec;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_ed, reg_ec);
+      REGTOE(reg_ed)
+      REGTOE(reg_ec)
+      MacMultiPrecisionTo(reg_ec, reg_ed, reg_da, reg_db, HalfwordPair::UL, n,
+                          PairMac::SubAdd, true, il);
+      return true;
+    }
+    case MSUBADMSH_EC_ED_DA_DBUU_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_ed, reg_ec;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_ed, reg_ec);
+      REGTOE(reg_ed)
+      REGTOE(reg_ec)
+      MacMultiPrecisionTo(reg_ec, reg_ed, reg_da, reg_db, HalfwordPair::UU, n,
+                          PairMac::SubAdd, true, il);
+      return true;
+    }
+    default:
+      TRICORE_LOG_REJECT("0x%lx: MsubadmhSh::%s received invalid opcode 2 0x%x",
+                         addr, __func__, op2);
+      return false;
+  }
 }
 
-bool Msubu::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
-                 size_t& len, LowLevelILFunction& il) {
+bool MsubadrhSh::Lift(uint8_t op1, uint8_t op2, const uint8_t* data,
+                      uint64_t addr, size_t& len, LowLevelILFunction& il) {
+  if (op1 != OP1_xE3_RRR1) {
+    TRICORE_LOG_REJECT("0x%lx: MsubadrhSh::%s received invalid opcode 1 0x%x",
+                       addr, __func__, op1);
+    return false;
+  }
+  switch (op2) {
+    case MSUBADRH_DC_DD_DA_DBLL_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_dd, reg_dc;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_dd, reg_dc);
+      MacRoundedPairTo(reg_dc, reg_dd, WORD, reg_da, reg_db, HalfwordPair::LL,
+                       n, PairMac::SubAdd, false, il);
+      return true;
+    }
+    case MSUBADRH_DC_DD_DA_DBLU_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_dd, reg_dc;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_dd, reg_dc);
+      MacRoundedPairTo(reg_dc, reg_dd, WORD, reg_da, reg_db, HalfwordPair::LU,
+                       n, PairMac::SubAdd, false, il);
+      return true;
+    }
+    case MSUBADRH_DC_DD_DA_DBUL_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_dd, reg_dc;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_dd, reg_dc);
+      MacRoundedPairTo(reg_dc, reg_dd, WORD, reg_da, reg_db, HalfwordPair::UL,
+                       n, PairMac::SubAdd, false, il);
+      return true;
+    }
+    case MSUBADRH_DC_DD_DA_DBUU_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_dd, reg_dc;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_dd, reg_dc);
+      MacRoundedPairTo(reg_dc, reg_dd, WORD, reg_da, reg_db, HalfwordPair::UU,
+                       n, PairMac::SubAdd, false, il);
+      return true;
+    }
+    case MSUBADRSH_DC_DD_DA_DBLL_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_dd, reg_dc;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_dd, reg_dc);
+      MacRoundedPairTo(reg_dc, reg_dd, WORD, reg_da, reg_db, HalfwordPair::LL,
+                       n, PairMac::SubAdd, true, il);
+      return true;
+    }
+    case MSUBADRSH_DC_DD_DA_DBLU_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_dd, reg_dc;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_dd, reg_dc);
+      MacRoundedPairTo(reg_dc, reg_dd, WORD, reg_da, reg_db, HalfwordPair::LU,
+                       n, PairMac::SubAdd, true, il);
+      return true;
+    }
+    case MSUBADRSH_DC_DD_DA_DBUL_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_dd, reg_dc;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_dd, reg_dc);
+      MacRoundedPairTo(reg_dc, reg_dd, WORD, reg_da, reg_db, HalfwordPair::UL,
+                       n, PairMac::SubAdd, true, il);
+      return true;
+    }
+    case MSUBADRSH_DC_DD_DA_DBUU_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_dd, reg_dc;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_dd, reg_dc);
+      MacRoundedPairTo(reg_dc, reg_dd, WORD, reg_da, reg_db, HalfwordPair::UU,
+                       n, PairMac::SubAdd, true, il);
+      return true;
+    }
+    default:
+      TRICORE_LOG_REJECT("0x%lx: MsubadrhSh::%s received invalid opcode 2 0x%x",
+                         addr, __func__, op2);
+      return false;
+  }
+}
+
+bool MsubmhSh::Lift(uint8_t op1, uint8_t op2, const uint8_t* data,
+                    uint64_t addr, size_t& len, LowLevelILFunction& il) {
+  if (op1 != OP1_xA3_RRR1) {
+    TRICORE_LOG_REJECT("0x%lx: MsubmhSh::%s received invalid opcode 1 0x%x",
+                       addr, __func__, op1);
+    return false;
+  }
+  switch (op2) {
+    case MSUBMH_EC_ED_DA_DBLL_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_ed, reg_ec;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_ed, reg_ec);
+      REGTOE(reg_ed)
+      REGTOE(reg_ec)
+      MacMultiPrecisionTo(reg_ec, reg_ed, reg_da, reg_db, HalfwordPair::LL, n,
+                          PairMac::Sub, false, il);
+      return true;
+    }
+    case MSUBMH_EC_ED_DA_DBLU_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_ed, reg_ec;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_ed, reg_ec);
+      REGTOE(reg_ed)
+      REGTOE(reg_ec)
+      MacMultiPrecisionTo(reg_ec, reg_ed, reg_da, reg_db, HalfwordPair::LU, n,
+                          PairMac::Sub, false, il);
+      return true;
+    }
+    case MSUBMH_EC_ED_DA_DBUL_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_ed, reg_ec;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_ed, reg_ec);
+      REGTOE(reg_ed)
+      REGTOE(reg_ec)
+      MacMultiPrecisionTo(reg_ec, reg_ed, reg_da, reg_db, HalfwordPair::UL, n,
+                          PairMac::Sub, false, il);
+      return true;
+    }
+    case MSUBMH_EC_ED_DA_DBUU_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_ed, reg_ec;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_ed, reg_ec);
+      REGTOE(reg_ed)
+      REGTOE(reg_ec)
+      MacMultiPrecisionTo(reg_ec, reg_ed, reg_da, reg_db, HalfwordPair::UU, n,
+                          PairMac::Sub, false, il);
+      return true;
+    }
+    case MSUBMSH_EC_ED_DA_DBLL_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_ed, reg_ec;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_ed, reg_ec);
+      REGTOE(reg_ed)
+      REGTOE(reg_ec)
+      MacMultiPrecisionTo(reg_ec, reg_ed, reg_da, reg_db, HalfwordPair::LL, n,
+                          PairMac::Sub, true, il);
+      return true;
+    }
+    case MSUBMSH_EC_ED_DA_DBLU_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_ed, reg_ec;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_ed, reg_ec);
+      REGTOE(reg_ed)
+      REGTOE(reg_ec)
+      MacMultiPrecisionTo(reg_ec, reg_ed, reg_da, reg_db, HalfwordPair::LU, n,
+                          PairMac::Sub, true, il);
+      return true;
+    }
+    case MSUBMSH_EC_ED_DA_DBUL_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_ed, reg_ec;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_ed, reg_ec);
+      REGTOE(reg_ed)
+      REGTOE(reg_ec)
+      MacMultiPrecisionTo(reg_ec, reg_ed, reg_da, reg_db, HalfwordPair::UL, n,
+                          PairMac::Sub, true, il);
+      return true;
+    }
+    case MSUBMSH_EC_ED_DA_DBUU_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_ed, reg_ec;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_ed, reg_ec);
+      REGTOE(reg_ed)
+      REGTOE(reg_ec)
+      MacMultiPrecisionTo(reg_ec, reg_ed, reg_da, reg_db, HalfwordPair::UU, n,
+                          PairMac::Sub, true, il);
+      return true;
+    }
+    default:
+      TRICORE_LOG_REJECT("0x%lx: MsubmhSh::%s received invalid opcode 2 0x%x",
+                         addr, __func__, op2);
+      return false;
+  }
+}
+
+bool MsubrhSh::Lift(uint8_t op1, uint8_t op2, const uint8_t* data,
+                    uint64_t addr, size_t& len, LowLevelILFunction& il) {
   switch (op1) {
-    case OP1_x33_RCR:
+    case OP1_xA3_RRR1:
       switch (op2) {
-        case MSUBU_EC_ED_DA_CONST9: {
+        case MSUBRH_DC_DD_DA_DBLL_N: {
           len = 4;
-          uint8_t op1, op2, reg_da, reg_ed, reg_ec;
-          int16_t const9;
-          Instruction::ExtractOpfieldsRCR(data, op1, op2, reg_da, const9,
-                                          reg_ed, reg_ec);
-          REGTOE(reg_ed)
-          REGTOE(reg_ec)
-          const9 &= 0x1FF;
-          il.AddInstruction(il.SetRegister(
-              DWORD, reg_ec,
-              il.Sub(DWORD, il.Register(DWORD, reg_ed),
-                     il.MultDoublePrecUnsigned(
-                         DWORD, il.Register(WORD, reg_da),
-                         il.ZeroExtend(WORD, il.Const(HWORD, const9))))));
+          uint8_t op1, op2, reg_da, reg_db, n, reg_dd, reg_dc;
+          Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                           reg_dd, reg_dc);
+          MacRoundedPairTo(reg_dc, reg_dd, WORD, reg_da, reg_db,
+                           HalfwordPair::LL, n, PairMac::Sub, false, il);
           return true;
         }
-        case MSUBSU_DC_DD_DA_CONST9: {
+        case MSUBRH_DC_DD_DA_DBLU_N: {
           len = 4;
-          uint8_t op1, op2, reg_da, reg_dd, reg_dc;
-          int16_t const9;
-          Instruction::ExtractOpfieldsRCR(data, op1, op2, reg_da, const9,
-                                          reg_dd, reg_dc);
-          const9 &= 0x1FF;
-          il.AddInstruction(il.SetRegister(
-              WORD, LLIL_TEMP(0),
-              il.Sub(WORD, il.Register(WORD, reg_dd),
-                     il.MultDoublePrecUnsigned(
-                         WORD, il.Register(WORD, reg_da),
-                         il.ZeroExtend(WORD, il.Const(HWORD, const9))))));
-          suov(il.Register(WORD, LLIL_TEMP(0)), il.Const(WORD, 32),
-               LLIL_TEMP(1), il, WORD);
-          il.AddInstruction(
-              il.SetRegister(WORD, reg_dc, il.Register(WORD, LLIL_TEMP(1))));
+          uint8_t op1, op2, reg_da, reg_db, n, reg_dd, reg_dc;
+          Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                           reg_dd, reg_dc);
+          MacRoundedPairTo(reg_dc, reg_dd, WORD, reg_da, reg_db,
+                           HalfwordPair::LU, n, PairMac::Sub, false, il);
+          return true;
+        }
+        case MSUBRH_DC_DD_DA_DBUL_N: {
+          len = 4;
+          uint8_t op1, op2, reg_da, reg_db, n, reg_dd, reg_dc;
+          Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                           reg_dd, reg_dc);
+          MacRoundedPairTo(reg_dc, reg_dd, WORD, reg_da, reg_db,
+                           HalfwordPair::UL, n, PairMac::Sub, false, il);
+          return true;
+        }
+        case MSUBRH_DC_DD_DA_DBUU_N: {
+          len = 4;
+          uint8_t op1, op2, reg_da, reg_db, n, reg_dd, reg_dc;
+          Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                           reg_dd, reg_dc);
+          MacRoundedPairTo(reg_dc, reg_dd, WORD, reg_da, reg_db,
+                           HalfwordPair::UU, n, PairMac::Sub, false, il);
+          return true;
+        }
+        case MSUBRSH_DC_DD_DA_DBLL_N: {
+          len = 4;
+          uint8_t op1, op2, reg_da, reg_db, n, reg_dd, reg_dc;
+          Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                           reg_dd, reg_dc);
+          MacRoundedPairTo(reg_dc, reg_dd, WORD, reg_da, reg_db,
+                           HalfwordPair::LL, n, PairMac::Sub, true, il);
+          return true;
+        }
+        case MSUBRSH_DC_DD_DA_DBLU_N: {
+          len = 4;
+          uint8_t op1, op2, reg_da, reg_db, n, reg_dd, reg_dc;
+          Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                           reg_dd, reg_dc);
+          MacRoundedPairTo(reg_dc, reg_dd, WORD, reg_da, reg_db,
+                           HalfwordPair::LU, n, PairMac::Sub, true, il);
+          return true;
+        }
+        case MSUBRSH_DC_DD_DA_DBUL_N: {
+          len = 4;
+          uint8_t op1, op2, reg_da, reg_db, n, reg_dd, reg_dc;
+          Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                           reg_dd, reg_dc);
+          MacRoundedPairTo(reg_dc, reg_dd, WORD, reg_da, reg_db,
+                           HalfwordPair::UL, n, PairMac::Sub, true, il);
           return true;
         }
-        case MSUBSU_EC_ED_DA_CONST9: {
+        case MSUBRSH_DC_DD_DA_DBUU_N: {
           len = 4;
-          uint8_t op1, op2, reg_da, reg_ed, reg_ec;
-          int16_t const9;
-          Instruction::ExtractOpfieldsRCR(data, op1, op2, reg_da, const9,
-                                          reg_ed, reg_ec);
-          REGTOE(reg_ed)
-          REGTOE(reg_ec)
-          const9 &= 0x1FF;
-          il.AddInstruction(il.SetRegister(
-              DWORD, LLIL_TEMP(0),
-              il.Sub(DWORD, il.Register(DWORD, reg_ed),
-                     il.MultDoublePrecUnsigned(
-                         DWORD, il.Register(WORD, reg_da),
-                         il.ZeroExtend(WORD, il.Const(HWORD, const9))))));
-          suov(il.Register(DWORD, LLIL_TEMP(0)), il.Const(WORD, 64),
-               LLIL_TEMP(1), il, DWORD);
-          il.AddInstruction(
-              il.SetRegister(DWORD, reg_ec, il.Register(DWORD, LLIL_TEMP(1))));
+          uint8_t op1, op2, reg_da, reg_db, n, reg_dd, reg_dc;
+          Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                           reg_dd, reg_dc);
+          MacRoundedPairTo(reg_dc, reg_dd, WORD, reg_da, reg_db,
+                           HalfwordPair::UU, n, PairMac::Sub, true, il);
           return true;
         }
         default:
-          LogDebug("0x%lx: Msubu::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT(
+              "0x%lx: MsubrhSh::%s received invalid opcode 2 0x%x",
+              addr, __func__, op2);
           return false;
       }
-    case OP1_x23_RRR2:
+    case OP1_x63_RRR1:
       switch (op2) {
-        case MSUBU_EC_ED_DA_DB: {
+        case MSUBRH_DC_ED_DA_DBUL_N: {
           len = 4;
-          uint8_t op1, op2, reg_da, reg_db, reg_ed, reg_ec;
-          Instruction::ExtractOpfieldsRRR2(data, op1, op2, reg_da, reg_db,
-                                           reg_ed, reg_ec);
+          uint8_t op1, op2, reg_da, reg_db, n, reg_ed, reg_dc;
+          Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                           reg_ed, reg_dc);
           REGTOE(reg_ed)
-          REGTOE(reg_ec)
-          il.AddInstruction(il.SetRegister(
-              DWORD, reg_ec,
-              il.Sub(DWORD, il.Register(DWORD, reg_ed),
-                     il.MultDoublePrecUnsigned(DWORD, il.Register(WORD, reg_da),
-                                               il.Register(WORD, reg_db)))));
-          return true;
-        }
-        case MSUBSU_DC_DD_DA_DB: {
-          len = 4;
-          uint8_t op1, op2, reg_da, reg_db, reg_dd, reg_dc;
-          Instruction::ExtractOpfieldsRRR2(data, op1, op2, reg_da, reg_db,
-                                           reg_dd, reg_dc);
-          il.AddInstruction(il.SetRegister(
-              WORD, LLIL_TEMP(0),
-              il.Sub(WORD, il.Register(WORD, reg_dd),
-                     il.MultDoublePrecUnsigned(WORD, il.Register(WORD, reg_da),
-                                               il.Register(WORD, reg_db)))));
-          suov(il.Register(WORD, LLIL_TEMP(0)), il.Const(WORD, 32),
-               LLIL_TEMP(1), il, WORD);
-          il.AddInstruction(
-              il.SetRegister(WORD, reg_dc, il.Register(WORD, LLIL_TEMP(1))));
+          MacRoundedPairTo(reg_dc, reg_ed, DWORD, reg_da, reg_db,
+                           HalfwordPair::UL, n, PairMac::Sub, false, il);
           return true;
         }
-        case MSUBSU_EC_ED_DA_DB: {
+        case MSUBRSH_DC_ED_DA_DBUL_N: {
           len = 4;
-          uint8_t op1, op2, reg_da, reg_db, reg_ed, reg_ec;
-          Instruction::ExtractOpfieldsRRR2(data, op1, op2, reg_da, reg_db,
-                                           reg_ed, reg_ec);
+          uint8_t op1, op2, reg_da, reg_db, n, reg_ed, reg_dc;
+          Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                           reg_ed, reg_dc);
           REGTOE(reg_ed)
-          REGTOE(reg_ec)
-          il.AddInstruction(il.SetRegister(
-              DWORD, LLIL_TEMP(0),
-              il.Sub(DWORD, il.Register(DWORD, reg_ed),
-                     il.MultDoublePrecUnsigned(DWORD, il.Register(WORD, reg_da),
-                                               il.Register(WORD, reg_db)))));
-          suov(il.Register(DWORD, LLIL_TEMP(0)), il.Const(WORD, 64),
-               LLIL_TEMP(1), il, DWORD);
-          il.AddInstruction(
-              il.SetRegister(DWORD, reg_ec, il.Register(DWORD, LLIL_TEMP(1))));
+          MacRoundedPairTo(reg_dc, reg_ed, DWORD, reg_da, reg_db,
+                           HalfwordPair::UL, n, PairMac::Sub, true, il);
           return true;
         }
         default:
-          LogDebug("0x%lx: Msubu::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT(
+              "0x%lx: MsubrhSh::%s received invalid opcode 2 0x%x",
+              addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Msubu::%s received invalid opcode 1 0x%x", addr,
-               __func__, op1);
+      TRICORE_LOG_REJECT("0x%lx: MsubrhSh::%s received invalid opcode 1 0x%x",
+                         addr, __func__, op1);
       return false;
   }
 }
 
-bool MsubadhSh::Lift(uint8_t op1, uint8_t op2, const uint8_t* data,
-                     uint64_t addr, size_t& len, LowLevelILFunction& il) {
-  UNIMPLEMENTED(*((const uint16_t*)data) & 0x1 ? 4 : 2)
-}
-
-bool MsubadmhSh::Lift(uint8_t op1, uint8_t op2, const uint8_t* data,
-                      uint64_t addr, size_t& len, LowLevelILFunction& il) {
-  UNIMPLEMENTED(*((const uint16_t*)data) & 0x1 ? 4 : 2)
-}
-
-bool MsubadrhSh::Lift(uint8_t op1, uint8_t op2, const uint8_t* data,
-                      uint64_t addr, size_t& len, LowLevelILFunction& il) {
-  UNIMPLEMENTED(*((const uint16_t*)data) & 0x1 ? 4 : 2)
-}
-
-bool MsubmhSh::Lift(uint8_t op1, uint8_t op2, const uint8_t* data,
-                    uint64_t addr, size_t& len, LowLevelILFunction& il) {
-  UNIMPLEMENTED(*((const uint16_t*)data) & 0x1 ? 4 : 2)
-}
-
-bool MsubrhSh::Lift(uint8_t op1, uint8_t op2, const uint8_t* data,
-                    uint64_t addr, size_t& len, LowLevelILFunction& il) {
-  UNIMPLEMENTED(*((const uint16_t*)data) & 0x1 ? 4 : 2)
-}
-
 bool Msubrq::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                   size_t& len, LowLevelILFunction& il) {
-  UNIMPLEMENTED(*((const uint16_t*)data) & 0x1 ? 4 : 2)
+  if (op1 != OP1_x63_RRR1) {
+    TRICORE_LOG_REJECT("0x%lx: Msubrq::%s received invalid opcode 1 0x%x", addr,
+                       __func__, op1);
+    return false;
+  }
+  switch (op2) {
+    case MSUBRQ_DC_DD_DAL_DBL_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_dd, reg_dc;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_dd, reg_dc);
+      MacRoundedQTo(reg_dc, il.Register(WORD, reg_dd), reg_da, reg_db, false, n,
+                    true, false, il);
+      return true;
+    }
+    case MSUBRQ_DC_DD_DAU_DBU_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_dd, reg_dc;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_dd, reg_dc);
+      MacRoundedQTo(reg_dc, il.Register(WORD, reg_dd), reg_da, reg_db, true, n,
+                    true, false, il);
+      return true;
+    }
+    case MSUBRSQ_DC_DD_DAL_DBL_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_dd, reg_dc;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_dd, reg_dc);
+      MacRoundedQTo(reg_dc, il.Register(WORD, reg_dd), reg_da, reg_db, false, n,
+                    true, true, il);
+      return true;
+    }
+    case MSUBRSQ_DC_DD_DAU_DBU_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_dd, reg_dc;
+      Instruction::ExtractOpfieldsRRR1(data, op1, op2, reg_da, reg_db, n,
+                                       reg_dd, reg_dc);
+      MacRoundedQTo(reg_dc, il.Register(WORD, reg_dd), reg_da, reg_db, true, n,
+                    true, true, il);
+      return true;
+    }
+    default:
+      TRICORE_LOG_REJECT("0x%lx: Msubrq::%s received invalid opcode 2 0x%x",
+                         addr, __func__, op2);
+      return false;
+  }
 }
 
 bool Mtcr::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                 size_t& len, LowLevelILFunction& il) {
   if (op1 != MTCR_CONST16_DA) {
-    LogDebug("0x%lx: Mtcr::%s received invalid opcode 1 0x%x", addr, __func__,
-             op1);
+    TRICORE_LOG_REJECT("0x%lx: Mtcr::%s received invalid opcode 1 0x%x", addr,
+                       __func__, op1);
     return false;
   }
   {
@@ -9023,15 +9462,14 @@ bool Mul::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
               il.MultDoublePrecSigned(
                   WORD, il.Register(WORD, reg_da),
                   il.SignExtend(WORD, il.Const(HWORD, const9)))));
-          ssov(il.Register(WORD, LLIL_TEMP(0)), il.Const(WORD, 32),
-               LLIL_TEMP(1), il, WORD);
+          ssov(il.Register(WORD, LLIL_TEMP(0)), 32, LLIL_TEMP(1), il, WORD);
           il.AddInstruction(
               il.SetRegister(WORD, reg_dc, il.Register(WORD, LLIL_TEMP(1))));
           return true;
         }
         default:
-          LogDebug("0x%lx: Mul::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Mul::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x73_RR2:
@@ -9068,32 +9506,162 @@ bool Mul::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
               WORD, LLIL_TEMP(0),
               il.MultDoublePrecSigned(WORD, il.Register(WORD, reg_da),
                                       il.Register(WORD, reg_db))));
-          ssov(il.Register(WORD, LLIL_TEMP(0)), il.Const(WORD, 32),
-               LLIL_TEMP(1), il, WORD);
+          ssov(il.Register(WORD, LLIL_TEMP(0)), 32, LLIL_TEMP(1), il, WORD);
           il.AddInstruction(
               il.SetRegister(WORD, reg_dc, il.Register(WORD, LLIL_TEMP(1))));
           return true;
         }
         default:
-          LogDebug("0x%lx: Mul::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Mul::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Mul::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Mul::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
 
 bool Mulh::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                 size_t& len, LowLevelILFunction& il) {
-  UNIMPLEMENTED(*((const uint16_t*)data) & 0x1 ? 4 : 2)
+  if (op1 != OP1_xB3_RR1) {
+    TRICORE_LOG_REJECT("0x%lx: Mulh::%s received invalid opcode 1 0x%x", addr,
+                       __func__, op1);
+    return false;
+  }
+  switch (op2) {
+    case MULH_EC_DA_DBLL_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_ec;
+      Instruction::ExtractOpfieldsRR1(data, op1, op2, reg_da, reg_db, n,
+                                      reg_ec);
+      REGTOE(reg_ec)
+      MulPairTo(reg_ec, reg_da, reg_db, HalfwordPair::LL, n, il);
+      return true;
+    }
+    case MULH_EC_DA_DBLU_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_ec;
+      Instruction::ExtractOpfieldsRR1(data, op1, op2, reg_da, reg_db, n,
+                                      reg_ec);
+      REGTOE(reg_ec)
+      MulPairTo(reg_ec, reg_da, reg_db, HalfwordPair::LU, n, il);
+      return true;
+    }
+    case MULH_EC_DA_DBUL_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_ec;
+      Instruction::ExtractOpfieldsRR1(data, op1, op2, reg_da, reg_db, n,
+                                      reg_ec);
+      REGTOE(reg_ec)
+      MulPairTo(reg_ec, reg_da, reg_db, HalfwordPair::UL, n, il);
+      return true;
+    }
+    case MULH_EC_DA_DBUU_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_ec;
+      Instruction::ExtractOpfieldsRR1(data, op1, op2, reg_da, reg_db, n,
+                                      reg_ec);
+      REGTOE(reg_ec)
+      MulPairTo(reg_ec, reg_da, reg_db, HalfwordPair::UU, n, il);
+      return true;
+    }
+    default:
+      TRICORE_LOG_REJECT("0x%lx: Mulh::%s received invalid opcode 2 0x%x", addr,
+                         __func__, op2);
+      return false;
+  }
 }
 
 bool Mulq::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                 size_t& len, LowLevelILFunction& il) {
-  UNIMPLEMENTED(*((const uint16_t*)data) & 0x1 ? 4 : 2)
+  if (op1 != OP1_x93_RR1) {
+    TRICORE_LOG_REJECT("0x%lx: Mulq::%s received invalid opcode 1 0x%x", addr,
+                       __func__, op1);
+    return false;
+  }
+  switch (op2) {
+    case MULQ_DC_DA_DB_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_dc;
+      Instruction::ExtractOpfieldsRR1(data, op1, op2, reg_da, reg_db, n,
+                                      reg_dc);
+      MulQTo(reg_dc, reg_da, QOperand::Word, reg_db, QOperand::Word, n, WORD,
+             il);
+      return true;
+    }
+    case MULQ_EC_DA_DB_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_ec;
+      Instruction::ExtractOpfieldsRR1(data, op1, op2, reg_da, reg_db, n,
+                                      reg_ec);
+      REGTOE(reg_ec)
+      MulQTo(reg_ec, reg_da, QOperand::Word, reg_db, QOperand::Word, n, DWORD,
+             il);
+      return true;
+    }
+    case MULQ_DC_DA_DBL_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_dc;
+      Instruction::ExtractOpfieldsRR1(data, op1, op2, reg_da, reg_db, n,
+                                      reg_dc);
+      MulQTo(reg_dc, reg_da, QOperand::Word, reg_db, QOperand::Lower, n, WORD,
+             il);
+      return true;
+    }
+    case MULQ_EC_DA_DBL_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_ec;
+      Instruction::ExtractOpfieldsRR1(data, op1, op2, reg_da, reg_db, n,
+                                      reg_ec);
+      REGTOE(reg_ec)
+      MulQTo(reg_ec, reg_da, QOperand::Word, reg_db, QOperand::Lower, n, DWORD,
+             il);
+      return true;
+    }
+    case MULQ_DC_DA_DBU_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_dc;
+      Instruction::ExtractOpfieldsRR1(data, op1, op2, reg_da, reg_db, n,
+                                      reg_dc);
+      MulQTo(reg_dc, reg_da, QOperand::Word, reg_db, QOperand::Upper, n, WORD,
+             il);
+      return true;
+    }
+    case MULQ_EC_DA_DBU_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_ec;
+      Instruction::ExtractOpfieldsRR1(data, op1, op2, reg_da, reg_db, n,
+                                      reg_ec);
+      REGTOE(reg_ec)
+      MulQTo(reg_ec, reg_da, QOperand::Word, reg_db, QOperand::Upper, n, DWORD,
+             il);
+      return true;
+    }
+    case MULQ_DC_DAL_DBL_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_dc;
+      Instruction::ExtractOpfieldsRR1(data, op1, op2, reg_da, reg_db, n,
+                                      reg_dc);
+      MulQTo(reg_dc, reg_da, QOperand::Lower, reg_db, QOperand::Lower, n, WORD,
+             il);
+      return true;
+    }
+    case MULQ_DC_DAU_DBU_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_dc;
+      Instruction::ExtractOpfieldsRR1(data, op1, op2, reg_da, reg_db, n,
+                                      reg_dc);
+      MulQTo(reg_dc, reg_da, QOperand::Upper, reg_db, QOperand::Upper, n, WORD,
+             il);
+      return true;
+    }
+    default:
+      TRICORE_LOG_REJECT("0x%lx: Mulq::%s received invalid opcode 2 0x%x", addr,
+                         __func__, op2);
+      return false;
+  }
 }
 
 bool Mulu::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
@@ -9128,15 +9696,14 @@ bool Mulu::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
               il.MultDoublePrecUnsigned(
                   WORD, il.Register(WORD, reg_da),
                   il.ZeroExtend(WORD, il.Const(HWORD, const9)))));
-          suov(il.Register(WORD, LLIL_TEMP(0)), il.Const(WORD, 32),
-               LLIL_TEMP(1), il, WORD);
+          suov(il.Register(WORD, LLIL_TEMP(0)), 32, LLIL_TEMP(1), il, WORD);
           il.AddInstruction(
               il.SetRegister(WORD, reg_dc, il.Register(WORD, LLIL_TEMP(1))));
           return true;
         }
         default:
-          LogDebug("0x%lx: Mulu::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Mulu::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x73_RR2:
@@ -9162,37 +9729,150 @@ bool Mulu::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
               WORD, LLIL_TEMP(0),
               il.MultDoublePrecUnsigned(WORD, il.Register(WORD, reg_da),
                                         il.Register(WORD, reg_db))));
-          suov(il.Register(WORD, LLIL_TEMP(0)), il.Const(WORD, 32),
-               LLIL_TEMP(1), il, WORD);
+          suov(il.Register(WORD, LLIL_TEMP(0)), 32, LLIL_TEMP(1), il, WORD);
           il.AddInstruction(
               il.SetRegister(WORD, reg_dc, il.Register(WORD, LLIL_TEMP(1))));
           return true;
         }
         default:
-          LogDebug("0x%lx: Mulu::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Mulu::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Mulu::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Mulu::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
 
 bool Mulmh::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                  size_t& len, LowLevelILFunction& il) {
-  UNIMPLEMENTED(*((const uint16_t*)data) & 0x1 ? 4 : 2)
+  if (op1 != OP1_xB3_RR1) {
+    TRICORE_LOG_REJECT("0x%lx: Mulmh::%s received invalid opcode 1 0x%x", addr,
+                       __func__, op1);
+    return false;
+  }
+  switch (op2) {
+    case MULMH_EC_DA_DBLL_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_ec;
+      Instruction::ExtractOpfieldsRR1(data, op1, op2, reg_da, reg_db, n,
+                                      reg_ec);
+      REGTOE(reg_ec)
+      MulMultiPrecisionTo(reg_ec, reg_da, reg_db, HalfwordPair::LL, n, il);
+      return true;
+    }
+    case MULMH_EC_DA_DBLU_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_ec;
+      Instruction::ExtractOpfieldsRR1(data, op1, op2, reg_da, reg_db, n,
+                                      reg_ec);
+      REGTOE(reg_ec)
+      MulMultiPrecisionTo(reg_ec, reg_da, reg_db, HalfwordPair::LU, n, il);
+      return true;
+    }
+    case MULMH_EC_DA_DBUL_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_ec;
+      Instruction::ExtractOpfieldsRR1(data, op1, op2, reg_da, reg_db, n,
+                                      reg_ec);
+      REGTOE(reg_ec)
+      MulMultiPrecisionTo(reg_ec, reg_da, reg_db, HalfwordPair::UL, n, il);
+      return true;
+    }
+    case MULMH_EC_DA_DBUU_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_ec;
+      Instruction::ExtractOpfieldsRR1(data, op1, op2, reg_da, reg_db, n,
+                                      reg_ec);
+      REGTOE(reg_ec)
+      MulMultiPrecisionTo(reg_ec, reg_da, reg_db, HalfwordPair::UU, n, il);
+      return true;
+    }
+    default:
+      TRICORE_LOG_REJECT("0x%lx: Mulmh::%s received invalid opcode 2 0x%x",
+                         addr, __func__, op2);
+      return false;
+  }
 }
 
 bool Mulrh::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                  size_t& len, LowLevelILFunction& il) {
-  UNIMPLEMENTED(*((const uint16_t*)data) & 0x1 ? 4 : 2)
+  if (op1 != OP1_xB3_RR1) {
+    TRICORE_LOG_REJECT("0x%lx: Mulrh::%s received invalid opcode 1 0x%x", addr,
+                       __func__, op1);
+    return false;
+  }
+  switch (op2) {
+    case MULRH_DC_DA_DBLL_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_dc;
+      Instruction::ExtractOpfieldsRR1(data, op1, op2, reg_da, reg_db, n,
+                                      reg_dc);
+      MulRoundedPairTo(reg_dc, reg_da, reg_db, HalfwordPair::LL, n, il);
+      return true;
+    }
+    case MULRH_DC_DA_DBLU_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_dc;
+      Instruction::ExtractOpfieldsRR1(data, op1, op2, reg_da, reg_db, n,
+                                      reg_dc);
+      MulRoundedPairTo(reg_dc, reg_da, reg_db, HalfwordPair::LU, n, il);
+      return true;
+    }
+    case MULRH_DC_DA_DBUL_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_dc;
+      Instruction::ExtractOpfieldsRR1(data, op1, op2, reg_da, reg_db, n,
+                                      reg_dc);
+      MulRoundedPairTo(reg_dc, reg_da, reg_db, HalfwordPair::UL, n, il);
+      return true;
+    }
+    case MULRH_DC_DA_DBUU_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_dc;
+      Instruction::ExtractOpfieldsRR1(data, op1, op2, reg_da, reg_db, n,
+                                      reg_dc);
+      MulRoundedPairTo(reg_dc, reg_da, reg_db, HalfwordPair::UU, n, il);
+      return true;
+    }
+    default:
+      TRICORE_LOG_REJECT("0x%lx: Mulrh::%s received invalid opcode 2 0x%x",
+                         addr, __func__, op2);
+      return false;
+  }
 }
 
 bool Mulrq::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                  size_t& len, LowLevelILFunction& il) {
-  UNIMPLEMENTED(*((const uint16_t*)data) & 0x1 ? 4 : 2)
+  if (op1 != OP1_x93_RR1) {
+    TRICORE_LOG_REJECT("0x%lx: Mulrq::%s received invalid opcode 1 0x%x", addr,
+                       __func__, op1);
+    return false;
+  }
+  switch (op2) {
+    case MULRQ_DC_DAL_DBL_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_dc;
+      Instruction::ExtractOpfieldsRR1(data, op1, op2, reg_da, reg_db, n,
+                                      reg_dc);
+      MulRoundedQTo(reg_dc, reg_da, reg_db, false, n, il);
+      return true;
+    }
+    case MULRQ_DC_DAU_DBU_N: {
+      len = 4;
+      uint8_t op1, op2, reg_da, reg_db, n, reg_dc;
+      Instruction::ExtractOpfieldsRR1(data, op1, op2, reg_da, reg_db, n,
+                                      reg_dc);
+      MulRoundedQTo(reg_dc, reg_da, reg_db, true, n, il);
+      return true;
+    }
+    default:
+      TRICORE_LOG_REJECT("0x%lx: Mulrq::%s received invalid opcode 2 0x%x",
+                         addr, __func__, op2);
+      return false;
+  }
 }
 
 bool Nand::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
@@ -9215,8 +9895,8 @@ bool Nand::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return true;
         }
         default:
-          LogDebug("0x%lx: Nand::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Nand::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x0F_RR:
@@ -9233,13 +9913,13 @@ bool Nand::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return true;
         }
         default:
-          LogDebug("0x%lx: Nand::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Nand::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Nand::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Nand::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -9247,8 +9927,8 @@ bool Nand::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Nandt::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                  size_t& len, LowLevelILFunction& il) {
   if (op1 != OP1_x07_BIT || op2 != NANDT_DC_DA_POS1_DB_POS2) {
-    LogDebug("0x%lx: Nandt::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT("0x%lx: Nandt::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
     return false;
   }
   {
@@ -9303,8 +9983,8 @@ bool Ne::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return true;
         }
         default:
-          LogDebug("0x%lx: Ne::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Ne::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x0B_RR:
@@ -9322,13 +10002,13 @@ bool Ne::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return true;
         }
         default:
-          LogDebug("0x%lx: Ne::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Ne::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Ne::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Ne::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -9336,8 +10016,8 @@ bool Ne::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Nea::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                size_t& len, LowLevelILFunction& il) {
   if (op1 != OP1_x01_RR || op2 != NEA_DC_AA_AB) {
-    LogDebug("0x%lx: Nea::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT("0x%lx: Nea::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
     return false;
   }
   {
@@ -9359,8 +10039,8 @@ bool Nea::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Neza::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                 size_t& len, LowLevelILFunction& il) {
   if (op1 != OP1_x01_RR || op2 != NEZA_DC_AA) {
-    LogDebug("0x%lx: Neza::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT("0x%lx: Neza::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
     return false;
   }
   {
@@ -9403,8 +10083,8 @@ bool Nor::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return true;
         }
         default:
-          LogDebug("0x%lx: Nor::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Nor::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x0F_RR:
@@ -9421,13 +10101,13 @@ bool Nor::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return true;
         }
         default:
-          LogDebug("0x%lx: Nor::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Nor::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Nor::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Nor::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -9435,8 +10115,8 @@ bool Nor::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Nort::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                 size_t& len, LowLevelILFunction& il) {
   if (op1 != OP1_x87_BIT || op2 != NORT_DC_DA_POS1_DB_POS2) {
-    LogDebug("0x%lx: Nort::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT("0x%lx: Nort::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
     return false;
   }
   {
@@ -9479,8 +10159,8 @@ bool Nort::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Not::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                size_t& len, LowLevelILFunction& il) {
   if (op1 != OP1_x46_SR || op2 != NOT_DA) {
-    LogDebug("0x%lx: Not::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT("0x%lx: Not::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
     return false;
   }
   {
@@ -9532,8 +10212,8 @@ bool Or::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return true;
         }
         default:
-          LogDebug("0x%lx: Or::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Or::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x0F_RR:
@@ -9550,13 +10230,13 @@ bool Or::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return true;
         }
         default:
-          LogDebug("0x%lx: Or::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Or::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Or::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Or::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -9565,8 +10245,9 @@ bool OrAndtAndntNortOrt::Lift(uint8_t op1, uint8_t op2, const uint8_t* data,
                               uint64_t addr, size_t& len,
                               LowLevelILFunction& il) {
   if (op1 != OP1_xC7_BIT) {
-    LogDebug("0x%lx: OrAndtAndntNortOrt::%s received invalid opcode 1 0x%x",
-             addr, __func__, op1);
+    TRICORE_LOG_REJECT(
+        "0x%lx: OrAndtAndntNortOrt::%s received invalid opcode 1 0x%x",
+        addr, __func__, op1);
     return false;
   }
   switch (op2) {
@@ -9671,8 +10352,9 @@ bool OrAndtAndntNortOrt::Lift(uint8_t op1, uint8_t op2, const uint8_t* data,
       return true;
     }
     default:
-      LogDebug("0x%lx: OrAndtAndntNortOrt::%s received invalid opcode 2 0x%x",
-               addr, __func__, op2);
+      TRICORE_LOG_REJECT(
+          "0x%lx: OrAndtAndntNortOrt::%s received invalid opcode 2 0x%x",
+          addr, __func__, op2);
       return false;
   }
 }
@@ -9698,8 +10380,8 @@ bool Oreq::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return true;
         }
         default:
-          LogDebug("0x%lx: Oreq::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Oreq::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x0B_RR:
@@ -9718,13 +10400,13 @@ bool Oreq::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return true;
         }
         default:
-          LogDebug("0x%lx: Oreq::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Oreq::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Oreq::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Oreq::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -9766,8 +10448,9 @@ bool OrgeGeu::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return true;
         }
         default:
-          LogDebug("0x%lx: OrgeGeu::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT(
+              "0x%lx: OrgeGeu::%s received invalid opcode 2 0x%x",
+              addr, __func__, op2);
           return false;
       }
     case OP1_x0B_RR:
@@ -9799,13 +10482,14 @@ bool OrgeGeu::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return true;
         }
         default:
-          LogDebug("0x%lx: OrgeGeu::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT(
+              "0x%lx: OrgeGeu::%s received invalid opcode 2 0x%x",
+              addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: OrgeGeu::%s received invalid opcode 1 0x%x", addr,
-               __func__, op1);
+      TRICORE_LOG_REJECT("0x%lx: OrgeGeu::%s received invalid opcode 1 0x%x",
+                         addr, __func__, op1);
       return false;
   }
 }
@@ -9847,8 +10531,9 @@ bool OrltLtu::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return true;
         }
         default:
-          LogDebug("0x%lx: OrltLtu::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT(
+              "0x%lx: OrltLtu::%s received invalid opcode 2 0x%x",
+              addr, __func__, op2);
           return false;
       }
     case OP1_x0B_RR:
@@ -9880,13 +10565,14 @@ bool OrltLtu::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return true;
         }
         default:
-          LogDebug("0x%lx: OrltLtu::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT(
+              "0x%lx: OrltLtu::%s received invalid opcode 2 0x%x",
+              addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: OrltLtu::%s received invalid opcode 1 0x%x", addr,
-               __func__, op1);
+      TRICORE_LOG_REJECT("0x%lx: OrltLtu::%s received invalid opcode 1 0x%x",
+                         addr, __func__, op1);
       return false;
   }
 }
@@ -9912,8 +10598,8 @@ bool Orne::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return true;
         }
         default:
-          LogDebug("0x%lx: Orne::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Orne::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x0B_RR:
@@ -9932,13 +10618,13 @@ bool Orne::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return true;
         }
         default:
-          LogDebug("0x%lx: Orne::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Orne::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Orne::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Orne::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -9946,8 +10632,8 @@ bool Orne::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Ort::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                size_t& len, LowLevelILFunction& il) {
   if (op1 != OP1_x87_BIT || op2 != ORT_DC_DA_POS1_DB_POS2) {
-    LogDebug("0x%lx: Ort::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT("0x%lx: Ort::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
     return false;
   }
   {
@@ -9995,8 +10681,8 @@ bool Orn::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return true;
         }
         default:
-          LogDebug("0x%lx: Orn::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Orn::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x0F_RR:
@@ -10013,13 +10699,13 @@ bool Orn::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return true;
         }
         default:
-          LogDebug("0x%lx: Orn::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Orn::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Orn::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Orn::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -10027,8 +10713,8 @@ bool Orn::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Ornt::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                 size_t& len, LowLevelILFunction& il) {
   if (op1 != OP1_x87_BIT || op2 != ORNT_DC_DA_POS1_DB_POS2) {
-    LogDebug("0x%lx: Ornt::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT("0x%lx: Ornt::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
     return false;
   }
   {
@@ -10075,8 +10761,15 @@ bool RestoreDa::Lift(uint8_t op1, uint8_t op2, const uint8_t* data,
 bool Ret::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                size_t& len, LowLevelILFunction& il) {
   len = *((const uint16_t*)data) & 0x1 ? 4 : 2;
-  // TODO: make sure A11 is even
-  il.AddInstruction(il.Return(il.Register(WORD, TRICORE_REG_A11)));
+  // The return address is the callee's A11 with bit 0 cleared, read before
+  // the caller's A11 is restored
+  il.AddInstruction(il.SetRegister(
+      WORD, LLIL_TEMP(kReturnAddress),
+      il.And(WORD, il.Register(WORD, TRICORE_REG_A11),
+             il.Const(WORD, 0xFFFFFFFE))));
+  RestoreContext(kUpperContext, il);
+  il.AddInstruction(
+      il.Return(il.Register(WORD, LLIL_TEMP(kReturnAddress))));
   return true;
 }
 
@@ -10102,7 +10795,14 @@ bool Rfm::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 
 bool Rslcx::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                  size_t& len, LowLevelILFunction& il) {
-  UNIMPLEMENTED(*((const uint16_t*)data) & 0x1 ? 4 : 2)
+  if (op1 != OP1_x0D_SYS || op2 != RSLCX) {
+    TRICORE_LOG_REJECT("0x%lx: Rslcx::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
+    return false;
+  }
+  len = 4;
+  RestoreContext(kLowerContext, il);
+  return true;
 }
 
 bool Rstv::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
@@ -10125,8 +10825,8 @@ bool Rsub::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return true;
         }
         default:
-          LogDebug("0x%lx: Rsub::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Rsub::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x8B_RC:
@@ -10144,13 +10844,13 @@ bool Rsub::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return true;
         }
         default:
-          LogDebug("0x%lx: Rsub::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Rsub::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Rsub::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Rsub::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -10158,8 +10858,8 @@ bool Rsub::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Rsubs::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                  size_t& len, LowLevelILFunction& il) {
   if (op1 != OP1_x8B_RC) {
-    LogDebug("0x%lx: Rsubs::%s received invalid opcode 1 0x%x", addr, __func__,
-             op1);
+    TRICORE_LOG_REJECT("0x%lx: Rsubs::%s received invalid opcode 1 0x%x", addr,
+                       __func__, op1);
     return false;
   }
   switch (op2) {
@@ -10172,8 +10872,7 @@ bool Rsubs::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           WORD, LLIL_TEMP(0),
           il.Sub(WORD, il.SignExtend(WORD, il.Const(HWORD, const9)),
                  il.Register(WORD, reg_da))));
-      ssov(il.Register(WORD, LLIL_TEMP(0)), il.Const(WORD, 32), reg_dc, il,
-           WORD);
+      ssov(il.Register(WORD, LLIL_TEMP(0)), 32, reg_dc, il, WORD);
       return true;
     }
     case RSUBSU_DC_DA_CONST9: {
@@ -10187,13 +10886,12 @@ bool Rsubs::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           WORD, LLIL_TEMP(0),
           il.Sub(WORD, il.SignExtend(WORD, il.Const(HWORD, const9)),
                  il.Register(WORD, reg_da))));
-      suov(il.Register(WORD, LLIL_TEMP(0)), il.Const(WORD, 32), reg_dc, il,
-           WORD);
+      suov(il.Register(WORD, LLIL_TEMP(0)), 32, reg_dc, il, WORD);
       return true;
     }
     default:
-      LogDebug("0x%lx: Rsubs::%s received invalid opcode 2 0x%x", addr,
-               __func__, op2);
+      TRICORE_LOG_REJECT("0x%lx: Rsubs::%s received invalid opcode 2 0x%x",
+                         addr, __func__, op2);
       return false;
   }
 }
@@ -10205,97 +10903,51 @@ bool Satb::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
       switch (op2) {
         case SATB_DA: {
           ExprId condition1, condition2;
-          LowLevelILLabel trueLabel1, falseLabel1, doneLabel1, trueLabel2,
-              falseLabel2, doneLabel2;
           len = 2;
           uint8_t op1, reg_da, op2;
           Instruction::ExtractOpfieldsSR(data, op1, reg_da, op2);
 
-          condition1 = il.CompareSignedLessThan(WORD, il.Register(WORD, reg_da),
-                                                il.Const(WORD, -0x80));
-          il.AddInstruction(il.If(condition1, trueLabel1, falseLabel1));
-
-          il.MarkLabel(trueLabel1);
-          il.AddInstruction(
-              il.SetRegister(WORD, LLIL_TEMP(0), il.Const(WORD, -0x80)));
-          il.AddInstruction(il.Goto(doneLabel1));
-
-          il.MarkLabel(falseLabel1);
-          il.AddInstruction(
-              il.SetRegister(WORD, LLIL_TEMP(0), il.Register(WORD, reg_da)));
-          il.AddInstruction(il.Goto(doneLabel1));
-
-          il.MarkLabel(doneLabel1);
+          condition1 = il.CompareSignedLessThan(WORD, il.Register(WORD, reg_da),
+                                                il.Const(WORD, -0x80));
+          SelectTo(LLIL_TEMP(0), condition1, il.Const(WORD, -0x80),
+                   il.Register(WORD, reg_da), il, WORD);
           condition2 = il.CompareSignedGreaterThan(
               WORD, il.Register(WORD, LLIL_TEMP(0)), il.Const(WORD, 0x7F));
-          il.AddInstruction(il.If(condition2, trueLabel2, falseLabel2));
-
-          il.MarkLabel(trueLabel2);
-          il.AddInstruction(il.SetRegister(WORD, reg_da, il.Const(WORD, 0x7F)));
-          il.AddInstruction(il.Goto(doneLabel2));
-
-          il.MarkLabel(falseLabel2);
-          il.AddInstruction(
-              il.SetRegister(WORD, reg_da, il.Register(WORD, LLIL_TEMP(0))));
-          il.AddInstruction(il.Goto(doneLabel2));
-
-          il.MarkLabel(doneLabel2);
+          SelectTo(reg_da, condition2, il.Const(WORD, 0x7F),
+                   il.Register(WORD, LLIL_TEMP(0)), il, WORD);
           return true;
         }
         default:
-          LogDebug("0x%lx: Satb::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Satb::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x0B_RR:
       switch (op2) {
         case SATB_DC_DA: {
           ExprId condition1, condition2;
-          LowLevelILLabel trueLabel1, falseLabel1, doneLabel1, trueLabel2,
-              falseLabel2, doneLabel2;
           len = 4;
           uint8_t op1, op2, reg_da, s2, n, reg_dc;
           Instruction::ExtractOpfieldsRR(data, op1, op2, reg_da, s2, n, reg_dc);
 
           condition1 = il.CompareSignedLessThan(WORD, il.Register(WORD, reg_da),
                                                 il.Const(WORD, -0x80));
-          il.AddInstruction(il.If(condition1, trueLabel1, falseLabel1));
-
-          il.MarkLabel(trueLabel1);
-          il.AddInstruction(
-              il.SetRegister(WORD, LLIL_TEMP(0), il.Const(WORD, -0x80)));
-          il.AddInstruction(il.Goto(doneLabel1));
-
-          il.MarkLabel(falseLabel1);
-          il.AddInstruction(
-              il.SetRegister(WORD, LLIL_TEMP(0), il.Register(WORD, reg_da)));
-          il.AddInstruction(il.Goto(doneLabel1));
-
-          il.MarkLabel(doneLabel1);
+          SelectTo(LLIL_TEMP(0), condition1, il.Const(WORD, -0x80),
+                   il.Register(WORD, reg_da), il, WORD);
           condition2 = il.CompareSignedGreaterThan(
               WORD, il.Register(WORD, LLIL_TEMP(0)), il.Const(WORD, 0x7F));
-          il.AddInstruction(il.If(condition2, trueLabel2, falseLabel2));
-
-          il.MarkLabel(trueLabel2);
-          il.AddInstruction(il.SetRegister(WORD, reg_dc, il.Const(WORD, 0x7F)));
-          il.AddInstruction(il.Goto(doneLabel2));
-
-          il.MarkLabel(falseLabel2);
-          il.AddInstruction(
-              il.SetRegister(WORD, reg_dc, il.Register(WORD, LLIL_TEMP(0))));
-          il.AddInstruction(il.Goto(doneLabel2));
-
-          il.MarkLabel(doneLabel2);
+          SelectTo(reg_dc, condition2, il.Const(WORD, 0x7F),
+                   il.Register(WORD, LLIL_TEMP(0)), il, WORD);
           return true;
         }
         default:
-          LogDebug("0x%lx: Satb::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Satb::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Satb::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Satb::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -10307,60 +10959,43 @@ bool Satbu::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
       switch (op2) {
         case SATBU_DA: {
           ExprId condition1;
-          LowLevelILLabel trueLabel1, doneLabel1;
           len = 2;
           uint8_t op1, reg_da, op2;
           Instruction::ExtractOpfieldsSR(data, op1, reg_da, op2);
 
           condition1 = il.CompareUnsignedGreaterThan(
               WORD, il.Register(WORD, reg_da), il.Const(WORD, 0xFF));
-          il.AddInstruction(il.If(condition1, trueLabel1, doneLabel1));
-
-          il.MarkLabel(trueLabel1);
-          il.AddInstruction(il.SetRegister(WORD, reg_da, il.Const(WORD, 0xFF)));
-          il.AddInstruction(il.Goto(doneLabel1));
-
-          il.MarkLabel(doneLabel1);
+          SelectTo(reg_da, condition1, il.Const(WORD, 0xFF),
+                   il.Register(WORD, reg_da), il, WORD);
           return true;
         }
         default:
-          LogDebug("0x%lx: Satbu::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Satbu::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x0B_RR:
       switch (op2) {
         case SATBU_DC_DA: {
           ExprId condition1;
-          LowLevelILLabel trueLabel1, falseLabel1, doneLabel1;
           len = 4;
           uint8_t op1, op2, reg_da, s2, n, reg_dc;
           Instruction::ExtractOpfieldsRR(data, op1, op2, reg_da, s2, n, reg_dc);
 
           condition1 = il.CompareUnsignedGreaterThan(
               WORD, il.Register(WORD, reg_da), il.Const(WORD, 0xFF));
-          il.AddInstruction(il.If(condition1, trueLabel1, falseLabel1));
-
-          il.MarkLabel(trueLabel1);
-          il.AddInstruction(il.SetRegister(WORD, reg_dc, il.Const(WORD, 0xFF)));
-          il.AddInstruction(il.Goto(doneLabel1));
-
-          il.MarkLabel(falseLabel1);
-          il.AddInstruction(
-              il.SetRegister(WORD, reg_dc, il.Register(WORD, reg_da)));
-          il.AddInstruction(il.Goto(doneLabel1));
-
-          il.MarkLabel(doneLabel1);
+          SelectTo(reg_dc, condition1, il.Const(WORD, 0xFF),
+                   il.Register(WORD, reg_da), il, WORD);
           return true;
         }
         default:
-          LogDebug("0x%lx: Satbu::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Satbu::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Satbu::%s received invalid opcode 1 0x%x", addr,
-               __func__, op1);
+      TRICORE_LOG_REJECT("0x%lx: Satbu::%s received invalid opcode 1 0x%x",
+                         addr, __func__, op1);
       return false;
   }
 }
@@ -10372,99 +11007,51 @@ bool Sath::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
       switch (op2) {
         case SATH_DA: {
           ExprId condition1, condition2;
-          LowLevelILLabel trueLabel1, falseLabel1, doneLabel1, trueLabel2,
-              falseLabel2, doneLabel2;
           len = 2;
           uint8_t op1, reg_da, op2;
           Instruction::ExtractOpfieldsSR(data, op1, reg_da, op2);
 
           condition1 = il.CompareSignedLessThan(WORD, il.Register(WORD, reg_da),
                                                 il.Const(WORD, -0x8000));
-          il.AddInstruction(il.If(condition1, trueLabel1, falseLabel1));
-
-          il.MarkLabel(trueLabel1);
-          il.AddInstruction(
-              il.SetRegister(WORD, LLIL_TEMP(0), il.Const(WORD, -0x8000)));
-          il.AddInstruction(il.Goto(doneLabel1));
-
-          il.MarkLabel(falseLabel1);
-          il.AddInstruction(
-              il.SetRegister(WORD, LLIL_TEMP(0), il.Register(WORD, reg_da)));
-          il.AddInstruction(il.Goto(doneLabel1));
-
-          il.MarkLabel(doneLabel1);
+          SelectTo(LLIL_TEMP(0), condition1, il.Const(WORD, -0x8000),
+                   il.Register(WORD, reg_da), il, WORD);
           condition2 = il.CompareSignedGreaterThan(
               WORD, il.Register(WORD, LLIL_TEMP(0)), il.Const(WORD, 0x7FFF));
-          il.AddInstruction(il.If(condition2, trueLabel2, falseLabel2));
-
-          il.MarkLabel(trueLabel2);
-          il.AddInstruction(
-              il.SetRegister(WORD, reg_da, il.Const(WORD, 0x7FFF)));
-          il.AddInstruction(il.Goto(doneLabel2));
-
-          il.MarkLabel(falseLabel2);
-          il.AddInstruction(
-              il.SetRegister(WORD, reg_da, il.Register(WORD, LLIL_TEMP(0))));
-          il.AddInstruction(il.Goto(doneLabel2));
-
-          il.MarkLabel(doneLabel2);
+          SelectTo(reg_da, condition2, il.Const(WORD, 0x7FFF),
+                   il.Register(WORD, LLIL_TEMP(0)), il, WORD);
           return true;
         }
         default:
-          LogDebug("0x%lx: Sath::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Sath::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x0B_RR:
       switch (op2) {
         case SATH_DC_DA: {
           ExprId condition1, condition2;
-          LowLevelILLabel trueLabel1, falseLabel1, doneLabel1, trueLabel2,
-              falseLabel2, doneLabel2;
           len = 4;
           uint8_t op1, op2, reg_da, s2, n, reg_dc;
           Instruction::ExtractOpfieldsRR(data, op1, op2, reg_da, s2, n, reg_dc);
 
           condition1 = il.CompareSignedLessThan(WORD, il.Register(WORD, reg_da),
                                                 il.Const(WORD, -0x8000));
-          il.AddInstruction(il.If(condition1, trueLabel1, falseLabel1));
-
-          il.MarkLabel(trueLabel1);
-          il.AddInstruction(
-              il.SetRegister(WORD, LLIL_TEMP(0), il.Const(WORD, -0x8000)));
-          il.AddInstruction(il.Goto(doneLabel1));
-
-          il.MarkLabel(falseLabel1);
-          il.AddInstruction(
-              il.SetRegister(WORD, LLIL_TEMP(0), il.Register(WORD, reg_da)));
-          il.AddInstruction(il.Goto(doneLabel1));
-
-          il.MarkLabel(doneLabel1);
+          SelectTo(LLIL_TEMP(0), condition1, il.Const(WORD, -0x8000),
+                   il.Register(WORD, reg_da), il, WORD);
           condition2 = il.CompareSignedGreaterThan(
               WORD, il.Register(WORD, LLIL_TEMP(0)), il.Const(WORD, 0x7FFF));
-          il.AddInstruction(il.If(condition2, trueLabel2, falseLabel2));
-
-          il.MarkLabel(trueLabel2);
-          il.AddInstruction(
-              il.SetRegister(WORD, reg_dc, il.Const(WORD, 0x7FFF)));
-          il.AddInstruction(il.Goto(doneLabel2));
-
-          il.MarkLabel(falseLabel2);
-          il.AddInstruction(
-              il.SetRegister(WORD, reg_dc, il.Register(WORD, LLIL_TEMP(0))));
-          il.AddInstruction(il.Goto(doneLabel2));
-
-          il.MarkLabel(doneLabel2);
+          SelectTo(reg_dc, condition2, il.Const(WORD, 0x7FFF),
+                   il.Register(WORD, LLIL_TEMP(0)), il, WORD);
           return true;
         }
         default:
-          LogDebug("0x%lx: Sath::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Sath::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Sath::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Sath::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -10476,62 +11063,43 @@ bool Sathu::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
       switch (op2) {
         case SATHU_DA: {
           ExprId condition1;
-          LowLevelILLabel trueLabel1, doneLabel1;
           len = 2;
           uint8_t op1, reg_da, op2;
           Instruction::ExtractOpfieldsSR(data, op1, reg_da, op2);
 
           condition1 = il.CompareUnsignedGreaterThan(
               WORD, il.Register(WORD, reg_da), il.Const(WORD, 0xFFFF));
-          il.AddInstruction(il.If(condition1, trueLabel1, doneLabel1));
-
-          il.MarkLabel(trueLabel1);
-          il.AddInstruction(
-              il.SetRegister(WORD, reg_da, il.Const(WORD, 0xFFFF)));
-          il.AddInstruction(il.Goto(doneLabel1));
-
-          il.MarkLabel(doneLabel1);
+          SelectTo(reg_da, condition1, il.Const(WORD, 0xFFFF),
+                   il.Register(WORD, reg_da), il, WORD);
           return true;
         }
         default:
-          LogDebug("0x%lx: Sathu::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Sathu::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x0B_RR:
       switch (op2) {
         case SATHU_DC_DA: {
           ExprId condition1;
-          LowLevelILLabel trueLabel1, falseLabel1, doneLabel1;
           len = 4;
           uint8_t op1, op2, reg_da, s2, n, reg_dc;
           Instruction::ExtractOpfieldsRR(data, op1, op2, reg_da, s2, n, reg_dc);
 
           condition1 = il.CompareUnsignedGreaterThan(
               WORD, il.Register(WORD, reg_da), il.Const(WORD, 0xFFFF));
-          il.AddInstruction(il.If(condition1, trueLabel1, falseLabel1));
-
-          il.MarkLabel(trueLabel1);
-          il.AddInstruction(
-              il.SetRegister(WORD, reg_dc, il.Const(WORD, 0xFFFF)));
-          il.AddInstruction(il.Goto(doneLabel1));
-
-          il.MarkLabel(falseLabel1);
-          il.AddInstruction(
-              il.SetRegister(WORD, reg_dc, il.Register(WORD, reg_da)));
-          il.AddInstruction(il.Goto(doneLabel1));
-
-          il.MarkLabel(doneLabel1);
+          SelectTo(reg_dc, condition1, il.Const(WORD, 0xFFFF),
+                   il.Register(WORD, reg_da), il, WORD);
           return true;
         }
         default:
-          LogDebug("0x%lx: Sathu::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Sathu::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Sathu::%s received invalid opcode 1 0x%x", addr,
-               __func__, op1);
+      TRICORE_LOG_REJECT("0x%lx: Sathu::%s received invalid opcode 1 0x%x",
+                         addr, __func__, op1);
       return false;
   }
 }
@@ -10543,7 +11111,6 @@ bool Sel::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
       switch (op2) {
         case SEL_DC_DD_DA_CONST9: {
           ExprId condition1;
-          LowLevelILLabel trueLabel1, falseLabel1, doneLabel1;
           len = 4;
           uint8_t op1, op2, reg_da, reg_dd, reg_dc;
           int16_t const9;
@@ -10552,31 +11119,19 @@ bool Sel::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 
           condition1 = il.CompareNotEqual(WORD, il.Register(WORD, reg_dd),
                                           il.Const(WORD, 0));
-          il.AddInstruction(il.If(condition1, trueLabel1, falseLabel1));
-
-          il.MarkLabel(trueLabel1);
-          il.AddInstruction(
-              il.SetRegister(WORD, reg_dc, il.Register(WORD, reg_da)));
-          il.AddInstruction(il.Goto(doneLabel1));
-
-          il.MarkLabel(falseLabel1);
-          il.AddInstruction(il.SetRegister(
-              WORD, reg_dc, il.SignExtend(WORD, il.Const(HWORD, const9))));
-          il.AddInstruction(il.Goto(doneLabel1));
-
-          il.MarkLabel(doneLabel1);
+          SelectTo(reg_dc, condition1, il.Register(WORD, reg_da),
+                   il.SignExtend(WORD, il.Const(HWORD, const9)), il, WORD);
           return true;
         }
         default:
-          LogDebug("0x%lx: Sel::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Sel::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x2B_RRR:
       switch (op2) {
         case SEL_DC_DD_DA_DB: {
           ExprId condition1;
-          LowLevelILLabel trueLabel1, falseLabel1, doneLabel1;
           len = 4;
           uint8_t op1, op2, reg_da, reg_db, n, reg_dd, reg_dc;
           Instruction::ExtractOpfieldsRRR(data, op1, op2, reg_da, reg_db, n,
@@ -10584,29 +11139,18 @@ bool Sel::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 
           condition1 = il.CompareNotEqual(WORD, il.Register(WORD, reg_dd),
                                           il.Const(WORD, 0));
-          il.AddInstruction(il.If(condition1, trueLabel1, falseLabel1));
-
-          il.MarkLabel(trueLabel1);
-          il.AddInstruction(
-              il.SetRegister(WORD, reg_dc, il.Register(WORD, reg_da)));
-          il.AddInstruction(il.Goto(doneLabel1));
-
-          il.MarkLabel(falseLabel1);
-          il.AddInstruction(
-              il.SetRegister(WORD, reg_dc, il.Register(WORD, reg_db)));
-          il.AddInstruction(il.Goto(doneLabel1));
-
-          il.MarkLabel(doneLabel1);
+          SelectTo(reg_dc, condition1, il.Register(WORD, reg_da),
+                   il.Register(WORD, reg_db), il, WORD);
           return true;
         }
         default:
-          LogDebug("0x%lx: Sel::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Sel::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Sel::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Sel::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -10618,7 +11162,6 @@ bool Seln::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
       switch (op2) {
         case SELN_DC_DD_DA_CONST9: {
           ExprId condition1;
-          LowLevelILLabel trueLabel1, falseLabel1, doneLabel1;
           len = 4;
           uint8_t op1, op2, reg_da, reg_dd, reg_dc;
           int16_t const9;
@@ -10627,31 +11170,19 @@ bool Seln::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 
           condition1 = il.CompareEqual(WORD, il.Register(WORD, reg_dd),
                                        il.Const(WORD, 0));
-          il.AddInstruction(il.If(condition1, trueLabel1, falseLabel1));
-
-          il.MarkLabel(trueLabel1);
-          il.AddInstruction(
-              il.SetRegister(WORD, reg_dc, il.Register(WORD, reg_da)));
-          il.AddInstruction(il.Goto(doneLabel1));
-
-          il.MarkLabel(falseLabel1);
-          il.AddInstruction(il.SetRegister(
-              WORD, reg_dc, il.SignExtend(WORD, il.Const(HWORD, const9))));
-          il.AddInstruction(il.Goto(doneLabel1));
-
-          il.MarkLabel(doneLabel1);
+          SelectTo(reg_dc, condition1, il.Register(WORD, reg_da),
+                   il.SignExtend(WORD, il.Const(HWORD, const9)), il, WORD);
           return true;
         }
         default:
-          LogDebug("0x%lx: Seln::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Seln::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x2B_RRR:
       switch (op2) {
         case SELN_DC_DD_DA_DB: {
           ExprId condition1;
-          LowLevelILLabel trueLabel1, falseLabel1, doneLabel1;
           len = 4;
           uint8_t op1, op2, reg_da, reg_db, n, reg_dd, reg_dc;
           Instruction::ExtractOpfieldsRRR(data, op1, op2, reg_da, reg_db, n,
@@ -10659,29 +11190,18 @@ bool Seln::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 
           condition1 = il.CompareEqual(WORD, il.Register(WORD, reg_dd),
                                        il.Const(WORD, 0));
-          il.AddInstruction(il.If(condition1, trueLabel1, falseLabel1));
-
-          il.MarkLabel(trueLabel1);
-          il.AddInstruction(
-              il.SetRegister(WORD, reg_dc, il.Register(WORD, reg_da)));
-          il.AddInstruction(il.Goto(doneLabel1));
-
-          il.MarkLabel(falseLabel1);
-          il.AddInstruction(
-              il.SetRegister(WORD, reg_dc, il.Register(WORD, reg_db)));
-          il.AddInstruction(il.Goto(doneLabel1));
-
-          il.MarkLabel(doneLabel1);
+          SelectTo(reg_dc, condition1, il.Register(WORD, reg_da),
+                   il.Register(WORD, reg_db), il, WORD);
           return true;
         }
         default:
-          LogDebug("0x%lx: Seln::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Seln::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Seln::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Seln::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -10753,8 +11273,8 @@ bool Sh::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return true;
         }
         default:
-          LogDebug("0x%lx: Sh::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Sh::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x0F_RR:
@@ -10805,13 +11325,13 @@ bool Sh::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return true;
         }
         default:
-          LogDebug("0x%lx: Sh::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Sh::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Sh::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Sh::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -10840,8 +11360,8 @@ bool Sheq::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return true;
         }
         default:
-          LogDebug("0x%lx: Sheq::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Sheq::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x0B_RR:
@@ -10862,13 +11382,13 @@ bool Sheq::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return true;
         }
         default:
-          LogDebug("0x%lx: Sheq::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Sheq::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Sheq::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Sheq::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -10916,8 +11436,9 @@ bool ShgeGeu::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return true;
         }
         default:
-          LogDebug("0x%lx: ShgeGeu::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT(
+              "0x%lx: ShgeGeu::%s received invalid opcode 2 0x%x",
+              addr, __func__, op2);
           return false;
       }
     case OP1_x0B_RR:
@@ -10953,20 +11474,61 @@ bool ShgeGeu::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return true;
         }
         default:
-          LogDebug("0x%lx: ShgeGeu::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT(
+              "0x%lx: ShgeGeu::%s received invalid opcode 2 0x%x",
+              addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: ShgeGeu::%s received invalid opcode 1 0x%x", addr,
-               __func__, op1);
+      TRICORE_LOG_REJECT("0x%lx: ShgeGeu::%s received invalid opcode 1 0x%x",
+                         addr, __func__, op1);
       return false;
   }
 }
 
 bool Shh::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                size_t& len, LowLevelILFunction& il) {
-  UNIMPLEMENTED(*((const uint16_t*)data) & 0x1 ? 4 : 2)
+  switch (op1) {
+    case OP1_x8F_RC:
+      switch (op2) {
+        case SHH_DC_DA_CONST9: {
+          len = 4;
+          uint8_t reg_da, reg_dc, op1, op2;
+          int16_t const9;
+          Instruction::ExtractOpfieldsRC(data, op1, op2, reg_da, reg_dc,
+                                         const9);
+          PackedTo(reg_dc, PackedOp::ShH,
+                   {il.Register(WORD, reg_da), il.Const(WORD, const9)},
+                   Shh::flags, il);
+          return true;
+        }
+        default:
+          TRICORE_LOG_REJECT("0x%lx: Shh::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
+          return false;
+      }
+    case OP1_x0F_RR:
+      switch (op2) {
+        case SHH_DC_DA_DB: {
+          len = 4;
+          uint8_t reg_dc, reg_da, reg_db, op1, op2, n;
+          Instruction::ExtractOpfieldsRR(data, op1, op2, reg_da, reg_db, n,
+                                         reg_dc);
+          PackedTo(reg_dc, PackedOp::ShH,
+                   {il.Register(WORD, reg_da), il.Register(WORD, reg_db)},
+                   Shh::flags, il);
+          return true;
+        }
+        default:
+          TRICORE_LOG_REJECT("0x%lx: Shh::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
+          return false;
+      }
+    default:
+      TRICORE_LOG_REJECT("0x%lx: Shh::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
+      return false;
+  }
 }
 
 bool ShltLtu::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
@@ -11012,8 +11574,9 @@ bool ShltLtu::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return true;
         }
         default:
-          LogDebug("0x%lx: ShltLtu::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT(
+              "0x%lx: ShltLtu::%s received invalid opcode 2 0x%x",
+              addr, __func__, op2);
           return false;
       }
     case OP1_x0B_RR:
@@ -11049,13 +11612,14 @@ bool ShltLtu::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return true;
         }
         default:
-          LogDebug("0x%lx: ShltLtu::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT(
+              "0x%lx: ShltLtu::%s received invalid opcode 2 0x%x",
+              addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: ShltLtu::%s received invalid opcode 1 0x%x", addr,
-               __func__, op1);
+      TRICORE_LOG_REJECT("0x%lx: ShltLtu::%s received invalid opcode 1 0x%x",
+                         addr, __func__, op1);
       return false;
   }
 }
@@ -11084,8 +11648,8 @@ bool Shne::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return true;
         }
         default:
-          LogDebug("0x%lx: Shne::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Shne::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x0B_RR:
@@ -11106,13 +11670,13 @@ bool Shne::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return true;
         }
         default:
-          LogDebug("0x%lx: Shne::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Shne::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Shne::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Shne::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -11235,8 +11799,9 @@ bool ShAndOrNorXorT::Lift(uint8_t op1, uint8_t op2, const uint8_t* data,
           return true;
         }
         default:
-          LogDebug("0x%lx: ShAndOrNorXorT::%s received invalid opcode 2 0x%x",
-                   addr, __func__, op2);
+          TRICORE_LOG_REJECT(
+              "0x%lx: ShAndOrNorXorT::%s received invalid opcode 2 0x%x",
+              addr, __func__, op2);
           return false;
       }
     case OP1_xA7_BIT:
@@ -11358,13 +11923,15 @@ bool ShAndOrNorXorT::Lift(uint8_t op1, uint8_t op2, const uint8_t* data,
           return true;
         }
         default:
-          LogDebug("0x%lx: ShAndOrNorXorT::%s received invalid opcode 2 0x%x",
-                   addr, __func__, op2);
+          TRICORE_LOG_REJECT(
+              "0x%lx: ShAndOrNorXorT::%s received invalid opcode 2 0x%x",
+              addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: ShAndOrNorXorT::%s received invalid opcode 1 0x%x", addr,
-               __func__, op1);
+      TRICORE_LOG_REJECT(
+          "0x%lx: ShAndOrNorXorT::%s received invalid opcode 1 0x%x",
+          addr, __func__, op1);
       return false;
   }
 }
@@ -11437,8 +12004,8 @@ bool Sha::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return true;
         }
         default:
-          LogDebug("0x%lx: Sha::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Sha::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x0F_RR:
@@ -11489,20 +12056,60 @@ bool Sha::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return true;
         }
         default:
-          LogDebug("0x%lx: Sha::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Sha::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Sha::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Sha::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
 
 bool Shah::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                 size_t& len, LowLevelILFunction& il) {
-  UNIMPLEMENTED(*((const uint16_t*)data) & 0x1 ? 4 : 2)
+  switch (op1) {
+    case OP1_x8F_RC:
+      switch (op2) {
+        case SHAH_DC_DA_CONST9: {
+          len = 4;
+          uint8_t reg_da, reg_dc, op1, op2;
+          int16_t const9;
+          Instruction::ExtractOpfieldsRC(data, op1, op2, reg_da, reg_dc,
+                                         const9);
+          PackedTo(reg_dc, PackedOp::ShaH,
+                   {il.Register(WORD, reg_da), il.Const(WORD, const9)},
+                   Shah::flags, il);
+          return true;
+        }
+        default:
+          TRICORE_LOG_REJECT("0x%lx: Shah::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
+          return false;
+      }
+    case OP1_x0F_RR:
+      switch (op2) {
+        case SHAH_DC_DA_DB: {
+          len = 4;
+          uint8_t reg_dc, reg_da, reg_db, op1, op2, n;
+          Instruction::ExtractOpfieldsRR(data, op1, op2, reg_da, reg_db, n,
+                                         reg_dc);
+          PackedTo(reg_dc, PackedOp::ShaH,
+                   {il.Register(WORD, reg_da), il.Register(WORD, reg_db)},
+                   Shah::flags, il);
+          return true;
+        }
+        default:
+          TRICORE_LOG_REJECT("0x%lx: Shah::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
+          return false;
+      }
+    default:
+      TRICORE_LOG_REJECT("0x%lx: Shah::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
+      return false;
+  }
 }
 
 bool Shas::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
@@ -11604,8 +12211,8 @@ bool Sta::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return true;
         }
         default:
-          LogDebug("0x%lx: Sta::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Sta::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x89_BO:
@@ -11658,8 +12265,8 @@ bool Sta::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return true;
         }
         default:
-          LogDebug("0x%lx: Sta::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Sta::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_xA9_BO:
@@ -11671,13 +12278,13 @@ bool Sta::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           len = 4;
           UNIMPLEMENTED(*((const uint16_t*)data) & 0x1 ? 4 : 2)
         default:
-          LogDebug("0x%lx: Sta::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Sta::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Sta::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Sta::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -11758,8 +12365,8 @@ bool Stb::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return true;
         }
         default:
-          LogDebug("0x%lx: Stb::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Stb::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x89_BO:
@@ -11809,8 +12416,8 @@ bool Stb::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return true;
         }
         default:
-          LogDebug("0x%lx: Stb::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Stb::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_xA9_BO:
@@ -11822,13 +12429,13 @@ bool Stb::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           len = 4;
           UNIMPLEMENTED(*((const uint16_t*)data) & 0x1 ? 4 : 2)
         default:
-          LogDebug("0x%lx: Stb::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Stb::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Stb::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Stb::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -11849,8 +12456,8 @@ bool Std::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return true;
         }
         default:
-          LogDebug("0x%lx: Std::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Std::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x89_BO:
@@ -11903,8 +12510,8 @@ bool Std::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return true;
         }
         default:
-          LogDebug("0x%lx: Std::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Std::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_xA9_BO:
@@ -11916,13 +12523,13 @@ bool Std::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           len = 4;
           UNIMPLEMENTED(*((const uint16_t*)data) & 0x1 ? 4 : 2)
         default:
-          LogDebug("0x%lx: Std::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Std::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Std::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Std::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -11943,8 +12550,8 @@ bool Stda::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return true;
         }
         default:
-          LogDebug("0x%lx: Stda::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Stda::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x89_BO:
@@ -11997,8 +12604,8 @@ bool Stda::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return true;
         }
         default:
-          LogDebug("0x%lx: Stda::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Stda::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_xA9_BO:
@@ -12010,13 +12617,13 @@ bool Stda::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           len = 4;
           UNIMPLEMENTED(*((const uint16_t*)data) & 0x1 ? 4 : 2)
         default:
-          LogDebug("0x%lx: Stda::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Stda::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Stda::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Stda::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -12097,8 +12704,8 @@ bool Sth::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return true;
         }
         default:
-          LogDebug("0x%lx: Sth::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Sth::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x89_BO:
@@ -12148,8 +12755,8 @@ bool Sth::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return true;
         }
         default:
-          LogDebug("0x%lx: Sth::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Sth::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_xA9_BO:
@@ -12161,13 +12768,13 @@ bool Sth::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           len = 4;
           UNIMPLEMENTED(*((const uint16_t*)data) & 0x1 ? 4 : 2)
         default:
-          LogDebug("0x%lx: Sth::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Sth::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Sth::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Sth::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -12189,8 +12796,8 @@ bool Stq::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return true;
         }
         default:
-          LogDebug("0x%lx: Stq::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Stq::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x89_BO:
@@ -12243,8 +12850,8 @@ bool Stq::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return true;
         }
         default:
-          LogDebug("0x%lx: Stq::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Stq::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_xA9_BO:
@@ -12254,13 +12861,13 @@ bool Stq::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
         case STQ_PB_OFF10_DA:
           UNIMPLEMENTED(*((const uint16_t*)data) & 0x1 ? 4 : 2)
         default:
-          LogDebug("0x%lx: Stq::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Stq::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Stq::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Stq::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -12268,8 +12875,8 @@ bool Stq::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Stt::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                size_t& len, LowLevelILFunction& il) {
   if (op1 != OP1_xD5_ABSB || op2 != STT_OFF18_BPOS3_B) {
-    LogDebug("0x%lx: Stt::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT("0x%lx: Stt::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
     return false;
   }
   {
@@ -12378,8 +12985,8 @@ bool Stw::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return true;
         }
         default:
-          LogDebug("0x%lx: Stw::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Stw::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x89_BO:
@@ -12429,8 +13036,8 @@ bool Stw::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return true;
         }
         default:
-          LogDebug("0x%lx: Stw::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Stw::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_xA9_BO:
@@ -12442,25 +13049,71 @@ bool Stw::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           len = 4;
           UNIMPLEMENTED(*((const uint16_t*)data) & 0x1 ? 4 : 2)
         default:
-          LogDebug("0x%lx: Stw::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Stw::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Stw::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Stw::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
 
 bool Stlcx::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                  size_t& len, LowLevelILFunction& il) {
-  UNIMPLEMENTED(*((const uint16_t*)data) & 0x1 ? 4 : 2)
+  switch (op1) {
+    case OP1_x15_ABS:
+      if (op2 != STLCX_OFF18) {
+        TRICORE_LOG_REJECT("0x%lx: Stlcx::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
+        return false;
+      }
+      break;
+    case OP1_x49_BO:
+      if (op2 != STLCX_AB_OFF10) {
+        TRICORE_LOG_REJECT("0x%lx: Stlcx::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
+        return false;
+      }
+      break;
+    default:
+      TRICORE_LOG_REJECT("0x%lx: Stlcx::%s received invalid opcode 1 0x%x",
+                         addr, __func__, op1);
+      return false;
+  }
+  len = 4;
+  SetCsaOperand(op1, data, il);
+  StoreContext(kLowerContext, il);
+  return true;
 }
 
 bool Stucx::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                  size_t& len, LowLevelILFunction& il) {
-  UNIMPLEMENTED(*((const uint16_t*)data) & 0x1 ? 4 : 2)
+  switch (op1) {
+    case OP1_x15_ABS:
+      if (op2 != STUCX_OFF18) {
+        TRICORE_LOG_REJECT("0x%lx: Stucx::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
+        return false;
+      }
+      break;
+    case OP1_x49_BO:
+      if (op2 != STUCX_AB_OFF10) {
+        TRICORE_LOG_REJECT("0x%lx: Stucx::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
+        return false;
+      }
+      break;
+    default:
+      TRICORE_LOG_REJECT("0x%lx: Stucx::%s received invalid opcode 1 0x%x",
+                         addr, __func__, op1);
+      return false;
+  }
+  len = 4;
+  SetCsaOperand(op1, data, il);
+  StoreContext(kUpperContext, il);
+  return true;
 }
 
 bool Sub::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
@@ -12508,13 +13161,13 @@ bool Sub::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return true;
         }
         default:
-          LogDebug("0x%lx: Sub::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Sub::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Sub::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Sub::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -12550,13 +13203,13 @@ bool Suba::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return true;
         }
         default:
-          LogDebug("0x%lx: Suba::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Suba::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Suba::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Suba::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -12564,87 +13217,32 @@ bool Suba::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Subbh::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                  size_t& len, LowLevelILFunction& il) {
   if (op1 != OP1_x0B_RR) {
-    LogDebug("0x%lx: Subbh::%s received invalid opcode 1 0x%x", addr, __func__,
-             op1);
+    TRICORE_LOG_REJECT("0x%lx: Subbh::%s received invalid opcode 1 0x%x", addr,
+                       __func__, op1);
     return false;
   }
   switch (op2) {
     case SUBB_DC_DA_DB: {
-      ExprId result_byte0, result_byte1, result_byte2, result_byte3, result;
       len = 4;
       uint8_t reg_dc, reg_da, reg_db, op1, op2, n;
       Instruction::ExtractOpfieldsRR(data, op1, op2, reg_da, reg_db, n, reg_dc);
-      result_byte0 = il.Sub(
-          BYTE,
-          il.And(WORD, il.Register(WORD, reg_da), il.Const(WORD, 0x000000FF)),
-          il.And(WORD, il.Register(WORD, reg_db), il.Const(WORD, 0x000000FF)));
-      result_byte1 =
-          il.Sub(BYTE,
-                 il.And(WORD,
-                        il.LogicalShiftRight(WORD, il.Register(WORD, reg_da),
-                                             il.Const(WORD, 8)),
-                        il.Const(WORD, 0x000000FF)),
-                 il.And(WORD,
-                        il.LogicalShiftRight(WORD, il.Register(WORD, reg_db),
-                                             il.Const(WORD, 8)),
-                        il.Const(WORD, 0x000000FF)));
-      result_byte2 =
-          il.Sub(BYTE,
-                 il.And(WORD,
-                        il.LogicalShiftRight(WORD, il.Register(WORD, reg_da),
-                                             il.Const(WORD, 16)),
-                        il.Const(WORD, 0x000000FF)),
-                 il.And(WORD,
-                        il.LogicalShiftRight(WORD, il.Register(WORD, reg_db),
-                                             il.Const(WORD, 16)),
-                        il.Const(WORD, 0x000000FF)));
-      result_byte3 =
-          il.Sub(BYTE,
-                 il.And(WORD,
-                        il.LogicalShiftRight(WORD, il.Register(WORD, reg_da),
-                                             il.Const(WORD, 24)),
-                        il.Const(WORD, 0x000000FF)),
-                 il.And(WORD,
-                        il.LogicalShiftRight(WORD, il.Register(WORD, reg_db),
-                                             il.Const(WORD, 24)),
-                        il.Const(WORD, 0x000000FF)));
-      result = il.Or(
-          WORD,
-          il.Or(WORD, il.ShiftLeft(WORD, result_byte3, il.Const(WORD, 24)),
-                il.ShiftLeft(WORD, result_byte2, il.Const(WORD, 16))),
-          il.Or(WORD, il.ShiftLeft(WORD, result_byte1, il.Const(WORD, 8)),
-                result_byte0));
-      il.AddInstruction(il.SetRegister(WORD, reg_dc, result));
+      PackedTo(reg_dc, PackedOp::SubB,
+               {il.Register(WORD, reg_da), il.Register(WORD, reg_db)},
+               Subbh::flags, il);
       return true;
     }
     case SUBH_DC_DA_DB: {
-      ExprId result_hword0, result_hword1, result;
       len = 4;
       uint8_t reg_dc, reg_da, reg_db, op1, op2, n;
       Instruction::ExtractOpfieldsRR(data, op1, op2, reg_da, reg_db, n, reg_dc);
-      result_hword0 = il.Sub(
-          HWORD,
-          il.And(WORD, il.Register(WORD, reg_da), il.Const(WORD, 0x0000FFFF)),
-          il.And(WORD, il.Register(WORD, reg_db), il.Const(WORD, 0x0000FFFF)));
-      result_hword1 =
-          il.Sub(HWORD,
-                 il.And(WORD,
-                        il.LogicalShiftRight(WORD, il.Register(WORD, reg_da),
-                                             il.Const(WORD, 16)),
-                        il.Const(WORD, 0x0000FFFF)),
-                 il.And(WORD,
-                        il.LogicalShiftRight(WORD, il.Register(WORD, reg_db),
-                                             il.Const(WORD, 16)),
-                        il.Const(WORD, 0x0000FFFF)));
-      result =
-          il.Or(WORD, il.ShiftLeft(WORD, result_hword1, il.Const(WORD, 16)),
-                result_hword0);
-      il.AddInstruction(il.SetRegister(WORD, reg_dc, result));
+      PackedTo(reg_dc, PackedOp::SubH,
+               {il.Register(WORD, reg_da), il.Register(WORD, reg_db)},
+               Subbh::flags, il);
       return true;
     }
     default:
-      LogDebug("0x%lx: Subh::%s received invalid opcode 2 0x%x", addr, __func__,
-               op2);
+      TRICORE_LOG_REJECT("0x%lx: Subh::%s received invalid opcode 2 0x%x", addr,
+                         __func__, op2);
       return false;
   }
 }
@@ -12666,8 +13264,7 @@ bool Subsu::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
       il.AddInstruction(il.SetRegister(
           WORD, LLIL_TEMP(0),
           il.Sub(WORD, il.Register(WORD, reg_da), il.Register(WORD, reg_db))));
-      ssov(il.Register(WORD, LLIL_TEMP(0)), il.Const(WORD, 32), reg_da, il,
-           WORD);
+      ssov(il.Register(WORD, LLIL_TEMP(0)), 32, reg_da, il, WORD);
       return true;
     }
     case OP1_x0B_RR:
@@ -12681,8 +13278,7 @@ bool Subsu::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
               il.SetRegister(WORD, LLIL_TEMP(0),
                              il.Sub(WORD, il.Register(WORD, reg_da),
                                     il.Register(WORD, reg_db))));
-          ssov(il.Register(WORD, LLIL_TEMP(0)), il.Const(WORD, 32), reg_dc, il,
-               WORD);
+          ssov(il.Register(WORD, LLIL_TEMP(0)), 32, reg_dc, il, WORD);
           return true;
         }
         case SUBSU_DC_DA_DB: {
@@ -12694,18 +13290,17 @@ bool Subsu::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
               il.SetRegister(WORD, LLIL_TEMP(0),
                              il.Sub(WORD, il.Register(WORD, reg_da),
                                     il.Register(WORD, reg_db))));
-          suov(il.Register(WORD, LLIL_TEMP(0)), il.Const(WORD, 32), reg_dc, il,
-               WORD);
+          suov(il.Register(WORD, LLIL_TEMP(0)), 32, reg_dc, il, WORD);
           return true;
         }
         default:
-          LogDebug("0x%lx: Subsu::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Subsu::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Subsu::%s received invalid opcode 1 0x%x", addr,
-               __func__, op1);
+      TRICORE_LOG_REJECT("0x%lx: Subsu::%s received invalid opcode 1 0x%x",
+                         addr, __func__, op1);
       return false;
   }
 }
@@ -12713,70 +13308,32 @@ bool Subsu::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool SubshHu::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                    size_t& len, LowLevelILFunction& il) {
   if (op1 != OP1_x0B_RR) {
-    LogDebug("0x%lx: SubshHu::%s received invalid opcode 1 0x%x", addr,
-             __func__, op1);
+    TRICORE_LOG_REJECT("0x%lx: SubshHu::%s received invalid opcode 1 0x%x",
+                       addr, __func__, op1);
     return false;
   }
   switch (op2) {
     case SUBSH_DC_DA_DB: {
-      ExprId result_hword0, result_hword1, result;
       len = 4;
       uint8_t reg_dc, reg_da, reg_db, op1, op2, n;
       Instruction::ExtractOpfieldsRR(data, op1, op2, reg_da, reg_db, n, reg_dc);
-      result_hword0 = il.Sub(
-          HWORD,
-          il.And(WORD, il.Register(WORD, reg_da), il.Const(WORD, 0x0000FFFF)),
-          il.And(WORD, il.Register(WORD, reg_db), il.Const(WORD, 0x0000FFFF)));
-      result_hword1 =
-          il.Sub(HWORD,
-                 il.And(WORD,
-                        il.LogicalShiftRight(WORD, il.Register(WORD, reg_da),
-                                             il.Const(WORD, 16)),
-                        il.Const(WORD, 0x0000FFFF)),
-                 il.And(WORD,
-                        il.LogicalShiftRight(WORD, il.Register(WORD, reg_db),
-                                             il.Const(WORD, 16)),
-                        il.Const(WORD, 0x0000FFFF)));
-      ssov(result_hword0, il.Const(HWORD, 16), LLIL_TEMP(0), il, HWORD);
-      ssov(result_hword1, il.Const(HWORD, 16), LLIL_TEMP(1), il, HWORD);
-      result = il.Or(WORD,
-                     il.ShiftLeft(WORD, il.Register(WORD, LLIL_TEMP(1)),
-                                  il.Const(WORD, 16)),
-                     il.Register(WORD, LLIL_TEMP(0)));
-      il.AddInstruction(il.SetRegister(WORD, reg_dc, result));
+      PackedTo(reg_dc, PackedOp::SubsH,
+               {il.Register(WORD, reg_da), il.Register(WORD, reg_db)},
+               SubshHu::flags, il);
       return true;
     }
     case SUBSHU_DC_DA_DB: {
-      ExprId result_hword0, result_hword1, result;
       len = 4;
       uint8_t reg_dc, reg_da, reg_db, op1, op2, n;
       Instruction::ExtractOpfieldsRR(data, op1, op2, reg_da, reg_db, n, reg_dc);
-      result_hword0 = il.Sub(
-          HWORD,
-          il.And(WORD, il.Register(WORD, reg_da), il.Const(WORD, 0x0000FFFF)),
-          il.And(WORD, il.Register(WORD, reg_db), il.Const(WORD, 0x0000FFFF)));
-      result_hword1 =
-          il.Sub(HWORD,
-                 il.And(WORD,
-                        il.LogicalShiftRight(WORD, il.Register(WORD, reg_da),
-                                             il.Const(WORD, 16)),
-                        il.Const(WORD, 0x0000FFFF)),
-                 il.And(WORD,
-                        il.LogicalShiftRight(WORD, il.Register(WORD, reg_db),
-                                             il.Const(WORD, 16)),
-                        il.Const(WORD, 0x0000FFFF)));
-      suov(result_hword0, il.Const(HWORD, 16), LLIL_TEMP(0), il, HWORD);
-      suov(result_hword1, il.Const(HWORD, 16), LLIL_TEMP(1), il, HWORD);
-      result = il.Or(WORD,
-                     il.ShiftLeft(WORD, il.Register(WORD, LLIL_TEMP(1)),
-                                  il.Const(WORD, 16)),
-                     il.Register(WORD, LLIL_TEMP(0)));
-      il.AddInstruction(il.SetRegister(WORD, reg_dc, result));
+      PackedTo(reg_dc, PackedOp::SubsHu,
+               {il.Register(WORD, reg_da), il.Register(WORD, reg_db)},
+               SubshHu::flags, il);
       return true;
     }
     default:
-      LogDebug("0x%lx: SubshHu::%s received invalid opcode 1 0x%x", addr,
-               __func__, op1);
+      TRICORE_LOG_REJECT("0x%lx: SubshHu::%s received invalid opcode 1 0x%x",
+                         addr, __func__, op1);
       return false;
   }
 }
@@ -12784,8 +13341,8 @@ bool SubshHu::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Subx::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                 size_t& len, LowLevelILFunction& il) {
   if (op1 != OP1_x0B_RR || op2 != SUBX_DC_DA_DB) {
-    LogDebug("0x%lx: Subx::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT("0x%lx: Subx::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
     return false;
   }
   {
@@ -12802,7 +13359,14 @@ bool Subx::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 
 bool Svlcx::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                  size_t& len, LowLevelILFunction& il) {
-  UNIMPLEMENTED(*((const uint16_t*)data) & 0x1 ? 4 : 2)
+  if (op1 != OP1_x0D_SYS || op2 != SVLCX) {
+    TRICORE_LOG_REJECT("0x%lx: Svlcx::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
+    return false;
+  }
+  len = 4;
+  SaveContext(kLowerContext, il);
+  return true;
 }
 
 bool Swapw::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
@@ -12852,8 +13416,8 @@ bool Xnor::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return true;
         }
         default:
-          LogDebug("0x%lx: Xnor::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Xnor::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x0F_RR:
@@ -12870,13 +13434,13 @@ bool Xnor::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return true;
         }
         default:
-          LogDebug("0x%lx: Xnor::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Xnor::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Xnor::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Xnor::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -12884,8 +13448,8 @@ bool Xnor::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Xnort::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                  size_t& len, LowLevelILFunction& il) {
   if (op1 != OP1_x07_BIT || op2 != XNORT_DC_DA_POS1_DB_POS2) {
-    LogDebug("0x%lx: Xnort::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT("0x%lx: Xnort::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
     return false;
   }
   {
@@ -12943,8 +13507,8 @@ bool Xor::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return true;
         }
         default:
-          LogDebug("0x%lx: Xor::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Xor::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x0F_RR:
@@ -12961,13 +13525,13 @@ bool Xor::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return true;
         }
         default:
-          LogDebug("0x%lx: Xor::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Xor::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Xor::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Xor::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -12993,8 +13557,8 @@ bool Xoreq::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return true;
         }
         default:
-          LogDebug("0x%lx: Xoreq::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Xoreq::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x0B_RR:
@@ -13013,13 +13577,13 @@ bool Xoreq::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return true;
         }
         default:
-          LogDebug("0x%lx: Xoreq::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Xoreq::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Xoreq::%s received invalid opcode 1 0x%x", addr,
-               __func__, op1);
+      TRICORE_LOG_REJECT("0x%lx: Xoreq::%s received invalid opcode 1 0x%x",
+                         addr, __func__, op1);
       return false;
   }
 }
@@ -13060,8 +13624,8 @@ bool Xorge::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return true;
         }
         default:
-          LogDebug("0x%lx: Xorge::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Xorge::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x0B_RR:
@@ -13093,13 +13657,13 @@ bool Xorge::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return true;
         }
         default:
-          LogDebug("0x%lx: Xorge::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Xorge::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Xorge::%s received invalid opcode 1 0x%x", addr,
-               __func__, op1);
+      TRICORE_LOG_REJECT("0x%lx: Xorge::%s received invalid opcode 1 0x%x",
+                         addr, __func__, op1);
       return false;
   }
 }
@@ -13140,8 +13704,8 @@ bool Xorlt::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return true;
         }
         default:
-          LogDebug("0x%lx: Xorlt::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Xorlt::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x0B_RR:
@@ -13173,13 +13737,13 @@ bool Xorlt::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return true;
         }
         default:
-          LogDebug("0x%lx: Xorlt::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Xorlt::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Xorlt::%s received invalid opcode 1 0x%x", addr,
-               __func__, op1);
+      TRICORE_LOG_REJECT("0x%lx: Xorlt::%s received invalid opcode 1 0x%x",
+                         addr, __func__, op1);
       return false;
   }
 }
@@ -13205,8 +13769,8 @@ bool Xorne::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return true;
         }
         default:
-          LogDebug("0x%lx: Xorne::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Xorne::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x0B_RR:
@@ -13225,13 +13789,13 @@ bool Xorne::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return true;
         }
         default:
-          LogDebug("0x%lx: Xorne::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Xorne::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Xorne::%s received invalid opcode 1 0x%x", addr,
-               __func__, op1);
+      TRICORE_LOG_REJECT("0x%lx: Xorne::%s received invalid opcode 1 0x%x",
+                         addr, __func__, op1);
       return false;
   }
 }
@@ -13239,8 +13803,8 @@ bool Xorne::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Xort::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                 size_t& len, LowLevelILFunction& il) {
   if (op1 != OP1_x07_BIT || op2 != XORT_DC_DA_POS1_DB_POS2) {
-    LogDebug("0x%lx: Xort::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT("0x%lx: Xort::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
     return false;
   }
   {
@@ -13274,8 +13838,8 @@ bool Xort::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Addf::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                 size_t& len, LowLevelILFunction& il) {
   if (op1 != OP1_x6B_RRR || op2 != ADDF_DC_DD_DA) {
-    LogDebug("0x%lx: Addf::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT("0x%lx: Addf::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
     return false;
   }
   {
@@ -13302,8 +13866,8 @@ bool Cmpf::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
   // bits[31:06] are cleared
 
   if (op1 != OP1_x4B_RR || op2 != CMPF_DC_DA_DB) {
-    LogDebug("0x%lx: Cmpf::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT("0x%lx: Cmpf::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
     return false;
   }
   {
@@ -13382,8 +13946,8 @@ bool Cmpf::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Divf::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                 size_t& len, LowLevelILFunction& il) {
   if (op1 != OP1_x4B_RR || op2 != DIVF_DC_DA_DB) {
-    LogDebug("0x%lx: Divf::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT("0x%lx: Divf::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
     return false;
   }
   {
@@ -13401,8 +13965,8 @@ bool Divf::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Ftoi::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                 size_t& len, LowLevelILFunction& il) {
   if (op1 != OP1_x4B_RR || op2 != FTOI_DC_DA) {
-    LogDebug("0x%lx: Ftoi::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT("0x%lx: Ftoi::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
     return false;
   }
   {
@@ -13443,8 +14007,8 @@ bool Ftouz::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Itof::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                 size_t& len, LowLevelILFunction& il) {
   if (op1 != OP1_x4B_RR || op2 != ITOF_DC_DA) {
-    LogDebug("0x%lx: Itof::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT("0x%lx: Itof::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
     return false;
   }
   {
@@ -13460,8 +14024,8 @@ bool Itof::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Maddf::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                  size_t& len, LowLevelILFunction& il) {
   if (op1 != OP1_x6B_RRR || op2 != MADDF_DC_DD_DA_DB) {
-    LogDebug("0x%lx: Maddf::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT("0x%lx: Maddf::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
     return false;
   }
   {
@@ -13486,8 +14050,8 @@ bool Msubf::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Mulf::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                 size_t& len, LowLevelILFunction& il) {
   if (op1 != OP1_x4B_RR || op2 != MULF_DC_DA_DB) {
-    LogDebug("0x%lx: Mulf::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT("0x%lx: Mulf::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
     return false;
   }
   {
@@ -13515,8 +14079,8 @@ bool Qseedf::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Subf::Lift(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                 size_t& len, LowLevelILFunction& il) {
   if (op1 != OP1_x6B_RRR || op2 != SUBF_DC_DD_DA) {
-    LogDebug("0x%lx: Subf::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT("0x%lx: Subf::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
     return false;
   }
   {
@@ -0,0 +1,86 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#ifndef BINARYNINJA_API_TRICORE_MNEMONICS_H
+#define BINARYNINJA_API_TRICORE_MNEMONICS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace Tricore {
+// Every mnemonic the Text handlers render, sorted
+inline constexpr std::string_view kMnemonics[] = {
+    "Itof", "abs", "abs.b", "abs.h", "absdif", "absdif.b", "absdif.h",
+    "absdifs", "absdifs.h", "abss", "abssh", "add", "add.a", "add.b", "add.f",
+    "add.h", "addc", "addi", "addih", "addih.a", "adds", "adds.h", "adds.hu",
+    "adds.u", "addsc.a", "addsc.at", "addx", "and", "and.and.t", "and.andn.t",
+    "and.eq", "and.ge", "and.ge.u", "and.lt", "and.lt.u", "and.ne",
+    "and.nor.t", "and.or.t", "and.t", "andn", "andn.t", "bisr", "bmerge",
+    "bsplit", "cachea.i", "cachea.w", "cachea.wi", "cachei.i", "cachei.w",
+    "cachei.wi", "cadd", "caddn", "call", "calla", "calli", "clo", "cloh",
+    "cls", "clsh", "clz", "clzh", "cmov", "cmovn", "cmp.f", "cmpswap.w",
+    "crc32", "csub", "csubn", "debug", "dextr", "disable", "div", "div.f",
+    "div.u", "dsync", "dvadj", "dvinit", "dvinit.b", "dvinit.bu", "dvinit.h",
+    "dvinit.hu", "dvinit.u", "dvstep", "dvstep.u", "enable", "eq", "eq.a",
+    "eq.b", "eq.h", "eq.w", "eqany.b", "eqany.h", "eqz.a", "extr", "extr.u",
+    "fcall", "fcalla", "fcalli", "fret", "ftoi", "ftoiz", "ftoq31", "ftoq31z",
+    "ftou", "ftouz", "ge", "ge.a", "ge.u", "imask", "ins.t", "insert",
+    "insn.t", "isync", "ixmax", "ixmax.u", "ixmin", "ixmin.u", "j", "ja",
+    "jeq", "jeqa", "jge", "jge.u", "jgez", "jgtz", "ji", "jl", "jla", "jlez",
+    "jli", "jlt", "jlt.u", "jltz", "jne", "jnea", "jned", "jnei", "jnz",
+    "jnz.a", "jnz.t", "jz", "jz.a", "jz.t", "ld.a", "ld.b", "ld.bu", "ld.d",
+    "ld.da", "ld.h", "ld.hu", "ld.q", "ld.w", "ldlcx", "ldmst", "lducx", "lea",
+    "loop", "loopu", "lt", "lt.a", "lt.b", "lt.bu", "lt.h", "lt.hu", "lt.u",
+    "lt.w", "lt.wu", "madd", "madd.f", "madd.h", "madd.q", "madd.u", "maddm.h",
+    "maddms.h", "maddr.h", "maddr.q", "maddrs.h", "maddrs.q", "madds",
+    "madds.h", "madds.q", "madds.u", "maddsu.h", "maddsum.h", "maddsums.h",
+    "maddsur.h", "maddsurs.h", "maddsus.h", "max", "max.b", "max.bu", "max.h",
+    "max.hu", "max.u", "mfcr", "min", "min.b", "min.bu", "min.h", "min.hu",
+    "min.u", "mov", "mov.a", "mov.aa", "mov.d", "mov.u", "movh", "movh.a",
+    "msub", "msub.f", "msub.h", "msub.q", "msub.u", "msubad.h", "msubadm.h",
+    "msubadms.h", "msubadr.h", "msubadrs.h", "msubads.h", "msubm.h",
+    "msubms.h", "msubr.h", "msubr.q", "msubrs.h", "msubrs.q", "msubs",
+    "msubs.h", "msubs.q", "msubs.u", "mtcr", "mul", "mul.f", "mul.h", "mul.q",
+    "mul.u", "mulm.h", "mulr.h", "mulr.q", "muls", "muls.u", "nand", "nand.t",
+    "ne", "ne.a", "nez.a", "nop", "nor", "nor.t", "not", "or", "or.and.t",
+    "or.andn.t", "or.eq", "or.ge", "or.ge.u", "or.lt", "or.lt.u", "or.ne",
+    "or.nor.t", "or.or.t", "or.t", "orn", "orn.t", "pack", "parity", "q31tof",
+    "qseed.f", "restore", "ret", "rfe", "rfm", "rslcx", "rstv", "rsub",
+    "rsubs", "rsubs.u", "sat.b", "sat.bu", "sat.h", "sat.hu", "sel", "seln",
+    "sh", "sh.and.t", "sh.andn.t", "sh.eq", "sh.ge", "sh.ge.u", "sh.h",
+    "sh.lt", "sh.lt.u", "sh.nand.t", "sh.ne", "sh.nor.t", "sh.or.t",
+    "sh.orn.t", "sh.xnor.t", "sh.xor.t", "sha", "sha.h", "shas", "st.a",
+    "st.b", "st.d", "st.da", "st.h", "st.q", "st.t", "st.w", "stlcx", "stucx",
+    "sub", "sub.a", "sub.b", "sub.f", "sub.h", "subc", "subs", "subs.h",
+    "subs.hu", "subs.u", "subx", "svlcx", "swap.w", "syscall", "tlbdemap",
+    "tlbflush.a", "tlbflush.b", "tlbmap", "tlbprobe.a", "tlbprobe.i", "trapsv",
+    "trapv", "unpack", "updfl", "utof", "wait", "xnor", "xnor.t", "xor",
+    "xor.eq", "xor.ge", "xor.ge.u", "xor.lt", "xor.lt.u", "xor.ne", "xor.t",
+};
+
+// Index of a mnemonic in kMnemonics. It converts from a string literal at
+// compile time, so handlers can keep writing "abs.b" while rendering only
+// copies an interned string, and a misspelled mnemonic fails to compile.
+class Mnemonic {
+ public:
+  template <size_t N>
+  consteval Mnemonic(const char (&text)[N]) : id(Find({text, N - 1})) {}
+
+  uint16_t Id() const { return id; }
+  // Interned text, for InstructionTextToken
+  const std::string& Text() const;
+
+ private:
+  static consteval uint16_t Find(std::string_view text) {
+    for (size_t i = 0; i < std::size(kMnemonics); i++)
+      if (kMnemonics[i] == text) return static_cast<uint16_t>(i);
+    throw "mnemonic missing from kMnemonics";
+  }
+
+  uint16_t id;
+};
+}  // namespace Tricore
+
+#endif  // BINARYNINJA_API_TRICORE_MNEMONICS_H
@@ -0,0 +1,161 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#ifndef BINARYNINJA_API_TRICORE_OPERANDS_H
+#define BINARYNINJA_API_TRICORE_OPERANDS_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "fields.h"
+#include "formats.h"
+#include "registers.h"
+
+namespace Tricore {
+// Instruction fields an operand template can refer to. The short formats'
+// s1d field is loaded as S1.
+enum class Operand : uint8_t {
+  None,
+  S1,
+  S2,
+  S3,
+  D,
+  N,
+  Pos,
+  Pos1,
+  Pos2,
+  Width,
+  B,
+  Bpos3,
+  Const4,
+  Const8,
+  Const9,
+  Const16,
+  Off4,
+  Off10,
+  Off16,
+  Ea,
+  Count,
+};
+
+// Width in bits of the field's C type in Opfields; the immediates and
+// offsets are signed, everything else is unsigned
+constexpr unsigned OperandBits(Operand field) {
+  switch (field) {
+    case Operand::Const9:
+    case Operand::Const16:
+    case Operand::Off10:
+    case Operand::Off16:
+      return 16;
+    case Operand::Ea:
+      return 32;
+    default:
+      return 8;
+  }
+}
+
+using OperandValues = std::array<int64_t, static_cast<size_t>(Operand::Count)>;
+
+// Decode the fields of format F that operand templates can refer to
+template <Format F>
+OperandValues LoadOperands(const uint8_t* data) {
+  const auto f = Opfields<F>::Decode(F < Format::ABS
+                                         ? InstructionFields::Load16(data)
+                                         : InstructionFields::Load32(data));
+  // Only fields present in F are ever read, and None is the fixed register
+  // base
+  OperandValues v;
+  v[static_cast<size_t>(Operand::None)] = 0;
+  auto set = [&v](Operand field, int64_t value) {
+    v[static_cast<size_t>(field)] = value;
+  };
+  if constexpr (requires { f.s1; }) set(Operand::S1, f.s1);
+  if constexpr (requires { f.s1d; }) set(Operand::S1, f.s1d);
+  if constexpr (requires { f.s2; }) set(Operand::S2, f.s2);
+  if constexpr (requires { f.s3; }) set(Operand::S3, f.s3);
+  if constexpr (requires { f.d; }) set(Operand::D, f.d);
+  if constexpr (requires { f.n; }) set(Operand::N, f.n);
+  if constexpr (requires { f.pos; }) set(Operand::Pos, f.pos);
+  if constexpr (requires { f.pos1; }) set(Operand::Pos1, f.pos1);
+  if constexpr (requires { f.pos2; }) set(Operand::Pos2, f.pos2);
+  if constexpr (requires { f.width; }) set(Operand::Width, f.width);
+  if constexpr (requires { f.b; }) set(Operand::B, f.b);
+  if constexpr (requires { f.bpos3; }) set(Operand::Bpos3, f.bpos3);
+  if constexpr (requires { f.const4; }) set(Operand::Const4, f.const4);
+  if constexpr (requires { f.const8; }) set(Operand::Const8, f.const8);
+  if constexpr (requires { f.const9; }) set(Operand::Const9, f.const9);
+  if constexpr (requires { f.const16; }) set(Operand::Const16, f.const16);
+  if constexpr (requires { f.off4; }) set(Operand::Off4, f.off4);
+  if constexpr (requires { f.off10; }) set(Operand::Off10, f.off10);
+  if constexpr (requires { f.off16; }) set(Operand::Off16, f.off16);
+  if constexpr (requires { f.ea; }) set(Operand::Ea, f.ea);
+  return v;
+}
+
+// One token of an operand template. A TextOp is an instruction format plus a
+// list of these, rendered in order after the mnemonic.
+struct OperandStep {
+  enum class Kind : uint8_t {
+    Register,     // field + value (register class), or the fixed id in value
+    Separator,    // ", "
+    Text,         // text
+    AddressMode,  // text when the addressing mode is value, else otherwise
+    Integer,      // signed hex; unsigned hex after masking with value when
+                  // the caller asks for unsigned
+    Unsigned,     // unsigned hex of the field's C type
+    Hex,          // unsigned hex of the field widened to 32 bits
+    Decimal,      // '#' and decimal, masked with value when unsigned
+  };
+
+  Kind kind;
+  Operand field = Operand::None;
+  bool address = false;  // PossibleAddressToken rather than IntegerToken
+  uint16_t value = 0;
+  const char* text = nullptr;
+  const char* otherwise = nullptr;
+};
+
+// Register class offsets, see the REGTO* macros in util.cpp
+constexpr OperandStep DReg(Operand field) {
+  return {OperandStep::Kind::Register, field};
+}
+constexpr OperandStep AReg(Operand field) {
+  return {OperandStep::Kind::Register, field, false, 16};
+}
+constexpr OperandStep EReg(Operand field) {
+  return {OperandStep::Kind::Register, field, false, 32};
+}
+constexpr OperandStep PReg(Operand field) {
+  return {OperandStep::Kind::Register, field, false, 48};
+}
+constexpr OperandStep FixedReg(uint16_t reg) {
+  return {OperandStep::Kind::Register, Operand::None, false, reg};
+}
+constexpr OperandStep Sep() { return {OperandStep::Kind::Separator}; }
+constexpr OperandStep Lit(const char* text) {
+  return {OperandStep::Kind::Text, Operand::None, false, 0, text};
+}
+constexpr OperandStep Mode(uint8_t mode, const char* text,
+                           const char* otherwise) {
+  return {OperandStep::Kind::AddressMode, Operand::None, false, mode, text,
+          otherwise};
+}
+constexpr OperandStep Int(Operand field, uint16_t unsignedMask = 0) {
+  return {OperandStep::Kind::Integer, field, false, unsignedMask};
+}
+constexpr OperandStep UInt(Operand field) {
+  return {OperandStep::Kind::Unsigned, field};
+}
+constexpr OperandStep Hex(Operand field) {
+  return {OperandStep::Kind::Hex, field};
+}
+constexpr OperandStep HexAddr(Operand field) {
+  return {OperandStep::Kind::Hex, field, true};
+}
+constexpr OperandStep DecAddr(Operand field, uint16_t unsignedMask = 0) {
+  return {OperandStep::Kind::Decimal, field, true, unsignedMask};
+}
+}  // namespace Tricore
+
+#endif  // BINARYNINJA_API_TRICORE_OPERANDS_H
@@ -0,0 +1,99 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#include "reject_log.h"
+
+#include <algorithm>
+#include <cstdio>
+
+namespace Tricore {
+static_assert((RejectLog::kEntries & (RejectLog::kEntries - 1)) == 0);
+
+// Each slot is guarded by a sequence lock, as in the decode cache: sequence
+// is odd while a writer owns the slot and 0 until the slot is first written.
+struct alignas(64) RejectSlot {
+  std::atomic<uint64_t> sequence{0};
+  std::atomic<uint64_t> ticket{0};
+  std::atomic<uint64_t> address{0};
+  std::atomic<const char*> format{nullptr};
+  std::atomic<const char*> function{nullptr};
+  std::atomic<uint64_t> opcodes{0};
+};
+
+static RejectSlot rejectSlots[RejectLog::kEntries];
+static std::atomic<uint64_t> rejectTickets{0};
+
+std::atomic<uint32_t> RejectLog::samplePeriod{0};
+
+void RejectLog::Record(uint32_t period, const char* format, uint64_t addr,
+                       const char* func, uint32_t op1, uint32_t op2) {
+  // Counting down per thread keeps the shared ticket counter off the path of
+  // the rejects that are not sampled
+  thread_local uint32_t countdown = 0;
+  if (countdown > period) countdown = period;
+  if (countdown > 1) {
+    countdown--;
+    return;
+  }
+  countdown = period;
+
+  const uint64_t ticket =
+      rejectTickets.fetch_add(1, std::memory_order_relaxed);
+  RejectSlot& slot = rejectSlots[ticket & (kEntries - 1)];
+  uint64_t sequence = slot.sequence.load(std::memory_order_relaxed);
+  if ((sequence & 1) ||
+      !slot.sequence.compare_exchange_strong(sequence, sequence + 1,
+                                             std::memory_order_relaxed))
+    return;
+  std::atomic_thread_fence(std::memory_order_release);
+
+  slot.ticket.store(ticket, std::memory_order_relaxed);
+  slot.address.store(addr, std::memory_order_relaxed);
+  slot.format.store(format, std::memory_order_relaxed);
+  slot.function.store(func, std::memory_order_relaxed);
+  slot.opcodes.store(static_cast<uint64_t>(op2) << 32 | op1,
+                     std::memory_order_relaxed);
+  slot.sequence.store(sequence + 2, std::memory_order_release);
+}
+
+std::vector<RejectedEncoding> RejectLog::Snapshot() {
+  std::vector<RejectedEncoding> samples;
+  samples.reserve(kEntries);
+  for (const RejectSlot& slot : rejectSlots) {
+    const uint64_t before = slot.sequence.load(std::memory_order_acquire);
+    RejectedEncoding sample;
+    sample.sequence = slot.ticket.load(std::memory_order_relaxed);
+    sample.address = slot.address.load(std::memory_order_relaxed);
+    sample.format = slot.format.load(std::memory_order_relaxed);
+    sample.function = slot.function.load(std::memory_order_relaxed);
+    const uint64_t opcodes = slot.opcodes.load(std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_acquire);
+    const uint64_t after = slot.sequence.load(std::memory_order_relaxed);
+    if (before == 0 || (before & 1) || before != after) continue;
+
+    sample.op1 = static_cast<uint32_t>(opcodes);
+    sample.op2 = static_cast<uint32_t>(opcodes >> 32);
+    samples.push_back(sample);
+  }
+  std::sort(samples.begin(), samples.end(),
+            [](const RejectedEncoding& a, const RejectedEncoding& b) {
+              return a.sequence < b.sequence;
+            });
+  return samples;
+}
+
+uint64_t RejectLog::Recorded() {
+  return rejectTickets.load(std::memory_order_relaxed);
+}
+
+std::string RejectedEncoding::Message() const {
+  // Every reject format takes the address, the handler's name and up to two
+  // opcodes; printf ignores the opcode a format does not use
+  char buf[256];
+  const int n = std::snprintf(buf, sizeof(buf), format,
+                              static_cast<unsigned long>(address), function,
+                              op1, op2);
+  if (n < 0) return format;
+  return std::string(buf, std::min<size_t>(n, sizeof(buf) - 1));
+}
+}  // namespace Tricore
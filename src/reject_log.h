@@ -0,0 +1,90 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#ifndef BINARYNINJA_API_TRICORE_REJECT_LOG_H
+#define BINARYNINJA_API_TRICORE_REJECT_LOG_H
+
+#include <binaryninjaapi.h>
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// The Text and Lift handlers' debug messages reach the core's logger only
+// when TRICORE_DEBUG_LOG is 1. CMake sets it to 0 for all but debug builds
+// unless the TRICORE_DEBUG_LOG option is on; built otherwise, it follows
+// NDEBUG. Without the messages, rejected encodings can still be sampled into
+// RejectLog at run time.
+#ifndef TRICORE_DEBUG_LOG
+#ifdef NDEBUG
+#define TRICORE_DEBUG_LOG 0
+#else
+#define TRICORE_DEBUG_LOG 1
+#endif
+#endif
+
+#define TRICORE_LOG_DEBUG(...)                                           \
+  do {                                                                   \
+    if constexpr (TRICORE_DEBUG_LOG) BinaryNinja::LogDebug(__VA_ARGS__); \
+  } while (0)
+
+// A handler rejecting the encoding at addr. format takes addr, func and one
+// or two opcodes, in that order.
+#define TRICORE_LOG_REJECT(format, addr, func, ...)                \
+  do {                                                             \
+    TRICORE_LOG_DEBUG(format, addr, func, __VA_ARGS__);            \
+    ::Tricore::RejectLog::Sample(format, addr, func, __VA_ARGS__); \
+  } while (0)
+
+namespace Tricore {
+struct RejectedEncoding {
+  uint64_t sequence;  // position in the order of sampled rejects
+  uint64_t address;
+  const char* format;
+  const char* function;
+  uint32_t op1;
+  uint32_t op2;
+
+  // The message the handler would have logged
+  std::string Message() const;
+};
+
+// Fixed-size ring of recently rejected encodings, shared by every
+// architecture and thread. Disabled by default, so a reject costs one
+// relaxed load; once enabled, every period-th reject on each thread is
+// recorded without taking a lock. The oldest samples are overwritten.
+class RejectLog {
+ public:
+  static constexpr size_t kEntries = 1024;
+
+  // Record one in period rejects; 0 turns sampling off
+  static void SetSamplePeriod(uint32_t period) {
+    samplePeriod.store(period, std::memory_order_relaxed);
+  }
+  static uint32_t SamplePeriod() {
+    return samplePeriod.load(std::memory_order_relaxed);
+  }
+
+  static void Sample(const char* format, uint64_t addr, const char* func,
+                     uint32_t op1, uint32_t op2 = 0) {
+    const uint32_t period = samplePeriod.load(std::memory_order_relaxed);
+    if (period != 0) [[unlikely]]
+      Record(period, format, addr, func, op1, op2);
+  }
+
+  // Samples still in the ring, oldest first. Entries being overwritten
+  // while they are read are skipped.
+  static std::vector<RejectedEncoding> Snapshot();
+  // Number of samples recorded since the plugin was loaded
+  static uint64_t Recorded();
+
+ private:
+  static void Record(uint32_t period, const char* format, uint64_t addr,
+                     const char* func, uint32_t op1, uint32_t op2);
+
+  static std::atomic<uint32_t> samplePeriod;
+};
+}  // namespace Tricore
+
+#endif  // BINARYNINJA_API_TRICORE_REJECT_LOG_H
@@ -7,6 +7,7 @@
 
 #include "instructions.h"
 #include "opcodes.h"
+#include "reject_log.h"
 #include "util.h"
 
 #define ITEXT(m)                            \
@@ -20,8 +21,8 @@ namespace Tricore {
 bool Abs::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x0B_RR || op2 != ABS_DC_DB) {
-    LogDebug("0x%lx: Abs::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT("0x%lx: Abs::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
     return false;
   }
   len = 4;
@@ -31,8 +32,8 @@ bool Abs::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Absbh::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                  size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x0B_RR) {
-    LogDebug("0x%lx: Absbh::%s received invalid opcode 1 0x%x", addr, __func__,
-             op1);
+    TRICORE_LOG_REJECT("0x%lx: Absbh::%s received invalid opcode 1 0x%x", addr,
+                       __func__, op1);
     return false;
   }
   switch (op2) {
@@ -43,8 +44,8 @@ bool Absbh::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
       len = 4;
       return Instruction::TextOpDcDb_RR(data, len, HWORD, result, "abs.h");
     default:
-      LogDebug("0x%lx: Absbh::%s received invalid opcode 2 0x%x", addr,
-               __func__, op2);
+      TRICORE_LOG_REJECT("0x%lx: Absbh::%s received invalid opcode 2 0x%x",
+                         addr, __func__, op2);
       return false;
   }
 }
@@ -54,8 +55,8 @@ bool Absdif::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
   switch (op1) {
     case OP1_x8B_RC:
       if (op2 != ABSDIF_DC_DA_CONST9) {
-        LogDebug("0x%lx: Absdif::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Absdif::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       len = 4;
@@ -63,15 +64,15 @@ bool Absdif::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                                               "absdif");
     case OP1_x0B_RR:
       if (op2 != ABSDIF_DC_DA_DB) {
-        LogDebug("0x%lx: Absdif::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Absdif::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       len = 4;
       return Instruction::TextOpDcDaDb_RR(data, len, WORD, result, "absdif");
     default:
-      LogDebug("0x%lx: Absdif::%s received invalid opcode 1 0x%x", addr,
-               __func__, op1);
+      TRICORE_LOG_REJECT("0x%lx: Absdif::%s received invalid opcode 1 0x%x",
+                         addr, __func__, op1);
       return false;
   }
 }
@@ -80,8 +81,8 @@ bool Absdifbh::Text(uint8_t op1, uint8_t op2, const uint8_t* data,
                     uint64_t addr, size_t& len,
                     std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x0B_RR) {
-    LogDebug("0x%lx: Absdifbh::%s received invalid opcode 1 0x%x", addr,
-             __func__, op1);
+    TRICORE_LOG_REJECT("0x%lx: Absdifbh::%s received invalid opcode 1 0x%x",
+                       addr, __func__, op1);
     return false;
   }
   switch (op2) {
@@ -92,8 +93,8 @@ bool Absdifbh::Text(uint8_t op1, uint8_t op2, const uint8_t* data,
       len = 4;
       return Instruction::TextOpDcDaDb_RR(data, len, HWORD, result, "absdif.h");
     default:
-      LogDebug("0x%lx: Absdifbh::%s received invalid opcode 2 0x%x", addr,
-               __func__, op2);
+      TRICORE_LOG_REJECT("0x%lx: Absdifbh::%s received invalid opcode 2 0x%x",
+                         addr, __func__, op2);
       return false;
   }
 }
@@ -103,8 +104,8 @@ bool Absdifs::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
   switch (op1) {
     case OP1_x8B_RC:
       if (op2 != ABSDIFS_DC_DA_CONST9) {
-        LogDebug("0x%lx: Absdifs::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Absdifs::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       len = 4;
@@ -112,15 +113,15 @@ bool Absdifs::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                                               "absdifs");
     case OP1_x0B_RR:
       if (op2 != ABSDIFS_DC_DA_DB) {
-        LogDebug("0x%lx: Absdifs::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Absdifs::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       len = 4;
       return Instruction::TextOpDcDaDb_RR(data, len, WORD, result, "absdifs");
     default:
-      LogDebug("0x%lx: Absdifs::%s received invalid opcode 1 0x%x", addr,
-               __func__, op1);
+      TRICORE_LOG_REJECT("0x%lx: Absdifs::%s received invalid opcode 1 0x%x",
+                         addr, __func__, op1);
       return false;
   }
 }
@@ -129,8 +130,9 @@ bool Absdifsh::Text(uint8_t op1, uint8_t op2, const uint8_t* data,
                     uint64_t addr, size_t& len,
                     std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x0B_RR || op2 != ABSDIFSH_DC_DA_DB) {
-    LogDebug("0x%lx: Absdifsh::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT(
+        "0x%lx: Absdifsh::%s received invalid opcode(s) 0x%x, 0x%x",
+        addr, __func__, op1, op2);
     return false;
   }
   len = 4;
@@ -140,8 +142,8 @@ bool Absdifsh::Text(uint8_t op1, uint8_t op2, const uint8_t* data,
 bool Abss::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                 size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x0B_RR || op2 != ABSS_DC_DB) {
-    LogDebug("0x%lx: Abss::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT("0x%lx: Abss::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
     return false;
   }
   len = 4;
@@ -151,8 +153,8 @@ bool Abss::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Abssh::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                  size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x0B_RR || op2 != ABSSH_DC_DB) {
-    LogDebug("0x%lx: Abssh::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT("0x%lx: Abssh::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
     return false;
   }
   len = 4;
@@ -184,23 +186,23 @@ bool Add::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
     // 32-bit instructions
     case OP1_x8B_RC:
       if (op2 != ADD_DC_DA_CONST9) {
-        LogDebug("0x%lx: Add::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Add::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       len = 4;
       return Instruction::TextOpDcDaConst9_RC(data, len, WORD, result, "add");
     case OP1_x0B_RR:
       if (op2 != ADD_DC_DA_DB) {
-        LogDebug("0x%lx: Add::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Add::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       len = 4;
       return Instruction::TextOpDcDaDb_RR(data, len, WORD, result, "add");
     default:
-      LogDebug("0x%lx: Add::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Add::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -218,15 +220,15 @@ bool Adda::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
     // 32-bit instructions
     case OP1_x01_RR:
       if (op2 != ADDA_AC_AA_AB) {
-        LogDebug("0x%lx: Adda::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Adda::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       len = 4;
       return Instruction::TextOpAcAaAb_RR(data, len, WORD, result, "add.a");
     default:
-      LogDebug("0x%lx: Adda::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Adda::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -234,8 +236,8 @@ bool Adda::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Addbh::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                  size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x0B_RR) {
-    LogDebug("0x%lx: Addbh::%s received invalid opcode 1 0x%x", addr, __func__,
-             op1);
+    TRICORE_LOG_REJECT("0x%lx: Addbh::%s received invalid opcode 1 0x%x", addr,
+                       __func__, op1);
     return false;
   }
   switch (op2) {
@@ -246,8 +248,8 @@ bool Addbh::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
       len = 4;
       return Instruction::TextOpDcDaDb_RR(data, len, HWORD, result, "add.h");
     default:
-      LogDebug("0x%lx: Addbh::%s received invalid opcode 2 0x%x", addr,
-               __func__, op2);
+      TRICORE_LOG_REJECT("0x%lx: Addbh::%s received invalid opcode 2 0x%x",
+                         addr, __func__, op2);
       return false;
   }
 }
@@ -257,8 +259,8 @@ bool Addc::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
   switch (op1) {
     case OP1_x8B_RC:
       if (op2 != ADDC_DC_DA_CONST9) {
-        LogDebug("0x%lx: Addc::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Addc::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       len = 4;
@@ -270,8 +272,8 @@ bool Addc::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
       len = 4;
       return Instruction::TextOpDcDaDb_RR(data, len, WORD, result, "addc");
     default:
-      LogDebug("0x%lx: Addc::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Addc::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -280,8 +282,8 @@ bool Addi::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                 size_t& len, std::vector<InstructionTextToken>& result) {
   // 32-bit, single opcode
   if (op1 != ADDI_DC_DA_CONST16) {
-    LogDebug("0x%lx: Addi::%s received invalid opcode 1 0x%x", addr, __func__,
-             op1);
+    TRICORE_LOG_REJECT("0x%lx: Addi::%s received invalid opcode 1 0x%x", addr,
+                       __func__, op1);
     return false;
   }
   len = 4;
@@ -292,8 +294,8 @@ bool Addih::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                  size_t& len, std::vector<InstructionTextToken>& result) {
   // 32-bit, single opcode
   if (op1 != ADDIH_DC_DA_CONST16) {
-    LogDebug("0x%lx: Addih::%s received invalid opcode 1 0x%x", addr, __func__,
-             op1);
+    TRICORE_LOG_REJECT("0x%lx: Addih::%s received invalid opcode 1 0x%x", addr,
+                       __func__, op1);
     return false;
   }
   len = 4;
@@ -304,8 +306,8 @@ bool Addiha::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                   size_t& len, std::vector<InstructionTextToken>& result) {
   // 32-bit, single opcode
   if (op1 != ADDIHA_AC_AA_CONST16) {
-    LogDebug("0x%lx: Addiha::%s received invalid opcode 1 0x%x", addr, __func__,
-             op1);
+    TRICORE_LOG_REJECT("0x%lx: Addiha::%s received invalid opcode 1 0x%x", addr,
+                       __func__, op1);
     return false;
   }
   len = 4;
@@ -321,23 +323,23 @@ bool Adds::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
       return Instruction::TextOpDaDb_SRR(data, len, WORD, result, "adds");
     case OP1_x8B_RC:
       if (op2 != ADDS_DC_DA_CONST9) {
-        LogDebug("0x%lx: Adds::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Adds::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       len = 4;
       return Instruction::TextOpDcDaConst9_RC(data, len, WORD, result, "adds");
     case OP1_x0B_RR:
       if (op2 != ADDS_DC_DA_DB) {
-        LogDebug("0x%lx: Adds::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Adds::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       len = 4;
       return Instruction::TextOpDcDaDb_RR(data, len, WORD, result, "adds");
     default:
-      LogDebug("0x%lx: Adds::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Adds::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -345,8 +347,8 @@ bool Adds::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Addshhu::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                    size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x0B_RR) {
-    LogDebug("0x%lx: Addshhu::%s received invalid opcode 1 0x%x", addr,
-             __func__, op1);
+    TRICORE_LOG_REJECT("0x%lx: Addshhu::%s received invalid opcode 1 0x%x",
+                       addr, __func__, op1);
     return false;
   }
   switch (op2) {
@@ -357,8 +359,8 @@ bool Addshhu::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
       len = 4;
       return Instruction::TextOpDcDaDb_RR(data, len, HWORD, result, "adds.hu");
     default:
-      LogDebug("0x%lx: Addshhu::%s received invalid opcode 2 0x%x", addr,
-               __func__, op2);
+      TRICORE_LOG_REJECT("0x%lx: Addshhu::%s received invalid opcode 2 0x%x",
+                         addr, __func__, op2);
       return false;
   }
 }
@@ -368,8 +370,8 @@ bool Addsu::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
   switch (op1) {
     case OP1_x8B_RC:
       if (op2 != ADDSU_DC_DA_CONST9) {
-        LogDebug("0x%lx: Addsu::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Addsu::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       len = 4;
@@ -377,15 +379,15 @@ bool Addsu::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                                               true);
     case OP1_x0B_RR:
       if (op2 != ADDSU_DC_DA_DB) {
-        LogDebug("0x%lx: Addsu::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Addsu::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       len = 4;
       return Instruction::TextOpDcDaDb_RR(data, len, WORD, result, "adds.u");
     default:
-      LogDebug("0x%lx: Addsu::%s received invalid opcode 1 0x%x", addr,
-               __func__, op1);
+      TRICORE_LOG_REJECT("0x%lx: Addsu::%s received invalid opcode 1 0x%x",
+                         addr, __func__, op1);
       return false;
   }
 }
@@ -409,13 +411,14 @@ bool Addscaat::Text(uint8_t op1, uint8_t op2, const uint8_t* data,
           return Instruction::TextOpAcAbDa_RR(data, len, WORD, result,
                                               "addsc.at");
         default:
-          LogDebug("0x%lx: Addscaat::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT(
+              "0x%lx: Addscaat::%s received invalid opcode 2 0x%x",
+              addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Addscaat::%s received invalid opcode 1 0x%x", addr,
-               __func__, op1);
+      TRICORE_LOG_REJECT("0x%lx: Addscaat::%s received invalid opcode 1 0x%x",
+                         addr, __func__, op1);
       return false;
   }
 }
@@ -425,23 +428,23 @@ bool Addx::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
   switch (op1) {
     case OP1_x8B_RC:
       if (op2 != ADDX_DC_DA_CONST9) {
-        LogDebug("0x%lx: Addx::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Addx::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       len = 4;
       return Instruction::TextOpDcDaConst9_RC(data, len, WORD, result, "addx");
     case OP1_x0B_RR:
       if (op2 != ADDX_DC_DA_DB) {
-        LogDebug("0x%lx: Addx::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Addx::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       len = 4;
       return Instruction::TextOpDcDaDb_RR(data, len, WORD, result, "addx");
     default:
-      LogDebug("0x%lx: Addx::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Addx::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -457,8 +460,8 @@ bool And::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
       return Instruction::TextOpDaDb_SRR(data, len, WORD, result, "and");
     case OP1_x8F_RC:
       if (op2 != AND_DC_DA_CONST9) {
-        LogDebug("0x%lx: And::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: And::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       len = 4;
@@ -466,15 +469,15 @@ bool And::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                                               true);
     case OP1_x0F_RR:
       if (op2 != AND_DC_DA_DB) {
-        LogDebug("0x%lx: And::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: And::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       len = 4;
       return Instruction::TextOpDcDaDb_RR(data, len, WORD, result, "and");
     default:
-      LogDebug("0x%lx: And::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: And::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -483,8 +486,9 @@ bool AndAndnNorOrT::Text(uint8_t op1, uint8_t op2, const uint8_t* data,
                          uint64_t addr, size_t& len,
                          std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x47_BIT) {
-    LogDebug("0x%lx: AndAndnNorOrT::%s received invalid opcode 1 0x%x", addr,
-             __func__, op1);
+    TRICORE_LOG_REJECT(
+        "0x%lx: AndAndnNorOrT::%s received invalid opcode 1 0x%x",
+        addr, __func__, op1);
     return false;
   }
   switch (op2) {
@@ -505,8 +509,9 @@ bool AndAndnNorOrT::Text(uint8_t op1, uint8_t op2, const uint8_t* data,
       return Instruction::TextOpDcDaPos1DbPos2_BIT(data, len, WORD, result,
                                                    "and.or.t");
     default:
-      LogDebug("0x%lx: AndAndnNorOrT::%s received invalid opcode 2 0x%x", addr,
-               __func__, op2);
+      TRICORE_LOG_REJECT(
+          "0x%lx: AndAndnNorOrT::%s received invalid opcode 2 0x%x",
+          addr, __func__, op2);
       return false;
   }
 }
@@ -516,8 +521,8 @@ bool Andeq::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
   switch (op1) {
     case OP1_x8B_RC:
       if (op2 != ANDEQ_DC_DA_CONST9) {
-        LogDebug("0x%lx: Andeq::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Andeq::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       len = 4;
@@ -525,15 +530,15 @@ bool Andeq::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                                               "and.eq");
     case OP1_x0B_RR:
       if (op2 != ANDEQ_DC_DA_DB) {
-        LogDebug("0x%lx: Andeq::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Andeq::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       len = 4;
       return Instruction::TextOpDcDaDb_RR(data, len, WORD, result, "and.eq");
     default:
-      LogDebug("0x%lx: Andeq::%s received invalid opcode 1 0x%x", addr,
-               __func__, op1);
+      TRICORE_LOG_REJECT("0x%lx: Andeq::%s received invalid opcode 1 0x%x",
+                         addr, __func__, op1);
       return false;
   }
 }
@@ -553,8 +558,9 @@ bool AndgeGeU::Text(uint8_t op1, uint8_t op2, const uint8_t* data,
           return Instruction::TextOpDcDaConst9_RC(data, len, WORD, result,
                                                   "and.ge.u", true);
         default:
-          LogDebug("0x%lx: AndgeGeU::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT(
+              "0x%lx: AndgeGeU::%s received invalid opcode 2 0x%x",
+              addr, __func__, op2);
           return false;
       }
     case OP1_x0B_RR:
@@ -568,13 +574,14 @@ bool AndgeGeU::Text(uint8_t op1, uint8_t op2, const uint8_t* data,
           return Instruction::TextOpDcDaDb_RR(data, len, WORD, result,
                                               "and.ge.u");
         default:
-          LogDebug("0x%lx: AndgeGeU::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT(
+              "0x%lx: AndgeGeU::%s received invalid opcode 2 0x%x",
+              addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: AndgeGeU::%s received invalid opcode 1 0x%x", addr,
-               __func__, op1);
+      TRICORE_LOG_REJECT("0x%lx: AndgeGeU::%s received invalid opcode 1 0x%x",
+                         addr, __func__, op1);
       return false;
   }
 }
@@ -594,8 +601,9 @@ bool AndltLtU::Text(uint8_t op1, uint8_t op2, const uint8_t* data,
           return Instruction::TextOpDcDaConst9_RC(data, len, WORD, result,
                                                   "and.lt.u", true);
         default:
-          LogDebug("0x%lx: AndltLtU::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT(
+              "0x%lx: AndltLtU::%s received invalid opcode 2 0x%x",
+              addr, __func__, op2);
           return false;
       }
     case OP1_x0B_RR:
@@ -609,13 +617,14 @@ bool AndltLtU::Text(uint8_t op1, uint8_t op2, const uint8_t* data,
           return Instruction::TextOpDcDaDb_RR(data, len, WORD, result,
                                               "and.lt.u");
         default:
-          LogDebug("0x%lx: AndltLtU::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT(
+              "0x%lx: AndltLtU::%s received invalid opcode 2 0x%x",
+              addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: AndltLtU::%s received invalid opcode 1 0x%x", addr,
-               __func__, op1);
+      TRICORE_LOG_REJECT("0x%lx: AndltLtU::%s received invalid opcode 1 0x%x",
+                         addr, __func__, op1);
       return false;
   }
 }
@@ -625,8 +634,8 @@ bool Andne::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
   switch (op1) {
     case OP1_x8B_RC:
       if (op2 != ANDNE_DC_DA_CONST9) {
-        LogDebug("0x%lx: Andne::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Andne::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       len = 4;
@@ -634,15 +643,15 @@ bool Andne::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                                               "and.ne");
     case OP1_x0B_RR:
       if (op2 != ANDNE_DC_DA_DB) {
-        LogDebug("0x%lx: Andne::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Andne::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       len = 4;
       return Instruction::TextOpDcDaDb_RR(data, len, WORD, result, "and.ne");
     default:
-      LogDebug("0x%lx: Andne::%s received invalid opcode 1 0x%x", addr,
-               __func__, op1);
+      TRICORE_LOG_REJECT("0x%lx: Andne::%s received invalid opcode 1 0x%x",
+                         addr, __func__, op1);
       return false;
   }
 }
@@ -650,8 +659,8 @@ bool Andne::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Andt::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                 size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x87_BIT || op2 != ANDT_DC_DA_POS1_DB_POS2) {
-    LogDebug("0x%lx: Andt::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT("0x%lx: Andt::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
     return false;
   }
   len = 4;
@@ -664,8 +673,8 @@ bool Andn::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
   switch (op1) {
     case OP1_x8F_RC:
       if (op2 != ANDN_DC_DA_CONST9) {
-        LogDebug("0x%lx: Andn::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Andn::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       len = 4;
@@ -673,15 +682,15 @@ bool Andn::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                                               true);
     case OP1_x0F_RR:
       if (op2 != ANDN_DC_DA_DB) {
-        LogDebug("0x%lx: Andn::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Andn::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       len = 4;
       return Instruction::TextOpDcDaDb_RR(data, len, WORD, result, "andn");
     default:
-      LogDebug("0x%lx: Andn::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Andn::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -689,8 +698,8 @@ bool Andn::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Andnt::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                  size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x87_BIT || op2 != ANDNT_DC_DA_POS1_DB_POS2) {
-    LogDebug("0x%lx: Andnt::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT("0x%lx: Andnt::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
     return false;
   }
   len = 4;
@@ -706,15 +715,15 @@ bool Bisr::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
       return Instruction::TextOpConst8_SC(data, len, WORD, result, "bisr");
     case OP1_xAD_RC:
       if (op2 != BISR_CONST9) {
-        LogDebug("0x%lx: Bisr::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Bisr::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       len = 4;
       return Instruction::TextOpConst9_RC(data, len, WORD, result, "bisr");
     default:
-      LogDebug("0x%lx: Bisr::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Bisr::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -722,8 +731,9 @@ bool Bisr::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Bmerge::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                   size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x4B_RR || op2 != BMERGE_DC_DA_DB) {
-    LogDebug("0x%lx: Bmerge::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT(
+        "0x%lx: Bmerge::%s received invalid opcode(s) 0x%x, 0x%x",
+        addr, __func__, op1, op2);
     return false;
   }
   len = 4;
@@ -733,8 +743,9 @@ bool Bmerge::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Bsplit::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                   size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x4B_RR || op2 != BSPLIT_EC_DA) {
-    LogDebug("0x%lx: Bsplit::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT(
+        "0x%lx: Bsplit::%s received invalid opcode(s) 0x%x, 0x%x",
+        addr, __func__, op1, op2);
     return false;
   }
   len = 4;
@@ -759,8 +770,9 @@ bool Cacheai::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpAbOff10_BO(data, len, WORD, result,
                                                "cachea.i", ADDRMODE_PREINC);
         default:
-          LogDebug("0x%lx: Cacheai::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT(
+              "0x%lx: Cacheai::%s received invalid opcode 2 0x%x",
+              addr, __func__, op2);
           return false;
       }
     case OP1_xA9_BO:
@@ -774,13 +786,14 @@ bool Cacheai::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpPbOff10_BO(data, len, WORD, result,
                                                "cachea.i", ADDRMODE_CIRC);
         default:
-          LogDebug("0x%lx: Cacheai::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT(
+              "0x%lx: Cacheai::%s received invalid opcode 2 0x%x",
+              addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Cacheai::%s received invalid opcode 1 0x%x", addr,
-               __func__, op1);
+      TRICORE_LOG_REJECT("0x%lx: Cacheai::%s received invalid opcode 1 0x%x",
+                         addr, __func__, op1);
       return false;
   }
 }
@@ -803,8 +816,9 @@ bool Cacheaw::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpAbOff10_BO(data, len, WORD, result,
                                                "cachea.w", ADDRMODE_PREINC);
         default:
-          LogDebug("0x%lx: Cacheaw::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT(
+              "0x%lx: Cacheaw::%s received invalid opcode 2 0x%x",
+              addr, __func__, op2);
           return false;
       }
     case OP1_xA9_BO:
@@ -818,13 +832,14 @@ bool Cacheaw::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpPbOff10_BO(data, len, WORD, result,
                                                "cachea.w", ADDRMODE_CIRC);
         default:
-          LogDebug("0x%lx: Cacheaw::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT(
+              "0x%lx: Cacheaw::%s received invalid opcode 2 0x%x",
+              addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Cacheaw::%s received invalid opcode 1 0x%x", addr,
-               __func__, op1);
+      TRICORE_LOG_REJECT("0x%lx: Cacheaw::%s received invalid opcode 1 0x%x",
+                         addr, __func__, op1);
       return false;
   }
 }
@@ -848,8 +863,9 @@ bool Cacheawi::Text(uint8_t op1, uint8_t op2, const uint8_t* data,
           return Instruction::TextOpAbOff10_BO(data, len, WORD, result,
                                                "cachea.wi", ADDRMODE_PREINC);
         default:
-          LogDebug("0x%lx: Cacheawi::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT(
+              "0x%lx: Cacheawi::%s received invalid opcode 2 0x%x",
+              addr, __func__, op2);
           return false;
       }
     case OP1_xA9_BO:
@@ -863,13 +879,14 @@ bool Cacheawi::Text(uint8_t op1, uint8_t op2, const uint8_t* data,
           return Instruction::TextOpPbOff10_BO(data, len, WORD, result,
                                                "cachea.wi", ADDRMODE_CIRC);
         default:
-          LogDebug("0x%lx: Cacheawi::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT(
+              "0x%lx: Cacheawi::%s received invalid opcode 2 0x%x",
+              addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Cacheawi::%s received invalid opcode 1 0x%x", addr,
-               __func__, op1);
+      TRICORE_LOG_REJECT("0x%lx: Cacheawi::%s received invalid opcode 1 0x%x",
+                         addr, __func__, op1);
       return false;
   }
 }
@@ -893,13 +910,14 @@ bool Cacheii::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpAbOff10_BO(data, len, WORD, result,
                                                "cachei.i", ADDRMODE_PREINC);
         default:
-          LogDebug("0x%lx: Cacheii::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT(
+              "0x%lx: Cacheii::%s received invalid opcode 2 0x%x",
+              addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Cacheii::%s received invalid opcode 1 0x%x", addr,
-               __func__, op1);
+      TRICORE_LOG_REJECT("0x%lx: Cacheii::%s received invalid opcode 1 0x%x",
+                         addr, __func__, op1);
       return false;
   }
 }
@@ -907,8 +925,8 @@ bool Cacheii::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Cacheiw::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                    size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x89_BO) {
-    LogDebug("0x%lx: Cacheiw::%s received invalid opcode 1 0x%x", addr,
-             __func__, op1);
+    TRICORE_LOG_REJECT("0x%lx: Cacheiw::%s received invalid opcode 1 0x%x",
+                       addr, __func__, op1);
     return false;
   }
   switch (op2) {
@@ -925,8 +943,8 @@ bool Cacheiw::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
       return Instruction::TextOpAbOff10_BO(data, len, WORD, result, "cachei.w",
                                            ADDRMODE_PREINC);
     default:
-      LogDebug("0x%lx: Cacheiw::%s received invalid opcode 2 0x%x", addr,
-               __func__, op2);
+      TRICORE_LOG_REJECT("0x%lx: Cacheiw::%s received invalid opcode 2 0x%x",
+                         addr, __func__, op2);
       return false;
   }
 }
@@ -935,8 +953,8 @@ bool Cacheiwi::Text(uint8_t op1, uint8_t op2, const uint8_t* data,
                     uint64_t addr, size_t& len,
                     std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x89_BO) {
-    LogDebug("0x%lx: Cacheiwi::%s received invalid opcode 1 0x%x", addr,
-             __func__, op1);
+    TRICORE_LOG_REJECT("0x%lx: Cacheiwi::%s received invalid opcode 1 0x%x",
+                       addr, __func__, op1);
     return false;
   }
   switch (op2) {
@@ -953,8 +971,8 @@ bool Cacheiwi::Text(uint8_t op1, uint8_t op2, const uint8_t* data,
       return Instruction::TextOpAbOff10_BO(data, len, WORD, result, "cachei.wi",
                                            ADDRMODE_PREINC);
     default:
-      LogDebug("0x%lx: Cacheiwi::%s received invalid opcode 2 0x%x", addr,
-               __func__, op2);
+      TRICORE_LOG_REJECT("0x%lx: Cacheiwi::%s received invalid opcode 2 0x%x",
+                         addr, __func__, op2);
       return false;
   }
 }
@@ -968,8 +986,8 @@ bool Cadd::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                                                 "cadd");
     case OP1_xAB_RCR:
       if (op2 != CADD_DC_DD_DA_CONST9) {
-        LogDebug("0x%lx: Cadd::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Cadd::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       len = 4;
@@ -977,15 +995,15 @@ bool Cadd::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                                                  "cadd");
     case OP1_x2B_RRR:
       if (op2 != CADD_DC_DD_DA_DB) {
-        LogDebug("0x%lx: Cadd::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Cadd::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       len = 4;
       return Instruction::TextOpDcDdDaDb_RRR(data, len, WORD, result, "cadd");
     default:
-      LogDebug("0x%lx: Cadd::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Cadd::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -999,8 +1017,8 @@ bool Caddn::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                                                 "caddn");
     case OP1_xAB_RCR:
       if (op2 != CADDN_DC_DD_DA_CONST9) {
-        LogDebug("0x%lx: Caddn::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Caddn::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       len = 4;
@@ -1008,51 +1026,55 @@ bool Caddn::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                                                  "caddn");
     case OP1_x2B_RRR:
       if (op2 != CADDN_DC_DD_DA_DB) {
-        LogDebug("0x%lx: Caddn::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Caddn::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       len = 4;
       return Instruction::TextOpDcDdDaDb_RRR(data, len, WORD, result, "caddn");
     default:
-      LogDebug("0x%lx: Caddn::%s received invalid opcode 1 0x%x", addr,
-               __func__, op1);
+      TRICORE_LOG_REJECT("0x%lx: Caddn::%s received invalid opcode 1 0x%x",
+                         addr, __func__, op1);
       return false;
   }
 }
 
 bool Call::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
-                size_t& len, std::vector<InstructionTextToken>& result) {
+                size_t& len, std::vector<InstructionTextToken>& result,
+                uint32_t target) {
   switch (op1) {
     case CALL_DISP8:
       len = 2;
-      return Instruction::TextOpDisp8_SB(data, addr, len, WORD, result, "call");
+      return Instruction::TextOpDisp8_SB(data, target, len, WORD, result,
+                                         "call");
     case CALL_DISP24:
       len = 4;
-      return Instruction::TextOpDisp24_B(data, addr, len, WORD, result, "call");
+      return Instruction::TextOpDisp24_B(data, target, len, WORD, result,
+                                         "call");
     default:
-      LogDebug("0x%lx: Call::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Call::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
 
 bool Calla::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
-                 size_t& len, std::vector<InstructionTextToken>& result) {
+                 size_t& len, std::vector<InstructionTextToken>& result,
+                 uint32_t target) {
   if (op1 != CALLA_DISP24) {
-    LogDebug("0x%lx: Calla::%s received invalid opcode 1 0x%x", addr, __func__,
-             op1);
+    TRICORE_LOG_REJECT("0x%lx: Calla::%s received invalid opcode 1 0x%x", addr,
+                       __func__, op1);
     return false;
   }
   len = 4;
-  return Instruction::TextOpDisp24_B(data, addr, len, WORD, result, "calla");
+  return Instruction::TextOpDisp24_B(data, target, len, WORD, result, "calla");
 }
 
 bool Calli::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                  size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x2D_RR || op2 != CALLI_AA) {
-    LogDebug("0x%lx: Calli::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT("0x%lx: Calli::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
     return false;
   }
   len = 4;
@@ -1062,8 +1084,8 @@ bool Calli::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Clo::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x0F_RR || op2 != CLO_DC_DA) {
-    LogDebug("0x%lx: Clo::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT("0x%lx: Clo::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
     return false;
   }
   len = 4;
@@ -1073,8 +1095,8 @@ bool Clo::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Cloh::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                 size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x0F_RR || op2 != CLOH_DC_DA) {
-    LogDebug("0x%lx: Cloh::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT("0x%lx: Cloh::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
     return false;
   }
   len = 4;
@@ -1086,8 +1108,8 @@ bool Cloh::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Cls::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x0F_RR || op2 != CLS_DC_DA) {
-    LogDebug("0x%lx: Cls::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT("0x%lx: Cls::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
     return false;
   }
   len = 4;
@@ -1097,8 +1119,8 @@ bool Cls::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Clsh::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                 size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x0F_RR || op2 != CLSH_DC_DA) {
-    LogDebug("0x%lx: Clsh::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT("0x%lx: Clsh::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
     return false;
   }
   len = 4;
@@ -1110,8 +1132,8 @@ bool Clsh::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Clz::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x0F_RR || op2 != CLZ_DC_DA) {
-    LogDebug("0x%lx: Clz::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT("0x%lx: Clz::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
     return false;
   }
   len = 4;
@@ -1121,8 +1143,8 @@ bool Clz::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Clzh::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                 size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x0F_RR || op2 != CLZH_DC_DA) {
-    LogDebug("0x%lx: Clzh::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT("0x%lx: Clzh::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
     return false;
   }
   len = 4;
@@ -1142,8 +1164,8 @@ bool Cmov::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
       len = 2;
       return Instruction::TextOpDaD15Db_SRR(data, len, WORD, result, "cmov");
     default:
-      LogDebug("0x%lx: Cmov::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Cmov::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -1159,8 +1181,8 @@ bool Cmovn::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
       len = 2;
       return Instruction::TextOpDaD15Db_SRR(data, len, WORD, result, "cmovn");
     default:
-      LogDebug("0x%lx: Cmovn::%s received invalid opcode 1 0x%x", addr,
-               __func__, op1);
+      TRICORE_LOG_REJECT("0x%lx: Cmovn::%s received invalid opcode 1 0x%x",
+                         addr, __func__, op1);
       return false;
   }
 }
@@ -1181,8 +1203,9 @@ bool Cmpswap::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpAbOff10Ea_BO(data, len, WORD, result,
                                                  "cmpswap.w", ADDRMODE_POSTINC);
         default:
-          LogDebug("0x%lx: Cmpswap::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT(
+              "0x%lx: Cmpswap::%s received invalid opcode 2 0x%x",
+              addr, __func__, op2);
           return false;
       }
     case OP1_x69_BO:
@@ -1194,13 +1217,14 @@ bool Cmpswap::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpPbOff10Ea_BO(data, len, WORD, result,
                                                  "cmpswap.w", ADDRMODE_CIRC);
         default:
-          LogDebug("0x%lx: Cmpswap::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT(
+              "0x%lx: Cmpswap::%s received invalid opcode 2 0x%x",
+              addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Cmpswap::%s received invalid opcode 1 0x%x", addr,
-               __func__, op1);
+      TRICORE_LOG_REJECT("0x%lx: Cmpswap::%s received invalid opcode 1 0x%x",
+                         addr, __func__, op1);
       return false;
   }
 }
@@ -1209,8 +1233,8 @@ bool Cmpswap::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Crc32::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                  size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x4B_RR || op2 != CRC32_DC_DB_DA) {
-    LogDebug("0x%lx: Crc32::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT("0x%lx: Crc32::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
     return false;
   }
   len = 4;
@@ -1220,8 +1244,8 @@ bool Crc32::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Csub::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                 size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x2B_RRR || op2 != CSUB_DC_DD_DA_DB) {
-    LogDebug("0x%lx: Csub::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT("0x%lx: Csub::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
     return false;
   }
   len = 4;
@@ -1231,8 +1255,8 @@ bool Csub::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Csubn::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                  size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x2B_RRR || op2 != CSUBN_DC_DD_DA_DB) {
-    LogDebug("0x%lx: Csubn::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT("0x%lx: Csubn::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
     return false;
   }
   len = 4;
@@ -1244,23 +1268,23 @@ bool Debug::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
   switch (op1) {
     case OP1_x00_SR:
       if (op2 != DEBUG16) {
-        LogDebug("0x%lx: Debug::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Debug::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       len = 2;
       return Instruction::TextOp_SR(data, len, WORD, result, "debug");
     case OP1_x0D_SYS:
       if (op2 != DEBUG32) {
-        LogDebug("0x%lx: Debug::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Debug::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       len = 4;
       return Instruction::TextOp_SYS(data, len, WORD, result, "debug");
     default:
-      LogDebug("0x%lx: Debug::%s received invalid opcode 1 0x%x", addr,
-               __func__, op1);
+      TRICORE_LOG_REJECT("0x%lx: Debug::%s received invalid opcode 1 0x%x",
+                         addr, __func__, op1);
       return false;
   }
 }
@@ -1270,8 +1294,8 @@ bool Dextr::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
   switch (op1) {
     case OP1_x77_RRPW:
       if (op2 != DEXTR_DC_DA_DB_POS) {
-        LogDebug("0x%lx: Dextr::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Dextr::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       len = 4;
@@ -1279,15 +1303,15 @@ bool Dextr::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                                                "dextr");
     case OP1_x17_RRRR:
       if (op2 != DEXTR_DC_DA_DB_DD) {
-        LogDebug("0x%lx: Dextr::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Dextr::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       len = 4;
       return Instruction::TextOpDcDaDbDd_RRRR(data, len, WORD, result, "dextr");
     default:
-      LogDebug("0x%lx: Dextr::%s received invalid opcode 1 0x%x", addr,
-               __func__, op1);
+      TRICORE_LOG_REJECT("0x%lx: Dextr::%s received invalid opcode 1 0x%x",
+                         addr, __func__, op1);
       return false;
   }
 }
@@ -1295,8 +1319,9 @@ bool Dextr::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Disable::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                    size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x0D_SYS || op2 != DISABLE) {
-    LogDebug("0x%lx: Disable::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT(
+        "0x%lx: Disable::%s received invalid opcode(s) 0x%x, 0x%x",
+        addr, __func__, op1, op2);
     return false;
   }
   len = 4;
@@ -1308,8 +1333,9 @@ bool DisableDa::Text(uint8_t op1, uint8_t op2, const uint8_t* data,
                      uint64_t addr, size_t& len,
                      std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x0D_SYS || op2 != DISABLE_DA) {
-    LogDebug("0x%lx: DisableDa::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT(
+        "0x%lx: DisableDa::%s received invalid opcode(s) 0x%x, 0x%x",
+        addr, __func__, op1, op2);
     return false;
   }
   len = 4;
@@ -1319,8 +1345,8 @@ bool DisableDa::Text(uint8_t op1, uint8_t op2, const uint8_t* data,
 bool Dsync::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                  size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x0D_SYS || op2 != DSYNC) {
-    LogDebug("0x%lx: Dsync::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT("0x%lx: Dsync::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
     return false;
   }
   len = 4;
@@ -1330,8 +1356,8 @@ bool Dsync::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Div::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x4B_RR) {
-    LogDebug("0x%lx: Div::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT("0x%lx: Div::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
     return false;
   }
   if (op2 == DIV_EC_DA_DB) {
@@ -1341,8 +1367,8 @@ bool Div::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
     len = 4;
     return Instruction::TextOpEcDaDb_RR(data, len, WORD, result, "div.u");
   } else {
-    LogDebug("0x%lx: Div::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT("0x%lx: Div::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
     return false;
   }
 }
@@ -1350,8 +1376,8 @@ bool Div::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Dvadj::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                  size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x6B_RRR || op2 != DVADJ_EC_ED_DB) {
-    LogDebug("0x%lx: Dvadj::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT("0x%lx: Dvadj::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
     return false;
   }
   len = 4;
@@ -1361,8 +1387,8 @@ bool Dvadj::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Dvinit::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                   size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x4B_RR) {
-    LogDebug("0x%lx: Dvinit::%s received invalid opcode 1 0x%x", addr, __func__,
-             op1);
+    TRICORE_LOG_REJECT("0x%lx: Dvinit::%s received invalid opcode 1 0x%x", addr,
+                       __func__, op1);
     return false;
   }
   switch (op2) {
@@ -1386,8 +1412,8 @@ bool Dvinit::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
       len = 4;
       return Instruction::TextOpEcDaDb_RR(data, len, WORD, result, "dvinit.u");
     default:
-      LogDebug("0x%lx: Dvinit::%s received invalid opcode 2 0x%x", addr,
-               __func__, op2);
+      TRICORE_LOG_REJECT("0x%lx: Dvinit::%s received invalid opcode 2 0x%x",
+                         addr, __func__, op2);
       return false;
   }
 }
@@ -1395,8 +1421,8 @@ bool Dvinit::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Dvstep::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                   size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x6B_RRR) {
-    LogDebug("0x%lx: Dvstep::%s received invalid opcode 1 0x%x", addr, __func__,
-             op1);
+    TRICORE_LOG_REJECT("0x%lx: Dvstep::%s received invalid opcode 1 0x%x", addr,
+                       __func__, op1);
     return false;
   }
   switch (op2) {
@@ -1407,8 +1433,8 @@ bool Dvstep::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
       len = 4;
       return Instruction::TextOpEcEdDb_RRR(data, len, WORD, result, "dvstep.u");
     default:
-      LogDebug("0x%lx: Dvstep::%s received invalid opcode 2 0x%x", addr,
-               __func__, op2);
+      TRICORE_LOG_REJECT("0x%lx: Dvstep::%s received invalid opcode 2 0x%x",
+                         addr, __func__, op2);
       return false;
   }
 }
@@ -1416,8 +1442,9 @@ bool Dvstep::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Enable::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                   size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x0D_SYS || op2 != ENABLE) {
-    LogDebug("0x%lx: Enable::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT(
+        "0x%lx: Enable::%s received invalid opcode(s) 0x%x, 0x%x",
+        addr, __func__, op1, op2);
     return false;
   }
   len = 4;
@@ -1435,23 +1462,23 @@ bool Eq::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
       return Instruction::TextOpD15DaDb_SRR(data, len, WORD, result, "eq");
     case OP1_x8B_RC:
       if (op2 != EQ_DC_DA_CONST9) {
-        LogDebug("0x%lx: Eq::%s received invalid opcode 2 0x%x", addr, __func__,
-                 op2);
+        TRICORE_LOG_REJECT("0x%lx: Eq::%s received invalid opcode 2 0x%x", addr,
+                           __func__, op2);
         return false;
       }
       len = 4;
       return Instruction::TextOpDcDaConst9_RC(data, len, WORD, result, "eq");
     case OP1_x0B_RR:
       if (op2 != EQ_DC_DA_DB) {
-        LogDebug("0x%lx: Eq::%s received invalid opcode 2 0x%x", addr, __func__,
-                 op2);
+        TRICORE_LOG_REJECT("0x%lx: Eq::%s received invalid opcode 2 0x%x", addr,
+                           __func__, op2);
         return false;
       }
       len = 4;
       return Instruction::TextOpDcDaDb_RR(data, len, WORD, result, "eq");
     default:
-      LogDebug("0x%lx: Eq::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Eq::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -1459,8 +1486,8 @@ bool Eq::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Eqa::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x01_RR || op2 != EQA_DC_AA_AB) {
-    LogDebug("0x%lx: Eqa::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT("0x%lx: Eqa::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
     return false;
   }
   len = 4;
@@ -1470,8 +1497,8 @@ bool Eqa::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Eqbhw::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                  size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x0B_RR) {
-    LogDebug("0x%lx: Eqbhw::%s received invalid opcode 1 0x%x", addr, __func__,
-             op1);
+    TRICORE_LOG_REJECT("0x%lx: Eqbhw::%s received invalid opcode 1 0x%x", addr,
+                       __func__, op1);
     return false;
   }
   switch (op2) {
@@ -1488,8 +1515,8 @@ bool Eqbhw::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
       return Instruction::TextOpDcDaDb_RR(data, len, WORD, result, "eq.w");
 
     default:
-      LogDebug("0x%lx: Eqbhw::%s received invalid opcode 2 0x%x", addr,
-               __func__, op2);
+      TRICORE_LOG_REJECT("0x%lx: Eqbhw::%s received invalid opcode 2 0x%x",
+                         addr, __func__, op2);
       return false;
   }
 }
@@ -1508,8 +1535,9 @@ bool Eqanybh::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpDcDaConst9_RC(data, len, WORD, result,
                                                   "eqany.h");
         default:
-          LogDebug("0x%lx: Eqanybh::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT(
+              "0x%lx: Eqanybh::%s received invalid opcode 2 0x%x",
+              addr, __func__, op2);
           return false;
       }
     case OP1_x0B_RR:
@@ -1523,13 +1551,14 @@ bool Eqanybh::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpDcDaDb_RR(data, len, WORD, result,
                                               "eqany.h");
         default:
-          LogDebug("0x%lx: Eqanybh::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT(
+              "0x%lx: Eqanybh::%s received invalid opcode 2 0x%x",
+              addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Eqanybh::%s received invalid opcode 1 0x%x", addr,
-               __func__, op1);
+      TRICORE_LOG_REJECT("0x%lx: Eqanybh::%s received invalid opcode 1 0x%x",
+                         addr, __func__, op1);
       return false;
   }
 }
@@ -1537,8 +1566,8 @@ bool Eqanybh::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Eqza::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                 size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x01_RR || op2 != EQZA_DC_AA) {
-    LogDebug("0x%lx: Eqza::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT("0x%lx: Eqza::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
     return false;
   }
   len = 4;
@@ -1559,8 +1588,8 @@ bool Extr::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpDcDaPosWidth_RRPW(data, len, WORD, result,
                                                       "extr.u");
         default:
-          LogDebug("0x%lx: Extr::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Extr::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x17_RRRR:
@@ -1574,8 +1603,8 @@ bool Extr::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpDcDaEd_RRRR(data, len, WORD, result,
                                                 "extr.u");
         default:
-          LogDebug("0x%lx: Extr::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Extr::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x57_RRRW:
@@ -1589,47 +1618,50 @@ bool Extr::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpDcDaDdWidth_RRRW(data, len, WORD, result,
                                                      "extr.u");
         default:
-          LogDebug("0x%lx: Extr::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Extr::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Extr::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Extr::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
 
 bool Fcall::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
-                 size_t& len, std::vector<InstructionTextToken>& result) {
+                 size_t& len, std::vector<InstructionTextToken>& result,
+                 uint32_t target) {
   switch (op1) {
     case FCALL_DISP24:
       len = 4;
-      return Instruction::TextOpDisp24_B(data, addr, len, WORD, result,
+      return Instruction::TextOpDisp24_B(data, target, len, WORD, result,
                                          "fcall");
     default:
-      LogDebug("0x%lx: Fcall::%s received invalid opcode 1 0x%x", addr,
-               __func__, op1);
+      TRICORE_LOG_REJECT("0x%lx: Fcall::%s received invalid opcode 1 0x%x",
+                         addr, __func__, op1);
       return false;
   }
 }
 
 bool Fcalla::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
-                  size_t& len, std::vector<InstructionTextToken>& result) {
+                  size_t& len, std::vector<InstructionTextToken>& result,
+                  uint32_t target) {
   if (op1 != FCALLA_DISP24) {
-    LogDebug("0x%lx: Fcalla::%s received invalid opcode 1 0x%x", addr, __func__,
-             op1);
+    TRICORE_LOG_REJECT("0x%lx: Fcalla::%s received invalid opcode 1 0x%x", addr,
+                       __func__, op1);
     return false;
   }
   len = 4;
-  return Instruction::TextOpDisp24_B(data, addr, len, WORD, result, "fcalla");
+  return Instruction::TextOpDisp24_B(data, target, len, WORD, result, "fcalla");
 }
 
 bool Fcalli::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                   size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x2D_RR || op2 != FCALLI_AA) {
-    LogDebug("0x%lx: Fcalli::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT(
+        "0x%lx: Fcalli::%s received invalid opcode(s) 0x%x, 0x%x",
+        addr, __func__, op1, op2);
     return false;
   }
   len = 4;
@@ -1645,8 +1677,8 @@ bool Fret::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           len = 2;
           return Instruction::TextOp_SR(data, len, WORD, result, "fret");
         default:
-          LogDebug("0x%lx: Fret::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Fret::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x0D_SYS:
@@ -1655,13 +1687,13 @@ bool Fret::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           len = 4;
           return Instruction::TextOp_SYS(data, len, WORD, result, "fret");
         default:
-          LogDebug("0x%lx: Fret::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Fret::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Fret::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Fret::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -1680,8 +1712,8 @@ bool Ge::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpDcDaConst9_RC(data, len, WORD, result,
                                                   "ge.u", true);
         default:
-          LogDebug("0x%lx: Ge::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Ge::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x0B_RR:
@@ -1693,13 +1725,13 @@ bool Ge::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           len = 4;
           return Instruction::TextOpDcDaDb_RR(data, len, WORD, result, "ge.u");
         default:
-          LogDebug("0x%lx: Ge::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Ge::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Ge::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Ge::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -1707,8 +1739,8 @@ bool Ge::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Gea::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x01_RR || op2 != GEA_DC_AA_AB) {
-    LogDebug("0x%lx: Gea::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT("0x%lx: Gea::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
     return false;
   }
   len = 4;
@@ -1720,8 +1752,8 @@ bool Imask::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
   switch (op1) {
     case OP1_xB7_RCPW:
       if (op2 != IMASK_EC_CONST4_POS_WIDTH) {
-        LogDebug("0x%lx: Imask::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Imask::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       len = 4;
@@ -1729,8 +1761,8 @@ bool Imask::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                                                       "imask");
     case OP1_xD7_RCRW:
       if (op2 != IMASK_EC_CONST4_DD_WIDTH) {
-        LogDebug("0x%lx: Imask::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Imask::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       len = 4;
@@ -1738,8 +1770,8 @@ bool Imask::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                                                      "imask");
     case OP1_x37_RRPW:
       if (op2 != IMASK_EC_DB_POS_WIDTH) {
-        LogDebug("0x%lx: Imask::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Imask::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       len = 4;
@@ -1747,16 +1779,16 @@ bool Imask::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                                                   "imask");
     case OP1_x57_RRRW:
       if (op2 != IMASK_EC_DB_DD_WIDTH) {
-        LogDebug("0x%lx: Imask::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Imask::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       len = 4;
       return Instruction::TextOpEcDbDdWidth_RRRW(data, len, WORD, result,
                                                  "imask");
     default:
-      LogDebug("0x%lx: Imask::%s received invalid opcode 1 0x%x", addr,
-               __func__, op1);
+      TRICORE_LOG_REJECT("0x%lx: Imask::%s received invalid opcode 1 0x%x",
+                         addr, __func__, op1);
       return false;
   }
 }
@@ -1764,8 +1796,8 @@ bool Imask::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool InstNt::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                   size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x67_BIT) {
-    LogDebug("0x%lx: InstNt::%s received invalid opcode 1 0x%x", addr, __func__,
-             op1);
+    TRICORE_LOG_REJECT("0x%lx: InstNt::%s received invalid opcode 1 0x%x", addr,
+                       __func__, op1);
     return false;
   }
   switch (op2) {
@@ -1778,8 +1810,8 @@ bool InstNt::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
       return Instruction::TextOpDcDaPos1DbPos2_BIT(data, len, WORD, result,
                                                    "insn.t");
     default:
-      LogDebug("0x%lx: InstNt::%s received invalid opcode 2 0x%x", addr,
-               __func__, op2);
+      TRICORE_LOG_REJECT("0x%lx: InstNt::%s received invalid opcode 2 0x%x",
+                         addr, __func__, op2);
       return false;
   }
 }
@@ -1789,8 +1821,8 @@ bool Insert::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
   switch (op1) {
     case OP1_xB7_RCPW:
       if (op2 != INSERT_DC_DA_CONST4_POS_WIDTH) {
-        LogDebug("0x%lx: Insert::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Insert::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       len = 4;
@@ -1798,8 +1830,8 @@ bool Insert::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                                                         "insert");
     case OP1_x97_RCRR:
       if (op2 != INSERT_DC_DA_CONST4_ED) {
-        LogDebug("0x%lx: Insert::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Insert::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       len = 4;
@@ -1807,8 +1839,8 @@ bool Insert::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                                                   "insert");
     case OP1_xD7_RCRW:
       if (op2 != INSERT_DC_DA_CONST4_DD_WIDTH) {
-        LogDebug("0x%lx: Insert::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Insert::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       len = 4;
@@ -1816,8 +1848,8 @@ bool Insert::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                                                        "insert");
     case OP1_x37_RRPW:
       if (op2 != INSERT_DC_DA_DB_POS_WIDTH) {
-        LogDebug("0x%lx: Insert::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Insert::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       len = 4;
@@ -1825,8 +1857,8 @@ bool Insert::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                                                     "insert");
     case OP1_x17_RRRR:
       if (op2 != INSERT_DC_DA_DB_ED) {
-        LogDebug("0x%lx: Insert::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Insert::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       len = 4;
@@ -1834,16 +1866,16 @@ bool Insert::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                                               "insert");
     case OP1_x57_RRRW:
       if (op2 != INSERT_DC_DA_DB_DD_WIDTH) {
-        LogDebug("0x%lx: Insert::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Insert::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       len = 4;
       return Instruction::TextOpDcDaDbDdWidth_RRRW(data, len, WORD, result,
                                                    "insert");
     default:
-      LogDebug("0x%lx: Insert::%s received invalid opcode 1 0x%x", addr,
-               __func__, op1);
+      TRICORE_LOG_REJECT("0x%lx: Insert::%s received invalid opcode 1 0x%x",
+                         addr, __func__, op1);
       return false;
   }
 }
@@ -1851,8 +1883,8 @@ bool Insert::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Isync::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                  size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x0D_SYS || op2 != ISYNC) {
-    LogDebug("0x%lx: Isync::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT("0x%lx: Isync::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
     return false;
   }
   len = 4;
@@ -1862,8 +1894,8 @@ bool Isync::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Ixmax::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                  size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x6B_RRR) {
-    LogDebug("0x%lx: Ixmax::%s received invalid opcode 1 0x%x", addr, __func__,
-             op1);
+    TRICORE_LOG_REJECT("0x%lx: Ixmax::%s received invalid opcode 1 0x%x", addr,
+                       __func__, op1);
     return false;
   }
   switch (op2) {
@@ -1874,8 +1906,8 @@ bool Ixmax::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
       len = 4;
       return Instruction::TextOpEcEdDb_RRR(data, len, WORD, result, "ixmax.u");
     default:
-      LogDebug("0x%lx: Ixmax::%s received invalid opcode 2 0x%x", addr,
-               __func__, op2);
+      TRICORE_LOG_REJECT("0x%lx: Ixmax::%s received invalid opcode 2 0x%x",
+                         addr, __func__, op2);
       return false;
   }
 }
@@ -1883,8 +1915,8 @@ bool Ixmax::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Ixmin::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                  size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x6B_RRR) {
-    LogDebug("0x%lx: Ixmin::%s received invalid opcode 1 0x%x", addr, __func__,
-             op1);
+    TRICORE_LOG_REJECT("0x%lx: Ixmin::%s received invalid opcode 1 0x%x", addr,
+                       __func__, op1);
     return false;
   }
   switch (op2) {
@@ -1895,149 +1927,158 @@ bool Ixmin::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
       len = 4;
       return Instruction::TextOpEcEdDb_RRR(data, len, WORD, result, "ixmin.u");
     default:
-      LogDebug("0x%lx: Ixmin::%s received invalid opcode 2 0x%x", addr,
-               __func__, op2);
+      TRICORE_LOG_REJECT("0x%lx: Ixmin::%s received invalid opcode 2 0x%x",
+                         addr, __func__, op2);
       return false;
   }
 }
 
 bool J::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
-             size_t& len, std::vector<InstructionTextToken>& result) {
+             size_t& len, std::vector<InstructionTextToken>& result,
+             uint32_t target) {
   switch (op1) {
     case J_DISP8:
       len = 2;
-      return Instruction::TextOpDisp8_SB(data, addr, len, WORD, result, "j");
+      return Instruction::TextOpDisp8_SB(data, target, len, WORD, result, "j");
     case J_DISP24:
       len = 4;
-      return Instruction::TextOpDisp24_B(data, addr, len, WORD, result, "j");
+      return Instruction::TextOpDisp24_B(data, target, len, WORD, result, "j");
     default:
-      LogDebug("0x%lx: J::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: J::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
 
 bool Ja::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
-              size_t& len, std::vector<InstructionTextToken>& result) {
+              size_t& len, std::vector<InstructionTextToken>& result,
+              uint32_t target) {
   if (op1 != JA_DISP24) {
-    LogDebug("0x%lx: Ja::%s received invalid opcode 1 0x%x", addr, __func__,
-             op1);
+    TRICORE_LOG_REJECT("0x%lx: Ja::%s received invalid opcode 1 0x%x", addr,
+                       __func__, op1);
     return false;
   }
   len = 4;
-  return Instruction::TextOpDisp24_B(data, addr, len, WORD, result, "ja");
+  return Instruction::TextOpDisp24_B(data, target, len, WORD, result, "ja");
 }
 
 bool Jeq::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
-               size_t& len, std::vector<InstructionTextToken>& result) {
+               size_t& len, std::vector<InstructionTextToken>& result,
+               uint32_t target) {
   switch (op1) {
     case JEQ_D15_CONST4_DISP4:
     case JEQ_D15_CONST4_DISP4_EX:  // TCv1.6 ISA only
       len = 2;
-      return Instruction::TextOpD15Const4Disp4_SBC(data, addr, len, WORD,
+      return Instruction::TextOpD15Const4Disp4_SBC(data, target, len, WORD,
                                                    result, "jeq");
     case JEQ_D15_DB_DISP4:
     case JEQ_D15_DB_DISP4_EX:  // TCv1.6 ISA only
       len = 2;
-      return Instruction::TextOpD15DbDisp4_SBR(data, addr, len, WORD, result,
+      return Instruction::TextOpD15DbDisp4_SBR(data, target, len, WORD, result,
                                                "jeq");
     case OP1_xDF_BRC:
       if (op2 != JEQ_DA_CONST4_DISP15) {
-        LogDebug("0x%lx: Jeq::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Jeq::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       len = 4;
-      return Instruction::TextOpDaConst4Disp15_BRC(data, addr, len, WORD,
+      return Instruction::TextOpDaConst4Disp15_BRC(data, target, len, WORD,
                                                    result, "jeq");
     case OP1_x5F_BRR:
       if (op2 != JEQ_DA_DB_DISP15) {
-        LogDebug("0x%lx: Jeq::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Jeq::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       len = 4;
-      return Instruction::TextOpDaDbDisp15_BRR(data, addr, len, WORD, result,
+      return Instruction::TextOpDaDbDisp15_BRR(data, target, len, WORD, result,
                                                "jeq");
     default:
-      LogDebug("0x%lx: Jeq::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Jeq::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
 
 bool Jeqa::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
-                size_t& len, std::vector<InstructionTextToken>& result) {
+                size_t& len, std::vector<InstructionTextToken>& result,
+                uint32_t target) {
   if (op1 != OP1_x7D_BRR || op2 != JEQA_AA_AB_DISP15) {
-    LogDebug("0x%lx: Jeqa::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT("0x%lx: Jeqa::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
     return false;
   }
   len = 4;
-  return Instruction::TextOpAaAbDisp15_BRR(data, addr, len, WORD, result,
+  return Instruction::TextOpAaAbDisp15_BRR(data, target, len, WORD, result,
                                            "jeqa");
 }
 
 bool Jge::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
-               size_t& len, std::vector<InstructionTextToken>& result) {
+               size_t& len, std::vector<InstructionTextToken>& result,
+               uint32_t target) {
   switch (op1) {
     case OP1_xFF_BRC:
       switch (op2) {
         case JGE_DA_CONST4_DISP15:
           len = 4;
-          return Instruction::TextOpDaConst4Disp15_BRC(data, addr, len, WORD,
+          return Instruction::TextOpDaConst4Disp15_BRC(data, target, len, WORD,
                                                        result, "jge");
         case JGEU_DA_CONST4_DISP15:
           len = 4;
-          return Instruction::TextOpDaConst4Disp15_BRC(data, addr, len, WORD,
+          return Instruction::TextOpDaConst4Disp15_BRC(data, target, len, WORD,
                                                        result, "jge.u", true);
         default:
-          LogDebug("0x%lx: Jge::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Jge::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x7F_BRR:
       switch (op2) {
         case JGE_DA_DB_DISP15:
           len = 4;
-          return Instruction::TextOpDaDbDisp15_BRR(data, addr, len, WORD,
+          return Instruction::TextOpDaDbDisp15_BRR(data, target, len, WORD,
                                                    result, "jge");
         case JGEU_DA_DB_DISP15:
           len = 4;
-          return Instruction::TextOpDaDbDisp15_BRR(data, addr, len, WORD,
+          return Instruction::TextOpDaDbDisp15_BRR(data, target, len, WORD,
                                                    result, "jge.u");
         default:
-          LogDebug("0x%lx: Jge::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Jge::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Jge::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Jge::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
 
 bool Jgez::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
-                size_t& len, std::vector<InstructionTextToken>& result) {
+                size_t& len, std::vector<InstructionTextToken>& result,
+                uint32_t target) {
   if (op1 != JGEZ_DB_DISP4) {
-    LogDebug("0x%lx: Jgez::%s received invalid opcode 1 0x%x", addr, __func__,
-             op1);
+    TRICORE_LOG_REJECT("0x%lx: Jgez::%s received invalid opcode 1 0x%x", addr,
+                       __func__, op1);
     return false;
   }
   len = 2;
-  return Instruction::TextOpDbDisp4_SBR(data, addr, len, WORD, result, "jgez");
+  return Instruction::TextOpDbDisp4_SBR(data, target, len, WORD, result,
+                                        "jgez");
 }
 
 bool Jgtz::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
-                size_t& len, std::vector<InstructionTextToken>& result) {
+                size_t& len, std::vector<InstructionTextToken>& result,
+                uint32_t target) {
   if (op1 != JGTZ_DB_DISP4) {
-    LogDebug("0x%lx: Jgtz::%s received invalid opcode 1 0x%x", addr, __func__,
-             op1);
+    TRICORE_LOG_REJECT("0x%lx: Jgtz::%s received invalid opcode 1 0x%x", addr,
+                       __func__, op1);
     return false;
   }
   len = 2;
-  return Instruction::TextOpDbDisp4_SBR(data, addr, len, WORD, result, "jgtz");
+  return Instruction::TextOpDbDisp4_SBR(data, target, len, WORD, result,
+                                        "jgtz");
 }
 
 bool Ji::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
@@ -2045,65 +2086,69 @@ bool Ji::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
   switch (op1) {
     case OP1_xDC_SR:
       if (op2 != JI_AA_16) {
-        LogDebug("0x%lx: Ji::%s received invalid opcode 2 0x%x", addr, __func__,
-                 op2);
+        TRICORE_LOG_REJECT("0x%lx: Ji::%s received invalid opcode 2 0x%x", addr,
+                           __func__, op2);
         return false;
       }
       len = 2;
       return Instruction::TextOpAa_SR(data, len, WORD, result, "ji");
     case OP1_x2D_RR:
       if (op2 != JI_AA_32) {
-        LogDebug("0x%lx: Ji::%s received invalid opcode 2 0x%x", addr, __func__,
-                 op2);
+        TRICORE_LOG_REJECT("0x%lx: Ji::%s received invalid opcode 2 0x%x", addr,
+                           __func__, op2);
         return false;
       }
       len = 4;
       return Instruction::TextOpAa_RR(data, len, WORD, result, "ji");
     default:
-      LogDebug("0x%lx: Ji::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Ji::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
 
 bool Jl::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
-              size_t& len, std::vector<InstructionTextToken>& result) {
+              size_t& len, std::vector<InstructionTextToken>& result,
+              uint32_t target) {
   if (op1 != JL_DISP24) {
-    LogDebug("0x%lx: Jl::%s received invalid opcode 1 0x%x", addr, __func__,
-             op1);
+    TRICORE_LOG_REJECT("0x%lx: Jl::%s received invalid opcode 1 0x%x", addr,
+                       __func__, op1);
     return false;
   }
   len = 4;
-  return Instruction::TextOpDisp24_B(data, addr, len, WORD, result, "jl");
+  return Instruction::TextOpDisp24_B(data, target, len, WORD, result, "jl");
 }
 
 bool Jla::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
-               size_t& len, std::vector<InstructionTextToken>& result) {
+               size_t& len, std::vector<InstructionTextToken>& result,
+               uint32_t target) {
   if (op1 != JLA_DISP24) {
-    LogDebug("0x%lx: Jla::%s received invalid opcode 1 0x%x", addr, __func__,
-             op1);
+    TRICORE_LOG_REJECT("0x%lx: Jla::%s received invalid opcode 1 0x%x", addr,
+                       __func__, op1);
     return false;
   }
   len = 4;
-  return Instruction::TextOpDisp24_B(data, addr, len, WORD, result, "jla");
+  return Instruction::TextOpDisp24_B(data, target, len, WORD, result, "jla");
 }
 
 bool Jlez::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
-                size_t& len, std::vector<InstructionTextToken>& result) {
+                size_t& len, std::vector<InstructionTextToken>& result,
+                uint32_t target) {
   if (op1 != JLEZ_DB_DISP4) {
-    LogDebug("0x%lx: Jlez::%s received invalid opcode 1 0x%x", addr, __func__,
-             op1);
+    TRICORE_LOG_REJECT("0x%lx: Jlez::%s received invalid opcode 1 0x%x", addr,
+                       __func__, op1);
     return false;
   }
   len = 2;
-  return Instruction::TextOpDbDisp4_SBR(data, addr, len, WORD, result, "jlez");
+  return Instruction::TextOpDbDisp4_SBR(data, target, len, WORD, result,
+                                        "jlez");
 }
 
 bool Jli::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x2D_RR || op2 != JLI_AA) {
-    LogDebug("0x%lx: Jli::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT("0x%lx: Jli::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
     return false;
   }
   len = 4;
@@ -2111,286 +2156,299 @@ bool Jli::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 }
 
 bool Jlt::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
-               size_t& len, std::vector<InstructionTextToken>& result) {
+               size_t& len, std::vector<InstructionTextToken>& result,
+               uint32_t target) {
   switch (op1) {
     case OP1_xBF_BRC:
       switch (op2) {
         case JLT_DA_CONST4_DISP15:
           len = 4;
-          return Instruction::TextOpDaConst4Disp15_BRC(data, addr, len, WORD,
+          return Instruction::TextOpDaConst4Disp15_BRC(data, target, len, WORD,
                                                        result, "jlt");
         case JLTU_DA_CONST4_DISP15:
           len = 4;
-          return Instruction::TextOpDaConst4Disp15_BRC(data, addr, len, WORD,
+          return Instruction::TextOpDaConst4Disp15_BRC(data, target, len, WORD,
                                                        result, "jlt.u", true);
         default:
-          LogDebug("0x%lx: Jlt::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Jlt::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x3F_BRR:
       switch (op2) {
         case JLT_DA_DB_DISP15:
           len = 4;
-          return Instruction::TextOpDaDbDisp15_BRR(data, addr, len, WORD,
+          return Instruction::TextOpDaDbDisp15_BRR(data, target, len, WORD,
                                                    result, "jlt");
         case JLTU_DA_DB_DISP15:
           len = 4;
-          return Instruction::TextOpDaDbDisp15_BRR(data, addr, len, WORD,
+          return Instruction::TextOpDaDbDisp15_BRR(data, target, len, WORD,
                                                    result, "jlt.u");
         default:
-          LogDebug("0x%lx: Jlt::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Jlt::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Jlt::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Jlt::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
 
 bool Jltz::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
-                size_t& len, std::vector<InstructionTextToken>& result) {
+                size_t& len, std::vector<InstructionTextToken>& result,
+                uint32_t target) {
   if (op1 != JLTZ_DB_DISP4) {
-    LogDebug("0x%lx: Jltz::%s received invalid opcode 1 0x%x", addr, __func__,
-             op1);
+    TRICORE_LOG_REJECT("0x%lx: Jltz::%s received invalid opcode 1 0x%x", addr,
+                       __func__, op1);
     return false;
   }
   len = 2;
-  return Instruction::TextOpDbDisp4_SBR(data, addr, len, WORD, result, "jltz");
+  return Instruction::TextOpDbDisp4_SBR(data, target, len, WORD, result,
+                                        "jltz");
 }
 
 bool Jne::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
-               size_t& len, std::vector<InstructionTextToken>& result) {
+               size_t& len, std::vector<InstructionTextToken>& result,
+               uint32_t target) {
   switch (op1) {
     case OP1_xDF_BRC:
       if (op2 != JNE_DA_CONST4_DISP15) {
-        LogDebug("0x%lx: Jne::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Jne::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       len = 4;
-      return Instruction::TextOpDaConst4Disp15_BRC(data, addr, len, WORD,
+      return Instruction::TextOpDaConst4Disp15_BRC(data, target, len, WORD,
                                                    result, "jne");
     case OP1_x5F_BRR:
       if (op2 != JNE_DA_DB_DISP15) {
-        LogDebug("0x%lx: Jne::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Jne::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       len = 4;
-      return Instruction::TextOpDaDbDisp15_BRR(data, addr, len, WORD, result,
+      return Instruction::TextOpDaDbDisp15_BRR(data, target, len, WORD, result,
                                                "jne");
     case JNE_D15_CONST4_DISP4:
     case JNE_D15_CONST4_DISP4_EX:  // TCv1.6 ISA only
       len = 2;
-      return Instruction::TextOpD15Const4Disp4_SBC(data, addr, len, WORD,
+      return Instruction::TextOpD15Const4Disp4_SBC(data, target, len, WORD,
                                                    result, "jne");
     case JNE_D15_DB_DISP4:
     case JNE_D15_DB_DISP4_EX:  // TCv1.6 ISA only
       len = 2;
-      return Instruction::TextOpD15DbDisp4_SBR(data, addr, len, WORD, result,
+      return Instruction::TextOpD15DbDisp4_SBR(data, target, len, WORD, result,
                                                "jne");
     default:
-      LogDebug("0x%lx: Jne::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Jne::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
 
 bool Jnea::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
-                size_t& len, std::vector<InstructionTextToken>& result) {
+                size_t& len, std::vector<InstructionTextToken>& result,
+                uint32_t target) {
   if (op1 != OP1_x7D_BRR || op2 != JNEA_AA_AB_DISP15) {
-    LogDebug("0x%lx: Jnea::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT("0x%lx: Jnea::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
     return false;
   }
   len = 4;
-  return Instruction::TextOpAaAbDisp15_BRR(data, addr, len, WORD, result,
+  return Instruction::TextOpAaAbDisp15_BRR(data, target, len, WORD, result,
                                            "jnea");
 }
 
 bool Jned::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
-                size_t& len, std::vector<InstructionTextToken>& result) {
+                size_t& len, std::vector<InstructionTextToken>& result,
+                uint32_t target) {
   switch (op1) {
     case OP1_x9F_BRC:
       if (op2 != JNED_DA_CONST4_DISP15) {
-        LogDebug("0x%lx: Jned::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Jned::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       len = 4;
-      return Instruction::TextOpDaConst4Disp15_BRC(data, addr, len, WORD,
+      return Instruction::TextOpDaConst4Disp15_BRC(data, target, len, WORD,
                                                    result, "jned");
     case OP1_x1F_BRR:
       if (op2 != JNED_DA_DB_DISP15) {
-        LogDebug("0x%lx: Jned::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Jned::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       len = 4;
-      return Instruction::TextOpDaDbDisp15_BRR(data, addr, len, WORD, result,
+      return Instruction::TextOpDaDbDisp15_BRR(data, target, len, WORD, result,
                                                "jned");
     default:
-      LogDebug("0x%lx: Jned::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Jned::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
 
 bool Jnei::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
-                size_t& len, std::vector<InstructionTextToken>& result) {
+                size_t& len, std::vector<InstructionTextToken>& result,
+                uint32_t target) {
   switch (op1) {
     case OP1_x9F_BRC:
       if (op2 != JNEI_DA_CONST4_DISP15) {
-        LogDebug("0x%lx: Jnei::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Jnei::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       len = 4;
-      return Instruction::TextOpDaConst4Disp15_BRC(data, addr, len, WORD,
+      return Instruction::TextOpDaConst4Disp15_BRC(data, target, len, WORD,
                                                    result, "jnei");
     case OP1_x1F_BRR:
       if (op2 != JNEI_DA_DB_DISP15) {
-        LogDebug("0x%lx: Jnei::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Jnei::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       len = 4;
-      return Instruction::TextOpDaDbDisp15_BRR(data, addr, len, WORD, result,
+      return Instruction::TextOpDaDbDisp15_BRR(data, target, len, WORD, result,
                                                "jnei");
     default:
-      LogDebug("0x%lx: Jnei::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Jnei::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
 
 bool Jnz::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
-               size_t& len, std::vector<InstructionTextToken>& result) {
+               size_t& len, std::vector<InstructionTextToken>& result,
+               uint32_t target) {
   switch (op1) {
     case JNZ_D15_DISP8:
       len = 2;
-      return Instruction::TextOpD15Disp8_SB(data, addr, len, WORD, result,
+      return Instruction::TextOpD15Disp8_SB(data, target, len, WORD, result,
                                             "jnz");
     case JNZ_DB_DISP4:
       len = 2;
-      return Instruction::TextOpDbDisp4_SBR(data, addr, len, WORD, result,
+      return Instruction::TextOpDbDisp4_SBR(data, target, len, WORD, result,
                                             "jnz");
     default:
-      LogDebug("0x%lx: Jnz::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Jnz::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
 
 bool Jnza::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
-                size_t& len, std::vector<InstructionTextToken>& result) {
+                size_t& len, std::vector<InstructionTextToken>& result,
+                uint32_t target) {
   switch (op1) {
     case JNZA_AB_DISP4:
       len = 2;
-      return Instruction::TextOpAbDisp4_SBR(data, addr, len, WORD, result,
+      return Instruction::TextOpAbDisp4_SBR(data, target, len, WORD, result,
                                             "jnz.a");
     case OP1_xBD_BRR:
       if (op2 != JNZA_AA_DISP15) {
-        LogDebug("0x%lx: Jnza::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Jnza::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       len = 4;
-      return Instruction::TextOpAaDisp15_BRR(data, addr, len, WORD, result,
+      return Instruction::TextOpAaDisp15_BRR(data, target, len, WORD, result,
                                              "jnz.a");
     default:
-      LogDebug("0x%lx: Jnza::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Jnza::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
 
 bool Jnzt::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
-                size_t& len, std::vector<InstructionTextToken>& result) {
+                size_t& len, std::vector<InstructionTextToken>& result,
+                uint32_t target) {
   switch (op1) {
     case JNZT_D15_N_DISP4:
       len = 2;
-      return Instruction::TextOpD15NDisp4_SBRN(data, addr, len, WORD, result,
+      return Instruction::TextOpD15NDisp4_SBRN(data, target, len, WORD, result,
                                                "jnz.t");
     case OP1_x6F_BRN:
       if (op2 != JNZT_DA_N_DISP15) {
-        LogDebug("0x%lx: Jnzt::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Jnzt::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       len = 4;
-      return Instruction::TextOpDaNDisp15_BRN(data, addr, len, WORD, result,
+      return Instruction::TextOpDaNDisp15_BRN(data, target, len, WORD, result,
                                               "jnz.t");
     default:
-      LogDebug("0x%lx: Jnzt::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Jnzt::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
 
 bool Jz::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
-              size_t& len, std::vector<InstructionTextToken>& result) {
+              size_t& len, std::vector<InstructionTextToken>& result,
+              uint32_t target) {
   switch (op1) {
     case JZ_D15_DISP8:
       len = 2;
-      return Instruction::TextOpD15Disp8_SB(data, addr, len, WORD, result,
+      return Instruction::TextOpD15Disp8_SB(data, target, len, WORD, result,
                                             "jz");
     case JZ_DB_DISP4:
       len = 2;
-      return Instruction::TextOpDbDisp4_SBR(data, addr, len, WORD, result,
+      return Instruction::TextOpDbDisp4_SBR(data, target, len, WORD, result,
                                             "jz");
     default:
-      LogDebug("0x%lx: Jz::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Jz::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
 
 bool Jza::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
-               size_t& len, std::vector<InstructionTextToken>& result) {
+               size_t& len, std::vector<InstructionTextToken>& result,
+               uint32_t target) {
   switch (op1) {
     case JZA_AB_DISP4:
       len = 2;
-      return Instruction::TextOpAbDisp4_SBR(data, addr, len, WORD, result,
+      return Instruction::TextOpAbDisp4_SBR(data, target, len, WORD, result,
                                             "jz.a");
     case OP1_xBD_BRR:
       if (op2 != JZA_AA_DISP15) {
-        LogDebug("0x%lx: Jza::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Jza::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       len = 4;
-      return Instruction::TextOpAaDisp15_BRR(data, addr, len, WORD, result,
+      return Instruction::TextOpAaDisp15_BRR(data, target, len, WORD, result,
                                              "jz.a");
     default:
-      LogDebug("0x%lx: Jza::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Jza::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
 
 bool Jzt::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
-               size_t& len, std::vector<InstructionTextToken>& result) {
+               size_t& len, std::vector<InstructionTextToken>& result,
+               uint32_t target) {
   switch (op1) {
     case JZT_D15_N_DISP4:
       len = 2;
-      return Instruction::TextOpD15NDisp4_SBRN(data, addr, len, WORD, result,
+      return Instruction::TextOpD15NDisp4_SBRN(data, target, len, WORD, result,
                                                "jz.t");
     case OP1_x6F_BRN:
       if (op2 != JZT_DA_N_DISP15) {
-        LogDebug("0x%lx: Jzt::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Jzt::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       len = 4;
-      return Instruction::TextOpDaNDisp15_BRN(data, addr, len, WORD, result,
+      return Instruction::TextOpDaNDisp15_BRN(data, target, len, WORD, result,
                                               "jz.t");
     default:
-      LogDebug("0x%lx: Jzt::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Jzt::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -2421,8 +2479,8 @@ bool Lda::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
       return Instruction::TextOpAaAbOff16_BOL(data, len, WORD, result, "ld.a");
     case OP1_x85_ABS:
       if (op2 != LDA_AA_OFF18) {
-        LogDebug("0x%lx: Lda::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Lda::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       len = 4;
@@ -2442,8 +2500,8 @@ bool Lda::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpAaAbOff10_BO(data, len, WORD, result,
                                                  "ld.a", ADDRMODE_PREINC);
         default:
-          LogDebug("0x%lx: Lda::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Lda::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x29_BO:
@@ -2457,13 +2515,13 @@ bool Lda::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpAaPbOff10_BO(data, len, WORD, result,
                                                  "ld.a", ADDRMODE_CIRC);
         default:
-          LogDebug("0x%lx: Lda::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Lda::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Lda::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Lda::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -2503,8 +2561,8 @@ bool Ldb::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpDaOff18_ABS(data, len, BYTE, result,
                                                 "ld.bu");
         default:
-          LogDebug("0x%lx: Ldb::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Ldb::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x09_BO:
@@ -2534,8 +2592,8 @@ bool Ldb::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpDaAbOff10_BO(data, len, BYTE, result,
                                                  "ld.bu", ADDRMODE_PREINC);
         default:
-          LogDebug("0x%lx: Ldb::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Ldb::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x29_BO:
@@ -2557,13 +2615,13 @@ bool Ldb::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpDaPbOff10_BO(data, len, BYTE, result,
                                                  "ld.bu", ADDRMODE_CIRC);
         default:
-          LogDebug("0x%lx: Ldb::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Ldb::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Ldb::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Ldb::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -2573,8 +2631,8 @@ bool Ldd::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
   switch (op1) {
     case OP1_x85_ABS:
       if (op2 != LDD_EA_OFF18) {
-        LogDebug("0x%lx: Ldd::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Ldd::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       len = 4;
@@ -2594,8 +2652,8 @@ bool Ldd::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpEaAbOff10_BO(data, len, DWORD, result,
                                                  "ld.d", ADDRMODE_PREINC);
         default:
-          LogDebug("0x%lx: Ldd::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Ldd::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x29_BO:
@@ -2609,13 +2667,13 @@ bool Ldd::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpEaPbOff10_BO(data, len, DWORD, result,
                                                  "ld.d", ADDRMODE_CIRC);
         default:
-          LogDebug("0x%lx: Ldd::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Ldd::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Ldd::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Ldd::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -2625,8 +2683,8 @@ bool Ldda::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
   switch (op1) {
     case OP1_x85_ABS:
       if (op2 != LDDA_PA_OFF18) {
-        LogDebug("0x%lx: Ldda::%s received invalid opcode 2 0x%x", addr,
-                 __func__, op2);
+        TRICORE_LOG_REJECT("0x%lx: Ldda::%s received invalid opcode 2 0x%x",
+                           addr, __func__, op2);
         return false;
       }
       len = 4;
@@ -2646,8 +2704,8 @@ bool Ldda::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpPaAbOff10_BO(data, len, DWORD, result,
                                                  "ld.da", ADDRMODE_PREINC);
         default:
-          LogDebug("0x%lx: Ldda::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Ldda::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x29_BO:
@@ -2661,13 +2719,13 @@ bool Ldda::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpPaPbOff10_BO(data, len, DWORD, result,
                                                  "ld.da", ADDRMODE_CIRC);
         default:
-          LogDebug("0x%lx: Ldda::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Ldda::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Ldda::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Ldda::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -2700,8 +2758,8 @@ bool Ldh::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpDaOff18_ABS(data, len, HWORD, result,
                                                 "ld.h");
         default:
-          LogDebug("0x%lx: Ldh::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Ldh::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x09_BO:
@@ -2719,8 +2777,8 @@ bool Ldh::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpDaAbOff10_BO(data, len, HWORD, result,
                                                  "ld.h", ADDRMODE_PREINC);
         default:
-          LogDebug("0x%lx: Ldh::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Ldh::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x29_BO:
@@ -2734,13 +2792,13 @@ bool Ldh::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpDaPbOff10_BO(data, len, HWORD, result,
                                                  "ld.h", ADDRMODE_CIRC);
         default:
-          LogDebug("0x%lx: Ldh::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Ldh::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Ldh::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Ldh::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -2759,8 +2817,8 @@ bool Ldhu::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpDaOff18_ABS(data, len, HWORD, result,
                                                 "ld.hu");
         default:
-          LogDebug("0x%lx: Ldhu::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Ldhu::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x09_BO:
@@ -2778,8 +2836,8 @@ bool Ldhu::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpDaAbOff10_BO(data, len, HWORD, result,
                                                  "ld.hu", ADDRMODE_PREINC);
         default:
-          LogDebug("0x%lx: Ldhu::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Ldhu::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x29_BO:
@@ -2793,13 +2851,13 @@ bool Ldhu::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpDaPbOff10_BO(data, len, HWORD, result,
                                                  "ld.hu", ADDRMODE_CIRC);
         default:
-          LogDebug("0x%lx: Ldhu::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Ldhu::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Ldhu::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Ldhu::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -2814,8 +2872,8 @@ bool Ldq::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpDaOff18_ABS(data, len, HWORD, result,
                                                 "ld.q");
         default:
-          LogDebug("0x%lx: Ldq::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Ldq::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x09_BO:
@@ -2833,8 +2891,8 @@ bool Ldq::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpDaAbOff10_BO(data, len, HWORD, result,
                                                  "ld.q", ADDRMODE_PREINC);
         default:
-          LogDebug("0x%lx: Ldq::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Ldq::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x29_BO:
@@ -2848,13 +2906,13 @@ bool Ldq::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpDaPbOff10_BO(data, len, HWORD, result,
                                                  "ld.q", ADDRMODE_CIRC);
         default:
-          LogDebug("0x%lx: Ldq::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Ldq::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Ldq::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Ldq::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -2890,8 +2948,8 @@ bool Ldw::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpDaOff18_ABS(data, len, WORD, result,
                                                 "ld.w");
         default:
-          LogDebug("0x%lx: Ldw::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Ldw::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x09_BO:
@@ -2909,8 +2967,8 @@ bool Ldw::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpDaAbOff10_BO(data, len, WORD, result,
                                                  "ld.w", ADDRMODE_PREINC);
         default:
-          LogDebug("0x%lx: Ldw::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Ldw::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x29_BO:
@@ -2924,13 +2982,13 @@ bool Ldw::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpDaPbOff10_BO(data, len, WORD, result,
                                                  "ld.w", ADDRMODE_CIRC);
         default:
-          LogDebug("0x%lx: Ldw::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Ldw::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Ldw::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Ldw::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -2944,8 +3002,8 @@ bool Ldlcx::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           len = 4;
           return Instruction::TextOpOff18_ABS(data, len, WORD, result, "ldlcx");
         default:
-          LogDebug("0x%lx: Ldlcx::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Ldlcx::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x49_BO:
@@ -2955,13 +3013,13 @@ bool Ldlcx::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpAbOff10_BO(data, len, WORD, result,
                                                "ldlcx");
         default:
-          LogDebug("0x%lx: Ldlcx::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Ldlcx::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Ldlcx::%s received invalid opcode 1 0x%x", addr,
-               __func__, op1);
+      TRICORE_LOG_REJECT("0x%lx: Ldlcx::%s received invalid opcode 1 0x%x",
+                         addr, __func__, op1);
       return false;
   }
 }
@@ -2976,8 +3034,8 @@ bool Ldmst::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpOff18Ea_ABS(data, len, WORD, result,
                                                 "ldmst");
         default:
-          LogDebug("0x%lx: Ldmst::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Ldmst::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x49_BO:
@@ -2995,8 +3053,8 @@ bool Ldmst::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpAbOff10Ea_BO(data, len, WORD, result,
                                                  "ldmst", ADDRMODE_PREINC);
         default:
-          LogDebug("0x%lx: Ldmst::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Ldmst::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x69_BO:
@@ -3010,13 +3068,13 @@ bool Ldmst::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpPbOff10Ea_BO(data, len, WORD, result,
                                                  "ldmst", ADDRMODE_CIRC);
         default:
-          LogDebug("0x%lx: Ldmst::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Ldmst::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Ldmst::%s received invalid opcode 1 0x%x", addr,
-               __func__, op1);
+      TRICORE_LOG_REJECT("0x%lx: Ldmst::%s received invalid opcode 1 0x%x",
+                         addr, __func__, op1);
       return false;
   }
 }
@@ -3030,8 +3088,8 @@ bool Lducx::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           len = 4;
           return Instruction::TextOpOff18_ABS(data, len, WORD, result, "lducx");
         default:
-          LogDebug("0x%lx: Lducx::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Lducx::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x49_BO:
@@ -3041,13 +3099,13 @@ bool Lducx::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpAbOff10_BO(data, len, WORD, result,
                                                "lducx");
         default:
-          LogDebug("0x%lx: Lducx::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Lducx::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Lducx::%s received invalid opcode 1 0x%x", addr,
-               __func__, op1);
+      TRICORE_LOG_REJECT("0x%lx: Lducx::%s received invalid opcode 1 0x%x",
+                         addr, __func__, op1);
       return false;
   }
 }
@@ -3064,8 +3122,8 @@ bool Lea::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           len = 4;
           return Instruction::TextOpAaOff18_ABS(data, len, WORD, result, "lea");
         default:
-          LogDebug("0x%lx: Lea::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Lea::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x49_BO:
@@ -3075,59 +3133,61 @@ bool Lea::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpAaAbOff10_BO(data, len, WORD, result,
                                                  "lea");
         default:
-          LogDebug("0x%lx: Lea::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Lea::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Lea::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Lea::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
 
 bool Loop::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
-                size_t& len, std::vector<InstructionTextToken>& result) {
+                size_t& len, std::vector<InstructionTextToken>& result,
+                uint32_t target) {
   switch (op1) {
     case LOOP_AB_DISP4:
       len = 2;
-      return Instruction::TextOpAbDisp4_SBR(data, addr, len, WORD, result,
+      return Instruction::TextOpAbDisp4_SBR(data, target, len, WORD, result,
                                             "loop");
     case OP1_xFD_BRR:
       switch (op2) {
         case LOOP_AB_DISP15:
           len = 4;
-          return Instruction::TextOpAbDisp15_BRR(data, addr, len, WORD, result,
-                                                 "loop");
+          return Instruction::TextOpAbDisp15_BRR(data, target, len, WORD,
+                                                 result, "loop");
         default:
-          LogDebug("0x%lx: Loop::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Loop::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Loop::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Loop::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
 
 bool Loopu::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
-                 size_t& len, std::vector<InstructionTextToken>& result) {
+                 size_t& len, std::vector<InstructionTextToken>& result,
+                 uint32_t target) {
   switch (op1) {
     case OP1_xFD_BRR:
       switch (op2) {
         case LOOPU_DISP15:
           len = 4;
-          return Instruction::TextOpDisp15_BRR(data, addr, len, WORD, result,
+          return Instruction::TextOpDisp15_BRR(data, target, len, WORD, result,
                                                "loopu");
         default:
-          LogDebug("0x%lx: Loopu::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Loopu::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Loopu::%s received invalid opcode 1 0x%x", addr,
-               __func__, op1);
+      TRICORE_LOG_REJECT("0x%lx: Loopu::%s received invalid opcode 1 0x%x",
+                         addr, __func__, op1);
       return false;
   }
 }
@@ -3152,8 +3212,8 @@ bool Lt::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpDcDaConst9_RC(data, len, WORD, result,
                                                   "lt.u", true);
         default:
-          LogDebug("0x%lx: Lt::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Lt::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x0B_RR:
@@ -3165,13 +3225,13 @@ bool Lt::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           len = 4;
           return Instruction::TextOpDcDaDb_RR(data, len, WORD, result, "lt.u");
         default:
-          LogDebug("0x%lx: Lt::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Lt::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Lt::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Lt::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -3179,8 +3239,8 @@ bool Lt::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Lta::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x01_RR || op2 != LTA_DC_AA_AB) {
-    LogDebug("0x%lx: Lta::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT("0x%lx: Lta::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
     return false;
   }
   len = 4;
@@ -3190,8 +3250,8 @@ bool Lta::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Ltb::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x0B_RR) {
-    LogDebug("0x%lx: Ltb::%s received invalid opcode 1 0x%x", addr, __func__,
-             op1);
+    TRICORE_LOG_REJECT("0x%lx: Ltb::%s received invalid opcode 1 0x%x", addr,
+                       __func__, op1);
     return false;
   }
   switch (op2) {
@@ -3202,8 +3262,8 @@ bool Ltb::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
       len = 4;
       return Instruction::TextOpDcDaDb_RR(data, len, BYTE, result, "lt.bu");
     default:
-      LogDebug("0x%lx: Ltb::%s received invalid opcode 2 0x%x", addr, __func__,
-               op2);
+      TRICORE_LOG_REJECT("0x%lx: Ltb::%s received invalid opcode 2 0x%x", addr,
+                         __func__, op2);
       return false;
   }
 }
@@ -3211,8 +3271,8 @@ bool Ltb::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Lth::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x0B_RR) {
-    LogDebug("0x%lx: Lth::%s received invalid opcode 1 0x%x", addr, __func__,
-             op1);
+    TRICORE_LOG_REJECT("0x%lx: Lth::%s received invalid opcode 1 0x%x", addr,
+                       __func__, op1);
     return false;
   }
   switch (op2) {
@@ -3223,8 +3283,8 @@ bool Lth::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
       len = 4;
       return Instruction::TextOpDcDaDb_RR(data, len, HWORD, result, "lt.hu");
     default:
-      LogDebug("0x%lx: Lth::%s received invalid opcode 2 0x%x", addr, __func__,
-               op2);
+      TRICORE_LOG_REJECT("0x%lx: Lth::%s received invalid opcode 2 0x%x", addr,
+                         __func__, op2);
       return false;
   }
 }
@@ -3232,8 +3292,8 @@ bool Lth::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Ltw::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x0B_RR) {
-    LogDebug("0x%lx: Ltw::%s received invalid opcode 1 0x%x", addr, __func__,
-             op1);
+    TRICORE_LOG_REJECT("0x%lx: Ltw::%s received invalid opcode 1 0x%x", addr,
+                       __func__, op1);
     return false;
   }
   switch (op2) {
@@ -3244,8 +3304,8 @@ bool Ltw::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
       len = 4;
       return Instruction::TextOpDcDaDb_RR(data, len, HWORD, result, "lt.wu");
     default:
-      LogDebug("0x%lx: Ltw::%s received invalid opcode 2 0x%x", addr, __func__,
-               op2);
+      TRICORE_LOG_REJECT("0x%lx: Ltw::%s received invalid opcode 2 0x%x", addr,
+                         __func__, op2);
       return false;
   }
 }
@@ -3272,8 +3332,8 @@ bool Madd::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpEcEdDaConst9_RCR(data, len, WORD, result,
                                                      "madds");
         default:
-          LogDebug("0x%lx: Madd::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Madd::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x03_RRR2:
@@ -3295,13 +3355,13 @@ bool Madd::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpEcEdDaDb_RRR2(data, len, WORD, result,
                                                   "madds");
         default:
-          LogDebug("0x%lx: Madd::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Madd::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Madd::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Madd::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -3309,8 +3369,8 @@ bool Madd::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Maddh::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                  size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x83_RRR1) {
-    LogDebug("0x%lx: Maddh::%s received invalid opcode 1 0x%x", addr, __func__,
-             op1);
+    TRICORE_LOG_REJECT("0x%lx: Maddh::%s received invalid opcode 1 0x%x", addr,
+                       __func__, op1);
     return false;
   }
   switch (op2) {
@@ -3347,8 +3407,8 @@ bool Maddh::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
       return Instruction::TextOpEcEdDaDbuuN_RRR1(data, len, HWORD, result,
                                                  "madds.h");
     default:
-      LogDebug("0x%lx: Maddh::%s received invalid opcode 2 0x%x", addr,
-               __func__, op2);
+      TRICORE_LOG_REJECT("0x%lx: Maddh::%s received invalid opcode 2 0x%x",
+                         addr, __func__, op2);
       return false;
   }
 }
@@ -3356,8 +3416,8 @@ bool Maddh::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Maddq::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                  size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x43_RRR1) {
-    LogDebug("0x%lx: Maddq::%s received invalid opcode 1 0x%x", addr, __func__,
-             op1);
+    TRICORE_LOG_REJECT("0x%lx: Maddq::%s received invalid opcode 1 0x%x", addr,
+                       __func__, op1);
     return false;
   }
   switch (op2) {
@@ -3442,8 +3502,8 @@ bool Maddq::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
       return Instruction::TextOpEcEdDauDbuN_RRR1(data, len, WORD, result,
                                                  "madds.q");
     default:
-      LogDebug("0x%lx: Maddq::%s received invalid opcode 2 0x%x", addr,
-               __func__, op2);
+      TRICORE_LOG_REJECT("0x%lx: Maddq::%s received invalid opcode 2 0x%x",
+                         addr, __func__, op2);
       return false;
   }
 }
@@ -3466,8 +3526,8 @@ bool Maddu::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpEcEdDaConst9_RCR(data, len, WORD, result,
                                                      "madds.u", true);
         default:
-          LogDebug("0x%lx: Maddu::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Maddu::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x03_RRR2:
@@ -3486,13 +3546,13 @@ bool Maddu::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                                                   "madds.u");
         case LTU_DC_DA_DB:
         default:
-          LogDebug("0x%lx: Maddu::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Maddu::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Maddu::%s received invalid opcode 1 0x%x", addr,
-               __func__, op1);
+      TRICORE_LOG_REJECT("0x%lx: Maddu::%s received invalid opcode 1 0x%x",
+                         addr, __func__, op1);
       return false;
   }
 }
@@ -3501,8 +3561,8 @@ bool MaddmhSh::Text(uint8_t op1, uint8_t op2, const uint8_t* data,
                     uint64_t addr, size_t& len,
                     std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x83_RRR1) {
-    LogDebug("0x%lx: MaddmhSh::%s received invalid opcode 1 0x%x", addr,
-             __func__, op1);
+    TRICORE_LOG_REJECT("0x%lx: MaddmhSh::%s received invalid opcode 1 0x%x",
+                       addr, __func__, op1);
     return false;
   }
   switch (op2) {
@@ -3539,8 +3599,8 @@ bool MaddmhSh::Text(uint8_t op1, uint8_t op2, const uint8_t* data,
       return Instruction::TextOpEcEdDaDbuuN_RRR1(data, len, HWORD, result,
                                                  "maddms.h");
     default:
-      LogDebug("0x%lx: MaddmhSh::%s received invalid opcode 2 0x%x", addr,
-               __func__, op2);
+      TRICORE_LOG_REJECT("0x%lx: MaddmhSh::%s received invalid opcode 2 0x%x",
+                         addr, __func__, op2);
       return false;
   }
 }
@@ -3584,8 +3644,9 @@ bool MaddrhSh::Text(uint8_t op1, uint8_t op2, const uint8_t* data,
           return Instruction::TextOpDcDdDaDbuuN_RRR1(data, len, HWORD, result,
                                                      "maddrs.h");
         default:
-          LogDebug("0x%lx: MaddrhSh::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT(
+              "0x%lx: MaddrhSh::%s received invalid opcode 2 0x%x",
+              addr, __func__, op2);
           return false;
       }
     case OP1_x43_RRR1:
@@ -3599,13 +3660,14 @@ bool MaddrhSh::Text(uint8_t op1, uint8_t op2, const uint8_t* data,
           return Instruction::TextOpDcEdDaDbulN_RRR1(data, len, HWORD, result,
                                                      "maddrs.h");
         default:
-          LogDebug("0x%lx: MaddrhSh::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT(
+              "0x%lx: MaddrhSh::%s received invalid opcode 2 0x%x",
+              addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: MaddrhSh::%s received invalid opcode 1 0x%x", addr,
-               __func__, op1);
+      TRICORE_LOG_REJECT("0x%lx: MaddrhSh::%s received invalid opcode 1 0x%x",
+                         addr, __func__, op1);
       return false;
   }
 }
@@ -3613,8 +3675,8 @@ bool MaddrhSh::Text(uint8_t op1, uint8_t op2, const uint8_t* data,
 bool Maddrq::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                   size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x43_RRR1) {
-    LogDebug("0x%lx: Maddrq::%s received invalid opcode 1 0x%x", addr, __func__,
-             op1);
+    TRICORE_LOG_REJECT("0x%lx: Maddrq::%s received invalid opcode 1 0x%x", addr,
+                       __func__, op1);
     return false;
   }
   switch (op2) {
@@ -3635,8 +3697,8 @@ bool Maddrq::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
       return Instruction::TextOpDcDdDauDbuN_RRR1(data, len, WORD, result,
                                                  "maddrs.q");
     default:
-      LogDebug("0x%lx: Maddrq::%s received invalid opcode 2 0x%x", addr,
-               __func__, op2);
+      TRICORE_LOG_REJECT("0x%lx: Maddrq::%s received invalid opcode 2 0x%x",
+                         addr, __func__, op2);
       return false;
   }
 }
@@ -3645,8 +3707,8 @@ bool MaddsuhSh::Text(uint8_t op1, uint8_t op2, const uint8_t* data,
                      uint64_t addr, size_t& len,
                      std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_xC3_RRR1) {
-    LogDebug("0x%lx: MaddsuhSh::%s received invalid opcode 1 0x%x", addr,
-             __func__, op1);
+    TRICORE_LOG_REJECT("0x%lx: MaddsuhSh::%s received invalid opcode 1 0x%x",
+                       addr, __func__, op1);
     return false;
   }
   switch (op2) {
@@ -3683,8 +3745,8 @@ bool MaddsuhSh::Text(uint8_t op1, uint8_t op2, const uint8_t* data,
       return Instruction::TextOpEcEdDaDbuuN_RRR1(data, len, HWORD, result,
                                                  "maddsus.h");
     default:
-      LogDebug("0x%lx: MaddsuhSh::%s received invalid opcode 2 0x%x", addr,
-               __func__, op2);
+      TRICORE_LOG_REJECT("0x%lx: MaddsuhSh::%s received invalid opcode 2 0x%x",
+                         addr, __func__, op2);
       return false;
   }
 }
@@ -3693,8 +3755,8 @@ bool MaddsumhSh::Text(uint8_t op1, uint8_t op2, const uint8_t* data,
                       uint64_t addr, size_t& len,
                       std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_xC3_RRR1) {
-    LogDebug("0x%lx: MaddsumhSh::%s received invalid opcode 1 0x%x", addr,
-             __func__, op1);
+    TRICORE_LOG_REJECT("0x%lx: MaddsumhSh::%s received invalid opcode 1 0x%x",
+                       addr, __func__, op1);
     return false;
   }
   switch (op2) {
@@ -3731,8 +3793,8 @@ bool MaddsumhSh::Text(uint8_t op1, uint8_t op2, const uint8_t* data,
       return Instruction::TextOpEcEdDaDbuuN_RRR1(data, len, HWORD, result,
                                                  "maddsums.h");
     default:
-      LogDebug("0x%lx: MaddsumhSh::%s received invalid opcode 2 0x%x", addr,
-               __func__, op2);
+      TRICORE_LOG_REJECT("0x%lx: MaddsumhSh::%s received invalid opcode 2 0x%x",
+                         addr, __func__, op2);
       return false;
   }
 }
@@ -3741,8 +3803,8 @@ bool MaddsurhSh::Text(uint8_t op1, uint8_t op2, const uint8_t* data,
                       uint64_t addr, size_t& len,
                       std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_xC3_RRR1) {
-    LogDebug("0x%lx: MaddsurhSh::%s received invalid opcode 1 0x%x", addr,
-             __func__, op1);
+    TRICORE_LOG_REJECT("0x%lx: MaddsurhSh::%s received invalid opcode 1 0x%x",
+                       addr, __func__, op1);
     return false;
   }
   switch (op2) {
@@ -3779,8 +3841,8 @@ bool MaddsurhSh::Text(uint8_t op1, uint8_t op2, const uint8_t* data,
       return Instruction::TextOpDcDdDaDbuuN_RRR1(data, len, HWORD, result,
                                                  "maddsurs.h");
     default:
-      LogDebug("0x%lx: MaddsurhSh::%s received invalid opcode 2 0x%x", addr,
-               __func__, op2);
+      TRICORE_LOG_REJECT("0x%lx: MaddsurhSh::%s received invalid opcode 2 0x%x",
+                         addr, __func__, op2);
       return false;
   }
 }
@@ -3799,8 +3861,8 @@ bool Max::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpDcDaConst9_RC(data, len, WORD, result,
                                                   "max.u", true);
         default:
-          LogDebug("0x%lx: Max::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Max::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x0B_RR:
@@ -3812,13 +3874,13 @@ bool Max::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           len = 4;
           return Instruction::TextOpDcDaDb_RR(data, len, WORD, result, "max.u");
         default:
-          LogDebug("0x%lx: Max::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Max::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Max::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Max::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -3826,8 +3888,8 @@ bool Max::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Maxb::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                 size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x0B_RR) {
-    LogDebug("0x%lx: Maxb::%s received invalid opcode 1 0x%x", addr, __func__,
-             op1);
+    TRICORE_LOG_REJECT("0x%lx: Maxb::%s received invalid opcode 1 0x%x", addr,
+                       __func__, op1);
     return false;
   }
   switch (op2) {
@@ -3838,8 +3900,8 @@ bool Maxb::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
       len = 4;
       return Instruction::TextOpDcDaDb_RR(data, len, BYTE, result, "max.bu");
     default:
-      LogDebug("0x%lx: Maxb::%s received invalid opcode 2 0x%x", addr, __func__,
-               op2);
+      TRICORE_LOG_REJECT("0x%lx: Maxb::%s received invalid opcode 2 0x%x", addr,
+                         __func__, op2);
       return false;
   }
 }
@@ -3847,8 +3909,8 @@ bool Maxb::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Maxh::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                 size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x0B_RR) {
-    LogDebug("0x%lx: Maxh::%s received invalid opcode 1 0x%x", addr, __func__,
-             op1);
+    TRICORE_LOG_REJECT("0x%lx: Maxh::%s received invalid opcode 1 0x%x", addr,
+                       __func__, op1);
     return false;
   }
   switch (op2) {
@@ -3859,8 +3921,8 @@ bool Maxh::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
       len = 4;
       return Instruction::TextOpDcDaDb_RR(data, len, HWORD, result, "max.hu");
     default:
-      LogDebug("0x%lx: Maxh::%s received invalid opcode 2 0x%x", addr, __func__,
-               op2);
+      TRICORE_LOG_REJECT("0x%lx: Maxh::%s received invalid opcode 2 0x%x", addr,
+                         __func__, op2);
       return false;
   }
 }
@@ -3868,8 +3930,8 @@ bool Maxh::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Mfcr::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                 size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != MFCR_DC_CONST16) {
-    LogDebug("0x%lx: Mfcr::%s received invalid opcode 1 0x%x", addr, __func__,
-             op1);
+    TRICORE_LOG_REJECT("0x%lx: Mfcr::%s received invalid opcode 1 0x%x", addr,
+                       __func__, op1);
     return false;
   }
   len = 4;
@@ -3891,8 +3953,8 @@ bool Min::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpDcDaConst9_RC(data, len, WORD, result,
                                                   "min.u", true);
         default:
-          LogDebug("0x%lx: Min::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Min::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x0B_RR:
@@ -3904,13 +3966,13 @@ bool Min::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           len = 4;
           return Instruction::TextOpDcDaDb_RR(data, len, WORD, result, "min.u");
         default:
-          LogDebug("0x%lx: Min::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Min::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Min::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Min::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -3918,8 +3980,8 @@ bool Min::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Minb::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                 size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x0B_RR) {
-    LogDebug("0x%lx: Minb::%s received invalid opcode 1 0x%x", addr, __func__,
-             op1);
+    TRICORE_LOG_REJECT("0x%lx: Minb::%s received invalid opcode 1 0x%x", addr,
+                       __func__, op1);
     return false;
   }
   switch (op2) {
@@ -3930,8 +3992,8 @@ bool Minb::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
       len = 4;
       return Instruction::TextOpDcDaDb_RR(data, len, BYTE, result, "min.bu");
     default:
-      LogDebug("0x%lx: Minb::%s received invalid opcode 2 0x%x", addr, __func__,
-               op2);
+      TRICORE_LOG_REJECT("0x%lx: Minb::%s received invalid opcode 2 0x%x", addr,
+                         __func__, op2);
       return false;
   }
 }
@@ -3939,8 +4001,8 @@ bool Minb::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Minh::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                 size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x0B_RR) {
-    LogDebug("0x%lx: Minh::%s received invalid opcode 1 0x%x", addr, __func__,
-             op1);
+    TRICORE_LOG_REJECT("0x%lx: Minh::%s received invalid opcode 1 0x%x", addr,
+                       __func__, op1);
     return false;
   }
   switch (op2) {
@@ -3951,8 +4013,8 @@ bool Minh::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
       len = 4;
       return Instruction::TextOpDcDaDb_RR(data, len, HWORD, result, "min.hu");
     default:
-      LogDebug("0x%lx: Minh::%s received invalid opcode 2 0x%x", addr, __func__,
-               op2);
+      TRICORE_LOG_REJECT("0x%lx: Minh::%s received invalid opcode 2 0x%x", addr,
+                         __func__, op2);
       return false;
   }
 }
@@ -3990,13 +4052,13 @@ bool Mov::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           len = 4;
           return Instruction::TextOpEcDaDb_RR(data, len, WORD, result, "mov");
         default:
-          LogDebug("0x%lx: Mov::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Mov::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Mov::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Mov::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -4017,13 +4079,13 @@ bool Mova::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           len = 4;
           return Instruction::TextOpAcDb_RR(data, len, WORD, result, "mov.a");
         default:
-          LogDebug("0x%lx: Mova::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Mova::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Mova::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Mova::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -4040,13 +4102,13 @@ bool Movaa::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           len = 4;
           return Instruction::TextOpAcAb_RR(data, len, WORD, result, "mov.aa");
         default:
-          LogDebug("0x%lx: Movaa::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Movaa::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Movaa::%s received invalid opcode 1 0x%x", addr,
-               __func__, op1);
+      TRICORE_LOG_REJECT("0x%lx: Movaa::%s received invalid opcode 1 0x%x",
+                         addr, __func__, op1);
       return false;
   }
 }
@@ -4063,13 +4125,13 @@ bool Movd::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           len = 4;
           return Instruction::TextOpDcAb_RR(data, len, WORD, result, "mov.d");
         default:
-          LogDebug("0x%lx: Movd::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Movd::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Movd::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Movd::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -4077,8 +4139,8 @@ bool Movd::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Movu::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                 size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != MOVU_DC_CONST16) {
-    LogDebug("0x%lx: Movu::%s received invalid opcode 1 0x%x", addr, __func__,
-             op1);
+    TRICORE_LOG_REJECT("0x%lx: Movu::%s received invalid opcode 1 0x%x", addr,
+                       __func__, op1);
     return false;
   }
   len = 4;
@@ -4089,8 +4151,8 @@ bool Movu::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Movh::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                 size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != MOVH_DC_CONST16) {
-    LogDebug("0x%lx: Movh::%s received invalid opcode 1 0x%x", addr, __func__,
-             op1);
+    TRICORE_LOG_REJECT("0x%lx: Movh::%s received invalid opcode 1 0x%x", addr,
+                       __func__, op1);
     return false;
   }
   len = 4;
@@ -4100,8 +4162,8 @@ bool Movh::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Movha::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                  size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != MOVHA_AC_CONST16) {
-    LogDebug("0x%lx: Movha::%s received invalid opcode 1 0x%x", addr, __func__,
-             op1);
+    TRICORE_LOG_REJECT("0x%lx: Movha::%s received invalid opcode 1 0x%x", addr,
+                       __func__, op1);
     return false;
   }
   len = 4;
@@ -4130,8 +4192,8 @@ bool Msub::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpEcEdDaConst9_RCR(data, len, WORD, result,
                                                      "msubs");
         default:
-          LogDebug("0x%lx: Msub::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Msub::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x23_RRR2:
@@ -4153,13 +4215,13 @@ bool Msub::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpEcEdDaDb_RRR2(data, len, WORD, result,
                                                   "msubs");
         default:
-          LogDebug("0x%lx: Msub::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Msub::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Msub::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Msub::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -4167,8 +4229,8 @@ bool Msub::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Msubh::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                  size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_xA3_RRR1) {
-    LogDebug("0x%lx: Msubh::%s received invalid opcode 1 0x%x", addr, __func__,
-             op1);
+    TRICORE_LOG_REJECT("0x%lx: Msubh::%s received invalid opcode 1 0x%x", addr,
+                       __func__, op1);
     return false;
   }
   switch (op2) {
@@ -4205,8 +4267,8 @@ bool Msubh::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
       return Instruction::TextOpEcEdDaDbuuN_RRR1(data, len, HWORD, result,
                                                  "msubs.h");
     default:
-      LogDebug("0x%lx: Msubh::%s received invalid opcode 2 0x%x", addr,
-               __func__, op2);
+      TRICORE_LOG_REJECT("0x%lx: Msubh::%s received invalid opcode 2 0x%x",
+                         addr, __func__, op2);
       return false;
   }
 }
@@ -4214,8 +4276,8 @@ bool Msubh::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Msubq::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                  size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x63_RRR1) {
-    LogDebug("0x%lx: Msubq::%s received invalid opcode 1 0x%x", addr, __func__,
-             op1);
+    TRICORE_LOG_REJECT("0x%lx: Msubq::%s received invalid opcode 1 0x%x", addr,
+                       __func__, op1);
     return false;
   }
   switch (op2) {
@@ -4300,8 +4362,8 @@ bool Msubq::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
       return Instruction::TextOpEcEdDauDbuN_RRR1(data, len, WORD, result,
                                                  "msubs.q");
     default:
-      LogDebug("0x%lx: Msubq::%s received invalid opcode 2 0x%x", addr,
-               __func__, op2);
+      TRICORE_LOG_REJECT("0x%lx: Msubq::%s received invalid opcode 2 0x%x",
+                         addr, __func__, op2);
       return false;
   }
 }
@@ -4324,8 +4386,8 @@ bool Msubu::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpEcEdDaConst9_RCR(data, len, WORD, result,
                                                      "msubs.u", true);
         default:
-          LogDebug("0x%lx: Msubu::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Msubu::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x23_RRR2:
@@ -4343,13 +4405,13 @@ bool Msubu::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpEcEdDaDb_RRR2(data, len, WORD, result,
                                                   "msubs.u");
         default:
-          LogDebug("0x%lx: Msubu::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Msubu::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Msubu::%s received invalid opcode 1 0x%x", addr,
-               __func__, op1);
+      TRICORE_LOG_REJECT("0x%lx: Msubu::%s received invalid opcode 1 0x%x",
+                         addr, __func__, op1);
       return false;
   }
 }
@@ -4358,8 +4420,8 @@ bool MsubadhSh::Text(uint8_t op1, uint8_t op2, const uint8_t* data,
                      uint64_t addr, size_t& len,
                      std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_xE3_RRR1) {
-    LogDebug("0x%lx: MsubadhSh::%s received invalid opcode 1 0x%x", addr,
-             __func__, op1);
+    TRICORE_LOG_REJECT("0x%lx: MsubadhSh::%s received invalid opcode 1 0x%x",
+                       addr, __func__, op1);
     return false;
   }
   switch (op2) {
@@ -4396,8 +4458,8 @@ bool MsubadhSh::Text(uint8_t op1, uint8_t op2, const uint8_t* data,
       return Instruction::TextOpEcEdDaDbuuN_RRR1(data, len, HWORD, result,
                                                  "msubads.h");
     default:
-      LogDebug("0x%lx: MsubadhSh::%s received invalid opcode 2 0x%x", addr,
-               __func__, op2);
+      TRICORE_LOG_REJECT("0x%lx: MsubadhSh::%s received invalid opcode 2 0x%x",
+                         addr, __func__, op2);
       return false;
   }
 }
@@ -4406,8 +4468,8 @@ bool MsubadmhSh::Text(uint8_t op1, uint8_t op2, const uint8_t* data,
                       uint64_t addr, size_t& len,
                       std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_xE3_RRR1) {
-    LogDebug("0x%lx: MsubadmhSh::%s received invalid opcode 1 0x%x", addr,
-             __func__, op1);
+    TRICORE_LOG_REJECT("0x%lx: MsubadmhSh::%s received invalid opcode 1 0x%x",
+                       addr, __func__, op1);
     return false;
   }
   switch (op2) {
@@ -4444,8 +4506,8 @@ bool MsubadmhSh::Text(uint8_t op1, uint8_t op2, const uint8_t* data,
       return Instruction::TextOpEcEdDaDbuuN_RRR1(data, len, HWORD, result,
                                                  "msubadms.h");
     default:
-      LogDebug("0x%lx: MsubadmhSh::%s received invalid opcode 2 0x%x", addr,
-               __func__, op2);
+      TRICORE_LOG_REJECT("0x%lx: MsubadmhSh::%s received invalid opcode 2 0x%x",
+                         addr, __func__, op2);
       return false;
   }
 }
@@ -4454,8 +4516,8 @@ bool MsubadrhSh::Text(uint8_t op1, uint8_t op2, const uint8_t* data,
                       uint64_t addr, size_t& len,
                       std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_xE3_RRR1) {
-    LogDebug("0x%lx: MsubadrhSh::%s received invalid opcode 1 0x%x", addr,
-             __func__, op1);
+    TRICORE_LOG_REJECT("0x%lx: MsubadrhSh::%s received invalid opcode 1 0x%x",
+                       addr, __func__, op1);
     return false;
   }
   switch (op2) {
@@ -4492,8 +4554,8 @@ bool MsubadrhSh::Text(uint8_t op1, uint8_t op2, const uint8_t* data,
       return Instruction::TextOpDcDdDaDbuuN_RRR1(data, len, HWORD, result,
                                                  "msubadrs.h");
     default:
-      LogDebug("0x%lx: MsubadrhSh::%s received invalid opcode 2 0x%x", addr,
-               __func__, op2);
+      TRICORE_LOG_REJECT("0x%lx: MsubadrhSh::%s received invalid opcode 2 0x%x",
+                         addr, __func__, op2);
       return false;
   }
 }
@@ -4502,8 +4564,8 @@ bool MsubmhSh::Text(uint8_t op1, uint8_t op2, const uint8_t* data,
                     uint64_t addr, size_t& len,
                     std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_xA3_RRR1) {
-    LogDebug("0x%lx: MsubmhSh::%s received invalid opcode 1 0x%x", addr,
-             __func__, op1);
+    TRICORE_LOG_REJECT("0x%lx: MsubmhSh::%s received invalid opcode 1 0x%x",
+                       addr, __func__, op1);
     return false;
   }
   switch (op2) {
@@ -4540,8 +4602,8 @@ bool MsubmhSh::Text(uint8_t op1, uint8_t op2, const uint8_t* data,
       return Instruction::TextOpEcEdDaDbuuN_RRR1(data, len, HWORD, result,
                                                  "msubms.h");
     default:
-      LogDebug("0x%lx: MsubmhSh::%s received invalid opcode 2 0x%x", addr,
-               __func__, op2);
+      TRICORE_LOG_REJECT("0x%lx: MsubmhSh::%s received invalid opcode 2 0x%x",
+                         addr, __func__, op2);
       return false;
   }
 }
@@ -4585,8 +4647,9 @@ bool MsubrhSh::Text(uint8_t op1, uint8_t op2, const uint8_t* data,
           return Instruction::TextOpDcDdDaDbuuN_RRR1(data, len, HWORD, result,
                                                      "msubrs.h");
         default:
-          LogDebug("0x%lx: MsubrhSh::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT(
+              "0x%lx: MsubrhSh::%s received invalid opcode 2 0x%x",
+              addr, __func__, op2);
           return false;
       }
     case OP1_x63_RRR1:
@@ -4600,13 +4663,14 @@ bool MsubrhSh::Text(uint8_t op1, uint8_t op2, const uint8_t* data,
           return Instruction::TextOpDcEdDaDbulN_RRR1(data, len, HWORD, result,
                                                      "msubrs.h");
         default:
-          LogDebug("0x%lx: MsubrhSh::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT(
+              "0x%lx: MsubrhSh::%s received invalid opcode 2 0x%x",
+              addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: MsubrhSh::%s received invalid opcode 1 0x%x", addr,
-               __func__, op1);
+      TRICORE_LOG_REJECT("0x%lx: MsubrhSh::%s received invalid opcode 1 0x%x",
+                         addr, __func__, op1);
       return false;
   }
 }
@@ -4614,8 +4678,8 @@ bool MsubrhSh::Text(uint8_t op1, uint8_t op2, const uint8_t* data,
 bool Msubrq::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                   size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x63_RRR1) {
-    LogDebug("0x%lx: Msubrq::%s received invalid opcode 1 0x%x", addr, __func__,
-             op1);
+    TRICORE_LOG_REJECT("0x%lx: Msubrq::%s received invalid opcode 1 0x%x", addr,
+                       __func__, op1);
     return false;
   }
   switch (op2) {
@@ -4636,8 +4700,8 @@ bool Msubrq::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
       return Instruction::TextOpDcDdDauDbuN_RRR1(data, len, WORD, result,
                                                  "msubrs.q");
     default:
-      LogDebug("0x%lx: Msubrq::%s received invalid opcode 2 0x%x", addr,
-               __func__, op2);
+      TRICORE_LOG_REJECT("0x%lx: Msubrq::%s received invalid opcode 2 0x%x",
+                         addr, __func__, op2);
       return false;
   }
 }
@@ -4645,8 +4709,8 @@ bool Msubrq::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Mtcr::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                 size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != MTCR_CONST16_DA) {
-    LogDebug("0x%lx: Mtcr::%s received invalid opcode 1 0x%x", addr, __func__,
-             op1);
+    TRICORE_LOG_REJECT("0x%lx: Mtcr::%s received invalid opcode 1 0x%x", addr,
+                       __func__, op1);
     return false;
   }
   len = 4;
@@ -4674,8 +4738,8 @@ bool Mul::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpDcDaConst9_RC(data, len, WORD, result,
                                                   "muls");
         default:
-          LogDebug("0x%lx: Mul::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Mul::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x73_RR2:
@@ -4690,13 +4754,13 @@ bool Mul::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           len = 4;
           return Instruction::TextOpDcDaDb_RR2(data, len, WORD, result, "muls");
         default:
-          LogDebug("0x%lx: Mul::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Mul::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Mul::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Mul::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -4704,8 +4768,8 @@ bool Mul::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Mulh::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                 size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_xB3_RR1) {
-    LogDebug("0x%lx: Mulh::%s received invalid opcode 1 0x%x", addr, __func__,
-             op1);
+    TRICORE_LOG_REJECT("0x%lx: Mulh::%s received invalid opcode 1 0x%x", addr,
+                       __func__, op1);
     return false;
   }
   switch (op2) {
@@ -4726,8 +4790,8 @@ bool Mulh::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
       return Instruction::TextOpEcDaDbuuN_RR1(data, len, HWORD, result,
                                               "mul.h");
     default:
-      LogDebug("0x%lx: Mulh::%s received invalid opcode 2 0x%x", addr, __func__,
-               op2);
+      TRICORE_LOG_REJECT("0x%lx: Mulh::%s received invalid opcode 2 0x%x", addr,
+                         __func__, op2);
       return false;
   }
 }
@@ -4735,8 +4799,8 @@ bool Mulh::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Mulq::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                 size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x93_RR1) {
-    LogDebug("0x%lx: Mulq::%s received invalid opcode 1 0x%x", addr, __func__,
-             op1);
+    TRICORE_LOG_REJECT("0x%lx: Mulq::%s received invalid opcode 1 0x%x", addr,
+                       __func__, op1);
     return false;
   }
   switch (op2) {
@@ -4767,8 +4831,8 @@ bool Mulq::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
       return Instruction::TextOpDcDauDbuN_RR1(data, len, HWORD, result,
                                               "mul.q");
     default:
-      LogDebug("0x%lx: Mulq::%s received invalid opcode 2 0x%x", addr, __func__,
-               op2);
+      TRICORE_LOG_REJECT("0x%lx: Mulq::%s received invalid opcode 2 0x%x", addr,
+                         __func__, op2);
       return false;
   }
 }
@@ -4787,8 +4851,8 @@ bool Mulu::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpDcDaConst9_RC(data, len, WORD, result,
                                                   "muls.u", true);
         default:
-          LogDebug("0x%lx: Mulu::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Mulu::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x73_RR2:
@@ -4802,13 +4866,13 @@ bool Mulu::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpDcDaDb_RR2(data, len, WORD, result,
                                                "muls.u");
         default:
-          LogDebug("0x%lx: Mulu::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Mulu::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Mulu::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Mulu::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -4816,8 +4880,8 @@ bool Mulu::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Mulmh::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                  size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_xB3_RR1) {
-    LogDebug("0x%lx: Mulmh::%s received invalid opcode 1 0x%x", addr, __func__,
-             op1);
+    TRICORE_LOG_REJECT("0x%lx: Mulmh::%s received invalid opcode 1 0x%x", addr,
+                       __func__, op1);
     return false;
   }
   switch (op2) {
@@ -4838,8 +4902,8 @@ bool Mulmh::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
       return Instruction::TextOpEcDaDbuuN_RR1(data, len, HWORD, result,
                                               "mulm.h");
     default:
-      LogDebug("0x%lx: Mulmh::%s received invalid opcode 2 0x%x", addr,
-               __func__, op2);
+      TRICORE_LOG_REJECT("0x%lx: Mulmh::%s received invalid opcode 2 0x%x",
+                         addr, __func__, op2);
       return false;
   }
 }
@@ -4847,8 +4911,8 @@ bool Mulmh::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Mulrh::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                  size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_xB3_RR1) {
-    LogDebug("0x%lx: Mulrh::%s received invalid opcode 1 0x%x", addr, __func__,
-             op1);
+    TRICORE_LOG_REJECT("0x%lx: Mulrh::%s received invalid opcode 1 0x%x", addr,
+                       __func__, op1);
     return false;
   }
   switch (op2) {
@@ -4869,8 +4933,8 @@ bool Mulrh::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
       return Instruction::TextOpDcDaDbuuN_RR1(data, len, HWORD, result,
                                               "mulr.h");
     default:
-      LogDebug("0x%lx: Mulrh::%s received invalid opcode 2 0x%x", addr,
-               __func__, op2);
+      TRICORE_LOG_REJECT("0x%lx: Mulrh::%s received invalid opcode 2 0x%x",
+                         addr, __func__, op2);
       return false;
   }
 }
@@ -4878,8 +4942,8 @@ bool Mulrh::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Mulrq::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                  size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x93_RR1) {
-    LogDebug("0x%lx: Mulrq::%s received invalid opcode 1 0x%x", addr, __func__,
-             op1);
+    TRICORE_LOG_REJECT("0x%lx: Mulrq::%s received invalid opcode 1 0x%x", addr,
+                       __func__, op1);
     return false;
   }
   switch (op2) {
@@ -4892,8 +4956,8 @@ bool Mulrq::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
       return Instruction::TextOpDcDauDbuN_RR1(data, len, WORD, result,
                                               "mulr.q");
     default:
-      LogDebug("0x%lx: Mulrq::%s received invalid opcode 2 0x%x", addr,
-               __func__, op2);
+      TRICORE_LOG_REJECT("0x%lx: Mulrq::%s received invalid opcode 2 0x%x",
+                         addr, __func__, op2);
       return false;
   }
 }
@@ -4908,8 +4972,8 @@ bool Nand::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpDcDaConst9_RC(data, len, WORD, result,
                                                   "nand", true);
         default:
-          LogDebug("0x%lx: Nand::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Nand::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x0F_RR:
@@ -4918,13 +4982,13 @@ bool Nand::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           len = 4;
           return Instruction::TextOpDcDaDb_RR(data, len, WORD, result, "nand");
         default:
-          LogDebug("0x%lx: Nand::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Nand::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Nand::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Nand::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -4932,8 +4996,8 @@ bool Nand::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Nandt::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                  size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x07_BIT || op2 != NANDT_DC_DA_POS1_DB_POS2) {
-    LogDebug("0x%lx: Nandt::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT("0x%lx: Nandt::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
     return false;
   }
   len = 4;
@@ -4951,8 +5015,8 @@ bool Ne::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpDcDaConst9_RC(data, len, WORD, result,
                                                   "ne");
         default:
-          LogDebug("0x%lx: Ne::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Ne::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x0B_RR:
@@ -4961,13 +5025,13 @@ bool Ne::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           len = 4;
           return Instruction::TextOpDcDaDb_RR(data, len, WORD, result, "ne");
         default:
-          LogDebug("0x%lx: Ne::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Ne::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Ne::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Ne::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -4975,8 +5039,8 @@ bool Ne::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Nea::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x01_RR || op2 != NEA_DC_AA_AB) {
-    LogDebug("0x%lx: Nea::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT("0x%lx: Nea::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
     return false;
   }
   len = 4;
@@ -4986,8 +5050,8 @@ bool Nea::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Neza::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                 size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x01_RR || op2 != NEZA_DC_AA) {
-    LogDebug("0x%lx: Neza::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT("0x%lx: Neza::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
     return false;
   }
   len = 4;
@@ -5003,8 +5067,8 @@ bool Nop::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           len = 2;
           return Instruction::TextOp_SR(data, len, WORD, result, "nop");
         default:
-          LogDebug("0x%lx: Ne::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Ne::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x0D_SYS:
@@ -5013,13 +5077,13 @@ bool Nop::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           len = 4;
           return Instruction::TextOp_SYS(data, len, WORD, result, "nop");
         default:
-          LogDebug("0x%lx: Nop::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Nop::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Nop::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Nop::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -5034,8 +5098,8 @@ bool Nor::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpDcDaConst9_RC(data, len, WORD, result,
                                                   "nor", true);
         default:
-          LogDebug("0x%lx: Nor::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Nor::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x0F_RR:
@@ -5044,13 +5108,13 @@ bool Nor::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           len = 4;
           return Instruction::TextOpDcDaDb_RR(data, len, WORD, result, "nor");
         default:
-          LogDebug("0x%lx: Nor::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Nor::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Nor::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Nor::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -5058,8 +5122,8 @@ bool Nor::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Nort::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                 size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x87_BIT || op2 != NORT_DC_DA_POS1_DB_POS2) {
-    LogDebug("0x%lx: Nort::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT("0x%lx: Nort::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
     return false;
   }
   len = 4;
@@ -5070,8 +5134,8 @@ bool Nort::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Not::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x46_SR || op2 != NOT_DA) {
-    LogDebug("0x%lx: Not::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT("0x%lx: Not::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
     return false;
   }
   len = 2;
@@ -5094,8 +5158,8 @@ bool Or::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpDcDaConst9_RC(data, len, WORD, result, "or",
                                                   true);
         default:
-          LogDebug("0x%lx: Or::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Or::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x0F_RR:
@@ -5104,13 +5168,13 @@ bool Or::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           len = 4;
           return Instruction::TextOpDcDaDb_RR(data, len, WORD, result, "or");
         default:
-          LogDebug("0x%lx: Or::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Or::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Or::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Or::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -5119,8 +5183,9 @@ bool OrAndtAndntNortOrt::Text(uint8_t op1, uint8_t op2, const uint8_t* data,
                               uint64_t addr, size_t& len,
                               std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_xC7_BIT) {
-    LogDebug("0x%lx: OrAndtAndntNortOrt::%s received invalid opcode 1 0x%x",
-             addr, __func__, op1);
+    TRICORE_LOG_REJECT(
+        "0x%lx: OrAndtAndntNortOrt::%s received invalid opcode 1 0x%x",
+        addr, __func__, op1);
     return false;
   }
   switch (op2) {
@@ -5141,8 +5206,9 @@ bool OrAndtAndntNortOrt::Text(uint8_t op1, uint8_t op2, const uint8_t* data,
       return Instruction::TextOpDcDaPos1DbPos2_BIT(data, len, WORD, result,
                                                    "or.or.t");
     default:
-      LogDebug("0x%lx: OrAndtAndntNortOrt::%s received invalid opcode 2 0x%x",
-               addr, __func__, op2);
+      TRICORE_LOG_REJECT(
+          "0x%lx: OrAndtAndntNortOrt::%s received invalid opcode 2 0x%x",
+          addr, __func__, op2);
       return false;
   }
 }
@@ -5157,8 +5223,8 @@ bool Oreq::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpDcDaConst9_RC(data, len, WORD, result,
                                                   "or.eq");
         default:
-          LogDebug("0x%lx: Oreq::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Oreq::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x0B_RR:
@@ -5167,13 +5233,13 @@ bool Oreq::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           len = 4;
           return Instruction::TextOpDcDaDb_RR(data, len, WORD, result, "or.eq");
         default:
-          LogDebug("0x%lx: Oreq::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Oreq::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Oreq::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Oreq::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -5192,8 +5258,9 @@ bool OrgeGeu::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpDcDaConst9_RC(data, len, WORD, result,
                                                   "or.ge.u", true);
         default:
-          LogDebug("0x%lx: OrgeGeu::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT(
+              "0x%lx: OrgeGeu::%s received invalid opcode 2 0x%x",
+              addr, __func__, op2);
           return false;
       }
     case OP1_x0B_RR:
@@ -5206,13 +5273,14 @@ bool OrgeGeu::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpDcDaDb_RR(data, len, WORD, result,
                                               "or.ge.u");
         default:
-          LogDebug("0x%lx: OrgeGeu::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT(
+              "0x%lx: OrgeGeu::%s received invalid opcode 2 0x%x",
+              addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: OrgeGeu::%s received invalid opcode 1 0x%x", addr,
-               __func__, op1);
+      TRICORE_LOG_REJECT("0x%lx: OrgeGeu::%s received invalid opcode 1 0x%x",
+                         addr, __func__, op1);
       return false;
   }
 }
@@ -5231,8 +5299,9 @@ bool OrltLtu::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpDcDaConst9_RC(data, len, WORD, result,
                                                   "or.lt.u", true);
         default:
-          LogDebug("0x%lx: OrltLtu::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT(
+              "0x%lx: OrltLtu::%s received invalid opcode 2 0x%x",
+              addr, __func__, op2);
           return false;
       }
     case OP1_x0B_RR:
@@ -5245,13 +5314,14 @@ bool OrltLtu::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpDcDaDb_RR(data, len, WORD, result,
                                               "or.lt.u");
         default:
-          LogDebug("0x%lx: OrltLtu::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT(
+              "0x%lx: OrltLtu::%s received invalid opcode 2 0x%x",
+              addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: OrltLtu::%s received invalid opcode 1 0x%x", addr,
-               __func__, op1);
+      TRICORE_LOG_REJECT("0x%lx: OrltLtu::%s received invalid opcode 1 0x%x",
+                         addr, __func__, op1);
       return false;
   }
 }
@@ -5266,8 +5336,8 @@ bool Orne::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpDcDaConst9_RC(data, len, WORD, result,
                                                   "or.ne");
         default:
-          LogDebug("0x%lx: Orne::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Orne::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x0B_RR:
@@ -5276,13 +5346,13 @@ bool Orne::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           len = 4;
           return Instruction::TextOpDcDaDb_RR(data, len, WORD, result, "or.ne");
         default:
-          LogDebug("0x%lx: Orne::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Orne::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Orne::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Orne::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -5290,8 +5360,8 @@ bool Orne::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Ort::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x87_BIT || op2 != ORT_DC_DA_POS1_DB_POS2) {
-    LogDebug("0x%lx: Ort::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT("0x%lx: Ort::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
     return false;
   }
   len = 4;
@@ -5308,8 +5378,8 @@ bool Orn::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpDcDaConst9_RC(data, len, WORD, result,
                                                   "orn", true);
         default:
-          LogDebug("0x%lx: Orn::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Orn::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x0F_RR:
@@ -5318,13 +5388,13 @@ bool Orn::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           len = 4;
           return Instruction::TextOpDcDaDb_RR(data, len, WORD, result, "orn");
         default:
-          LogDebug("0x%lx: Orn::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Orn::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Orn::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Orn::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -5332,8 +5402,8 @@ bool Orn::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Ornt::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                 size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x87_BIT || op2 != ORNT_DC_DA_POS1_DB_POS2) {
-    LogDebug("0x%lx: Ornt::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT("0x%lx: Ornt::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
     return false;
   }
   len = 4;
@@ -5344,8 +5414,8 @@ bool Ornt::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Pack::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                 size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x6B_RRR || op2 != PACK_DC_ED_DA) {
-    LogDebug("0x%lx: Pack::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT("0x%lx: Pack::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
     return false;
   }
   len = 4;
@@ -5355,8 +5425,9 @@ bool Pack::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Parity::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                   size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x4B_RR || op2 != PARITY_DC_DA) {
-    LogDebug("0x%lx: Parity::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT(
+        "0x%lx: Parity::%s received invalid opcode(s) 0x%x, 0x%x",
+        addr, __func__, op1, op2);
     return false;
   }
   len = 4;
@@ -5368,8 +5439,9 @@ bool RestoreDa::Text(uint8_t op1, uint8_t op2, const uint8_t* data,
                      uint64_t addr, size_t& len,
                      std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x0D_SYS || op2 != RESTORE_DA) {
-    LogDebug("0x%lx: RestoreDa::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT(
+        "0x%lx: RestoreDa::%s received invalid opcode(s) 0x%x, 0x%x",
+        addr, __func__, op1, op2);
     return false;
   }
   len = 4;
@@ -5385,8 +5457,8 @@ bool Ret::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           len = 2;
           return Instruction::TextOp_SR(data, len, WORD, result, "ret");
         default:
-          LogDebug("0x%lx: Ret::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Ret::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x0D_SYS:
@@ -5395,13 +5467,13 @@ bool Ret::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           len = 4;
           return Instruction::TextOp_SYS(data, len, WORD, result, "ret");
         default:
-          LogDebug("0x%lx: Ret::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Ret::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Ret::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Ret::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -5415,8 +5487,8 @@ bool Rfe::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           len = 2;
           return Instruction::TextOp_SR(data, len, WORD, result, "rfe");
         default:
-          LogDebug("0x%lx: Rfe::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Rfe::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x0D_SYS:
@@ -5425,13 +5497,13 @@ bool Rfe::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           len = 4;
           return Instruction::TextOp_SYS(data, len, WORD, result, "rfe");
         default:
-          LogDebug("0x%lx: Rfe::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Rfe::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Rfe::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Rfe::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -5439,8 +5511,8 @@ bool Rfe::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Rfm::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x0D_SYS || op2 != RFM) {
-    LogDebug("0x%lx: Rfm::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT("0x%lx: Rfm::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
     return false;
   }
   len = 4;
@@ -5450,8 +5522,8 @@ bool Rfm::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Rslcx::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                  size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x0D_SYS || op2 != RSLCX) {
-    LogDebug("0x%lx: Rslcx::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT("0x%lx: Rslcx::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
     return false;
   }
   len = 4;
@@ -5461,8 +5533,8 @@ bool Rslcx::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Rstv::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                 size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x2F_SYS || op2 != RSTV) {
-    LogDebug("0x%lx: Rstv::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT("0x%lx: Rstv::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
     return false;
   }
   len = 4;
@@ -5478,8 +5550,8 @@ bool Rsub::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           len = 2;
           return Instruction::TextOpDa_SR(data, len, WORD, result, "rsub");
         default:
-          LogDebug("0x%lx: Rsub::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Rsub::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x8B_RC:
@@ -5489,13 +5561,13 @@ bool Rsub::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpDcDaConst9_RC(data, len, WORD, result,
                                                   "rsub");
         default:
-          LogDebug("0x%lx: Rsub::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Rsub::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Rsub::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Rsub::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -5503,8 +5575,8 @@ bool Rsub::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Rsubs::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                  size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x8B_RC) {
-    LogDebug("0x%lx: Rsubs::%s received invalid opcode 1 0x%x", addr, __func__,
-             op1);
+    TRICORE_LOG_REJECT("0x%lx: Rsubs::%s received invalid opcode 1 0x%x", addr,
+                       __func__, op1);
     return false;
   }
   switch (op2) {
@@ -5516,8 +5588,8 @@ bool Rsubs::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
       return Instruction::TextOpDcDaConst9_RC(data, len, WORD, result,
                                               "rsubs.u", true);
     default:
-      LogDebug("0x%lx: Rsubs::%s received invalid opcode 2 0x%x", addr,
-               __func__, op2);
+      TRICORE_LOG_REJECT("0x%lx: Rsubs::%s received invalid opcode 2 0x%x",
+                         addr, __func__, op2);
       return false;
   }
 }
@@ -5531,8 +5603,8 @@ bool Satb::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           len = 2;
           return Instruction::TextOpDa_SR(data, len, BYTE, result, "sat.b");
         default:
-          LogDebug("0x%lx: Satb::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Satb::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x0B_RR:
@@ -5541,13 +5613,13 @@ bool Satb::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           len = 4;
           return Instruction::TextOpDcDa_RR(data, len, BYTE, result, "sat.b");
         default:
-          LogDebug("0x%lx: Satb::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Satb::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Satb::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Satb::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -5561,8 +5633,8 @@ bool Satbu::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           len = 2;
           return Instruction::TextOpDa_SR(data, len, BYTE, result, "sat.bu");
         default:
-          LogDebug("0x%lx: Satbu::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Satbu::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x0B_RR:
@@ -5571,13 +5643,13 @@ bool Satbu::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           len = 4;
           return Instruction::TextOpDcDa_RR(data, len, BYTE, result, "sat.bu");
         default:
-          LogDebug("0x%lx: Satbu::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Satbu::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Satbu::%s received invalid opcode 1 0x%x", addr,
-               __func__, op1);
+      TRICORE_LOG_REJECT("0x%lx: Satbu::%s received invalid opcode 1 0x%x",
+                         addr, __func__, op1);
       return false;
   }
 }
@@ -5591,8 +5663,8 @@ bool Sath::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           len = 2;
           return Instruction::TextOpDa_SR(data, len, HWORD, result, "sat.h");
         default:
-          LogDebug("0x%lx: Sath::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Sath::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x0B_RR:
@@ -5601,13 +5673,13 @@ bool Sath::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           len = 4;
           return Instruction::TextOpDcDa_RR(data, len, HWORD, result, "sat.h");
         default:
-          LogDebug("0x%lx: Sath::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Sath::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Sath::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Sath::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -5621,8 +5693,8 @@ bool Sathu::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           len = 2;
           return Instruction::TextOpDa_SR(data, len, HWORD, result, "sat.hu");
         default:
-          LogDebug("0x%lx: Sathu::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Sathu::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x0B_RR:
@@ -5631,13 +5703,13 @@ bool Sathu::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           len = 4;
           return Instruction::TextOpDcDa_RR(data, len, HWORD, result, "sat.hu");
         default:
-          LogDebug("0x%lx: Sathu::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Sathu::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Sathu::%s received invalid opcode 1 0x%x", addr,
-               __func__, op1);
+      TRICORE_LOG_REJECT("0x%lx: Sathu::%s received invalid opcode 1 0x%x",
+                         addr, __func__, op1);
       return false;
   }
 }
@@ -5652,8 +5724,8 @@ bool Sel::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpDcDdDaConst9_RCR(data, len, WORD, result,
                                                      "sel");
         default:
-          LogDebug("0x%lx: Sel::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Sel::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x2B_RRR:
@@ -5663,13 +5735,13 @@ bool Sel::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpDcDdDaDb_RRR(data, len, WORD, result,
                                                  "sel");
         default:
-          LogDebug("0x%lx: Sel::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Sel::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Sel::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Sel::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -5684,8 +5756,8 @@ bool Seln::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpDcDdDaConst9_RCR(data, len, WORD, result,
                                                      "seln");
         default:
-          LogDebug("0x%lx: Seln::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Seln::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x2B_RRR:
@@ -5695,13 +5767,13 @@ bool Seln::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpDcDdDaDb_RRR(data, len, WORD, result,
                                                  "seln");
         default:
-          LogDebug("0x%lx: Seln::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Seln::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Seln::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Seln::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -5719,8 +5791,8 @@ bool Sh::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpDcDaConst9_RC(data, len, WORD, result,
                                                   "sh");
         default:
-          LogDebug("0x%lx: Sh::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Sh::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x0F_RR:
@@ -5729,13 +5801,13 @@ bool Sh::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           len = 4;
           return Instruction::TextOpDcDaDb_RR(data, len, WORD, result, "sh");
         default:
-          LogDebug("0x%lx: Sh::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Sh::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Sh::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Sh::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -5750,8 +5822,8 @@ bool Sheq::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpDcDaConst9_RC(data, len, WORD, result,
                                                   "sh.eq");
         default:
-          LogDebug("0x%lx: Sheq::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Sheq::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x0B_RR:
@@ -5760,13 +5832,13 @@ bool Sheq::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           len = 4;
           return Instruction::TextOpDcDaDb_RR(data, len, WORD, result, "sh.eq");
         default:
-          LogDebug("0x%lx: Sheq::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Sheq::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Sheq::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Sheq::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -5785,8 +5857,9 @@ bool ShgeGeu::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpDcDaConst9_RC(data, len, WORD, result,
                                                   "sh.ge.u", true);
         default:
-          LogDebug("0x%lx: ShgeGeu::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT(
+              "0x%lx: ShgeGeu::%s received invalid opcode 2 0x%x",
+              addr, __func__, op2);
           return false;
       }
     case OP1_x0B_RR:
@@ -5799,13 +5872,14 @@ bool ShgeGeu::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpDcDaDb_RR(data, len, WORD, result,
                                               "sh.ge.u");
         default:
-          LogDebug("0x%lx: ShgeGeu::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT(
+              "0x%lx: ShgeGeu::%s received invalid opcode 2 0x%x",
+              addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: ShgeGeu::%s received invalid opcode 1 0x%x", addr,
-               __func__, op1);
+      TRICORE_LOG_REJECT("0x%lx: ShgeGeu::%s received invalid opcode 1 0x%x",
+                         addr, __func__, op1);
       return false;
   }
 }
@@ -5820,8 +5894,8 @@ bool Shh::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpDcDaConst9_RC(data, len, HWORD, result,
                                                   "sh.h");
         default:
-          LogDebug("0x%lx: Shh::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Shh::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x0F_RR:
@@ -5830,13 +5904,13 @@ bool Shh::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           len = 4;
           return Instruction::TextOpDcDaDb_RR(data, len, HWORD, result, "sh.h");
         default:
-          LogDebug("0x%lx: Shh::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Shh::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Shh::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Shh::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -5855,8 +5929,9 @@ bool ShltLtu::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpDcDaConst9_RC(data, len, WORD, result,
                                                   "sh.lt.u", true);
         default:
-          LogDebug("0x%lx: ShltLtu::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT(
+              "0x%lx: ShltLtu::%s received invalid opcode 2 0x%x",
+              addr, __func__, op2);
           return false;
       }
     case OP1_x0B_RR:
@@ -5869,13 +5944,14 @@ bool ShltLtu::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpDcDaDb_RR(data, len, WORD, result,
                                               "sh.lt.u");
         default:
-          LogDebug("0x%lx: ShltLtu::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT(
+              "0x%lx: ShltLtu::%s received invalid opcode 2 0x%x",
+              addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: ShltLtu::%s received invalid opcode 1 0x%x", addr,
-               __func__, op1);
+      TRICORE_LOG_REJECT("0x%lx: ShltLtu::%s received invalid opcode 1 0x%x",
+                         addr, __func__, op1);
       return false;
   }
 }
@@ -5890,8 +5966,8 @@ bool Shne::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpDcDaConst9_RC(data, len, WORD, result,
                                                   "sh.ne");
         default:
-          LogDebug("0x%lx: Shne::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Shne::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x0B_RR:
@@ -5900,13 +5976,13 @@ bool Shne::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           len = 4;
           return Instruction::TextOpDcDaDb_RR(data, len, WORD, result, "sh.ne");
         default:
-          LogDebug("0x%lx: Shne::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Shne::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Shne::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Shne::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -5934,8 +6010,9 @@ bool ShAndOrNorXorT::Text(uint8_t op1, uint8_t op2, const uint8_t* data,
           return Instruction::TextOpDcDaPos1DbPos2_BIT(data, len, WORD, result,
                                                        "sh.or.t");
         default:
-          LogDebug("0x%lx: ShAndOrNorXorT::%s received invalid opcode 2 0x%x",
-                   addr, __func__, op2);
+          TRICORE_LOG_REJECT(
+              "0x%lx: ShAndOrNorXorT::%s received invalid opcode 2 0x%x",
+              addr, __func__, op2);
           return false;
       }
     case OP1_xA7_BIT:
@@ -5957,13 +6034,15 @@ bool ShAndOrNorXorT::Text(uint8_t op1, uint8_t op2, const uint8_t* data,
           return Instruction::TextOpDcDaPos1DbPos2_BIT(data, len, WORD, result,
                                                        "sh.xor.t");
         default:
-          LogDebug("0x%lx: ShAndOrNorXorT::%s received invalid opcode 2 0x%x",
-                   addr, __func__, op2);
+          TRICORE_LOG_REJECT(
+              "0x%lx: ShAndOrNorXorT::%s received invalid opcode 2 0x%x",
+              addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: ShAndOrNorXorT::%s received invalid opcode 1 0x%x", addr,
-               __func__, op1);
+      TRICORE_LOG_REJECT(
+          "0x%lx: ShAndOrNorXorT::%s received invalid opcode 1 0x%x",
+          addr, __func__, op1);
       return false;
   }
 }
@@ -5981,8 +6060,8 @@ bool Sha::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpDcDaConst9_RC(data, len, WORD, result,
                                                   "sha");
         default:
-          LogDebug("0x%lx: Sha::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Sha::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x0F_RR:
@@ -5991,13 +6070,13 @@ bool Sha::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           len = 4;
           return Instruction::TextOpDcDaDb_RR(data, len, WORD, result, "sha");
         default:
-          LogDebug("0x%lx: Sha::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Sha::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Sha::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Sha::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -6012,8 +6091,8 @@ bool Shah::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpDcDaConst9_RC(data, len, HWORD, result,
                                                   "sha.h");
         default:
-          LogDebug("0x%lx: Shah::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Shah::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x0F_RR:
@@ -6023,13 +6102,13 @@ bool Shah::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpDcDaDb_RR(data, len, HWORD, result,
                                               "sha.h");
         default:
-          LogDebug("0x%lx: Shah::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Shah::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Shah::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Shah::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -6044,8 +6123,8 @@ bool Shas::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpDcDaConst9_RC(data, len, HWORD, result,
                                                   "shas");
         default:
-          LogDebug("0x%lx: Shas::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Shas::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x0F_RR:
@@ -6054,13 +6133,13 @@ bool Shas::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           len = 4;
           return Instruction::TextOpDcDaDb_RR(data, len, HWORD, result, "shas");
         default:
-          LogDebug("0x%lx: Shas::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Shas::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Shas::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Shas::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -6096,8 +6175,8 @@ bool Sta::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpOff18Aa_ABS(data, len, WORD, result,
                                                 "st.a");
         default:
-          LogDebug("0x%lx: Sta::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Sta::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x89_BO:
@@ -6115,8 +6194,8 @@ bool Sta::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpAbOff10Aa_BO(data, len, WORD, result,
                                                  "st.a", ADDRMODE_PREINC);
         default:
-          LogDebug("0x%lx: Sta::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Sta::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_xA9_BO:
@@ -6130,13 +6209,13 @@ bool Sta::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpPbOff10Aa_BO(data, len, WORD, result,
                                                  "st.a", ADDRMODE_CIRC);
         default:
-          LogDebug("0x%lx: Sta::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Sta::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Sta::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Sta::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -6168,8 +6247,8 @@ bool Stb::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpOff18Da_ABS(data, len, BYTE, result,
                                                 "st.b");
         default:
-          LogDebug("0x%lx: Stb::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Stb::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x89_BO:
@@ -6187,8 +6266,8 @@ bool Stb::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpAbOff10Da_BO(data, len, BYTE, result,
                                                  "st.b", ADDRMODE_PREINC);
         default:
-          LogDebug("0x%lx: Stb::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Stb::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_xA9_BO:
@@ -6202,13 +6281,13 @@ bool Stb::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpPbOff10Da_BO(data, len, BYTE, result,
                                                  "st.b", ADDRMODE_CIRC);
         default:
-          LogDebug("0x%lx: Stb::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Stb::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Stb::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Stb::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -6223,8 +6302,8 @@ bool Std::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpOff18Ea_ABS(data, len, DWORD, result,
                                                 "st.d");
         default:
-          LogDebug("0x%lx: Std::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Std::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x89_BO:
@@ -6242,8 +6321,8 @@ bool Std::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpAbOff10Ea_BO(data, len, DWORD, result,
                                                  "st.d", ADDRMODE_PREINC);
         default:
-          LogDebug("0x%lx: Std::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Std::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_xA9_BO:
@@ -6257,13 +6336,13 @@ bool Std::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpPbOff10Ea_BO(data, len, DWORD, result,
                                                  "st.d", ADDRMODE_CIRC);
         default:
-          LogDebug("0x%lx: Std::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Std::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Std::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Std::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -6278,8 +6357,8 @@ bool Stda::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpOff18Pa_ABS(data, len, DWORD, result,
                                                 "st.da");
         default:
-          LogDebug("0x%lx: Stda::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Stda::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x89_BO:
@@ -6297,8 +6376,8 @@ bool Stda::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpAbOff10Pa_BO(data, len, DWORD, result,
                                                  "st.da", ADDRMODE_PREINC);
         default:
-          LogDebug("0x%lx: Stda::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Stda::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_xA9_BO:
@@ -6312,13 +6391,13 @@ bool Stda::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpPbOff10Pa_BO(data, len, DWORD, result,
                                                  "st.da", ADDRMODE_CIRC);
         default:
-          LogDebug("0x%lx: Stda::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Stda::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Stda::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Stda::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -6351,8 +6430,8 @@ bool Sth::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpOff18Da_ABS(data, len, HWORD, result,
                                                 "st.h");
         default:
-          LogDebug("0x%lx: Sth::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Sth::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x89_BO:
@@ -6370,8 +6449,8 @@ bool Sth::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpAbOff10Da_BO(data, len, HWORD, result,
                                                  "st.h", ADDRMODE_PREINC);
         default:
-          LogDebug("0x%lx: Sth::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Sth::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_xA9_BO:
@@ -6385,13 +6464,13 @@ bool Sth::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpPbOff10Da_BO(data, len, HWORD, result,
                                                  "st.h", ADDRMODE_CIRC);
         default:
-          LogDebug("0x%lx: Sth::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Sth::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Sth::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Sth::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -6406,8 +6485,8 @@ bool Stq::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpOff18Da_ABS(data, len, HWORD, result,
                                                 "st.q");
         default:
-          LogDebug("0x%lx: Stq::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Stq::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x89_BO:
@@ -6425,8 +6504,8 @@ bool Stq::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpAbOff10Da_BO(data, len, HWORD, result,
                                                  "st.q", ADDRMODE_PREINC);
         default:
-          LogDebug("0x%lx: Stq::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Stq::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_xA9_BO:
@@ -6440,13 +6519,13 @@ bool Stq::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpPbOff10Da_BO(data, len, HWORD, result,
                                                  "st.q", ADDRMODE_CIRC);
         default:
-          LogDebug("0x%lx: Stq::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Stq::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Stq::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Stq::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -6454,8 +6533,8 @@ bool Stq::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Stt::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_xD5_ABSB || op2 != STT_OFF18_BPOS3_B) {
-    LogDebug("0x%lx: Stt::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT("0x%lx: Stt::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
     return false;
   }
   len = 4;
@@ -6493,8 +6572,8 @@ bool Stw::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpOff18Da_ABS(data, len, WORD, result,
                                                 "st.w");
         default:
-          LogDebug("0x%lx: Stw::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Stw::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x89_BO:
@@ -6512,8 +6591,8 @@ bool Stw::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpAbOff10Da_BO(data, len, WORD, result,
                                                  "st.w", ADDRMODE_PREINC);
         default:
-          LogDebug("0x%lx: Stw::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Stw::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_xA9_BO:
@@ -6528,13 +6607,13 @@ bool Stw::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                                                  "st.w"),
                  ADDRMODE_CIRC;
         default:
-          LogDebug("0x%lx: Stw::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Stw::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Stw::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Stw::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -6548,8 +6627,8 @@ bool Stlcx::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           len = 4;
           return Instruction::TextOpOff18_ABS(data, len, WORD, result, "stlcx");
         default:
-          LogDebug("0x%lx: Stlcx::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Stlcx::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x49_BO:
@@ -6559,13 +6638,13 @@ bool Stlcx::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpAbOff10_BO(data, len, WORD, result,
                                                "stlcx");
         default:
-          LogDebug("0x%lx: Stlcx::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Stlcx::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Stlcx::%s received invalid opcode 1 0x%x", addr,
-               __func__, op1);
+      TRICORE_LOG_REJECT("0x%lx: Stlcx::%s received invalid opcode 1 0x%x",
+                         addr, __func__, op1);
       return false;
   }
 }
@@ -6579,8 +6658,8 @@ bool Stucx::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           len = 4;
           return Instruction::TextOpOff18_ABS(data, len, WORD, result, "stucx");
         default:
-          LogDebug("0x%lx: Stucx::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Stucx::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x49_BO:
@@ -6590,13 +6669,13 @@ bool Stucx::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpAbOff10_BO(data, len, WORD, result,
                                                "stucx");
         default:
-          LogDebug("0x%lx: Stucx::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Stucx::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Stucx::%s received invalid opcode 1 0x%x", addr,
-               __func__, op1);
+      TRICORE_LOG_REJECT("0x%lx: Stucx::%s received invalid opcode 1 0x%x",
+                         addr, __func__, op1);
       return false;
   }
 }
@@ -6619,13 +6698,13 @@ bool Sub::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           len = 4;
           return Instruction::TextOpDcDaDb_RR(data, len, WORD, result, "sub");
         default:
-          LogDebug("0x%lx: Sub::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Sub::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Sub::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Sub::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -6642,13 +6721,13 @@ bool Suba::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           len = 4;
           return Instruction::TextOpAcAaAb_RR(data, len, WORD, result, "sub.a");
         default:
-          LogDebug("0x%lx: Suba::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Suba::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Suba::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Suba::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -6656,8 +6735,8 @@ bool Suba::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Subbh::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                  size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x0B_RR) {
-    LogDebug("0x%lx: Subbh::%s received invalid opcode 1 0x%x", addr, __func__,
-             op1);
+    TRICORE_LOG_REJECT("0x%lx: Subbh::%s received invalid opcode 1 0x%x", addr,
+                       __func__, op1);
     return false;
   }
   switch (op2) {
@@ -6668,8 +6747,8 @@ bool Subbh::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
       len = 4;
       return Instruction::TextOpDcDaDb_RR(data, len, HWORD, result, "sub.h");
     default:
-      LogDebug("0x%lx: Subh::%s received invalid opcode 2 0x%x", addr, __func__,
-               op2);
+      TRICORE_LOG_REJECT("0x%lx: Subh::%s received invalid opcode 2 0x%x", addr,
+                         __func__, op2);
       return false;
   }
 }
@@ -6677,8 +6756,8 @@ bool Subbh::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Subc::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                 size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x0B_RR || op2 != SUBC_DC_DA_DB) {
-    LogDebug("0x%lx: Subc::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT("0x%lx: Subc::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
     return false;
   }
   len = 4;
@@ -6701,13 +6780,13 @@ bool Subsu::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpDcDaDb_RR(data, len, WORD, result,
                                               "subs.u");
         default:
-          LogDebug("0x%lx: Subsu::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Subsu::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Subsu::%s received invalid opcode 1 0x%x", addr,
-               __func__, op1);
+      TRICORE_LOG_REJECT("0x%lx: Subsu::%s received invalid opcode 1 0x%x",
+                         addr, __func__, op1);
       return false;
   }
 }
@@ -6715,8 +6794,8 @@ bool Subsu::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool SubshHu::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                    size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x0B_RR) {
-    LogDebug("0x%lx: SubshHu::%s received invalid opcode 1 0x%x", addr,
-             __func__, op1);
+    TRICORE_LOG_REJECT("0x%lx: SubshHu::%s received invalid opcode 1 0x%x",
+                       addr, __func__, op1);
     return false;
   }
   switch (op2) {
@@ -6727,8 +6806,8 @@ bool SubshHu::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
       len = 4;
       return Instruction::TextOpDcDaDb_RR(data, len, WORD, result, "subs.hu");
     default:
-      LogDebug("0x%lx: SubshHu::%s received invalid opcode 1 0x%x", addr,
-               __func__, op1);
+      TRICORE_LOG_REJECT("0x%lx: SubshHu::%s received invalid opcode 1 0x%x",
+                         addr, __func__, op1);
       return false;
   }
 }
@@ -6736,8 +6815,8 @@ bool SubshHu::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Subx::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                 size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x0B_RR || op2 != SUBX_DC_DA_DB) {
-    LogDebug("0x%lx: Subx::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT("0x%lx: Subx::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
     return false;
   }
   len = 4;
@@ -6747,8 +6826,8 @@ bool Subx::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Svlcx::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                  size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x0D_SYS || op2 != SVLCX) {
-    LogDebug("0x%lx: Svlcx::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT("0x%lx: Svlcx::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
     return false;
   }
   len = 4;
@@ -6765,8 +6844,8 @@ bool Swapw::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpOff18Da_ABS(data, len, WORD, result,
                                                 "swap.w");
         default:
-          LogDebug("0x%lx: Swapw::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Swapw::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x49_BO:
@@ -6784,8 +6863,8 @@ bool Swapw::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpAbOff10Da_BO(data, len, WORD, result,
                                                  "swap.w", ADDRMODE_PREINC);
         default:
-          LogDebug("0x%lx: Swapw::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Swapw::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x69_BO:
@@ -6799,13 +6878,13 @@ bool Swapw::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpPbOff10Da_BO(data, len, WORD, result,
                                                  "swap.w", ADDRMODE_CIRC);
         default:
-          LogDebug("0x%lx: Swapw::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Swapw::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Subsu::%s received invalid opcode 1 0x%x", addr,
-               __func__, op1);
+      TRICORE_LOG_REJECT("0x%lx: Subsu::%s received invalid opcode 1 0x%x",
+                         addr, __func__, op1);
       return false;
   }
 }
@@ -6813,8 +6892,9 @@ bool Swapw::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Syscall::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                    size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_xAD_RC || op2 != SYSCALL_CONST9) {
-    LogDebug("0x%lx: Syscall::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT(
+        "0x%lx: Syscall::%s received invalid opcode(s) 0x%x, 0x%x",
+        addr, __func__, op1, op2);
     return false;
   }
   len = 4;
@@ -6824,8 +6904,9 @@ bool Syscall::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Trapsv::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                   size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x0D_SYS || op2 != TRAPSV) {
-    LogDebug("0x%lx: Trapsv::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT(
+        "0x%lx: Trapsv::%s received invalid opcode(s) 0x%x, 0x%x",
+        addr, __func__, op1, op2);
     return false;
   }
   len = 4;
@@ -6835,8 +6916,8 @@ bool Trapsv::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Trapv::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                  size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x0D_SYS || op2 != TRAPV) {
-    LogDebug("0x%lx: Trapv::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT("0x%lx: Trapv::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
     return false;
   }
   len = 4;
@@ -6846,8 +6927,9 @@ bool Trapv::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Unpack::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                   size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x4B_RR || op2 != UNPACK_EC_DA) {
-    LogDebug("0x%lx: Unpack::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT(
+        "0x%lx: Unpack::%s received invalid opcode(s) 0x%x, 0x%x",
+        addr, __func__, op1, op2);
     return false;
   }
   len = 4;
@@ -6864,8 +6946,8 @@ bool Xnor::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpDcDaConst9_RC(data, len, WORD, result,
                                                   "xnor", true);
         default:
-          LogDebug("0x%lx: Xnor::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Xnor::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x0F_RR:
@@ -6874,13 +6956,13 @@ bool Xnor::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           len = 4;
           return Instruction::TextOpDcDaDb_RR(data, len, WORD, result, "xnor");
         default:
-          LogDebug("0x%lx: Xnor::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Xnor::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Xnor::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Xnor::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -6888,8 +6970,8 @@ bool Xnor::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Xnort::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                  size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x07_BIT || op2 != XNORT_DC_DA_POS1_DB_POS2) {
-    LogDebug("0x%lx: Xnort::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT("0x%lx: Xnort::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
     return false;
   }
   len = 4;
@@ -6910,8 +6992,8 @@ bool Xor::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpDcDaConst9_RC(data, len, WORD, result,
                                                   "xor", true);
         default:
-          LogDebug("0x%lx: Xor::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Xor::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x0F_RR:
@@ -6920,13 +7002,13 @@ bool Xor::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           len = 4;
           return Instruction::TextOpDcDaDb_RR(data, len, WORD, result, "xor");
         default:
-          LogDebug("0x%lx: Xor::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Xor::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Xor::%s received invalid opcode 1 0x%x", addr, __func__,
-               op1);
+      TRICORE_LOG_REJECT("0x%lx: Xor::%s received invalid opcode 1 0x%x", addr,
+                         __func__, op1);
       return false;
   }
 }
@@ -6941,8 +7023,8 @@ bool Xoreq::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpDcDaConst9_RC(data, len, WORD, result,
                                                   "xor.eq");
         default:
-          LogDebug("0x%lx: Xoreq::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Xoreq::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x0B_RR:
@@ -6952,13 +7034,13 @@ bool Xoreq::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpDcDaDb_RR(data, len, WORD, result,
                                               "xor.eq");
         default:
-          LogDebug("0x%lx: Xoreq::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Xoreq::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Xoreq::%s received invalid opcode 1 0x%x", addr,
-               __func__, op1);
+      TRICORE_LOG_REJECT("0x%lx: Xoreq::%s received invalid opcode 1 0x%x",
+                         addr, __func__, op1);
       return false;
   }
 }
@@ -6977,8 +7059,8 @@ bool Xorge::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpDcDaConst9_RC(data, len, WORD, result,
                                                   "xor.ge.u", true);
         default:
-          LogDebug("0x%lx: Xorge::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Xorge::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x0B_RR:
@@ -6992,13 +7074,13 @@ bool Xorge::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpDcDaDb_RR(data, len, WORD, result,
                                               "xor.ge.u");
         default:
-          LogDebug("0x%lx: Xorge::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Xorge::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Xorge::%s received invalid opcode 1 0x%x", addr,
-               __func__, op1);
+      TRICORE_LOG_REJECT("0x%lx: Xorge::%s received invalid opcode 1 0x%x",
+                         addr, __func__, op1);
       return false;
   }
 }
@@ -7017,8 +7099,8 @@ bool Xorlt::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpDcDaConst9_RC(data, len, WORD, result,
                                                   "xor.lt.u", true);
         default:
-          LogDebug("0x%lx: Xorlt::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Xorlt::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x0B_RR:
@@ -7032,13 +7114,13 @@ bool Xorlt::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpDcDaDb_RR(data, len, WORD, result,
                                               "xor.lt.u");
         default:
-          LogDebug("0x%lx: Xorlt::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Xorlt::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Xorlt::%s received invalid opcode 1 0x%x", addr,
-               __func__, op1);
+      TRICORE_LOG_REJECT("0x%lx: Xorlt::%s received invalid opcode 1 0x%x",
+                         addr, __func__, op1);
       return false;
   }
 }
@@ -7053,8 +7135,8 @@ bool Xorne::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpDcDaConst9_RC(data, len, WORD, result,
                                                   "xor.ne");
         default:
-          LogDebug("0x%lx: Xorne::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Xorne::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     case OP1_x0B_RR:
@@ -7064,13 +7146,13 @@ bool Xorne::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
           return Instruction::TextOpDcDaDb_RR(data, len, WORD, result,
                                               "xor.ne");
         default:
-          LogDebug("0x%lx: Xorne::%s received invalid opcode 2 0x%x", addr,
-                   __func__, op2);
+          TRICORE_LOG_REJECT("0x%lx: Xorne::%s received invalid opcode 2 0x%x",
+                             addr, __func__, op2);
           return false;
       }
     default:
-      LogDebug("0x%lx: Xorne::%s received invalid opcode 1 0x%x", addr,
-               __func__, op1);
+      TRICORE_LOG_REJECT("0x%lx: Xorne::%s received invalid opcode 1 0x%x",
+                         addr, __func__, op1);
       return false;
   }
 }
@@ -7078,8 +7160,8 @@ bool Xorne::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Xort::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                 size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x07_BIT || op2 != XORT_DC_DA_POS1_DB_POS2) {
-    LogDebug("0x%lx: Xort::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT("0x%lx: Xort::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
     return false;
   }
   len = 4;
@@ -7091,8 +7173,8 @@ bool Xort::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Addf::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                 size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x6B_RRR || op2 != ADDF_DC_DD_DA) {
-    LogDebug("0x%lx: Addf::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT("0x%lx: Addf::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
     return false;
   }
   len = 4;
@@ -7102,8 +7184,8 @@ bool Addf::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Cmpf::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                 size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x4B_RR || op2 != CMPF_DC_DA_DB) {
-    LogDebug("0x%lx: Cmpf::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT("0x%lx: Cmpf::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
     return false;
   }
   len = 4;
@@ -7113,8 +7195,8 @@ bool Cmpf::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Divf::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                 size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x4B_RR || op2 != DIVF_DC_DA_DB) {
-    LogDebug("0x%lx: Divf::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT("0x%lx: Divf::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
     return false;
   }
   len = 4;
@@ -7124,8 +7206,8 @@ bool Divf::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Ftoi::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                 size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x4B_RR || op2 != FTOI_DC_DA) {
-    LogDebug("0x%lx: Ftoi::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT("0x%lx: Ftoi::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
     return false;
   }
   len = 4;
@@ -7135,8 +7217,8 @@ bool Ftoi::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Ftoiz::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                  size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x4B_RR || op2 != FTOIZ_DC_DA) {
-    LogDebug("0x%lx: Ftoiz::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT("0x%lx: Ftoiz::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
     return false;
   }
   len = 4;
@@ -7146,8 +7228,9 @@ bool Ftoiz::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Ftoq31::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                   size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x4B_RR || op2 != FTOQ31_DC_DA_DB) {
-    LogDebug("0x%lx: Ftoq31::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT(
+        "0x%lx: Ftoq31::%s received invalid opcode(s) 0x%x, 0x%x",
+        addr, __func__, op1, op2);
     return false;
   }
   len = 4;
@@ -7157,8 +7240,9 @@ bool Ftoq31::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Ftoq31z::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                    size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x4B_RR || op2 != FTOQ31Z_DC_DA_DB) {
-    LogDebug("0x%lx: Ftoq31z::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT(
+        "0x%lx: Ftoq31z::%s received invalid opcode(s) 0x%x, 0x%x",
+        addr, __func__, op1, op2);
     return false;
   }
   len = 4;
@@ -7168,8 +7252,8 @@ bool Ftoq31z::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Ftou::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                 size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x4B_RR || op2 != FTOU_DC_DA) {
-    LogDebug("0x%lx: Ftou::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT("0x%lx: Ftou::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
     return false;
   }
   len = 4;
@@ -7179,8 +7263,8 @@ bool Ftou::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Ftouz::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                  size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x4B_RR || op2 != FTOUZ_DC_DA) {
-    LogDebug("0x%lx: Ftouz::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT("0x%lx: Ftouz::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
     return false;
   }
   len = 4;
@@ -7190,8 +7274,8 @@ bool Ftouz::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Itof::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                 size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x4B_RR || op2 != ITOF_DC_DA) {
-    LogDebug("0x%lx: Itof::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT("0x%lx: Itof::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
     return false;
   }
   len = 4;
@@ -7201,8 +7285,8 @@ bool Itof::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Maddf::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                  size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x6B_RRR || op2 != MADDF_DC_DD_DA_DB) {
-    LogDebug("0x%lx: Maddf::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT("0x%lx: Maddf::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
     return false;
   }
   len = 4;
@@ -7212,8 +7296,8 @@ bool Maddf::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Msubf::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                  size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x6B_RRR || op2 != MSUBF_DC_DD_DA_DB) {
-    LogDebug("0x%lx: Msubf::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT("0x%lx: Msubf::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
     return false;
   }
   len = 4;
@@ -7223,8 +7307,8 @@ bool Msubf::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Mulf::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                 size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x4B_RR || op2 != MULF_DC_DA_DB) {
-    LogDebug("0x%lx: Mulf::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT("0x%lx: Mulf::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
     return false;
   }
   len = 4;
@@ -7234,8 +7318,9 @@ bool Mulf::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Q31tof::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                   size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x4B_RR || op2 != Q31TOF_DC_DA_DB) {
-    LogDebug("0x%lx: Q31tof::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT(
+        "0x%lx: Q31tof::%s received invalid opcode(s) 0x%x, 0x%x",
+        addr, __func__, op1, op2);
     return false;
   }
   len = 4;
@@ -7245,8 +7330,9 @@ bool Q31tof::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Qseedf::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                   size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x4B_RR || op2 != QSEEDF_DC_DA) {
-    LogDebug("0x%lx: Qseedf::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT(
+        "0x%lx: Qseedf::%s received invalid opcode(s) 0x%x, 0x%x",
+        addr, __func__, op1, op2);
     return false;
   }
   len = 4;
@@ -7256,8 +7342,8 @@ bool Qseedf::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Subf::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                 size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x6B_RRR || op2 != SUBF_DC_DD_DA) {
-    LogDebug("0x%lx: Subf::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT("0x%lx: Subf::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
     return false;
   }
   len = 4;
@@ -7267,8 +7353,8 @@ bool Subf::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Updfl::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                  size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x4B_RR || op2 != UPDFL_DA) {
-    LogDebug("0x%lx: Updfl::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT("0x%lx: Updfl::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
     return false;
   }
   len = 4;
@@ -7278,8 +7364,8 @@ bool Updfl::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
 bool Utof::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                 size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x4B_RR || op2 != UTOF_DC_DA) {
-    LogDebug("0x%lx: Utof::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT("0x%lx: Utof::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
     return false;
   }
   len = 4;
@@ -7291,8 +7377,9 @@ bool Tlbdemap::Text(uint8_t op1, uint8_t op2, const uint8_t* data,
                     uint64_t addr, size_t& len,
                     std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x75_RR || op2 != TLBDEMAP_DA) {
-    LogDebug("0x%lx: Tlbdemap::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT(
+        "0x%lx: Tlbdemap::%s received invalid opcode(s) 0x%x, 0x%x",
+        addr, __func__, op1, op2);
     return false;
   }
   len = 4;
@@ -7303,8 +7390,8 @@ bool Tlbflush::Text(uint8_t op1, uint8_t op2, const uint8_t* data,
                     uint64_t addr, size_t& len,
                     std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x75_RR) {
-    LogDebug("0x%lx: Tlbflush::%s received invalid opcode 1 0x%x", addr,
-             __func__, op1);
+    TRICORE_LOG_REJECT("0x%lx: Tlbflush::%s received invalid opcode 1 0x%x",
+                       addr, __func__, op1);
     return false;
   }
   switch (op2) {
@@ -7315,8 +7402,8 @@ bool Tlbflush::Text(uint8_t op1, uint8_t op2, const uint8_t* data,
       len = 4;
       return Instruction::TextOp_RR(data, len, WORD, result, "tlbflush.b");
     default:
-      LogDebug("0x%lx: Tlbflush::%s received invalid opcode 2 0x%x", addr,
-               __func__, op2);
+      TRICORE_LOG_REJECT("0x%lx: Tlbflush::%s received invalid opcode 2 0x%x",
+                         addr, __func__, op2);
       return false;
   }
 }
@@ -7324,8 +7411,9 @@ bool Tlbflush::Text(uint8_t op1, uint8_t op2, const uint8_t* data,
 bool Tlbmap::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                   size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x75_RR || op2 != TLBMAP_EA) {
-    LogDebug("0x%lx: Tlbmap::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT(
+        "0x%lx: Tlbmap::%s received invalid opcode(s) 0x%x, 0x%x",
+        addr, __func__, op1, op2);
     return false;
   }
   len = 4;
@@ -7336,8 +7424,9 @@ bool Tlbprobea::Text(uint8_t op1, uint8_t op2, const uint8_t* data,
                      uint64_t addr, size_t& len,
                      std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x75_RR || op2 != TLBPROBEA_DA) {
-    LogDebug("0x%lx: Tlbprobea::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT(
+        "0x%lx: Tlbprobea::%s received invalid opcode(s) 0x%x, 0x%x",
+        addr, __func__, op1, op2);
     return false;
   }
   len = 4;
@@ -7348,8 +7437,9 @@ bool Tlbprobei::Text(uint8_t op1, uint8_t op2, const uint8_t* data,
                      uint64_t addr, size_t& len,
                      std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x75_RR || op2 != TLBPROBEI_DA) {
-    LogDebug("0x%lx: Tlbprobei::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT(
+        "0x%lx: Tlbprobei::%s received invalid opcode(s) 0x%x, 0x%x",
+        addr, __func__, op1, op2);
     return false;
   }
   len = 4;
@@ -7360,11 +7450,33 @@ bool Tlbprobei::Text(uint8_t op1, uint8_t op2, const uint8_t* data,
 bool Wait::Text(uint8_t op1, uint8_t op2, const uint8_t* data, uint64_t addr,
                 size_t& len, std::vector<InstructionTextToken>& result) {
   if (op1 != OP1_x0D_SYS || op2 != WAIT) {
-    LogDebug("0x%lx: Wait::%s received invalid opcode(s) 0x%x, 0x%x", addr,
-             __func__, op1, op2);
+    TRICORE_LOG_REJECT("0x%lx: Wait::%s received invalid opcode(s) 0x%x, 0x%x",
+                       addr, __func__, op1, op2);
     return false;
   }
   len = 4;
   return Instruction::TextOp_SYS(data, len, WORD, result, "wait");
 }
+
+bool Text(const DecodedInstruction& insn, const uint8_t* data, uint64_t addr,
+          size_t& len, std::vector<InstructionTextToken>& result) {
+#define TEXT_Plain(name) \
+  name::Text(insn.op1, insn.op2, data, addr, len, result)
+#define TEXT_Target(name) \
+  name::Text(insn.op1, insn.op2, data, addr, len, result, insn.target)
+#define TEXT_Branch TEXT_Target
+
+  switch (insn.id) {
+#define TRICORE_INSTRUCTION(name, written_flags, signature) \
+  case InstructionId::name:                                 \
+    return TEXT_##signature(name);
+#include "instruction_table.def"
+    default:
+      return false;
+  }
+
+#undef TEXT_Plain
+#undef TEXT_Target
+#undef TEXT_Branch
+}
 }  // namespace Tricore
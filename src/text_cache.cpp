@@ -0,0 +1,106 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#include "text_cache.h"
+
+#include <bit>
+#include <cstring>
+
+using namespace BinaryNinja;
+
+namespace Tricore {
+struct TextCache::Entry {
+  uint32_t raw;
+  uint8_t length;
+  uint64_t address;  // only compared for branches
+  std::vector<InstructionTextToken> tokens;
+};
+
+std::atomic<bool> TextCache::bypassed{false};
+
+TextCache::TextCache(size_t entries) {
+  if (entries < 2) return;
+  entries = std::bit_floor(entries);
+  slots = std::make_unique<std::shared_ptr<const Entry>[]>(entries);
+  mask = entries / 2 - 1;
+}
+
+TextCache::~TextCache() = default;
+
+// The text of a direct branch or call includes its target
+static bool IsPcRelative(const DecodedInstruction& insn) {
+  return insn.branch == BranchKind::Call ||
+         insn.branch == BranchKind::Unconditional ||
+         insn.branch == BranchKind::Conditional;
+}
+
+// Shared entries use the first half of the slots and per-address branch
+// entries the second, so a run of branches cannot evict the common
+// encodings. Fibonacci hashing spreads the few distinct encodings of typical
+// code over the first half; branches are indexed by halfword address like
+// the decode cache, so nearby branches never collide.
+static size_t SlotIndex(uint32_t raw, bool pcRelative, uint64_t addr,
+                        size_t mask) {
+  if (pcRelative) return mask + 1 + (static_cast<size_t>(addr >> 1) & mask);
+  return static_cast<size_t>((raw * 0x9E3779B97F4A7C15ull) >> 32) & mask;
+}
+
+std::shared_ptr<const TextCache::Entry> TextCache::Load(size_t index) const {
+  std::lock_guard<std::mutex> lock(locks[index % kLocks]);
+  return slots[index];
+}
+
+bool TextCache::Lookup(const uint8_t* data, uint64_t addr, size_t& len,
+                       std::vector<InstructionTextToken>& result) {
+  if (!slots || len < 2 || bypassed.load(std::memory_order_relaxed))
+    return false;
+
+  // The key's instruction word, in the same form as DecodedInstruction::raw
+  uint32_t raw;
+  if (data[0] & 0x01u) {
+    if (len < 4) return false;
+    std::memcpy(&raw, data, sizeof(raw));
+  } else {
+    uint16_t raw16;
+    std::memcpy(&raw16, data, sizeof(raw16));
+    raw = raw16;
+  }
+
+  // Whether the word is a branch is only known once it has been decoded, so
+  // try the shared slot first and then the per-address one
+  std::shared_ptr<const Entry> entry = Load(SlotIndex(raw, false, 0, mask));
+  if (!entry || entry->raw != raw) {
+    entry = Load(SlotIndex(raw, true, addr, mask));
+    if (!entry || entry->raw != raw || entry->address != addr) {
+      counters.Miss();
+      return false;
+    }
+  }
+
+  counters.Hit();
+  len = entry->length;
+  result.insert(result.end(), entry->tokens.begin(), entry->tokens.end());
+  return true;
+}
+
+void TextCache::Insert(const DecodedInstruction& insn, uint64_t addr,
+                       std::span<const InstructionTextToken> text) {
+  if (!slots || bypassed.load(std::memory_order_relaxed)) return;
+
+  const bool pcRelative = IsPcRelative(insn);
+  auto entry = std::make_shared<const Entry>(
+      Entry{insn.raw, insn.length, pcRelative ? addr : 0,
+            std::vector<InstructionTextToken>(text.begin(), text.end())});
+  const size_t index = SlotIndex(insn.raw, pcRelative, addr, mask);
+  std::lock_guard<std::mutex> lock(locks[index % kLocks]);
+  slots[index] = std::move(entry);
+}
+
+TextCacheStats TextCache::Stats() const {
+  TextCacheStats stats;
+  stats.hits = counters.Hits();
+  stats.misses = counters.Misses();
+  stats.entries = slots ? 2 * (mask + 1) : 0;
+  return stats;
+}
+}  // namespace Tricore
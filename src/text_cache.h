@@ -0,0 +1,77 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#ifndef BINARYNINJA_API_TRICORE_TEXT_CACHE_H
+#define BINARYNINJA_API_TRICORE_TEXT_CACHE_H
+
+#include <binaryninjaapi.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <vector>
+
+#include "cache_counters.h"
+#include "decoder.h"
+
+namespace Tricore {
+struct TextCacheStats {
+  uint64_t hits = 0;
+  uint64_t misses = 0;
+  size_t entries = 0;
+};
+
+// Direct-mapped cache of rendered disassembly keyed by instruction word.
+// Only direct branches and calls print their address-dependent target, so
+// every other instruction shares one entry across all the addresses it
+// appears at; branches are keyed by (instruction word, address) in a separate
+// half of the table. Entries are immutable and swapped under a striped lock,
+// so lookups from any number of threads only contend while copying a
+// pointer.
+class TextCache {
+ public:
+  // entries is rounded down to a power of two, half of them for branches;
+  // 0 disables the cache
+  explicit TextCache(size_t entries);
+  ~TextCache();
+
+  TextCache(const TextCache&) = delete;
+  TextCache& operator=(const TextCache&) = delete;
+
+  // Appends the cached text of the instruction at data (located at addr) to
+  // result and sets len to its length. Returns false on a miss or when
+  // fewer than the instruction's length bytes are available.
+  bool Lookup(const uint8_t* data, uint64_t addr, size_t& len,
+              std::vector<BinaryNinja::InstructionTextToken>& result);
+  // Stores the text rendered for insn, located at addr
+  void Insert(const DecodedInstruction& insn, uint64_t addr,
+              std::span<const BinaryNinja::InstructionTextToken> text);
+
+  TextCacheStats Stats() const;
+
+  // Makes every TextCache miss and drop inserts, or work again, so benchmarks
+  // can time the callbacks without the cache
+  static void SetBypassed(bool bypass) {
+    bypassed.store(bypass, std::memory_order_relaxed);
+  }
+
+ private:
+  struct Entry;
+
+  static constexpr size_t kLocks = 64;
+
+  std::shared_ptr<const Entry> Load(size_t index) const;
+
+  std::unique_ptr<std::shared_ptr<const Entry>[]> slots;
+  size_t mask = 0;
+  mutable std::mutex locks[kLocks];
+  CacheCounters counters;
+
+  static std::atomic<bool> bypassed;
+};
+}  // namespace Tricore
+
+#endif  // BINARYNINJA_API_TRICORE_TEXT_CACHE_H
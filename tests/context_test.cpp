@@ -0,0 +1,310 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+// Checks the context save area (CSA) model of the call and return lifters.
+//
+// Lifts call, ret and calli a11 through the registered architecture and
+// runs their LLIL on a small machine with registers and memory:
+//   - call stores the upper context to the CSA at FCX, links PCXI to it,
+//     moves FCX to the next free CSA and sets A11 to the return address
+//   - ret restores the upper context and the two lists from that CSA and
+//     returns to A11 with bit 0 cleared
+//   - after the call, the caller's upper context, PCXI and FCX are set back
+//     whatever the callee left in them
+//   - calli a11 reads A11 into a temporary before A11 is overwritten
+//
+// The plugin is linked in and registered directly, as in the benchmarks.
+
+#include <binaryninjaapi.h>
+#include <lowlevelilinstruction.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <string>
+
+#include "registers.h"
+
+using namespace BinaryNinja;
+
+extern "C" bool CorePluginInit();
+
+static constexpr uint64_t kBase = 0x80000000;
+
+// The upper context in CSA word order
+static const uint32_t kUpperContext[16] = {
+    TRICORE_REG_PCXI, TRICORE_REG_PSW, TRICORE_REG_A10, TRICORE_REG_A11,
+    TRICORE_REG_D8,   TRICORE_REG_D9,  TRICORE_REG_D10, TRICORE_REG_D11,
+    TRICORE_REG_A12,  TRICORE_REG_A13, TRICORE_REG_A14, TRICORE_REG_A15,
+    TRICORE_REG_D12,  TRICORE_REG_D13, TRICORE_REG_D14, TRICORE_REG_D15};
+
+// CALLI's copy of its target register (kCallTarget in lift.cpp)
+static constexpr uint32_t kCallTarget = LLIL_TEMP(1023);
+
+static int failures = 0;
+
+static void Check(bool ok, const std::string& what) {
+  if (ok) return;
+  std::fprintf(stderr, "FAIL: %s\n", what.c_str());
+  failures++;
+}
+
+static void CheckEqual(uint64_t actual, uint64_t expected,
+                       const std::string& what) {
+  char values[64];
+  std::snprintf(values, sizeof(values), " (0x%llx, expected 0x%llx)",
+                static_cast<unsigned long long>(actual),
+                static_cast<unsigned long long>(expected));
+  Check(actual == expected, what + values);
+}
+
+struct Machine {
+  std::map<uint32_t, uint64_t> registers;
+  std::map<uint64_t, uint32_t> memory;  // 32-bit words
+
+  uint64_t Register(uint32_t reg) const {
+    const auto it = registers.find(reg);
+    return it == registers.end() ? 0 : it->second;
+  }
+  uint32_t Word(uint64_t addr) const {
+    const auto it = memory.find(addr);
+    return it == memory.end() ? 0 : it->second;
+  }
+};
+
+static uint64_t Mask(size_t size) {
+  return size >= 8 ? ~uint64_t{0} : (uint64_t{1} << (8 * size)) - 1;
+}
+
+// Evaluates the expressions the CSA helpers emit
+static uint64_t Evaluate(const LowLevelILInstruction& expr,
+                         const Machine& machine) {
+  const uint64_t mask = Mask(expr.size);
+  switch (expr.operation) {
+    case LLIL_CONST:
+      return static_cast<uint64_t>(expr.GetConstant<LLIL_CONST>()) & mask;
+    case LLIL_CONST_PTR:
+      return static_cast<uint64_t>(expr.GetConstant<LLIL_CONST_PTR>()) &
+             mask;
+    case LLIL_REG:
+      return machine.Register(expr.GetSourceRegister<LLIL_REG>()) & mask;
+    case LLIL_LOAD:
+      return machine.Word(
+                 Evaluate(expr.GetSourceExpr<LLIL_LOAD>(), machine)) &
+             mask;
+    case LLIL_AND:
+      return Evaluate(expr.GetLeftExpr<LLIL_AND>(), machine) &
+             Evaluate(expr.GetRightExpr<LLIL_AND>(), machine) & mask;
+    case LLIL_OR:
+      return (Evaluate(expr.GetLeftExpr<LLIL_OR>(), machine) |
+              Evaluate(expr.GetRightExpr<LLIL_OR>(), machine)) &
+             mask;
+    case LLIL_ADD:
+      return (Evaluate(expr.GetLeftExpr<LLIL_ADD>(), machine) +
+              Evaluate(expr.GetRightExpr<LLIL_ADD>(), machine)) &
+             mask;
+    case LLIL_LSL:
+      return (Evaluate(expr.GetLeftExpr<LLIL_LSL>(), machine)
+              << Evaluate(expr.GetRightExpr<LLIL_LSL>(), machine)) &
+             mask;
+    case LLIL_SX: {
+      const LowLevelILInstruction source = expr.GetSourceExpr<LLIL_SX>();
+      const uint64_t value = Evaluate(source, machine);
+      const uint64_t sign = uint64_t{1} << (8 * source.size - 1);
+      return ((value ^ sign) - sign) & mask;
+    }
+    default:
+      Check(false, "unexpected LLIL expression " +
+                       std::to_string(static_cast<int>(expr.operation)));
+      return 0;
+  }
+}
+
+// Where a run of lifted IL stopped
+struct Stop {
+  BNLowLevelILOperation operation = LLIL_NOP;  // LLIL_CALL, LLIL_RET or none
+  uint64_t target = 0;
+  size_t next = 0;  // instruction after the stop
+};
+
+// Runs instructions from first until a call or return, or the end
+static Stop Run(LowLevelILFunction& il, size_t first, Machine& machine) {
+  Stop stop;
+  const size_t count = il.GetInstructionCount();
+  for (size_t i = first; i < count; i++) {
+    const LowLevelILInstruction insn = il.GetInstruction(i);
+    switch (insn.operation) {
+      case LLIL_SET_REG:
+        machine.registers[insn.GetDestRegister<LLIL_SET_REG>()] =
+            Evaluate(insn.GetSourceExpr<LLIL_SET_REG>(), machine);
+        break;
+      case LLIL_STORE:
+        machine.memory[Evaluate(insn.GetDestExpr<LLIL_STORE>(), machine)] =
+            static_cast<uint32_t>(
+                Evaluate(insn.GetSourceExpr<LLIL_STORE>(), machine));
+        break;
+      case LLIL_CALL:
+        stop.operation = LLIL_CALL;
+        stop.target = Evaluate(insn.GetDestExpr<LLIL_CALL>(), machine);
+        stop.next = i + 1;
+        return stop;
+      case LLIL_RET:
+        stop.operation = LLIL_RET;
+        stop.target = Evaluate(insn.GetDestExpr<LLIL_RET>(), machine);
+        stop.next = i + 1;
+        return stop;
+      default:
+        Check(false, "unexpected LLIL instruction " +
+                         std::to_string(static_cast<int>(insn.operation)));
+        break;
+    }
+  }
+  stop.next = count;
+  return stop;
+}
+
+static Ref<LowLevelILFunction> Lift(Architecture* arch, uint32_t word,
+                                    uint64_t addr) {
+  uint8_t data[4];
+  std::memcpy(data, &word, sizeof(data));
+  Ref<LowLevelILFunction> il = new LowLevelILFunction(arch);
+  size_t len = sizeof(data);
+  char what[32];
+  std::snprintf(what, sizeof(what), "lifting 0x%08x", word);
+  Check(arch->GetInstructionLowLevelIL(data, addr, len, *il), what);
+  return il;
+}
+
+// The caller's state: every register distinct, FCX heading a free list of
+// two CSAs and PCXI linking to an older saved context
+static Machine CallerState() {
+  Machine machine;
+  for (uint32_t i = 0; i < 16; i++) {
+    machine.registers[TRICORE_REG_D0 + i] = 0x1000 + i;
+    machine.registers[TRICORE_REG_A0 + i] = 0xD0002000 + 4 * i;
+  }
+  machine.registers[TRICORE_REG_A11] = 0x80000100;
+  machine.registers[TRICORE_REG_PSW] = 0x00000B80;
+  // Status bits above the link set, linked to segment 0xB, offset 5
+  machine.registers[TRICORE_REG_PCXI] = 0x00CB0005;
+  // Segment 0xA, offset 0x10 (address 0xA0000400), then offset 0x11
+  machine.registers[TRICORE_REG_FCX] = 0x000A0010;
+  machine.memory[0xA0000400] = 0x000A0011;
+  return machine;
+}
+
+static void CheckUpperContext(const Machine& machine, const Machine& caller,
+                              const std::string& when) {
+  for (uint32_t reg : kUpperContext)
+    CheckEqual(machine.Register(reg), caller.Register(reg),
+               when + ": register " + std::to_string(reg));
+  CheckEqual(machine.Register(TRICORE_REG_FCX),
+             caller.Register(TRICORE_REG_FCX), when + ": FCX");
+}
+
+static void TestCallReturn(Architecture* arch) {
+  // call 0x80000020 (16-bit, disp8 0x10), then ret at the callee
+  Ref<LowLevelILFunction> call = Lift(arch, 0x105C, kBase);
+  Ref<LowLevelILFunction> ret = Lift(arch, 0x9000, kBase + 0x20);
+
+  const Machine caller = CallerState();
+  Machine machine = caller;
+  const Stop called = Run(*call, 0, machine);
+  Check(called.operation == LLIL_CALL, "call: no LLIL_CALL");
+  CheckEqual(called.target, kBase + 0x20, "call: target");
+
+  // The upper context went to the CSA FCX pointed at
+  for (uint32_t i = 0; i < 16; i++)
+    CheckEqual(machine.Word(0xA0000400 + 4 * i),
+               caller.Register(kUpperContext[i]),
+               "call: CSA word " + std::to_string(i));
+  CheckEqual(machine.Register(TRICORE_REG_PCXI), 0x00CA0010,
+             "call: PCXI links to the saved CSA");
+  CheckEqual(machine.Register(TRICORE_REG_FCX), 0x000A0011,
+             "call: FCX moves to the next free CSA");
+  CheckEqual(machine.Register(TRICORE_REG_A11), kBase + 2,
+             "call: A11 holds the return address");
+
+  // The callee changes the upper context and returns a value in D2; bit 0
+  // of A11 is ignored by ret
+  const Machine atCall = machine;
+  for (uint32_t reg : kUpperContext)
+    if (reg != TRICORE_REG_PCXI) machine.registers[reg] ^= 0x5A5A0000;
+  machine.registers[TRICORE_REG_A11] = (kBase + 2) | 1;
+  machine.registers[TRICORE_REG_D2] = 0x42;
+
+  const Stop returned = Run(*ret, 0, machine);
+  Check(returned.operation == LLIL_RET, "ret: no LLIL_RET");
+  Check(returned.next == ret->GetInstructionCount(),
+        "ret: LLIL_RET is not the last instruction");
+  CheckEqual(returned.target, kBase + 2, "ret: target is A11 & ~1");
+  CheckUpperContext(machine, caller, "ret");
+  CheckEqual(machine.Word(0xA0000400), 0x000A0011,
+             "ret: the CSA links back into the free list");
+  CheckEqual(machine.Register(TRICORE_REG_D2), 0x42,
+             "ret: lower context is left alone");
+
+  // The caller's side of the call sets its context back after ret ...
+  Machine afterReturn = machine;
+  Run(*call, called.next, afterReturn);
+  CheckUpperContext(afterReturn, caller, "call after ret");
+  CheckEqual(afterReturn.Register(TRICORE_REG_D2), 0x42,
+             "call after ret: return value");
+
+  // ... and whatever the callee left behind
+  Machine clobbered = atCall;
+  for (uint32_t reg : kUpperContext) clobbered.registers[reg] = 0xDEAD0000;
+  clobbered.registers[TRICORE_REG_FCX] = 0xDEAD0000;
+  Run(*call, called.next, clobbered);
+  CheckUpperContext(clobbered, caller, "call after clobbering callee");
+}
+
+static void TestCalliA11(Architecture* arch) {
+  // calli a11
+  Ref<LowLevelILFunction> calli = Lift(arch, 0x00000B2D, kBase);
+
+  // A11 is copied to a temporary by the first instruction, before the
+  // call sequence writes the return address
+  Check(calli->GetInstructionCount() > 0, "calli: no IL");
+  const LowLevelILInstruction first = calli->GetInstruction(0);
+  Check(first.operation == LLIL_SET_REG &&
+            first.GetDestRegister<LLIL_SET_REG>() == kCallTarget,
+        "calli: first instruction does not set the call target temporary");
+  if (first.operation == LLIL_SET_REG) {
+    const LowLevelILInstruction source = first.GetSourceExpr<LLIL_SET_REG>();
+    Check(source.operation == LLIL_REG &&
+              source.GetSourceRegister<LLIL_REG>() == TRICORE_REG_A11,
+          "calli: call target temporary is not read from A11");
+  }
+
+  Machine machine = CallerState();
+  machine.registers[TRICORE_REG_A11] = 0x80004000;
+  const Stop called = Run(*calli, 0, machine);
+  Check(called.operation == LLIL_CALL, "calli: no LLIL_CALL");
+  CheckEqual(called.target, 0x80004000, "calli: target is the old A11");
+  CheckEqual(machine.Register(TRICORE_REG_A11), kBase + 4,
+             "calli: A11 holds the return address");
+  CheckEqual(machine.Word(0xA0000400 + 4 * 3), 0x80004000,
+             "calli: CSA holds the old A11");
+}
+
+int main() {
+  CorePluginInit();
+  Ref<Architecture> arch = Architecture::GetByName("tricore");
+  if (!arch) {
+    std::fprintf(stderr, "architecture tricore is not registered\n");
+    return 1;
+  }
+
+  TestCallReturn(arch);
+  TestCalliA11(arch);
+
+  Shutdown();
+  if (failures) {
+    std::fprintf(stderr, "%d check(s) failed\n", failures);
+    return 1;
+  }
+  std::printf("context save area checks passed\n");
+  return 0;
+}
@@ -0,0 +1,294 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+// Headless disassembler for raw TriCore images.
+//
+// Usage: tricore-objdump [-b base] [-m isa] [-q] [-s] image.bin
+//
+// Linearly sweeps the image with the plugin's decoder and Text handlers and
+// writes an objdump-style listing to stdout. Invalid encodings are listed as
+// "(bad)" and skipped a halfword at a time. Instruction throughput and the
+// number of invalid encodings are reported on stderr at exit. Only the Binary
+// Ninja API's token type is used; the core is never initialized, so no
+// license is needed.
+//
+//   -b base  load address of the first byte (default 0x80000000)
+//   -m isa   tc1.3, tc1.6 (default), tc1.6.2 or tc1.8
+//   -q       no listing, only the summary
+//   -s       add per-instruction decode, render and reject counts to the
+//            summary
+
+#include <binaryninjaapi.h>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#ifdef _WIN32
+#include <fstream>
+#include <iterator>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "decoder.h"
+#include "instruction_stats.h"
+#include "instructions.h"
+
+using namespace BinaryNinja;
+using namespace Tricore;
+
+// Read-only view of a whole file, memory-mapped where the platform allows
+class MappedImage {
+ public:
+  bool Open(const char* path) {
+#ifdef _WIN32
+    std::ifstream file(path, std::ios::binary);
+    if (!file) return false;
+    buffer.assign(std::istreambuf_iterator<char>(file),
+                  std::istreambuf_iterator<char>());
+    data = buffer.data();
+    size = buffer.size();
+    return true;
+#else
+    const int fd = open(path, O_RDONLY);
+    if (fd < 0) return false;
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+      close(fd);
+      return false;
+    }
+    size = static_cast<size_t>(st.st_size);
+    if (size != 0) {
+      void* map = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (map == MAP_FAILED) {
+        close(fd);
+        return false;
+      }
+      madvise(map, size, MADV_SEQUENTIAL);
+      data = static_cast<const uint8_t*>(map);
+    }
+    close(fd);
+    return true;
+#endif
+  }
+
+  ~MappedImage() {
+#ifndef _WIN32
+    if (data) munmap(const_cast<uint8_t*>(data), size);
+#endif
+  }
+
+  const uint8_t* data = nullptr;
+  size_t size = 0;
+
+ private:
+#ifdef _WIN32
+  std::vector<uint8_t> buffer;
+#endif
+};
+
+// Accumulates the listing and writes it to stdout in large blocks
+class ListingWriter {
+ public:
+  ListingWriter() : buffer(kCapacity) {}
+  ~ListingWriter() { Flush(); }
+
+  void Append(std::string_view text) {
+    if (used + text.size() > buffer.size()) Flush();
+    if (text.size() > buffer.size()) {
+      std::fwrite(text.data(), 1, text.size(), stdout);
+      return;
+    }
+    std::memcpy(&buffer[used], text.data(), text.size());
+    used += text.size();
+  }
+
+  void Append(char c) {
+    if (used == buffer.size()) Flush();
+    buffer[used++] = c;
+  }
+
+  // Lowercase hex, zero-padded to digits
+  void AppendHex(uint64_t value, int digits) {
+    static constexpr char kDigits[] = "0123456789abcdef";
+    if (used + digits > buffer.size()) Flush();
+    for (int i = digits - 1; i >= 0; i--) {
+      buffer[used + i] = kDigits[value & 0xF];
+      value >>= 4;
+    }
+    used += digits;
+  }
+
+  void Flush() {
+    if (used) std::fwrite(buffer.data(), 1, used, stdout);
+    used = 0;
+  }
+
+ private:
+  static constexpr size_t kCapacity = 1 << 20;
+
+  std::vector<char> buffer;
+  size_t used = 0;
+};
+
+struct ListingStats {
+  uint64_t instructions = 0;
+  uint64_t short16 = 0;
+  uint64_t invalid = 0;     // undecodable halfwords
+  uint64_t unrendered = 0;  // decoded, but rejected by the Text handler
+};
+
+// Address, instruction bytes in memory order and the column separator
+static void AppendPrefix(ListingWriter& out, uint64_t addr,
+                         const uint8_t* data, size_t length) {
+  out.AppendHex(addr, addr > 0xFFFFFFFF ? 16 : 8);
+  out.Append(":\t");
+  for (size_t i = 0; i < 4; i++) {
+    if (i < length) {
+      out.AppendHex(data[i], 2);
+      out.Append(i + 1 < 4 ? ' ' : '\t');
+    } else {
+      out.Append(i + 1 < 4 ? "   " : "  \t");
+    }
+  }
+}
+
+template <IsaVersion Version>
+static ListingStats Disassemble(const uint8_t* image, size_t size,
+                                uint64_t base, bool list) {
+  ListingWriter out;
+  ListingStats stats;
+  DecodedInstruction insn;
+  std::vector<InstructionTextToken> tokens;
+  tokens.reserve(32);
+
+  for (size_t offset = 0; offset + 2 <= size;) {
+    const uint8_t* data = image + offset;
+    const uint64_t addr = base + offset;
+    size_t len = size - offset;
+
+    if (!Decode<Version>(data, addr, len, insn)) {
+      InstructionStats::Count(InstructionId::Invalid,
+                              InstructionEvent::Rejected);
+      stats.invalid++;
+      if (list) {
+        AppendPrefix(out, addr, data, 2);
+        out.Append("(bad)\n");
+      }
+      offset += 2;
+      continue;
+    }
+
+    InstructionStats::Count(insn.id, InstructionEvent::Decoded);
+
+    tokens.clear();
+    if (!Tricore::Text(insn, data, addr, len, tokens)) {
+      InstructionStats::Count(insn.id, InstructionEvent::Rejected);
+      stats.unrendered++;
+      if (list) {
+        AppendPrefix(out, addr, data, insn.length);
+        out.Append("(bad)\n");
+      }
+      offset += insn.length;
+      continue;
+    }
+
+    InstructionStats::Count(insn.id, InstructionEvent::Rendered);
+    stats.instructions++;
+    if (insn.length == 2) stats.short16++;
+    if (list) {
+      AppendPrefix(out, addr, data, insn.length);
+      for (const InstructionTextToken& token : tokens) out.Append(token.text);
+      out.Append('\n');
+    }
+    offset += insn.length;
+  }
+  return stats;
+}
+
+static void Usage() {
+  std::fprintf(stderr,
+               "usage: tricore-objdump [-b base] [-m tc1.3|tc1.6|tc1.6.2|"
+               "tc1.8] [-q] [-s] image.bin\n");
+}
+
+int main(int argc, char** argv) {
+  uint64_t base = 0x80000000;
+  std::string isa = "tc1.6";
+  bool list = true;
+  bool instructionStats = false;
+  const char* path = nullptr;
+
+  for (int i = 1; i < argc; i++) {
+    const std::string_view arg = argv[i];
+    if (arg == "-b" && i + 1 < argc) {
+      base = std::strtoull(argv[++i], nullptr, 0);
+    } else if (arg == "-m" && i + 1 < argc) {
+      isa = argv[++i];
+    } else if (arg == "-q") {
+      list = false;
+    } else if (arg == "-s") {
+      instructionStats = true;
+    } else if (!path && arg.size() && arg[0] != '-') {
+      path = argv[i];
+    } else {
+      Usage();
+      return 2;
+    }
+  }
+  if (!path) {
+    Usage();
+    return 2;
+  }
+
+  MappedImage image;
+  if (!image.Open(path)) {
+    std::fprintf(stderr, "could not read %s\n", path);
+    return 1;
+  }
+
+  const auto start = std::chrono::steady_clock::now();
+  ListingStats stats;
+  if (isa == "tc1.3") {
+    stats = Disassemble<IsaVersion::TC13>(image.data, image.size, base, list);
+  } else if (isa == "tc1.6") {
+    stats = Disassemble<IsaVersion::TC16>(image.data, image.size, base, list);
+  } else if (isa == "tc1.6.2") {
+    stats = Disassemble<IsaVersion::TC162>(image.data, image.size, base, list);
+  } else if (isa == "tc1.8") {
+    stats = Disassemble<IsaVersion::TC18>(image.data, image.size, base, list);
+  } else {
+    std::fprintf(stderr, "unknown ISA version %s\n", isa.c_str());
+    Usage();
+    return 2;
+  }
+  std::fflush(stdout);
+  const std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+
+  const double seconds = elapsed.count() > 0 ? elapsed.count() : 1e-9;
+  std::fprintf(stderr, "image:             %zu bytes at 0x%llx (%s)\n",
+               image.size, static_cast<unsigned long long>(base), isa.c_str());
+  std::fprintf(stderr, "instructions:      %llu (%llu 16-bit)\n",
+               static_cast<unsigned long long>(stats.instructions),
+               static_cast<unsigned long long>(stats.short16));
+  std::fprintf(stderr, "invalid encodings: %llu (+%llu not rendered)\n",
+               static_cast<unsigned long long>(stats.invalid),
+               static_cast<unsigned long long>(stats.unrendered));
+  std::fprintf(stderr, "elapsed:           %.3f s\n", elapsed.count());
+  std::fprintf(stderr, "throughput:        %.2f M instructions/s, %.1f MB/s\n",
+               stats.instructions / seconds / 1e6,
+               image.size / seconds / 1e6);
+  if (instructionStats)
+    std::fprintf(stderr, "\n%s", InstructionStats::Report().c_str());
+  return 0;
+}